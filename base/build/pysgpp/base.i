@@ -85,6 +85,8 @@ namespace std {
 %include "base/src/sgpp/base/grid/storage/hashmap/SerializationVersion.hpp"
 %ignore sgpp::base::HashGridPoint::operator=;
 %include "base/src/sgpp/base/grid/storage/hashmap/HashGridPoint.hpp"
+%ignore sgpp::base::HashGridPointMap;
+%include "base/src/sgpp/base/grid/storage/hashmap/HashGridPointMap.hpp"
 %ignore sgpp::base::HashGridStorage::operator=;
 %ignore sgpp::base::HashGridStorage::operator[];
 %include "base/src/sgpp/base/grid/storage/hashmap/HashGridStorage.hpp"
@@ -13,6 +13,7 @@
 #include <sgpp/globaldef.hpp>
 
 #include <utility>
+#include <vector>
 
 
 namespace sgpp {
@@ -46,6 +47,50 @@ class AlgorithmEvaluationTransposed {
    * @param result vector that will contain the local support of the given ansatzfuction for all evaluations points
    */
   void operator()(BASIS& basis, const DataVector& point, double alpha, DataVector& result) {
+    traverse(basis, point, alpha, result);
+  }
+
+  /**
+   * Computes the contributions \f$\alpha \phi_i(x)\f$ of the given evaluation point to all
+   * basis functions that are non-zero there and appends them as tuples
+   * \f$(i, \alpha \phi_i(x))\f$ to the result vector (which is not cleared beforehand).
+   * This allows to accumulate the contributions of several evaluation points later on,
+   * e.g. in a blocked or partitioned fashion.
+   *
+   * @param basis a sparse grid basis
+   * @param point evaluation point within the domain
+   * @param alpha the coefficient of the regarded ansatzfunction
+   * @param result vector to which the (sequence number, contribution) pairs are appended
+   */
+  void operator()(BASIS& basis, const DataVector& point, double alpha,
+                  std::vector<std::pair<size_t, double>>& result) {
+    traverse(basis, point, alpha, result);
+  }
+
+ protected:
+  GridStorage& storage;
+
+  /// adds a contribution to a dense result vector
+  static inline void accumulate(DataVector& result, size_t seq, double value) {
+    result[seq] += value;
+  }
+
+  /// appends a contribution to a sparse list of contributions
+  static inline void accumulate(std::vector<std::pair<size_t, double>>& result, size_t seq,
+                                double value) {
+    result.push_back(std::make_pair(seq, value));
+  }
+
+  /**
+   * Transforms the evaluation point to the unit cube and starts the recursive traversal.
+   *
+   * @param basis a sparse grid basis
+   * @param point evaluation point within the domain
+   * @param alpha the coefficient of the regarded ansatzfunction
+   * @param result container the contributions are accumulated to
+   */
+  template <class RESULT>
+  void traverse(BASIS& basis, const DataVector& point, double alpha, RESULT& result) {
     GridStorage::grid_iterator working(storage);
 
     const size_t bits = sizeof(index_t) * 8;  // how many levels can we store in a index_type?
@@ -80,9 +125,6 @@ class AlgorithmEvaluationTransposed {
     delete[] source;
   }
 
- protected:
-  GridStorage& storage;
-
   /**
    * Recursive traversal of the "tree" of basis functions for evaluation, used in operator().
    * For a given evaluation point \f$x\f$, it stores tuples (std::pair) of
@@ -97,10 +139,11 @@ class AlgorithmEvaluationTransposed {
    * @param alpha the coefficient of current ansatzfunction
    * @param result vector that will contain the local support of the given ansatzfuction for all evaluations points
    */
+  template <class RESULT>
   void rec(BASIS& basis, DataVector& point, size_t current_dim,
            double value, GridStorage::grid_iterator& working,
            index_t* source, double alpha,
-           DataVector& result) {
+           RESULT& result) {
     const unsigned int BITS_IN_BYTE = 8;
     // maximum possible level for the index type
     const level_t max_level = static_cast<level_t>(sizeof(index_t) * BITS_IN_BYTE - 1);
@@ -125,7 +168,7 @@ class AlgorithmEvaluationTransposed {
         const double new_value = basis.eval(work_level, work_index, point[current_dim]) * value;
 
         if (current_dim == storage.getDimension() - 1) {
-          result[seq] += alpha * new_value;
+          accumulate(result, seq, alpha * new_value);
         } else {
           rec(basis, point, current_dim + 1, new_value, working, source, alpha, result);
           if (!hint) working.resetToLevelOne(current_dim+1);
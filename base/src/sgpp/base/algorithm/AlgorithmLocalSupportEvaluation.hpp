@@ -0,0 +1,946 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef ALGORITHMLOCALSUPPORTEVALUATION_HPP
+#define ALGORITHMLOCALSUPPORTEVALUATION_HPP
+
+#include <sgpp/base/algorithm/AlgorithmMultipleOutputEvaluation.hpp>
+#include <sgpp/base/algorithm/AlgorithmPartitionedAccumulation.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Evaluation of sparse grid functions whose one-dimensional basis functions have a
+ * (more or less) local support that is not nested, e.g., B-splines and their
+ * modified, not-a-knot and Clenshaw-Curtis variants.
+ *
+ * Instead of looping over all grid points for every evaluation point, the grid points are
+ * grouped by their level vector (i.e., by hierarchical subspaces). For a given evaluation
+ * point, the one-dimensional basis functions are evaluated only once per dimension, level
+ * and index, and only for those indices whose support (given by a radius in the index
+ * coordinate \f$x \cdot 2^\ell\f$) contains the point. Then, the non-zero tensor products are
+ * enumerated subspace by subspace: either as the Cartesian product of the non-zero
+ * one-dimensional functions (looked up in the GridStorage) or by iterating over the
+ * points of the subspace, whichever is cheaper. For local bases, this reduces the cost
+ * of one evaluation from \f$\mathcal{O}(Nd)\f$ to about
+ * \f$\mathcal{O}(\#\text{subspaces} \cdot (p+1)^d)\f$.
+ *
+ * Gradients and Hessians are computed in the same way from the 1D derivatives, which
+ * requires the basis to provide evalDx() and evalDxDx().
+ *
+ * The grid structure is computed by prepare() and shared between copies of an object,
+ * so every thread should use its own copy (and its own basis object, as some bases
+ * are not thread-safe).
+ *
+ * @tparam BASIS  one-dimensional basis, has to be constructible from the degree
+ *                if mult(), multTranspose() or the batched evalGradient() and
+ *                evalHessian() are used
+ */
+template <class BASIS>
+class AlgorithmLocalSupportEvaluation {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param storage         storage of the sparse grid
+   * @param supportRadius   radius of the support of the 1D basis functions of level l and
+   *                        index i in the index coordinate, i.e., the function vanishes
+   *                        for \f$|x \cdot 2^l - i| > r\f$ (use infinity for global support)
+   * @param maxGlobalLevel  1D basis functions with level less than or equal to this level
+   *                        are assumed to have global support
+   * @param clenshawCurtis  if the basis lives on Clenshaw-Curtis points, in which case
+   *                        the index coordinate is \f$\arccos(1 - 2x) / \pi \cdot 2^l\f$
+   */
+  explicit AlgorithmLocalSupportEvaluation(GridStorage& storage, double supportRadius,
+                                           level_t maxGlobalLevel = 0,
+                                           bool clenshawCurtis = false)
+      : storage(storage),
+        supportRadius(supportRadius),
+        maxGlobalLevel(maxGlobalLevel),
+        clenshawCurtis(clenshawCurtis),
+        structure(),
+        values(),
+        counters(),
+        partialProducts(),
+        workingPoint(storage.getDimension()) {}
+
+  /**
+   * Copy constructor, the grid structure is shared, the scratch memory is not.
+   *
+   * @param other   object to copy
+   */
+  AlgorithmLocalSupportEvaluation(const AlgorithmLocalSupportEvaluation& other)
+      : storage(other.storage),
+        supportRadius(other.supportRadius),
+        maxGlobalLevel(other.maxGlobalLevel),
+        clenshawCurtis(other.clenshawCurtis),
+        structure(other.structure),
+        values(),
+        counters(),
+        partialProducts(),
+        workingPoint(storage.getDimension()) {}
+
+  /**
+   * Groups the grid points by subspaces and collects the indices per dimension and level.
+   * eval() and operator() call this automatically if the grid has been changed since
+   * (see GridStorage::getModificationCount()).
+   */
+  void prepare() {
+    std::shared_ptr<Structure> newStructure(new Structure());
+    const size_t dim = storage.getDimension();
+    const size_t gridSize = storage.getSize();
+    std::map<std::vector<level_t>, size_t> subspaceIndices;
+    std::vector<level_t> level(dim);
+
+    newStructure->modificationCount = storage.getModificationCount();
+    newStructure->indices.resize(dim);
+
+    for (size_t k = 0; k < gridSize; k++) {
+      const GridPoint& gp = storage[k];
+
+      for (size_t t = 0; t < dim; t++) {
+        level[t] = gp.getLevel(t);
+        std::vector<std::vector<index_t>>& indicesT = newStructure->indices[t];
+
+        if (indicesT.size() <= level[t]) {
+          indicesT.resize(level[t] + 1);
+        }
+
+        indicesT[level[t]].push_back(gp.getIndex(t));
+      }
+
+      std::map<std::vector<level_t>, size_t>::iterator it = subspaceIndices.find(level);
+
+      if (it == subspaceIndices.end()) {
+        it = subspaceIndices.insert(std::make_pair(level, newStructure->subspaces.size())).first;
+        newStructure->subspaces.push_back(Subspace());
+        newStructure->subspaces.back().level = level;
+      }
+
+      newStructure->subspaces[it->second].points.push_back(k);
+    }
+
+    // sort indices and remove duplicates
+    for (size_t t = 0; t < dim; t++) {
+      for (size_t l = 0; l < newStructure->indices[t].size(); l++) {
+        std::vector<index_t>& indicesTL = newStructure->indices[t][l];
+        std::sort(indicesTL.begin(), indicesTL.end());
+        indicesTL.erase(std::unique(indicesTL.begin(), indicesTL.end()), indicesTL.end());
+      }
+    }
+
+    structure = newStructure;
+  }
+
+  /**
+   * Determines all basis functions that do not vanish at a given point.
+   *
+   * @param basis             1D basis
+   * @param pointInUnitCube   evaluation point (in the unit cube)
+   * @param[out] result       pairs (sequence number, value of the basis function)
+   */
+  void operator()(BASIS& basis, const DataVector& pointInUnitCube,
+                  std::vector<std::pair<size_t, double>>& result) {
+    evaluate1D(basis, pointInUnitCube);
+    findAffected(false, result);
+  }
+
+  /**
+   * Evaluates a sparse grid function.
+   *
+   * @param basis             1D basis
+   * @param alpha             coefficient vector
+   * @param pointInUnitCube   evaluation point (in the unit cube)
+   * @return                  value of the function at the point
+   */
+  double eval(BASIS& basis, const DataVector& alpha, const DataVector& pointInUnitCube) {
+    (*this)(basis, pointInUnitCube, affected);
+    double result = 0.0;
+
+    for (size_t k = 0; k < affected.size(); k++) {
+      result += alpha[affected[k].first] * affected[k].second;
+    }
+
+    return result;
+  }
+
+  /**
+   * Evaluates multiple sparse grid functions (given by the columns of the coefficient
+   * matrix). The non-zero basis functions are determined once and applied to the
+   * corresponding rows of the coefficient matrix by AlgorithmMultipleOutputEvaluation.
+   *
+   * @param basis             1D basis
+   * @param alpha             coefficient matrix (each column is a coefficient vector)
+   * @param pointInUnitCube   evaluation point (in the unit cube)
+   * @param[out] value        values of the functions at the point
+   */
+  void eval(BASIS& basis, const DataMatrix& alpha, const DataVector& pointInUnitCube,
+            DataVector& value) {
+    (*this)(basis, pointInUnitCube, affected);
+    AlgorithmMultipleOutputEvaluation::eval(alpha, affected, value);
+  }
+
+  /**
+   * Evaluates multiple sparse grid functions (given by the columns of the coefficient
+   * matrix) at multiple points in parallel.
+   *
+   * @param degree            degree of the 1D basis (every thread constructs its own basis)
+   * @param alpha             coefficient matrix (each column is a coefficient vector)
+   * @param pointsInUnitCube  evaluation points (row-wise, in the unit cube)
+   * @param[out] result       values of the functions at the points (the j-th row contains
+   *                          the values at the j-th point)
+   */
+  void eval(size_t degree, const DataMatrix& alpha, const DataMatrix& pointsInUnitCube,
+            DataMatrix& result) {
+    const size_t m = pointsInUnitCube.getNrows();
+    const size_t numberOfFunctions = alpha.getNcols();
+    prepareIfNecessary();
+    result.resize(m, numberOfFunctions);
+    result.setAll(0.0);
+
+#pragma omp parallel
+    {
+      BASIS threadBasis(degree);
+      AlgorithmLocalSupportEvaluation<BASIS> threadAlgorithm(*this);
+      DataVector point(pointsInUnitCube.getNcols());
+      std::vector<std::pair<size_t, double>> pointAffected;
+
+#pragma omp for schedule(dynamic, 16)
+      for (size_t j = 0; j < m; j++) {
+        pointsInUnitCube.getRow(j, point);
+        threadAlgorithm(threadBasis, point, pointAffected);
+        AlgorithmMultipleOutputEvaluation::accumulate(
+            alpha, pointAffected, result.getPointer() + j * numberOfFunctions);
+      }
+    }
+  }
+
+  /**
+   * Evaluates a sparse grid function at multiple points in parallel.
+   *
+   * @param degree            degree of the 1D basis (every thread constructs its own basis)
+   * @param alpha             coefficient vector
+   * @param pointsInUnitCube  evaluation points (row-wise, in the unit cube)
+   * @param[out] result       values of the function at the points
+   */
+  void mult(size_t degree, const DataVector& alpha, const DataMatrix& pointsInUnitCube,
+            DataVector& result) {
+    const size_t m = pointsInUnitCube.getNrows();
+    prepareIfNecessary();
+    result.resize(m);
+
+#pragma omp parallel
+    {
+      BASIS threadBasis(degree);
+      AlgorithmLocalSupportEvaluation<BASIS> threadAlgorithm(*this);
+      DataVector point(pointsInUnitCube.getNcols());
+
+#pragma omp for schedule(dynamic, 16)
+      for (size_t j = 0; j < m; j++) {
+        pointsInUnitCube.getRow(j, point);
+        result[j] = threadAlgorithm.eval(threadBasis, alpha, point);
+      }
+    }
+  }
+
+  /**
+   * Computes the transposed evaluation \f$\sum_j \text{source}_j \varphi_i(x_j)\f$ for all
+   * grid points in parallel (see AlgorithmPartitionedAccumulation).
+   *
+   * @param degree            degree of the 1D basis (every thread constructs its own basis)
+   * @param source            coefficients of the evaluation points
+   * @param pointsInUnitCube  evaluation points (row-wise, in the unit cube)
+   * @param[out] result       result vector (size is the number of grid points)
+   */
+  void multTranspose(size_t degree, const DataVector& source,
+                     const DataMatrix& pointsInUnitCube, DataVector& result) {
+    prepareIfNecessary();
+    result.resize(storage.getSize());
+    result.setAll(0.0);
+
+    AlgorithmPartitionedAccumulation::apply(
+        pointsInUnitCube.getNrows(), PointEvaluator(*this, degree, pointsInUnitCube),
+        [&source, &result](size_t i, size_t j, double value) { result[i] += source[j] * value; });
+  }
+
+  /**
+   * Evaluates a sparse grid function and its gradient.
+   * The basis has to provide evalDx().
+   *
+   * @param basis             1D basis
+   * @param alpha             coefficient vector
+   * @param pointInUnitCube   evaluation point (in the unit cube)
+   * @param innerDerivative   inner derivatives of the transformation to the unit cube
+   *                          (inverse widths of the bounding box)
+   * @param[out] gradient     gradient of the function at the point
+   * @return                  value of the function at the point
+   */
+  double evalGradient(BASIS& basis, const DataVector& alpha, const DataVector& pointInUnitCube,
+                      const DataVector& innerDerivative, DataVector& gradient) {
+    const size_t dim = storage.getDimension();
+    evalBasisDerivatives(basis, pointInUnitCube, innerDerivative, 1);
+    double result = 0.0;
+
+    gradient.resize(dim);
+    gradient.setAll(0.0);
+
+    for (size_t k = 0; k < affected.size(); k++) {
+      const double coefficient = alpha[affected[k].first];
+      result += coefficient * affected[k].second;
+
+      for (size_t t = 0; t < dim; t++) {
+        gradient[t] += coefficient * basisGradients[k * dim + t];
+      }
+    }
+
+    return result;
+  }
+
+  /**
+   * Evaluates multiple sparse grid functions (given by the columns of the coefficient
+   * matrix) and their gradients.
+   * The basis has to provide evalDx().
+   *
+   * @param basis             1D basis
+   * @param alpha             coefficient matrix (each column is a coefficient vector)
+   * @param pointInUnitCube   evaluation point (in the unit cube)
+   * @param innerDerivative   inner derivatives of the transformation to the unit cube
+   * @param[out] value        values of the functions at the point
+   * @param[out] gradient     Jacobian of the functions (each row is a gradient vector)
+   */
+  void evalGradient(BASIS& basis, const DataMatrix& alpha, const DataVector& pointInUnitCube,
+                    const DataVector& innerDerivative, DataVector& value,
+                    DataMatrix& gradient) {
+    const size_t dim = storage.getDimension();
+    const size_t m = alpha.getNcols();
+    evalBasisDerivatives(basis, pointInUnitCube, innerDerivative, 1);
+
+    value.resize(m);
+    value.setAll(0.0);
+    gradient.resize(m, dim);
+    gradient.setAll(0.0);
+
+    for (size_t k = 0; k < affected.size(); k++) {
+      const size_t i = affected[k].first;
+
+      for (size_t j = 0; j < m; j++) {
+        const double coefficient = alpha(i, j);
+        value[j] += coefficient * affected[k].second;
+
+        for (size_t t = 0; t < dim; t++) {
+          gradient(j, t) += coefficient * basisGradients[k * dim + t];
+        }
+      }
+    }
+  }
+
+  /**
+   * Evaluates a sparse grid function, its gradient and its Hessian.
+   * The basis has to provide evalDx() and evalDxDx().
+   *
+   * @param basis             1D basis
+   * @param alpha             coefficient vector
+   * @param pointInUnitCube   evaluation point (in the unit cube)
+   * @param innerDerivative   inner derivatives of the transformation to the unit cube
+   * @param[out] gradient     gradient of the function at the point
+   * @param[out] hessian      Hessian of the function at the point
+   * @return                  value of the function at the point
+   */
+  double evalHessian(BASIS& basis, const DataVector& alpha, const DataVector& pointInUnitCube,
+                     const DataVector& innerDerivative, DataVector& gradient,
+                     DataMatrix& hessian) {
+    const size_t dim = storage.getDimension();
+    evalBasisDerivatives(basis, pointInUnitCube, innerDerivative, 2);
+    double result = 0.0;
+
+    gradient.resize(dim);
+    gradient.setAll(0.0);
+    hessian.resize(dim, dim);
+    hessian.setAll(0.0);
+
+    for (size_t k = 0; k < affected.size(); k++) {
+      const double coefficient = alpha[affected[k].first];
+      result += coefficient * affected[k].second;
+
+      for (size_t t = 0; t < dim; t++) {
+        gradient[t] += coefficient * basisGradients[k * dim + t];
+
+        for (size_t t2 = 0; t2 < dim; t2++) {
+          hessian(t, t2) += coefficient * basisHessians[(k * dim + t) * dim + t2];
+        }
+      }
+    }
+
+    return result;
+  }
+
+  /**
+   * Evaluates multiple sparse grid functions (given by the columns of the coefficient
+   * matrix), their gradients and their Hessians.
+   * The basis has to provide evalDx() and evalDxDx().
+   *
+   * @param basis             1D basis
+   * @param alpha             coefficient matrix (each column is a coefficient vector)
+   * @param pointInUnitCube   evaluation point (in the unit cube)
+   * @param innerDerivative   inner derivatives of the transformation to the unit cube
+   * @param[out] value        values of the functions at the point
+   * @param[out] gradient     Jacobian of the functions (each row is a gradient vector)
+   * @param[out] hessian      vector of Hessians of the functions
+   */
+  void evalHessian(BASIS& basis, const DataMatrix& alpha, const DataVector& pointInUnitCube,
+                   const DataVector& innerDerivative, DataVector& value, DataMatrix& gradient,
+                   std::vector<DataMatrix>& hessian) {
+    const size_t dim = storage.getDimension();
+    const size_t m = alpha.getNcols();
+    evalBasisDerivatives(basis, pointInUnitCube, innerDerivative, 2);
+
+    value.resize(m);
+    value.setAll(0.0);
+    gradient.resize(m, dim);
+    gradient.setAll(0.0);
+    hessian.resize(m);
+
+    for (size_t j = 0; j < m; j++) {
+      hessian[j].resize(dim, dim);
+      hessian[j].setAll(0.0);
+    }
+
+    for (size_t k = 0; k < affected.size(); k++) {
+      const size_t i = affected[k].first;
+
+      for (size_t j = 0; j < m; j++) {
+        const double coefficient = alpha(i, j);
+        value[j] += coefficient * affected[k].second;
+
+        for (size_t t = 0; t < dim; t++) {
+          gradient(j, t) += coefficient * basisGradients[k * dim + t];
+
+          for (size_t t2 = 0; t2 < dim; t2++) {
+            hessian[j](t, t2) += coefficient * basisHessians[(k * dim + t) * dim + t2];
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Evaluates a sparse grid function and its gradient at multiple points in parallel.
+   * The basis has to provide evalDx().
+   *
+   * @param degree            degree of the 1D basis (every thread constructs its own basis)
+   * @param alpha             coefficient vector
+   * @param pointsInUnitCube  evaluation points (row-wise, in the unit cube)
+   * @param innerDerivative   inner derivatives of the transformation to the unit cube
+   * @param[out] value        values of the function at the points
+   * @param[out] gradient     gradients of the function at the points (row-wise)
+   */
+  void evalGradient(size_t degree, const DataVector& alpha, const DataMatrix& pointsInUnitCube,
+                    const DataVector& innerDerivative, DataVector& value,
+                    DataMatrix& gradient) {
+    const size_t dim = storage.getDimension();
+    const size_t m = pointsInUnitCube.getNrows();
+    prepareIfNecessary();
+    value.resize(m);
+    gradient.resize(m, dim);
+
+#pragma omp parallel
+    {
+      BASIS threadBasis(degree);
+      AlgorithmLocalSupportEvaluation<BASIS> threadAlgorithm(*this);
+      DataVector point(dim);
+      DataVector pointGradient(dim);
+
+#pragma omp for schedule(dynamic, 16)
+      for (size_t j = 0; j < m; j++) {
+        pointsInUnitCube.getRow(j, point);
+        value[j] =
+            threadAlgorithm.evalGradient(threadBasis, alpha, point, innerDerivative, pointGradient);
+        gradient.setRow(j, pointGradient);
+      }
+    }
+  }
+
+  /**
+   * Evaluates a sparse grid function, its gradient and its Hessian at multiple points
+   * in parallel.
+   * The basis has to provide evalDx() and evalDxDx().
+   *
+   * @param degree            degree of the 1D basis (every thread constructs its own basis)
+   * @param alpha             coefficient vector
+   * @param pointsInUnitCube  evaluation points (row-wise, in the unit cube)
+   * @param innerDerivative   inner derivatives of the transformation to the unit cube
+   * @param[out] value        values of the function at the points
+   * @param[out] gradient     gradients of the function at the points (row-wise)
+   * @param[out] hessian      Hessians of the function at the points
+   */
+  void evalHessian(size_t degree, const DataVector& alpha, const DataMatrix& pointsInUnitCube,
+                   const DataVector& innerDerivative, DataVector& value, DataMatrix& gradient,
+                   std::vector<DataMatrix>& hessian) {
+    const size_t dim = storage.getDimension();
+    const size_t m = pointsInUnitCube.getNrows();
+    prepareIfNecessary();
+    value.resize(m);
+    gradient.resize(m, dim);
+    hessian.resize(m);
+
+#pragma omp parallel
+    {
+      BASIS threadBasis(degree);
+      AlgorithmLocalSupportEvaluation<BASIS> threadAlgorithm(*this);
+      DataVector point(dim);
+      DataVector pointGradient(dim);
+
+#pragma omp for schedule(dynamic, 16)
+      for (size_t j = 0; j < m; j++) {
+        pointsInUnitCube.getRow(j, point);
+        value[j] = threadAlgorithm.evalHessian(threadBasis, alpha, point, innerDerivative,
+                                               pointGradient, hessian[j]);
+        gradient.setRow(j, pointGradient);
+      }
+    }
+  }
+
+ protected:
+  /**
+   * Evaluates the basis functions at the points of a data set, used by multTranspose.
+   * Every copy constructs its own basis and algorithm, such that the copies can be used
+   * by different threads.
+   */
+  class PointEvaluator {
+   public:
+    PointEvaluator(const AlgorithmLocalSupportEvaluation<BASIS>& algorithm, size_t degree,
+                   const DataMatrix& pointsInUnitCube)
+        : degree(degree),
+          basis(degree),
+          algorithm(algorithm),
+          pointsInUnitCube(pointsInUnitCube),
+          point(pointsInUnitCube.getNcols()) {}
+
+    PointEvaluator(const PointEvaluator& other)
+        : PointEvaluator(other.algorithm, other.degree, other.pointsInUnitCube) {}
+
+    void operator()(size_t j, std::vector<std::pair<size_t, double>>& affected) {
+      pointsInUnitCube.getRow(j, point);
+      algorithm(basis, point, affected);
+    }
+
+   private:
+    size_t degree;
+    BASIS basis;
+    AlgorithmLocalSupportEvaluation<BASIS> algorithm;
+    const DataMatrix& pointsInUnitCube;
+    DataVector point;
+  };
+
+  /// grid points of one hierarchical subspace
+  struct Subspace {
+    /// level vector
+    std::vector<level_t> level;
+    /// sequence numbers of the grid points
+    std::vector<size_t> points;
+  };
+
+  /// grid structure shared between copies
+  struct Structure {
+    /// modification count of the storage when the structure was created
+    size_t modificationCount;
+    /// indices[t][l] contains the sorted indices of level l in dimension t
+    std::vector<std::vector<std::vector<index_t>>> indices;
+    /// all non-empty subspaces
+    std::vector<Subspace> subspaces;
+  };
+
+  /// storage of the sparse grid
+  GridStorage& storage;
+  /// support radius of the 1D basis functions in the index coordinate
+  double supportRadius;
+  /// maximal level with global support
+  level_t maxGlobalLevel;
+  /// whether the basis lives on Clenshaw-Curtis points
+  bool clenshawCurtis;
+  /// grid structure
+  std::shared_ptr<const Structure> structure;
+  /// values[t][l] contains pairs (index, value) of the non-zero 1D functions
+  std::vector<std::vector<std::vector<std::pair<index_t, double>>>> values;
+  /// derivatives[t][l] contains the first and second derivatives corresponding to values[t][l]
+  std::vector<std::vector<std::vector<std::pair<double, double>>>> derivatives;
+  /// counters for the enumeration of Cartesian products
+  std::vector<size_t> counters;
+  /// partial products for the enumeration of Cartesian products
+  std::vector<double> partialProducts;
+  /// grid point used for looking up sequence numbers
+  GridPoint workingPoint;
+  /// temporary vector of affected basis functions
+  std::vector<std::pair<size_t, double>> affected;
+  /// positions of the 1D functions in values for every affected basis function (row-wise)
+  std::vector<size_t> affectedPositions;
+  /// gradients of the affected basis functions (row-wise)
+  std::vector<double> basisGradients;
+  /// Hessians of the affected basis functions (row-major, one after another)
+  std::vector<double> basisHessians;
+  /// 1D values and derivatives of one affected basis function (temporary vectors)
+  std::vector<double> value1D, dx1D, dxdx1D;
+
+  /**
+   * Calls prepare() if the grid structure has not been computed yet or if the grid has
+   * been changed since.
+   */
+  inline void prepareIfNecessary() {
+    if ((structure == nullptr) ||
+        (structure->modificationCount != storage.getModificationCount())) {
+      prepare();
+    }
+  }
+
+  /**
+   * Enumerates the basis functions whose 1D factors have been computed by evaluate1D()
+   * or evaluate1DDerivatives().
+   *
+   * @param storePositions  whether to store the positions of the 1D factors in
+   *                        affectedPositions (needed for derivatives)
+   * @param[out] result     pairs (sequence number, value of the basis function)
+   */
+  void findAffected(bool storePositions, std::vector<std::pair<size_t, double>>& result) {
+    result.clear();
+    affectedPositions.clear();
+
+    const size_t dim = storage.getDimension();
+    const std::vector<Subspace>& subspaces = structure->subspaces;
+
+    for (size_t s = 0; s < subspaces.size(); s++) {
+      const Subspace& subspace = subspaces[s];
+      const size_t numberOfPoints = subspace.points.size();
+      size_t numberOfCombinations = 1;
+
+      for (size_t t = 0; (t < dim) && (numberOfCombinations > 0); t++) {
+        numberOfCombinations *= values[t][subspace.level[t]].size();
+
+        // avoid overflows, we iterate over the points of the subspace in this case anyway
+        numberOfCombinations = std::min(numberOfCombinations, numberOfPoints + 1);
+      }
+
+      if (numberOfCombinations == 0) {
+        continue;
+      } else if (numberOfCombinations <= numberOfPoints) {
+        enumerateCombinations(subspace, storePositions, result);
+      } else {
+        enumeratePoints(subspace, storePositions, result);
+      }
+    }
+  }
+
+
+  /**
+   * Computes the values, gradients and (if derivativeOrder is 2) Hessians of all basis
+   * functions that do not vanish at a given point and stores them in affected,
+   * basisGradients and basisHessians.
+   *
+   * @param basis             1D basis
+   * @param pointInUnitCube   evaluation point (in the unit cube)
+   * @param innerDerivative   inner derivatives of the transformation to the unit cube
+   * @param derivativeOrder   1 (gradients) or 2 (gradients and Hessians)
+   */
+  void evalBasisDerivatives(BASIS& basis, const DataVector& pointInUnitCube,
+                            const DataVector& innerDerivative, size_t derivativeOrder) {
+    const size_t dim = storage.getDimension();
+    evaluate1DDerivatives(basis, pointInUnitCube, derivativeOrder);
+    findAffected(true, affected);
+
+    basisGradients.resize(affected.size() * dim);
+    basisHessians.resize((derivativeOrder > 1) ? affected.size() * dim * dim : 0);
+    value1D.resize(dim);
+    dx1D.resize(dim);
+    dxdx1D.resize(dim);
+
+    for (size_t k = 0; k < affected.size(); k++) {
+      const GridPoint& gp = storage[affected[k].first];
+
+      for (size_t t = 0; t < dim; t++) {
+        const level_t l = gp.getLevel(t);
+        const size_t position = affectedPositions[k * dim + t];
+        value1D[t] = values[t][l][position].second;
+        dx1D[t] = derivatives[t][l][position].first * innerDerivative[t];
+        dxdx1D[t] = derivatives[t][l][position].second * innerDerivative[t] * innerDerivative[t];
+      }
+
+      for (size_t t = 0; t < dim; t++) {
+        double curGradient = dx1D[t];
+
+        for (size_t t2 = 0; t2 < dim; t2++) {
+          if (t2 != t) {
+            curGradient *= value1D[t2];
+          }
+        }
+
+        basisGradients[k * dim + t] = curGradient;
+      }
+
+      if (derivativeOrder > 1) {
+        for (size_t t = 0; t < dim; t++) {
+          for (size_t t2 = t; t2 < dim; t2++) {
+            double curHessian = 1.0;
+
+            for (size_t t3 = 0; t3 < dim; t3++) {
+              if ((t3 == t) && (t3 == t2)) {
+                curHessian *= dxdx1D[t3];
+              } else if ((t3 == t) || (t3 == t2)) {
+                curHessian *= dx1D[t3];
+              } else {
+                curHessian *= value1D[t3];
+              }
+            }
+
+            basisHessians[(k * dim + t) * dim + t2] = curHessian;
+            basisHessians[(k * dim + t2) * dim + t] = curHessian;
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Evaluates all 1D basis functions that do not vanish at the point.
+   *
+   * @param basis             1D basis
+   * @param pointInUnitCube   evaluation point (in the unit cube)
+   */
+  void evaluate1D(BASIS& basis, const DataVector& pointInUnitCube) {
+    prepareIfNecessary();
+
+    const size_t dim = storage.getDimension();
+    values.resize(dim);
+
+    for (size_t t = 0; t < dim; t++) {
+      const double x = pointInUnitCube[t];
+      values[t].resize(structure->indices[t].size());
+
+      for (level_t l = 0; l < values[t].size(); l++) {
+        std::vector<std::pair<index_t, double>>& valuesTL = values[t][l];
+        std::vector<index_t>::const_iterator first, last;
+        valuesTL.clear();
+        getSupportRange(t, l, x, first, last);
+
+        for (; first != last; ++first) {
+          const double value = basis.eval(l, *first, x);
+
+          if (value != 0.0) {
+            valuesTL.push_back(std::make_pair(*first, value));
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Evaluates all 1D basis functions and their derivatives that do not vanish at the point.
+   * In contrast to evaluate1D(), functions whose value vanishes, but whose derivatives do
+   * not vanish, are kept.
+   *
+   * @param basis             1D basis
+   * @param pointInUnitCube   evaluation point (in the unit cube)
+   * @param derivativeOrder   1 (first derivatives) or 2 (first and second derivatives)
+   */
+  void evaluate1DDerivatives(BASIS& basis, const DataVector& pointInUnitCube,
+                             size_t derivativeOrder) {
+    prepareIfNecessary();
+
+    const size_t dim = storage.getDimension();
+    values.resize(dim);
+    derivatives.resize(dim);
+
+    for (size_t t = 0; t < dim; t++) {
+      const double x = pointInUnitCube[t];
+      values[t].resize(structure->indices[t].size());
+      derivatives[t].resize(structure->indices[t].size());
+
+      for (level_t l = 0; l < values[t].size(); l++) {
+        std::vector<std::pair<index_t, double>>& valuesTL = values[t][l];
+        std::vector<std::pair<double, double>>& derivativesTL = derivatives[t][l];
+        std::vector<index_t>::const_iterator first, last;
+        valuesTL.clear();
+        derivativesTL.clear();
+        getSupportRange(t, l, x, first, last);
+
+        for (; first != last; ++first) {
+          const double value = basis.eval(l, *first, x);
+          const double dx = basis.evalDx(l, *first, x);
+          const double dxdx = ((derivativeOrder > 1) ? basis.evalDxDx(l, *first, x) : 0.0);
+
+          if ((value != 0.0) || (dx != 0.0) || (dxdx != 0.0)) {
+            valuesTL.push_back(std::make_pair(*first, value));
+            derivativesTL.push_back(std::make_pair(dx, dxdx));
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Determines the indices of level l in dimension t whose 1D basis functions may not
+   * vanish at the coordinate x.
+   *
+   * @param t           dimension
+   * @param l           level
+   * @param x           coordinate (in the unit interval)
+   * @param[out] first  iterator to the first index
+   * @param[out] last   iterator past the last index
+   */
+  inline void getSupportRange(size_t t, level_t l, double x,
+                              std::vector<index_t>::const_iterator& first,
+                              std::vector<index_t>::const_iterator& last) const {
+    const std::vector<index_t>& indicesTL = structure->indices[t][l];
+    first = indicesTL.begin();
+    last = indicesTL.end();
+
+    if (std::isinf(supportRadius) || (l <= maxGlobalLevel)) {
+      return;
+    }
+
+    // 2^l * arccos(1 - 2x) / pi for Clenshaw-Curtis points, 2^l * x otherwise
+    const double unscaledCoordinate =
+        (clenshawCurtis ? std::acos(std::max(-1.0, std::min(1.0, 1.0 - 2.0 * x))) / M_PI : x);
+    const double coordinate =
+        unscaledCoordinate * static_cast<double>(static_cast<index_t>(1) << l);
+    const double lower = std::max(0.0, std::ceil(coordinate - supportRadius));
+    const double upper = std::floor(coordinate + supportRadius);
+
+    if (upper < 0.0) {
+      last = first;
+      return;
+    }
+
+    first = std::lower_bound(indicesTL.begin(), indicesTL.end(), static_cast<index_t>(lower));
+    last = std::upper_bound(first, indicesTL.end(), static_cast<index_t>(upper));
+  }
+
+  /**
+   * Enumerates the Cartesian product of the non-zero 1D functions of a subspace and
+   * looks up the corresponding grid points.
+   *
+   * @param subspace        subspace
+   * @param storePositions  whether to append the positions of the 1D factors
+   *                        to affectedPositions
+   * @param[out] result     vector to which the non-zero basis functions are appended
+   */
+  void enumerateCombinations(const Subspace& subspace, bool storePositions,
+                             std::vector<std::pair<size_t, double>>& result) {
+    const size_t dim = storage.getDimension();
+    counters.assign(dim, 0);
+    partialProducts.resize(dim + 1);
+    partialProducts[0] = 1.0;
+
+    for (size_t t = 0; t < dim; t++) {
+      const std::pair<index_t, double>& entry = values[t][subspace.level[t]][0];
+      workingPoint.push(t, subspace.level[t], entry.first);
+      partialProducts[t + 1] = partialProducts[t] * entry.second;
+    }
+
+    while (true) {
+      workingPoint.rehash();
+      const size_t seq = storage.getSequenceNumber(workingPoint);
+
+      if (!storage.isInvalidSequenceNumber(seq)) {
+        result.push_back(std::make_pair(seq, partialProducts[dim]));
+
+        if (storePositions) {
+          affectedPositions.insert(affectedPositions.end(), counters.begin(), counters.end());
+        }
+      }
+
+      // increment counters (odometer), the last dimension changes fastest
+      size_t t = dim;
+
+      while (t > 0) {
+        t--;
+
+        if (++counters[t] < values[t][subspace.level[t]].size()) {
+          break;
+        }
+
+        counters[t] = 0;
+
+        if (t == 0) {
+          return;
+        }
+      }
+
+      for (; t < dim; t++) {
+        const std::pair<index_t, double>& entry = values[t][subspace.level[t]][counters[t]];
+        workingPoint.push(t, subspace.level[t], entry.first);
+        partialProducts[t + 1] = partialProducts[t] * entry.second;
+      }
+    }
+  }
+
+  /**
+   * Iterates over the grid points of a subspace and multiplies the (precomputed)
+   * non-zero 1D functions.
+   *
+   * @param subspace        subspace
+   * @param storePositions  whether to append the positions of the 1D factors
+   *                        to affectedPositions (basis functions with value zero are
+   *                        kept in this case, as their derivatives may not vanish)
+   * @param[out] result     vector to which the non-zero basis functions are appended
+   */
+  void enumeratePoints(const Subspace& subspace, bool storePositions,
+                       std::vector<std::pair<size_t, double>>& result) {
+    const size_t dim = storage.getDimension();
+    counters.resize(dim);
+
+    for (size_t k = 0; k < subspace.points.size(); k++) {
+      const size_t seq = subspace.points[k];
+      const GridPoint& gp = storage[seq];
+      double value = 1.0;
+      bool found = true;
+
+      for (size_t t = 0; t < dim; t++) {
+        const std::vector<std::pair<index_t, double>>& valuesTL = values[t][subspace.level[t]];
+        const index_t i = gp.getIndex(t);
+        std::vector<std::pair<index_t, double>>::const_iterator it =
+            std::lower_bound(valuesTL.begin(), valuesTL.end(),
+                             std::make_pair(i, -std::numeric_limits<double>::infinity()));
+
+        if ((it == valuesTL.end()) || (it->first != i)) {
+          found = false;
+          break;
+        }
+
+        value *= it->second;
+        counters[t] = static_cast<size_t>(it - valuesTL.begin());
+      }
+
+      if (found && (storePositions || (value != 0.0))) {
+        result.push_back(std::make_pair(seq, value));
+
+        if (storePositions) {
+          affectedPositions.insert(affectedPositions.end(), counters.begin(), counters.end());
+        }
+      }
+    }
+  }
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* ALGORITHMLOCALSUPPORTEVALUATION_HPP */
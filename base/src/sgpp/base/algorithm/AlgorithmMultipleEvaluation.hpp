@@ -12,11 +12,19 @@
 
 #include <sgpp/base/algorithm/AlgorithmEvaluation.hpp>
 #include <sgpp/base/algorithm/AlgorithmEvaluationTransposed.hpp>
+#include <sgpp/base/algorithm/AlgorithmMultipleOutputEvaluation.hpp>
+#include <sgpp/base/algorithm/AlgorithmPartitionedAccumulation.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
 #include <iostream>
 #include <utility>
+#include <vector>
 
 namespace sgpp {
 namespace base {
@@ -38,6 +46,10 @@ class AlgorithmMultipleEvaluation {
   /**
    * Performs a transposed mass evaluation
    *
+   * The contributions of the data points are accumulated in parallel by
+   * AlgorithmPartitionedAccumulation, hence the result does not depend on the scheduling of the
+   * threads.
+   *
    * @param storage GridStorage object that contains the grid's points information
    * @param basis a reference to a class that implements a specific basis
    * @param source the coefficients of the grid points
@@ -47,77 +59,114 @@ class AlgorithmMultipleEvaluation {
   void mult_transpose(GridStorage& storage, BASIS& basis, DataVector& source, DataMatrix& x,
                       DataVector& result) {
     result.setAll(0.0);
-    size_t source_size = source.getSize();
+    DataVector line(x.getNcols());
+    AlgorithmEvaluationTransposed<BASIS> AlgoEvalTrans(storage);
+
+    AlgorithmPartitionedAccumulation::apply(
+        source.getSize(),
+        [&basis, &source, &x, line, AlgoEvalTrans](
+            size_t i, std::vector<std::pair<size_t, double>>& affected) mutable {
+          x.getRow(i, line);
+          AlgoEvalTrans(basis, line, source[i], affected);
+        },
+        [&result](size_t k, size_t, double value) { result[k] += value; });
+  }
+
+  /**
+   * Performs a mass evaluation
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source the coefficients of the grid points
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the result vector of the matrix vector multiplication
+   */
+  void mult(GridStorage& storage, BASIS& basis, DataVector& source, DataMatrix& x,
+            DataVector& result) {
+    result.setAll(0.0);
+    size_t result_size = result.getSize();
 
 #pragma omp parallel
     {
-      DataVector privateResult(result.getSize());
-
       DataVector line(x.getNcols());
-      AlgorithmEvaluationTransposed<BASIS> AlgoEvalTrans(storage);
+      AlgorithmEvaluation<BASIS> AlgoEval(storage);
 
 #pragma omp for schedule(static)
 
-      for (size_t i = 0; i < source_size; i++) {
+      for (size_t i = 0; i < result_size; i++) {
         x.getRow(i, line);
 
-        AlgoEvalTrans(basis, line, source[i], privateResult);
+        result[i] = AlgoEval(basis, line, source);
       }
-
-#pragma omp critical
-      { result.add(privateResult); }
     }
   }
-  // implementation requires OpenMP 4.0 support
-  //        void mult_transpose(GridStorage& storage, BASIS& basis, DataVector& source,
-  //                            DataMatrix& x, DataVector& result) {
-  //          result.setAll(0.0);
-  //          size_t source_size = source.getSize();
-  //
-  //          #pragma omp declare reduction(accumulate :
-  // ...      sgpp::base::DataVector : omp_out.add(omp_in))
-  // ...      initializer ( omp_priv = DataVector(omp_orig.getSize(), 0))
-  //
-  //          #pragma omp parallel
-  //          {
-  //            DataVector line(x.getNcols());
-  //            AlgorithmEvaluationTransposed<BASIS> AlgoEvalTrans(storage);
-  //
-  //            #pragma omp for reduction(accumulate:result) schedule(static)
-  //
-  //            for (size_t i = 0; i < source_size; i++) {
-  //              x.getRow(i, line);
-  //
-  //              AlgoEvalTrans(basis, line, source[i], result);
-  //            }
-  //          }
-  //        }
 
   /**
-   * Performs a mass evaluation
+   * Performs a transposed mass evaluation for several source vectors at once.
+   * The basis functions are evaluated once per data point, the contributions to all columns
+   * are accumulated like in the vector version of mult_transpose.
    *
    * @param storage GridStorage object that contains the grid's points information
    * @param basis a reference to a class that implements a specific basis
-   * @param source the coefficients of the grid points
+   * @param source the coefficients of the data points, one column per source vector
    * @param x the d-dimensional vector with data points (row-wise)
-   * @param result the result vector of the matrix vector multiplication
+   * @param result the results of the matrix vector multiplications, one column per source vector
    */
-  void mult(GridStorage& storage, BASIS& basis, DataVector& source, DataMatrix& x,
-            DataVector& result) {
+  void mult_transpose(GridStorage& storage, BASIS& basis, DataMatrix& source, DataMatrix& x,
+                      DataMatrix& result) {
     result.setAll(0.0);
-    size_t result_size = result.getSize();
+    const size_t numberOfColumns = source.getNcols();
+    const double* sourceData = source.getPointer();
+    double* resultData = result.getPointer();
+    DataVector line(x.getNcols());
+    AlgorithmEvaluationTransposed<BASIS> AlgoEvalTrans(storage);
+
+    AlgorithmPartitionedAccumulation::apply(
+        source.getNrows(),
+        [&basis, &x, line, AlgoEvalTrans](
+            size_t i, std::vector<std::pair<size_t, double>>& affected) mutable {
+          x.getRow(i, line);
+          AlgoEvalTrans(basis, line, 1.0, affected);
+        },
+        [numberOfColumns, sourceData, resultData](size_t k, size_t i, double value) {
+          double* resultRow = resultData + k * numberOfColumns;
+          const double* sourceRow = sourceData + i * numberOfColumns;
+
+          for (size_t j = 0; j < numberOfColumns; j++) {
+            resultRow[j] += value * sourceRow[j];
+          }
+        });
+  }
+
+  /**
+   * Performs a mass evaluation for several coefficient vectors at once.
+   * The basis functions are evaluated once per data point.
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source the coefficients of the grid points, one column per coefficient vector
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the results of the evaluations, one column per coefficient vector
+   */
+  void mult(GridStorage& storage, BASIS& basis, DataMatrix& source, DataMatrix& x,
+            DataMatrix& result) {
+    result.setAll(0.0);
+    const size_t result_size = result.getNrows();
 
 #pragma omp parallel
     {
       DataVector line(x.getNcols());
-      AlgorithmEvaluation<BASIS> AlgoEval(storage);
+      AlgorithmEvaluationTransposed<BASIS> AlgoEvalTrans(storage);
+      std::vector<std::pair<size_t, double>> affected;
 
 #pragma omp for schedule(static)
 
       for (size_t i = 0; i < result_size; i++) {
         x.getRow(i, line);
-
-        result[i] = AlgoEval(basis, line, source);
+        affected.clear();
+        AlgoEvalTrans(basis, line, 1.0, affected);
+        AlgorithmMultipleOutputEvaluation::accumulate(source, affected,
+                                                      result.getPointer() + i * source.getNcols());
       }
     }
   }
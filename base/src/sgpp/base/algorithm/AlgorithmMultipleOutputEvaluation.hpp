@@ -0,0 +1,97 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef ALGORITHMMULTIPLEOUTPUTEVALUATION_HPP
+#define ALGORITHMMULTIPLEOUTPUTEVALUATION_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Evaluation of multiple sparse grid functions that share the same grid (given by the
+ * columns of a coefficient matrix \f$\alpha \in \mathbb{R}^{N \times m}\f$) at one point.
+ *
+ * Given the compact list of the basis functions that do not vanish at the point, i.e.,
+ * pairs \f$(k, \varphi_k(\vec{x}))\f$, the values
+ * \f$g_j(\vec{x}) = \sum_k \alpha_{k,j} \varphi_k(\vec{x})\f$ are computed as a small
+ * dense matrix-vector product of the gathered rows of \f$\alpha\f$ (which are contiguous,
+ * as DataMatrix is stored row-major) with the basis values. Four rows are combined per
+ * sweep over the outputs to reduce the loads and stores of the result, and the sweep
+ * is vectorized.
+ */
+class AlgorithmMultipleOutputEvaluation {
+ public:
+  /**
+   * Adds \f$\sum_k \varphi_k(\vec{x}) \alpha_{k,\cdot}\f$ to a result array.
+   *
+   * @param alpha         coefficient matrix (each column is a coefficient vector)
+   * @param basisValues   pairs (sequence number, value of the basis function)
+   * @param[in,out] value array of alpha.getNcols() values to which the result is added
+   */
+  static void accumulate(const DataMatrix& alpha,
+                         const std::vector<std::pair<size_t, double>>& basisValues,
+                         double* value) {
+    const size_t m = alpha.getNcols();
+    const size_t n = basisValues.size();
+    const double* alphaData = alpha.getPointer();
+    size_t k = 0;
+
+    for (; k + 4 <= n; k += 4) {
+      const double* row0 = alphaData + basisValues[k].first * m;
+      const double* row1 = alphaData + basisValues[k + 1].first * m;
+      const double* row2 = alphaData + basisValues[k + 2].first * m;
+      const double* row3 = alphaData + basisValues[k + 3].first * m;
+      const double weight0 = basisValues[k].second;
+      const double weight1 = basisValues[k + 1].second;
+      const double weight2 = basisValues[k + 2].second;
+      const double weight3 = basisValues[k + 3].second;
+
+#pragma omp simd
+      for (size_t j = 0; j < m; j++) {
+        value[j] += weight0 * row0[j] + weight1 * row1[j] + weight2 * row2[j] +
+                    weight3 * row3[j];
+      }
+    }
+
+    for (; k < n; k++) {
+      const double* row = alphaData + basisValues[k].first * m;
+      const double weight = basisValues[k].second;
+
+#pragma omp simd
+      for (size_t j = 0; j < m; j++) {
+        value[j] += weight * row[j];
+      }
+    }
+  }
+
+  /**
+   * Computes \f$\sum_k \varphi_k(\vec{x}) \alpha_{k,\cdot}\f$.
+   *
+   * @param alpha         coefficient matrix (each column is a coefficient vector)
+   * @param basisValues   pairs (sequence number, value of the basis function)
+   * @param[out] value    values of the linear combinations
+   */
+  static void eval(const DataMatrix& alpha,
+                   const std::vector<std::pair<size_t, double>>& basisValues,
+                   DataVector& value) {
+    value.resize(alpha.getNcols());
+    value.setAll(0.0);
+    accumulate(alpha, basisValues, value.getPointer());
+  }
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* ALGORITHMMULTIPLEOUTPUTEVALUATION_HPP */
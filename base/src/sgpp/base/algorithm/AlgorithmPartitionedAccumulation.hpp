@@ -0,0 +1,132 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef ALGORITHMPARTITIONEDACCUMULATION_HPP
+#define ALGORITHMPARTITIONEDACCUMULATION_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Parallel accumulation of sparse contributions of data points to grid points, as needed by
+ * transposed mass evaluations \f$\sum_j s_j \varphi_i(x_j)\f$.
+ *
+ * The data points are processed in blocks of dataBlockSize points per thread.
+ * For each block, every thread collects the (sparse) contributions of its points and
+ * sorts them into buckets according to the thread that owns the affected grid points
+ * (the grid points are distributed round-robin in tiles of gridTileSize consecutive
+ * sequence numbers). Afterwards, each thread adds the contributions of all buckets it
+ * owns to the result. Hence, no thread-private copies of the whole result and no
+ * critical sections are needed, the additional memory only depends on the block size, and
+ * the result does not depend on the scheduling of the threads.
+ */
+class AlgorithmPartitionedAccumulation {
+ public:
+  /// number of data points per thread that are processed in one block
+  static const size_t dataBlockSize = 256;
+  /// number of consecutive grid points that are owned by the same thread
+  static const size_t gridTileSize = 64;
+
+  /**
+   * Accumulates the contributions of all data points. Must not be called inside of a parallel
+   * region.
+   *
+   * @param numberOfPoints  number of data points
+   * @param evaluator       callable evaluate(j, affected) that appends the pairs (sequence
+   *                        number, value) of the grid points affected by data point j to
+   *                        affected; every thread works on its own copy, so thread-local state
+   *                        like bases or buffers can be captured by value
+   * @param accumulate      callable accumulate(i, j, value) that adds the value computed for
+   *                        grid point i and data point j to the result; calls for the same grid
+   *                        point are never concurrent
+   */
+  template <class Evaluator, class Accumulator>
+  static void apply(size_t numberOfPoints, const Evaluator& evaluator, Accumulator accumulate) {
+    typedef std::tuple<size_t, size_t, double> Contribution;
+
+    // contributions[t][o] contains the contributions computed by thread t
+    // to grid points owned by thread o
+    std::vector<std::vector<std::vector<Contribution>>> contributions;
+
+#pragma omp parallel shared(contributions)
+    {
+      size_t numThreads = 1;
+      size_t threadId = 0;
+#ifdef _OPENMP
+      numThreads = static_cast<size_t>(omp_get_num_threads());
+      threadId = static_cast<size_t>(omp_get_thread_num());
+#endif
+
+      Evaluator evaluate(evaluator);
+      std::vector<std::pair<size_t, double>> affected;
+
+      if (numThreads == 1) {
+        for (size_t j = 0; j < numberOfPoints; j++) {
+          affected.clear();
+          evaluate(j, affected);
+
+          for (size_t k = 0; k < affected.size(); k++) {
+            accumulate(affected[k].first, j, affected[k].second);
+          }
+        }
+      } else {
+#pragma omp single
+        { contributions.resize(numThreads, std::vector<std::vector<Contribution>>(numThreads)); }
+
+        std::vector<std::vector<Contribution>>& buckets = contributions[threadId];
+
+        for (size_t blockStart = 0; blockStart < numberOfPoints;
+             blockStart += numThreads * dataBlockSize) {
+          // phase 1: compute the contributions of this thread's data block
+          for (size_t owner = 0; owner < numThreads; owner++) {
+            buckets[owner].clear();
+          }
+
+          const size_t j0 = std::min(numberOfPoints, blockStart + threadId * dataBlockSize);
+          const size_t j1 = std::min(numberOfPoints, j0 + dataBlockSize);
+
+          for (size_t j = j0; j < j1; j++) {
+            affected.clear();
+            evaluate(j, affected);
+
+            for (size_t k = 0; k < affected.size(); k++) {
+              buckets[(affected[k].first / gridTileSize) % numThreads].push_back(
+                  std::make_tuple(affected[k].first, j, affected[k].second));
+            }
+          }
+
+#pragma omp barrier
+
+          // phase 2: accumulate the contributions to the grid points owned by this thread
+          for (size_t t = 0; t < numThreads; t++) {
+            for (const Contribution& contribution : contributions[t][threadId]) {
+              accumulate(std::get<0>(contribution), std::get<1>(contribution),
+                         std::get<2>(contribution));
+            }
+          }
+
+#pragma omp barrier
+        }
+      }
+    }
+  }
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* ALGORITHMPARTITIONEDACCUMULATION_HPP */
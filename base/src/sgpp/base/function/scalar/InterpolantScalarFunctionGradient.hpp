@@ -7,6 +7,7 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/function/scalar/ScalarFunctionGradient.hpp>
 #include <sgpp/base/grid/Grid.hpp>
@@ -62,6 +63,33 @@ class InterpolantScalarFunctionGradient : public ScalarFunctionGradient {
     return opEvalGradient->evalGradient(alpha, x, gradient);
   }
 
+  /**
+   * Evaluation of the function and its gradient at multiple points.
+   * The points are passed to the evaluation operation at once,
+   * which may evaluate them in parallel.
+   *
+   * @param      x        matrix \f$\vec{x} \in [0, 1]^{N \times d}\f$
+   *                      of evaluation points (row-wise)
+   * @param[out] value    vector of size \f$N\f$, where the \f$k\f$-th
+   *                      entry is \f$f(\vec{x}_k)\f$
+   *                      (infinity if \f$\vec{x}_k \notin [0, 1]^d\f$)
+   * @param[out] gradient matrix of size \f$N \times d\f$
+   *                      where the \f$k\f$-th row is
+   *                      \f$\nabla f(\vec{x}_k)\f$
+   */
+  void eval(const DataMatrix& x, DataVector& value, DataMatrix& gradient) override {
+    opEvalGradient->evalGradient(alpha, x, value, gradient);
+
+    for (size_t k = 0; k < x.getNrows(); k++) {
+      for (size_t t = 0; t < d; t++) {
+        if ((x(k, t) < 0.0) || (x(k, t) > 1.0)) {
+          value[k] = std::numeric_limits<double>::infinity();
+          break;
+        }
+      }
+    }
+  }
+
   /**
    * @param[out] clone pointer to cloned object
    */
@@ -15,6 +15,7 @@
 #include <sgpp/base/operation/hash/OperationEvalHessian.hpp>
 
 #include <limits>
+#include <vector>
 
 namespace sgpp {
 namespace base {
@@ -66,6 +67,37 @@ class InterpolantScalarFunctionHessian : public ScalarFunctionHessian {
     return opEvalHessian->evalHessian(alpha, x, gradient, hessian);
   }
 
+  /**
+   * Evaluation of the function, its gradient and its Hessian at multiple points.
+   * The points are passed to the evaluation operation at once,
+   * which may evaluate them in parallel.
+   *
+   * @param      x        matrix \f$\vec{x} \in [0, 1]^{N \times d}\f$
+   *                      of evaluation points (row-wise)
+   * @param[out] value    vector of size \f$N\f$, where the \f$k\f$-th
+   *                      entry is \f$f(\vec{x}_k)\f$
+   *                      (infinity if \f$\vec{x}_k \notin [0, 1]^d\f$)
+   * @param[out] gradient matrix of size \f$N \times d\f$
+   *                      where the \f$k\f$-th row is
+   *                      \f$\nabla f(\vec{x}_k)\f$
+   * @param[out] hessian  \f$N\f$-vector of Hessians
+   *                      \f$\nabla^2 f(\vec{x}_k) \in
+   *                      \mathbb{R}^{d \times d}\f$
+   */
+  void eval(const DataMatrix& x, DataVector& value, DataMatrix& gradient,
+            std::vector<DataMatrix>& hessian) override {
+    opEvalHessian->evalHessian(alpha, x, value, gradient, hessian);
+
+    for (size_t k = 0; k < x.getNrows(); k++) {
+      for (size_t t = 0; t < d; t++) {
+        if ((x(k, t) < 0.0) || (x(k, t) > 1.0)) {
+          value[k] = std::numeric_limits<double>::infinity();
+          break;
+        }
+      }
+    }
+  }
+
   /**
    * @param[out] clone pointer to cloned object
    */
@@ -73,9 +73,9 @@ class ScalarFunctionHessian {
    *                      \f$\nabla^2 f(\vec{x}_k) \in
    *                      \mathbb{R}^{d \times d}\f$
    */
-  inline void eval(const DataMatrix& x, DataVector& value,
-                   DataMatrix& gradient,
-                   std::vector<DataMatrix>& hessian) {
+  virtual void eval(const DataMatrix& x, DataVector& value,
+                    DataMatrix& gradient,
+                    std::vector<DataMatrix>& hessian) {
     const size_t N = x.getNrows();
     DataVector xk(d);
     DataVector yk(d);
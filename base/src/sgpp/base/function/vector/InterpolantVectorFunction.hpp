@@ -73,6 +73,33 @@ class InterpolantVectorFunction : public VectorFunction {
     opEval->eval(alpha, x, value);
   }
 
+  /**
+   * Evaluation of the function at multiple points.
+   * The points are passed to the evaluation operation at once,
+   * which may evaluate them in parallel.
+   *
+   * @param      x      matrix \f$\vec{x} \in [0, 1]^{N \times d}\f$
+   *                    of evaluation points (row-wise)
+   * @param[out] value  matrix of size \f$N \times m\f$
+   *                    where the \f$k\f$-th row is \f$g(\vec{x}_k)\f$
+   *                    (infinity if \f$\vec{x}_k \notin [0, 1]^d\f$)
+   */
+  void eval(const DataMatrix& x, DataMatrix& value) override {
+    opEval->eval(alpha, x, value);
+
+    for (size_t k = 0; k < x.getNrows(); k++) {
+      for (size_t t = 0; t < d; t++) {
+        if ((x(k, t) < 0.0) || (x(k, t) > 1.0)) {
+          for (size_t j = 0; j < m; j++) {
+            value(k, j) = std::numeric_limits<double>::infinity();
+          }
+
+          break;
+        }
+      }
+    }
+  }
+
   /**
    * @param[out] clone pointer to cloned object
    */
@@ -0,0 +1,125 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/grid/storage/hashmap/HashGridPointFlatMap.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+HashGridPointFlatMap::HashGridPointFlatMap()
+    : distances(), hashes(), entries(), numElements(0), mask(0) {}
+
+void HashGridPointFlatMap::clear() {
+  std::fill(distances.begin(), distances.end(), 0);
+  numElements = 0;
+}
+
+void HashGridPointFlatMap::reserve(size_t n) {
+  size_t capacity = 16;
+
+  while (capacity * maxLoadNumerator < n * 8) {
+    capacity *= 2;
+  }
+
+  if (capacity > distances.size()) {
+    grow(capacity);
+  }
+}
+
+size_t& HashGridPointFlatMap::operator[](HashGridPoint* key) {
+  size_t pos = findSlot(key);
+
+  if (pos != distances.size()) {
+    return entries[pos].second;
+  }
+
+  if ((numElements + 1) * 8 > distances.size() * maxLoadNumerator) {
+    grow(std::max<size_t>(16, 2 * distances.size()));
+  }
+
+  pos = insertNew(key, key->getHash(), 0);
+  return entries[pos].second;
+}
+
+size_t HashGridPointFlatMap::erase(const HashGridPoint* key) {
+  size_t pos = findSlot(key);
+
+  if (pos == distances.size()) {
+    return 0;
+  }
+
+  // backward shift deletion: move the following entries one slot closer to their home
+  // until an empty slot or an entry in its home slot is reached
+  size_t next = (pos + 1) & mask;
+
+  while (distances[next] > 1) {
+    distances[pos] = distances[next] - 1;
+    hashes[pos] = hashes[next];
+    entries[pos] = entries[next];
+    pos = next;
+    next = (next + 1) & mask;
+  }
+
+  distances[pos] = 0;
+  numElements--;
+  return 1;
+}
+
+void HashGridPointFlatMap::grow(size_t newCapacity) {
+  std::vector<uint32_t> oldDistances(newCapacity, 0);
+  std::vector<size_t> oldHashes(newCapacity);
+  std::vector<value_type> oldEntries(newCapacity);
+
+  distances.swap(oldDistances);
+  hashes.swap(oldHashes);
+  entries.swap(oldEntries);
+  mask = newCapacity - 1;
+  numElements = 0;
+
+  for (size_t i = 0; i < oldDistances.size(); i++) {
+    if (oldDistances[i] != 0) {
+      insertNew(oldEntries[i].first, oldHashes[i], oldEntries[i].second);
+    }
+  }
+}
+
+size_t HashGridPointFlatMap::insertNew(HashGridPoint* key, size_t hash, size_t value) {
+  size_t pos = slotOf(hash);
+  uint32_t dist = 1;
+  value_type entry(key, value);
+  size_t result = distances.size();
+
+  while (true) {
+    if (distances[pos] == 0) {
+      distances[pos] = dist;
+      hashes[pos] = hash;
+      entries[pos] = entry;
+      numElements++;
+      return (result == distances.size()) ? pos : result;
+    }
+
+    // take the slot from entries that are closer to their home slot ("rich") and
+    // continue inserting the displaced entry
+    if (distances[pos] < dist) {
+      std::swap(dist, distances[pos]);
+      std::swap(hash, hashes[pos]);
+      std::swap(entry, entries[pos]);
+
+      if (result == distances.size()) {
+        result = pos;
+      }
+    }
+
+    pos = (pos + 1) & mask;
+    dist++;
+  }
+}
+
+}  // namespace base
+}  // namespace sgpp
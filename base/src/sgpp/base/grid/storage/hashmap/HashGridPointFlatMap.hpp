@@ -0,0 +1,236 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef HASHGRIDPOINTFLATMAP_HPP
+#define HASHGRIDPOINTFLATMAP_HPP
+
+#include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <stdint.h>
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Open-addressing hash map (Robin Hood hashing with backward shift deletion) that maps
+ * grid points to their sequence numbers.
+ *
+ * In contrast to std::unordered_map, all slots live in three contiguous arrays (probe
+ * distances, cached hash values and key/value pairs). A lookup therefore only touches
+ * a short, linear run of slots and dereferences a stored grid point only if the cached
+ * hash values match, which avoids most of the pointer chasing of node-based maps.
+ *
+ * The interface is the subset of std::unordered_map that is used by HashGridStorage and
+ * its clients (find, operator[], erase, clear, size, begin/end, iterators with
+ * first/second). The map does not own the grid points.
+ */
+class HashGridPointFlatMap {
+ public:
+  /// key type
+  typedef HashGridPoint* key_type;
+  /// mapped type (sequence number)
+  typedef size_t mapped_type;
+  /// value type of iterators
+  typedef std::pair<HashGridPoint*, size_t> value_type;
+
+  /**
+   * Forward iterator over the occupied slots of the map.
+   */
+  template <class MapType, class ValueType>
+  class IteratorBase : public std::iterator<std::forward_iterator_tag, ValueType> {
+   public:
+    IteratorBase() : map(nullptr), pos(0) {}
+
+    IteratorBase(MapType* map, size_t pos) : map(map), pos(pos) { skipEmpty(); }
+
+    /// allow conversion from iterator to const_iterator
+    template <class OtherMapType, class OtherValueType>
+    IteratorBase(const IteratorBase<OtherMapType, OtherValueType>& other)  // NOLINT
+        : map(other.map), pos(other.pos) {}
+
+    ValueType& operator*() const { return map->entries[pos]; }
+
+    ValueType* operator->() const { return &map->entries[pos]; }
+
+    IteratorBase& operator++() {
+      ++pos;
+      skipEmpty();
+      return *this;
+    }
+
+    IteratorBase operator++(int) {
+      IteratorBase result(*this);
+      ++(*this);
+      return result;
+    }
+
+    template <class OtherMapType, class OtherValueType>
+    bool operator==(const IteratorBase<OtherMapType, OtherValueType>& other) const {
+      return pos == other.pos;
+    }
+
+    template <class OtherMapType, class OtherValueType>
+    bool operator!=(const IteratorBase<OtherMapType, OtherValueType>& other) const {
+      return pos != other.pos;
+    }
+
+   private:
+    inline void skipEmpty() {
+      while ((pos < map->distances.size()) && (map->distances[pos] == 0)) {
+        ++pos;
+      }
+    }
+
+    MapType* map;
+    size_t pos;
+
+    template <class OtherMapType, class OtherValueType>
+    friend class IteratorBase;
+  };
+
+  /// iterator
+  typedef IteratorBase<HashGridPointFlatMap, value_type> iterator;
+  /// const iterator
+  typedef IteratorBase<const HashGridPointFlatMap, const value_type> const_iterator;
+
+  /**
+   * Constructor, creates an empty map
+   */
+  HashGridPointFlatMap();
+
+  /**
+   * @return number of stored grid points
+   */
+  inline size_t size() const { return numElements; }
+
+  /**
+   * @return true if no grid points are stored
+   */
+  inline bool empty() const { return numElements == 0; }
+
+  /**
+   * Removes all entries (the grid points themselves are not deleted).
+   */
+  void clear();
+
+  /**
+   * Allocates enough slots such that n grid points can be stored without rehashing.
+   *
+   * @param n number of grid points
+   */
+  void reserve(size_t n);
+
+  /**
+   * Looks up a grid point.
+   *
+   * @param key grid point to look up
+   * @return iterator pointing to the entry or end() if the grid point is not stored
+   */
+  inline iterator find(const HashGridPoint* key) { return iterator(this, findSlot(key)); }
+
+  /**
+   * Looks up a grid point.
+   *
+   * @param key grid point to look up
+   * @return iterator pointing to the entry or end() if the grid point is not stored
+   */
+  inline const_iterator find(const HashGridPoint* key) const {
+    return const_iterator(this, findSlot(key));
+  }
+
+  /**
+   * Returns the sequence number of a grid point, inserting the pointer with value zero
+   * if an equal grid point is not stored yet.
+   *
+   * @param key grid point (the pointer itself is stored, not a copy)
+   * @return reference to the sequence number
+   */
+  size_t& operator[](HashGridPoint* key);
+
+  /**
+   * Removes a grid point from the map.
+   *
+   * @param key grid point to remove
+   * @return number of removed entries (0 or 1)
+   */
+  size_t erase(const HashGridPoint* key);
+
+  /// @return iterator to the first entry
+  inline iterator begin() { return iterator(this, 0); }
+
+  /// @return iterator past the last entry
+  inline iterator end() { return iterator(this, distances.size()); }
+
+  /// @return iterator to the first entry
+  inline const_iterator begin() const { return const_iterator(this, 0); }
+
+  /// @return iterator past the last entry
+  inline const_iterator end() const { return const_iterator(this, distances.size()); }
+
+ private:
+  /**
+   * Distributes the bits of the grid point hash, as the hash of HashGridPoint is a
+   * polynomial in the levels and indices and therefore has badly mixed low bits.
+   */
+  inline size_t slotOf(size_t hash) const {
+    uint64_t h = static_cast<uint64_t>(hash);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return static_cast<size_t>(h) & mask;
+  }
+
+  inline size_t findSlot(const HashGridPoint* key) const {
+    if (numElements == 0) {
+      return distances.size();
+    }
+
+    const size_t hash = key->getHash();
+    size_t pos = slotOf(hash);
+
+    // Robin Hood invariant: the entry cannot be stored further away from its home slot
+    // than the occupant of the currently probed slot
+    for (uint32_t dist = 1; dist <= distances[pos]; ++dist) {
+      if ((hashes[pos] == hash) && entries[pos].first->equals(*key)) {
+        return pos;
+      }
+
+      pos = (pos + 1) & mask;
+    }
+
+    return distances.size();
+  }
+
+  void grow(size_t newCapacity);
+
+  /// inserts an entry which is known not to be contained and returns its slot
+  size_t insertNew(HashGridPoint* key, size_t hash, size_t value);
+
+  /// probe distance + 1 for every slot, 0 marks an empty slot
+  std::vector<uint32_t> distances;
+  /// cached hash values of the stored grid points
+  std::vector<size_t> hashes;
+  /// key/value pairs
+  std::vector<value_type> entries;
+  /// number of stored entries
+  size_t numElements;
+  /// capacity - 1 (capacity is a power of two)
+  size_t mask;
+
+  /// maximum load factor numerator (load factor is maxLoadNumerator / 8)
+  static const size_t maxLoadNumerator = 7;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* HASHGRIDPOINTFLATMAP_HPP */
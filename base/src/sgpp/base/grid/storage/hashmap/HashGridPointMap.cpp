@@ -0,0 +1,56 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/grid/storage/hashmap/HashGridPointMap.hpp>
+
+namespace sgpp {
+namespace base {
+
+const GridPointMapType HashGridPointMap::DEFAULT_TYPE;
+
+HashGridPointMap::HashGridPointMap(GridPointMapType type) : type(type), flatMap(), stdMap() {}
+
+void HashGridPointMap::setType(GridPointMapType newType) {
+  if (newType == type) {
+    return;
+  }
+
+  if (newType == GridPointMapType::StdUnorderedMap) {
+    stdMap.reserve(flatMap.size());
+
+    for (HashGridPointFlatMap::const_iterator iter = flatMap.begin(); iter != flatMap.end();
+         ++iter) {
+      stdMap[iter->first] = iter->second;
+    }
+
+    flatMap = HashGridPointFlatMap();
+  } else {
+    flatMap.reserve(stdMap.size());
+
+    for (std_map::const_iterator iter = stdMap.begin(); iter != stdMap.end(); ++iter) {
+      flatMap[iter->first] = iter->second;
+    }
+
+    stdMap = std_map();
+  }
+
+  type = newType;
+}
+
+void HashGridPointMap::clear() {
+  flatMap.clear();
+  stdMap.clear();
+}
+
+void HashGridPointMap::reserve(size_t n) {
+  if (useStd()) {
+    stdMap.reserve(n);
+  } else {
+    flatMap.reserve(n);
+  }
+}
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,218 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef HASHGRIDPOINTMAP_HPP
+#define HASHGRIDPOINTMAP_HPP
+
+#include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridPointFlatMap.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <unordered_map>
+#include <utility>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Implementation of the map from grid points to sequence numbers of HashGridStorage.
+ */
+enum class GridPointMapType {
+  /// open-addressing map HashGridPointFlatMap
+  FlatHashMap,
+  /// node-based std::unordered_map
+  StdUnorderedMap
+};
+
+/**
+ * Map from grid points to their sequence numbers, whose implementation can be chosen at
+ * runtime (see GridPointMapType). The default is HashGridPointFlatMap, unless
+ * USE_STD_GRID_MAP is defined at compile time.
+ *
+ * The interface is the subset of std::unordered_map that is used by HashGridStorage and
+ * its clients. Iterators only give read access to the entries.
+ */
+class HashGridPointMap {
+ public:
+  /// key type
+  typedef HashGridPoint* key_type;
+  /// mapped type (sequence number)
+  typedef size_t mapped_type;
+  /// value type of iterators
+  typedef std::pair<HashGridPoint*, size_t> value_type;
+  /// node-based map
+  typedef std::unordered_map<HashGridPoint*, size_t, HashGridPointPointerHashFunctor,
+                             HashGridPointPointerEqualityFunctor>
+      std_map;
+
+  /// implementation that is used if none is specified
+#ifdef USE_STD_GRID_MAP
+  static const GridPointMapType DEFAULT_TYPE = GridPointMapType::StdUnorderedMap;
+#else
+  static const GridPointMapType DEFAULT_TYPE = GridPointMapType::FlatHashMap;
+#endif
+
+  /**
+   * Forward iterator over the entries of the map.
+   */
+  class const_iterator : public std::iterator<std::forward_iterator_tag, const value_type> {
+   public:
+    const_iterator() : useStd(false), flatIter(), stdIter(), current() {}
+
+    explicit const_iterator(HashGridPointFlatMap::const_iterator iter)
+        : useStd(false), flatIter(iter), stdIter(), current() {}
+
+    explicit const_iterator(std_map::const_iterator iter)
+        : useStd(true), flatIter(), stdIter(iter), current() {}
+
+    const HashGridPointMap::value_type& operator*() const {
+      if (useStd) {
+        current = HashGridPointMap::value_type(stdIter->first, stdIter->second);
+      } else {
+        current = *flatIter;
+      }
+
+      return current;
+    }
+
+    const HashGridPointMap::value_type* operator->() const { return &**this; }
+
+    const_iterator& operator++() {
+      if (useStd) {
+        ++stdIter;
+      } else {
+        ++flatIter;
+      }
+
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator result(*this);
+      ++(*this);
+      return result;
+    }
+
+    bool operator==(const const_iterator& other) const {
+      return useStd ? (stdIter == other.stdIter) : (flatIter == other.flatIter);
+    }
+
+    bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+   private:
+    bool useStd;
+    HashGridPointFlatMap::const_iterator flatIter;
+    std_map::const_iterator stdIter;
+    /// copy of the current entry, as the implementations use different value types
+    mutable HashGridPointMap::value_type current;
+  };
+
+  /// iterator (read-only as well)
+  typedef const_iterator iterator;
+
+  /**
+   * Constructor, creates an empty map
+   *
+   * @param type implementation of the map
+   */
+  explicit HashGridPointMap(GridPointMapType type = DEFAULT_TYPE);
+
+  /**
+   * @return implementation of the map
+   */
+  inline GridPointMapType getType() const { return type; }
+
+  /**
+   * Changes the implementation of the map, keeping all entries.
+   *
+   * @param newType new implementation of the map
+   */
+  void setType(GridPointMapType newType);
+
+  /**
+   * @return number of stored grid points
+   */
+  inline size_t size() const { return useStd() ? stdMap.size() : flatMap.size(); }
+
+  /**
+   * @return true if no grid points are stored
+   */
+  inline bool empty() const { return size() == 0; }
+
+  /**
+   * Removes all entries (the grid points themselves are not deleted).
+   */
+  void clear();
+
+  /**
+   * Allocates memory such that n grid points can be stored without rehashing.
+   *
+   * @param n number of grid points
+   */
+  void reserve(size_t n);
+
+  /**
+   * Looks up a grid point.
+   *
+   * @param key grid point to look up
+   * @return iterator pointing to the entry or end() if the grid point is not stored
+   */
+  inline const_iterator find(const HashGridPoint* key) const {
+    if (useStd()) {
+      return const_iterator(stdMap.find(const_cast<HashGridPoint*>(key)));
+    } else {
+      return const_iterator(flatMap.find(key));
+    }
+  }
+
+  /**
+   * Returns the sequence number of a grid point, inserting the pointer with value zero
+   * if an equal grid point is not stored yet.
+   *
+   * @param key grid point (the pointer itself is stored, not a copy)
+   * @return reference to the sequence number
+   */
+  inline size_t& operator[](HashGridPoint* key) {
+    return useStd() ? stdMap[key] : flatMap[key];
+  }
+
+  /**
+   * Removes a grid point from the map.
+   *
+   * @param key grid point to remove
+   * @return number of removed entries (0 or 1)
+   */
+  inline size_t erase(const HashGridPoint* key) {
+    return useStd() ? stdMap.erase(const_cast<HashGridPoint*>(key)) : flatMap.erase(key);
+  }
+
+  /// @return iterator to the first entry
+  inline const_iterator begin() const {
+    return useStd() ? const_iterator(stdMap.cbegin()) : const_iterator(flatMap.begin());
+  }
+
+  /// @return iterator past the last entry
+  inline const_iterator end() const {
+    return useStd() ? const_iterator(stdMap.cend()) : const_iterator(flatMap.end());
+  }
+
+ private:
+  inline bool useStd() const { return type == GridPointMapType::StdUnorderedMap; }
+
+  /// implementation of the map
+  GridPointMapType type;
+  /// entries if type is FlatHashMap
+  HashGridPointFlatMap flatMap;
+  /// entries if type is StdUnorderedMap
+  std_map stdMap;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* HASHGRIDPOINTMAP_HPP */
@@ -26,7 +26,8 @@ HashGridStorage::HashGridStorage(size_t dimension)
       algoDims(),
       boundingBox(new BoundingBox(dimension)),
       stretching(nullptr),
-      bUseStretching(false) {
+      bUseStretching(false),
+      modificationCount(0) {
   for (size_t i = 0; i < dimension; i++) {
     algoDims.push_back(i);
   }
@@ -40,7 +41,8 @@ HashGridStorage::HashGridStorage(BoundingBox& creationBoundingBox)
       algoDims(),
       boundingBox(new BoundingBox(creationBoundingBox)),
       stretching(nullptr),
-      bUseStretching(false) {
+      bUseStretching(false),
+      modificationCount(0) {
   // this look like a bug, creationBoundingBox not used
   for (size_t i = 0; i < dimension; i++) {
     algoDims.push_back(i);
@@ -55,7 +57,8 @@ HashGridStorage::HashGridStorage(Stretching& creationStretching)
       algoDims(),
       boundingBox(nullptr),
       stretching(new Stretching(creationStretching)),
-      bUseStretching(true) {
+      bUseStretching(true),
+      modificationCount(0) {
   // this look like a bug, creationBoundingBox not used
   for (size_t i = 0; i < dimension; i++) {
     algoDims.push_back(i);
@@ -67,7 +70,8 @@ HashGridStorage::HashGridStorage(std::string& istr)
       dimension(0lu),
       list(),
       map(),
-      algoDims() {
+      algoDims(),
+      modificationCount(0) {
   std::istringstream istream;
   istream.str(istr);
 
@@ -83,7 +87,8 @@ HashGridStorage::HashGridStorage(std::istream& istream)
       dimension(0lu),
       list(),
       map(),
-      algoDims() {
+      algoDims(),
+      modificationCount(0) {
   parseGridDescription(istream);
 
   for (size_t i = 0; i < dimension; i++) {
@@ -95,11 +100,14 @@ HashGridStorage::HashGridStorage(HashGridStorage& copyFrom)
     :  // GridStorage(copyFrom),
       dimension(copyFrom.dimension),
       list(),
-      map(),
+      map(copyFrom.getGridPointMapType()),
       algoDims(copyFrom.algoDims),
       boundingBox(copyFrom.bUseStretching ? nullptr : new BoundingBox(*copyFrom.boundingBox)),
       stretching(copyFrom.bUseStretching ? new Stretching(*copyFrom.stretching) : nullptr),
-      bUseStretching(copyFrom.bUseStretching) {
+      bUseStretching(copyFrom.bUseStretching),
+      modificationCount(0) {
+  reserve(copyFrom.getSize());
+
   // copy gridpoints
   for (size_t i = 0; i < copyFrom.getSize(); i++) {
     this->insert(copyFrom[i]);
@@ -117,6 +125,7 @@ void HashGridStorage::operator=(const HashGridStorage& other) {
 
   dimension = other.dimension;
   algoDims = other.algoDims;
+  map.setType(other.getGridPointMapType());
   bUseStretching = other.bUseStretching;
 
   if (other.bUseStretching) {
@@ -125,6 +134,8 @@ void HashGridStorage::operator=(const HashGridStorage& other) {
     boundingBox = new BoundingBox(*other.boundingBox);
   }
 
+  reserve(other.getSize());
+
   for (size_t i = 0; i < other.getSize(); i++) {
     this->insert(other[i]);
   }
@@ -153,8 +164,20 @@ void HashGridStorage::clear() {
   map.clear();
   // remove all list entries
   list.clear();
+  modificationCount++;
 }
 
+void HashGridStorage::reserve(size_t numberOfPoints) {
+  list.reserve(numberOfPoints);
+  map.reserve(numberOfPoints);
+}
+
+size_t HashGridStorage::getModificationCount() const { return modificationCount; }
+
+GridPointMapType HashGridStorage::getGridPointMapType() const { return map.getType(); }
+
+void HashGridStorage::setGridPointMapType(GridPointMapType type) { map.setType(type); }
+
 std::vector<size_t> HashGridStorage::deletePoints(std::list<size_t>& removePoints) {
   point_pointer curPoint;
   std::vector<size_t> remainingPoints;
@@ -242,12 +265,151 @@ void HashGridStorage::serialize(std::ostream& ostream, int version) const {
     stretching->serialize(ostream, version);
   }
 
+  if (version >= SERIALIZATION_VERSION_BINARY) {
+    serializeCompactGridPoints(ostream);
+    return;
+  }
+
   // print the coordinates of the grid points
   for (grid_list_const_iterator iter = list.begin(); iter != list.end(); iter++) {
     (*iter)->serialize(ostream, version);
   }
 }
 
+namespace {
+
+/// marker line between the text header and the binary encoded grid points
+const char compactGridPointsMarker[] = "binary";
+
+inline void writeVarint(std::string& buffer, uint64_t value) {
+  while (value >= 0x80) {
+    buffer.push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+
+  buffer.push_back(static_cast<char>(value));
+}
+
+inline uint64_t readVarint(std::streambuf& buffer) {
+  uint64_t value = 0;
+
+  for (unsigned int shift = 0; shift < 64; shift += 7) {
+    const int byte = buffer.sbumpc();
+
+    if (byte == std::char_traits<char>::eof()) {
+      throw generation_exception("HashGridStorage: unexpected end of binary grid points");
+    }
+
+    value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+
+    if ((byte & 0x80) == 0) {
+      return value;
+    }
+  }
+
+  throw generation_exception("HashGridStorage: invalid binary grid points");
+}
+
+}  // namespace
+
+void HashGridStorage::serializeCompactGridPoints(std::ostream& ostream) const {
+  ostream << compactGridPointsMarker << "\n";
+
+  // every point stores the levels and indices of the dimensions in which it differs from the
+  // previous point (consecutive points of refined grids mostly differ in few dimensions)
+  std::vector<level_t> previousLevel(dimension, 0);
+  std::vector<index_t> previousIndex(dimension, 0);
+  std::vector<size_t> changedDims;
+  std::string buffer;
+  const size_t flushSize = 1 << 20;
+
+  for (const point_pointer point : list) {
+    changedDims.clear();
+
+    for (size_t d = 0; d < dimension; d++) {
+      if ((point->getLevel(d) != previousLevel[d]) || (point->getIndex(d) != previousIndex[d])) {
+        changedDims.push_back(d);
+      }
+    }
+
+    writeVarint(buffer, 2 * changedDims.size() + (point->isLeaf() ? 1 : 0));
+    size_t nextDim = 0;
+
+    for (size_t d : changedDims) {
+      writeVarint(buffer, d - nextDim);
+      writeVarint(buffer, point->getLevel(d));
+      writeVarint(buffer, point->getIndex(d));
+      previousLevel[d] = point->getLevel(d);
+      previousIndex[d] = point->getIndex(d);
+      nextDim = d + 1;
+    }
+
+    if (buffer.size() >= flushSize) {
+      ostream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+      buffer.clear();
+    }
+  }
+
+  ostream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+  ostream << std::endl;
+}
+
+void HashGridStorage::parseCompactGridPoints(std::istream& istream, size_t numberOfPoints) {
+  std::string marker;
+  istream >> marker;
+
+  if ((marker != compactGridPointsMarker) || (istream.get() != '\n')) {
+    throw generation_exception("HashGridStorage: binary grid points expected");
+  }
+
+  std::streambuf& buffer = *istream.rdbuf();
+  std::vector<level_t> level(dimension, 0);
+  std::vector<index_t> index(dimension, 0);
+  const size_t firstPoint = list.size();
+
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    const uint64_t header = readVarint(buffer);
+    const uint64_t numberOfChangedDims = header / 2;
+    size_t d = 0;
+
+    for (uint64_t k = 0; k < numberOfChangedDims; k++) {
+      d += readVarint(buffer);
+
+      if (d >= dimension) {
+        throw generation_exception("HashGridStorage: invalid binary grid points");
+      }
+
+      level[d] = static_cast<level_t>(readVarint(buffer));
+      index[d] = static_cast<index_t>(readVarint(buffer));
+      d++;
+    }
+
+    point_pointer point = new HashGridPoint(dimension);
+
+    for (size_t t = 0; t < dimension; t++) {
+      point->push(t, level[t], index[t]);
+    }
+
+    point->setLeaf((header & 1) != 0);
+    list.push_back(point);
+  }
+
+  // bulk build of the hash map: hash all points in parallel, then insert them into the map,
+  // which has been reserved for all points
+  const size_t numberOfPointsRead = list.size() - firstPoint;
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < numberOfPointsRead; i++) {
+    list[firstPoint + i]->rehash();
+  }
+
+  for (size_t i = firstPoint; i < list.size(); i++) {
+    map[list[i]] = i;
+  }
+
+  modificationCount++;
+}
+
 std::string HashGridStorage::toString() const {
   std::ostringstream ostream;
   this->toString(ostream);
@@ -288,6 +450,7 @@ size_t HashGridStorage::getDimension() const { return dimension; }
 size_t HashGridStorage::insert(const point_type& index) {
   point_pointer insert = new HashGridPoint(index);
   list.push_back(insert);
+  modificationCount++;
   return (map[insert] = list.size() - 1);
 }
 
@@ -332,6 +495,7 @@ void HashGridStorage::update(point_type& index, size_t pos) {
     point_pointer insert = new HashGridPoint(index);
     list[pos] = insert;
     map[insert] = pos;
+    modificationCount++;
   }
 }
 
@@ -340,6 +504,7 @@ void HashGridStorage::deleteLast() {
   map.erase(del);
   list.pop_back();
   delete del;
+  modificationCount++;
 }
 
 void HashGridStorage::setAlgorithmicDimensions(std::vector<size_t> newAlgoDims) {
@@ -353,6 +518,8 @@ void HashGridStorage::setAlgorithmicDimensions(std::vector<size_t> newAlgoDims)
   for (size_t i = 0; i < newAlgoDims.size(); i++) {
     algoDims.push_back(newAlgoDims[i]);
   }
+
+  modificationCount++;
 }
 
 void HashGridStorage::recalcLeafProperty() {
@@ -395,6 +562,8 @@ void HashGridStorage::recalcLeafProperty() {
 
     point->setLeaf(isLeaf);
   }
+
+  modificationCount++;
 }
 
 // TODO(someone): this looks very fishy...
@@ -417,6 +586,7 @@ void HashGridStorage::setBoundingBox(BoundingBox& boundingBox) {
 
   bUseStretching = false;
   this->boundingBox = new BoundingBox(boundingBox);
+  modificationCount++;
 }
 
 void HashGridStorage::setStretching(Stretching& stretching) {
@@ -428,6 +598,7 @@ void HashGridStorage::setStretching(Stretching& stretching) {
 
   bUseStretching = true;
   this->stretching = new Stretching(stretching);
+  modificationCount++;
 }
 
 void HashGridStorage::getLevelIndexArraysForEval(DataMatrix& level, DataMatrix& index) {
@@ -611,11 +782,12 @@ void HashGridStorage::parseGridDescription(std::istream& istream) {
   istream >> num;
 
   // check whether grid was created with a version that is too new
-  if (version > SERIALIZATION_VERSION) {
+  if (version > SERIALIZATION_VERSION_BINARY) {
     if (version != 4) {
       std::ostringstream errstream;
       errstream << "Version of serialized grid (" << version
-                << ") is too new. Max. recognized version is " << SERIALIZATION_VERSION << ".";
+                << ") is too new. Max. recognized version is " << SERIALIZATION_VERSION_BINARY
+                << ".";
       throw generation_exception(errstream.str().c_str());
     }
   }
@@ -670,12 +842,21 @@ void HashGridStorage::parseGridDescription(std::istream& istream) {
     }
   }
 
+  reserve(num);
+
+  if (version >= SERIALIZATION_VERSION_BINARY) {
+    parseCompactGridPoints(istream, num);
+    return;
+  }
+
   for (size_t i = 0; i < num; i++) {
     point_pointer index = new HashGridPoint(istream, version);
     list.push_back(index);
     map[index] = i;
   }
 
+  modificationCount++;
+
   // set's the grid point's leaf information which is not saved in version 1
   if (version == 1 || version == 4) {
     recalcLeafProperty();
@@ -9,6 +9,7 @@
 #include <sgpp/base/exception/generation_exception.hpp>
 
 #include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridPointMap.hpp>
 #include <sgpp/base/grid/storage/hashmap/SerializationVersion.hpp>
 
 #include <sgpp/base/grid/common/BoundingBox.hpp>
@@ -47,10 +48,8 @@ class HashGridStorage {
   typedef HashGridPoint* point_pointer;
   /// pointer to constant index_type
   typedef const HashGridPoint* index_const_pointer;
-  /// unordered_map of index_pointers
-  typedef std::unordered_map<point_pointer, size_t, HashGridPointPointerHashFunctor,
-                             HashGridPointPointerEqualityFunctor>
-      grid_map;
+  /// map of index_pointers, implementation selectable by setGridPointMapType
+  typedef HashGridPointMap grid_map;
   /// iterator of grid_map
   typedef grid_map::iterator grid_map_iterator;
   /// const_iterator of grid_map
@@ -128,6 +127,37 @@ class HashGridStorage {
    */
   void clear();
 
+  /**
+   * Reserves memory for the given number of grid points, such that inserting them
+   * does not trigger a rehash of the grid point index
+   *
+   * @param numberOfPoints expected number of grid points
+   */
+  void reserve(size_t numberOfPoints);
+
+  /**
+   * Returns a counter that is incremented whenever grid points are inserted, updated or
+   * deleted, or the algorithmic dimensions or the domain are changed. Data structures that
+   * are derived from the grid (e.g., by operations) can compare it to detect that they are
+   * outdated, which is not possible with the number of grid points alone.
+   *
+   * @return number of modifications since the construction of the storage
+   */
+  size_t getModificationCount() const;
+
+  /**
+   * @return implementation of the map from grid points to sequence numbers
+   */
+  GridPointMapType getGridPointMapType() const;
+
+  /**
+   * Changes the implementation of the map from grid points to sequence numbers, e.g., to
+   * fall back to std::unordered_map. The grid points and their sequence numbers are kept.
+   *
+   * @param type new implementation
+   */
+  void setGridPointMapType(GridPointMapType type);
+
   /**
    * Remove several point from HashGridStorage. The points to removed
    * are stored in a list. This function returns a vector of remaining points
@@ -159,6 +189,8 @@ class HashGridStorage {
    *
    * @param ostream reference to a stream into that all gridstorage information is written
    * @param version the serialization version of the file
+   *        (SERIALIZATION_VERSION_BINARY for the compact binary encoding of the grid points,
+   *        which requires a stream opened in binary mode)
    */
   void serialize(std::ostream& ostream, int version = SERIALIZATION_VERSION) const;
 
@@ -535,12 +567,31 @@ class HashGridStorage {
   /// Flag to check if stretching or boundingBox used
   bool bUseStretching;
 
+  /// number of modifications of the grid points, the algorithmic dimensions or the domain
+  size_t modificationCount;
+
   /**
    * Parses the gird's information (grid points, dimensions, bounding box) from a string stream
    *
    * @param istream the string stream that contains the information
    */
   void parseGridDescription(std::istream& istream);
+
+  /**
+   * Writes the grid points in the compact binary encoding of SERIALIZATION_VERSION_BINARY
+   *
+   * @param ostream the stream to write to
+   */
+  void serializeCompactGridPoints(std::ostream& ostream) const;
+
+  /**
+   * Reads grid points in the compact binary encoding of SERIALIZATION_VERSION_BINARY and builds
+   * the hash map in bulk afterwards
+   *
+   * @param istream the stream to read from
+   * @param numberOfPoints the number of grid points to read
+   */
+  void parseCompactGridPoints(std::istream& istream, size_t numberOfPoints);
 };
 
 HashGridStorage::point_pointer inline HashGridStorage::create(point_type& index) {
@@ -552,6 +603,7 @@ void inline HashGridStorage::destroy(point_pointer index) { delete index; }
 
 unsigned int inline HashGridStorage::store(point_pointer index) {
   list.push_back(index);
+  modificationCount++;
   return static_cast<unsigned int>(map[index] = static_cast<unsigned int>(list.size() - 1));
 }
 
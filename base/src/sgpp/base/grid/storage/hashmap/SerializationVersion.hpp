@@ -20,7 +20,13 @@
  * Version 7: PointDistribution changed from enum to enum class
  * Version 8: Add custom boundaryLevel (>= 1) for LinearBoundaryGrid etc.
  * Version 9: Remove PointDistribution again, include Clenshaw-Curtis points in Stretching
+ * Version 10: same as Ver 9, but the grid points are stored in a compact binary encoding
+ *         (varint-encoded levels and indices of the dimensions that differ from the previous
+ *         point); needs binary streams, NOT THE DEFAULT
  */
 #define SERIALIZATION_VERSION 9
 
+/// newest version that can be read (and written on request)
+#define SERIALIZATION_VERSION_BINARY 10
+
 #endif /* SERIALIZATIONVERSION_HPP */
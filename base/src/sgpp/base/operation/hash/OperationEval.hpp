@@ -59,6 +59,31 @@ class OperationEval {
       value[j] = eval(curAlpha, point);
     }
   }
+
+  /**
+   * Evaluates multiple linear combinations at multiple points.
+   * Implementations may process the points in parallel.
+   *
+   * @param      alpha  coefficient matrix (each column is a coefficient vector)
+   * @param      points evaluation points (row-wise)
+   * @param[out] value  values of the linear combinations (the j-th row contains
+   *                    the values at the j-th point)
+   */
+  virtual void eval(const DataMatrix& alpha,
+                    const DataMatrix& points,
+                    DataMatrix& value) {
+    const size_t m = points.getNrows();
+    DataVector curPoint(points.getNcols());
+    DataVector curValue(alpha.getNcols());
+
+    value.resize(m, alpha.getNcols());
+
+    for (size_t j = 0; j < m; j++) {
+      points.getRow(j, curPoint);
+      eval(alpha, curPoint, curValue);
+      value.setRow(j, curValue);
+    }
+  }
 };
 
 }  // namespace base
@@ -9,68 +9,26 @@
 namespace sgpp {
 namespace base {
 
-double OperationEvalBsplineClenshawCurtisNaive::eval(
-  const DataVector& alpha, const DataVector& point) {
-  const size_t n = storage.getSize();
-  const size_t d = storage.getDimension();
-  double result = 0.0;
-
+double OperationEvalBsplineClenshawCurtisNaive::eval(const DataVector& alpha,
+                                                     const DataVector& point) {
   pointInUnitCube = point;
   storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
-
-  for (size_t i = 0; i < n; i++) {
-    const GridPoint& gp = storage[i];
-    double curValue = 1.0;
-
-    for (size_t t = 0; t < d; t++) {
-      const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]);
-
-      if (val1d == 0.0) {
-        curValue = 0.0;
-        break;
-      }
-
-      curValue *= val1d;
-    }
-
-    result += alpha[i] * curValue;
-  }
-
-  return result;
+  return algorithm.eval(base, alpha, pointInUnitCube);
 }
 
 void OperationEvalBsplineClenshawCurtisNaive::eval(const DataMatrix& alpha,
-                                                   const DataVector& point,
-                                                   DataVector& value) {
-  const size_t n = storage.getSize();
-  const size_t d = storage.getDimension();
-  const size_t m = alpha.getNcols();
-
+                                                   const DataVector& point, DataVector& value) {
   pointInUnitCube = point;
   storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
+  algorithm.eval(base, alpha, pointInUnitCube, value);
+}
 
-  value.resize(m);
-  value.setAll(0.0);
-
-  for (size_t i = 0; i < n; i++) {
-    const GridPoint& gp = storage[i];
-    double curValue = 1.0;
-
-    for (size_t t = 0; t < d; t++) {
-      const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]);
-
-      if (val1d == 0.0) {
-        curValue = 0.0;
-        break;
-      }
-
-      curValue *= val1d;
-    }
-
-    for (size_t j = 0; j < m; j++) {
-      value[j] += alpha(i, j) * curValue;
-    }
-  }
+void OperationEvalBsplineClenshawCurtisNaive::eval(const DataMatrix& alpha,
+                                                   const DataMatrix& points,
+                                                   DataMatrix& value) {
+  DataMatrix pointsInUnitCube(points);
+  storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
+  algorithm.eval(base.getDegree(), alpha, pointsInUnitCube, value);
 }
 
 }  // namespace base
@@ -8,6 +8,7 @@
 
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/operation/hash/OperationEval.hpp>
+#include <sgpp/base/algorithm/AlgorithmLocalSupportEvaluation.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
@@ -28,7 +29,8 @@ class OperationEvalBsplineNaive : public OperationEval {
    * @param degree    B-spline degree
    */
   OperationEvalBsplineNaive(GridStorage& storage, size_t degree) :
-    storage(storage), base(degree), pointInUnitCube(storage.getDimension()) {
+    storage(storage), base(degree), pointInUnitCube(storage.getDimension()),
+    algorithm(storage, (static_cast<double>(base.getDegree()) + 1.0) / 2.0) {
   }
 
   /**
@@ -52,6 +54,14 @@ class OperationEvalBsplineNaive : public OperationEval {
   void eval(const DataMatrix& alpha, const DataVector& point,
             DataVector& value) override;
 
+  /**
+   * @param      alpha  coefficient matrix (each column is a coefficient vector)
+   * @param      points evaluation points (row-wise)
+   * @param[out] value  values of linear combination (row-wise)
+   */
+  void eval(const DataMatrix& alpha, const DataMatrix& points,
+            DataMatrix& value) override;
+
  protected:
   /// storage of the sparse grid
   GridStorage& storage;
@@ -59,6 +69,8 @@ class OperationEvalBsplineNaive : public OperationEval {
   SBsplineBase base;
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
+  /// evaluation of the basis functions whose support contains the point
+  AlgorithmLocalSupportEvaluation<SBsplineBase> algorithm;
 };
 
 }  // namespace base
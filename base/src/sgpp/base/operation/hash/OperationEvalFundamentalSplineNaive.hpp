@@ -8,9 +8,13 @@
 
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/operation/hash/OperationEval.hpp>
+#include <sgpp/base/algorithm/AlgorithmLocalSupportEvaluation.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/FundamentalSplineBasis.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+
+#include <limits>
 
 namespace sgpp {
 namespace base {
@@ -27,7 +31,8 @@ class OperationEvalFundamentalSplineNaive : public OperationEval {
    * @param degree    B-spline degree
    */
   OperationEvalFundamentalSplineNaive(GridStorage& storage, size_t degree) :
-    storage(storage), base(degree), pointInUnitCube(storage.getDimension()) {
+    storage(storage), base(degree), pointInUnitCube(storage.getDimension()),
+    algorithm(storage, std::numeric_limits<double>::infinity()) {
   }
 
   /**
@@ -51,6 +56,14 @@ class OperationEvalFundamentalSplineNaive : public OperationEval {
   void eval(const DataMatrix& alpha, const DataVector& point,
             DataVector& value) override;
 
+  /**
+   * @param      alpha  coefficient matrix (each column is a coefficient vector)
+   * @param      points evaluation points (row-wise)
+   * @param[out] value  values of linear combination (row-wise)
+   */
+  void eval(const DataMatrix& alpha, const DataMatrix& points,
+            DataMatrix& value) override;
+
  protected:
   /// storage of the sparse grid
   GridStorage& storage;
@@ -58,6 +71,8 @@ class OperationEvalFundamentalSplineNaive : public OperationEval {
   SFundamentalSplineBase base;
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
+  /// evaluation of the basis functions whose support contains the point
+  AlgorithmLocalSupportEvaluation<SFundamentalSplineBase> algorithm;
 };
 
 }  // namespace base
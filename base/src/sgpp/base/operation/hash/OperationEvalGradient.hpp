@@ -66,6 +66,34 @@ class OperationEvalGradient {
     }
   }
 
+  /**
+   * Evaluates the linear combination and its gradient at multiple points.
+   * Implementations may process the points in parallel.
+   *
+   * @param       alpha     coefficient vector
+   * @param       points    evaluation points (row-wise)
+   * @param[out]  value     values of the linear combination at the points
+   * @param[out]  gradient  gradients of the linear combination at the points (row-wise)
+   */
+  virtual void evalGradient(const DataVector& alpha,
+                            const DataMatrix& points,
+                            DataVector& value,
+                            DataMatrix& gradient) {
+    const size_t d = points.getNcols();
+    const size_t m = points.getNrows();
+    DataVector curPoint(d);
+    DataVector curGradient(d);
+
+    value.resize(m);
+    gradient.resize(m, d);
+
+    for (size_t j = 0; j < m; j++) {
+      points.getRow(j, curPoint);
+      value[j] = evalGradient(alpha, curPoint, curGradient);
+      gradient.setRow(j, curGradient);
+    }
+  }
+
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
 };
@@ -8,6 +8,7 @@
 
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/operation/hash/OperationEvalGradient.hpp>
+#include <sgpp/base/algorithm/AlgorithmLocalSupportEvaluation.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineBoundaryBasis.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
@@ -31,7 +32,8 @@ class OperationEvalGradientBsplineBoundaryNaive : public
     storage(storage),
     base(degree),
     pointInUnitCube(storage.getDimension()),
-    innerDerivative(storage.getDimension()) {
+    innerDerivative(storage.getDimension()),
+    algorithm(storage, (static_cast<double>(base.getDegree()) + 1.0) / 2.0) {
   }
 
   /**
@@ -61,6 +63,17 @@ class OperationEvalGradientBsplineBoundaryNaive : public
                     DataVector& value,
                     DataMatrix& gradient) override;
 
+  /**
+   * @param       alpha     coefficient vector
+   * @param       points    evaluation points (row-wise)
+   * @param[out]  value     values of the linear combination at the points
+   * @param[out]  gradient  gradients of the linear combination at the points (row-wise)
+   */
+  void evalGradient(const DataVector& alpha,
+                    const DataMatrix& points,
+                    DataVector& value,
+                    DataMatrix& gradient) override;
+
  protected:
   /// storage of the sparse grid
   GridStorage& storage;
@@ -70,6 +83,8 @@ class OperationEvalGradientBsplineBoundaryNaive : public
   DataVector pointInUnitCube;
   /// inner derivative (temporary vector)
   DataVector innerDerivative;
+  /// evaluation of the basis functions whose support contains the point
+  AlgorithmLocalSupportEvaluation<SBsplineBoundaryBase> algorithm;
 };
 
 }  // namespace base
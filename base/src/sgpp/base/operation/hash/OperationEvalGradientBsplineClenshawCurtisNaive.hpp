@@ -8,6 +8,7 @@
 
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/operation/hash/OperationEvalGradient.hpp>
+#include <sgpp/base/algorithm/AlgorithmLocalSupportEvaluation.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineClenshawCurtisBasis.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
@@ -32,7 +33,8 @@ class OperationEvalGradientBsplineClenshawCurtisNaive :
     storage(storage),
     base(degree),
     pointInUnitCube(storage.getDimension()),
-    innerDerivative(storage.getDimension()) {
+    innerDerivative(storage.getDimension()),
+    algorithm(storage, (static_cast<double>(base.getDegree()) + 1.0) / 2.0, 0, true) {
   }
 
   /**
@@ -62,6 +64,17 @@ class OperationEvalGradientBsplineClenshawCurtisNaive :
                     DataVector& value,
                     DataMatrix& gradient) override;
 
+  /**
+   * @param       alpha     coefficient vector
+   * @param       points    evaluation points (row-wise)
+   * @param[out]  value     values of the linear combination at the points
+   * @param[out]  gradient  gradients of the linear combination at the points (row-wise)
+   */
+  void evalGradient(const DataVector& alpha,
+                    const DataMatrix& points,
+                    DataVector& value,
+                    DataMatrix& gradient) override;
+
  protected:
   /// storage of the sparse grid
   GridStorage& storage;
@@ -71,6 +84,8 @@ class OperationEvalGradientBsplineClenshawCurtisNaive :
   DataVector pointInUnitCube;
   /// inner derivative (temporary vector)
   DataVector innerDerivative;
+  /// evaluation of the basis functions whose support contains the point
+  AlgorithmLocalSupportEvaluation<SBsplineClenshawCurtisBase> algorithm;
 };
 
 }  // namespace base
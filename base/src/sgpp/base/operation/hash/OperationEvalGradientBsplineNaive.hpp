@@ -8,6 +8,7 @@
 
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/operation/hash/OperationEvalGradient.hpp>
+#include <sgpp/base/algorithm/AlgorithmLocalSupportEvaluation.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
@@ -30,7 +31,8 @@ class OperationEvalGradientBsplineNaive : public OperationEvalGradient {
     storage(storage),
     base(degree),
     pointInUnitCube(storage.getDimension()),
-    innerDerivative(storage.getDimension()) {
+    innerDerivative(storage.getDimension()),
+    algorithm(storage, (static_cast<double>(base.getDegree()) + 1.0) / 2.0) {
   }
 
   /**
@@ -60,6 +62,17 @@ class OperationEvalGradientBsplineNaive : public OperationEvalGradient {
                     DataVector& value,
                     DataMatrix& gradient) override;
 
+  /**
+   * @param       alpha     coefficient vector
+   * @param       points    evaluation points (row-wise)
+   * @param[out]  value     values of the linear combination at the points
+   * @param[out]  gradient  gradients of the linear combination at the points (row-wise)
+   */
+  void evalGradient(const DataVector& alpha,
+                    const DataMatrix& points,
+                    DataVector& value,
+                    DataMatrix& gradient) override;
+
  protected:
   /// storage of the sparse grid
   GridStorage& storage;
@@ -69,6 +82,8 @@ class OperationEvalGradientBsplineNaive : public OperationEvalGradient {
   DataVector pointInUnitCube;
   /// inner derivative (temporary vector)
   DataVector innerDerivative;
+  /// evaluation of the basis functions whose support contains the point
+  AlgorithmLocalSupportEvaluation<SBsplineBase> algorithm;
 };
 
 }  // namespace base
@@ -8,10 +8,13 @@
 
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/operation/hash/OperationEvalGradient.hpp>
+#include <sgpp/base/algorithm/AlgorithmLocalSupportEvaluation.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/FundamentalNakSplineBasis.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
+#include <limits>
+
 namespace sgpp {
 namespace base {
 
@@ -32,7 +35,8 @@ class OperationEvalGradientFundamentalNakSplineNaive : public
     storage(storage),
     base(degree),
     pointInUnitCube(storage.getDimension()),
-    innerDerivative(storage.getDimension()) {
+    innerDerivative(storage.getDimension()),
+    algorithm(storage, std::numeric_limits<double>::infinity()) {
   }
 
   /**
@@ -62,6 +66,17 @@ class OperationEvalGradientFundamentalNakSplineNaive : public
                     DataVector& value,
                     DataMatrix& gradient) override;
 
+  /**
+   * @param       alpha     coefficient vector
+   * @param       points    evaluation points (row-wise)
+   * @param[out]  value     values of the linear combination at the points
+   * @param[out]  gradient  gradients of the linear combination at the points (row-wise)
+   */
+  void evalGradient(const DataVector& alpha,
+                    const DataMatrix& points,
+                    DataVector& value,
+                    DataMatrix& gradient) override;
+
  protected:
   /// storage of the sparse grid
   GridStorage& storage;
@@ -71,6 +86,8 @@ class OperationEvalGradientFundamentalNakSplineNaive : public
   DataVector pointInUnitCube;
   /// inner derivative (temporary vector)
   DataVector innerDerivative;
+  /// evaluation of the basis functions whose support contains the point
+  AlgorithmLocalSupportEvaluation<SFundamentalNakSplineBase> algorithm;
 };
 
 }  // namespace base
@@ -77,6 +77,39 @@ class OperationEvalHessian {
       gradient.setRow(j, curGradient);
     }
   }
+
+  /**
+   * Evaluates the linear combination, its gradient and its Hessian at multiple points.
+   * Implementations may process the points in parallel.
+   *
+   * @param       alpha     coefficient vector
+   * @param       points    evaluation points (row-wise)
+   * @param[out]  value     values of the linear combination at the points
+   * @param[out]  gradient  gradients of the linear combination at the points (row-wise)
+   * @param[out]  hessian   Hessians of the linear combination at the points
+   */
+  virtual void evalHessian(const DataVector& alpha,
+                           const DataMatrix& points,
+                           DataVector& value,
+                           DataMatrix& gradient,
+                           std::vector<DataMatrix>& hessian) {
+    const size_t d = points.getNcols();
+    const size_t m = points.getNrows();
+    DataVector curPoint(d);
+    DataVector curGradient(d);
+
+    value.resize(m);
+    gradient.resize(m, d);
+    hessian.resize(m);
+
+    for (size_t j = 0; j < m; j++) {
+      points.getRow(j, curPoint);
+      hessian[j].resize(d, d);
+      value[j] = evalHessian(alpha, curPoint, curGradient, hessian[j]);
+      gradient.setRow(j, curGradient);
+    }
+  }
+
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
 };
@@ -8,6 +8,7 @@
 
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/operation/hash/OperationEvalHessian.hpp>
+#include <sgpp/base/algorithm/AlgorithmLocalSupportEvaluation.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineBoundaryBasis.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
@@ -35,7 +36,8 @@ class OperationEvalHessianBsplineBoundaryNaive : public
     storage(storage),
     base(degree),
     pointInUnitCube(storage.getDimension()),
-    innerDerivative(storage.getDimension()) {
+    innerDerivative(storage.getDimension()),
+    algorithm(storage, (static_cast<double>(base.getDegree()) + 1.0) / 2.0) {
   }
 
   /**
@@ -69,6 +71,19 @@ class OperationEvalHessianBsplineBoundaryNaive : public
                    DataMatrix& gradient,
                    std::vector<DataMatrix>& hessian) override;
 
+  /**
+   * @param       alpha     coefficient vector
+   * @param       points    evaluation points (row-wise)
+   * @param[out]  value     values of the linear combination at the points
+   * @param[out]  gradient  gradients of the linear combination at the points (row-wise)
+   * @param[out]  hessian   Hessians of the linear combination at the points
+   */
+  void evalHessian(const DataVector& alpha,
+                   const DataMatrix& points,
+                   DataVector& value,
+                   DataMatrix& gradient,
+                   std::vector<DataMatrix>& hessian) override;
+
  protected:
   /// storage of the sparse grid
   GridStorage& storage;
@@ -78,6 +93,8 @@ class OperationEvalHessianBsplineBoundaryNaive : public
   DataVector pointInUnitCube;
   /// inner derivative (temporary vector)
   DataVector innerDerivative;
+  /// evaluation of the basis functions whose support contains the point
+  AlgorithmLocalSupportEvaluation<SBsplineBoundaryBase> algorithm;
 };
 
 }  // namespace base
@@ -8,6 +8,7 @@
 
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/operation/hash/OperationEvalHessian.hpp>
+#include <sgpp/base/algorithm/AlgorithmLocalSupportEvaluation.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
@@ -34,7 +35,8 @@ class OperationEvalHessianBsplineNaive : public OperationEvalHessian {
     storage(storage),
     base(degree),
     pointInUnitCube(storage.getDimension()),
-    innerDerivative(storage.getDimension()) {
+    innerDerivative(storage.getDimension()),
+    algorithm(storage, (static_cast<double>(base.getDegree()) + 1.0) / 2.0) {
   }
 
   /**
@@ -68,6 +70,19 @@ class OperationEvalHessianBsplineNaive : public OperationEvalHessian {
                    DataMatrix& gradient,
                    std::vector<DataMatrix>& hessian) override;
 
+  /**
+   * @param       alpha     coefficient vector
+   * @param       points    evaluation points (row-wise)
+   * @param[out]  value     values of the linear combination at the points
+   * @param[out]  gradient  gradients of the linear combination at the points (row-wise)
+   * @param[out]  hessian   Hessians of the linear combination at the points
+   */
+  void evalHessian(const DataVector& alpha,
+                   const DataMatrix& points,
+                   DataVector& value,
+                   DataMatrix& gradient,
+                   std::vector<DataMatrix>& hessian) override;
+
  protected:
   /// storage of the sparse grid
   GridStorage& storage;
@@ -77,6 +92,8 @@ class OperationEvalHessianBsplineNaive : public OperationEvalHessian {
   DataVector pointInUnitCube;
   /// inner derivative (temporary vector)
   DataVector innerDerivative;
+  /// evaluation of the basis functions whose support contains the point
+  AlgorithmLocalSupportEvaluation<SBsplineBase> algorithm;
 };
 
 }  // namespace base
@@ -8,11 +8,13 @@
 
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/operation/hash/OperationEvalHessian.hpp>
+#include <sgpp/base/algorithm/AlgorithmLocalSupportEvaluation.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/FundamentalNakSplineBasis.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 
+#include <limits>
 #include <vector>
 
 namespace sgpp {
@@ -35,7 +37,8 @@ class OperationEvalHessianFundamentalNakSplineNaive : public
     storage(storage),
     base(degree),
     pointInUnitCube(storage.getDimension()),
-    innerDerivative(storage.getDimension()) {
+    innerDerivative(storage.getDimension()),
+    algorithm(storage, std::numeric_limits<double>::infinity()) {
   }
 
   /**
@@ -69,6 +72,19 @@ class OperationEvalHessianFundamentalNakSplineNaive : public
                    DataMatrix& gradient,
                    std::vector<DataMatrix>& hessian) override;
 
+  /**
+   * @param       alpha     coefficient vector
+   * @param       points    evaluation points (row-wise)
+   * @param[out]  value     values of the linear combination at the points
+   * @param[out]  gradient  gradients of the linear combination at the points (row-wise)
+   * @param[out]  hessian   Hessians of the linear combination at the points
+   */
+  void evalHessian(const DataVector& alpha,
+                   const DataMatrix& points,
+                   DataVector& value,
+                   DataMatrix& gradient,
+                   std::vector<DataMatrix>& hessian) override;
+
  protected:
   /// storage of the sparse grid
   GridStorage& storage;
@@ -78,6 +94,8 @@ class OperationEvalHessianFundamentalNakSplineNaive : public
   DataVector pointInUnitCube;
   /// inner derivative (temporary vector)
   DataVector innerDerivative;
+  /// evaluation of the basis functions whose support contains the point
+  AlgorithmLocalSupportEvaluation<SFundamentalNakSplineBase> algorithm;
 };
 
 }  // namespace base
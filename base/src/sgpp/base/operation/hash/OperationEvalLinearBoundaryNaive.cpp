@@ -5,6 +5,9 @@
 
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/operation/hash/OperationEvalLinearBoundaryNaive.hpp>
+#include <sgpp/base/algorithm/AlgorithmMultipleOutputEvaluation.hpp>
+
+#include <utility>
 
 namespace sgpp {
 namespace base {
@@ -44,13 +47,11 @@ void OperationEvalLinearBoundaryNaive::eval(const DataMatrix& alpha,
                                             DataVector& value) {
   const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
-  const size_t m = alpha.getNcols();
 
   pointInUnitCube = point;
   storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
 
-  value.resize(m);
-  value.setAll(0.0);
+  basisValues.clear();
 
   for (size_t i = 0; i < n; i++) {
     const GridPoint& gp = storage[i];
@@ -67,10 +68,12 @@ void OperationEvalLinearBoundaryNaive::eval(const DataMatrix& alpha,
       curValue *= val1d;
     }
 
-    for (size_t j = 0; j < m; j++) {
-      value[j] += alpha(i, j) * curValue;
+    if (curValue != 0.0) {
+      basisValues.push_back(std::make_pair(i, curValue));
     }
   }
+
+  AlgorithmMultipleOutputEvaluation::eval(alpha, basisValues, value);
 }
 
 }  // namespace base
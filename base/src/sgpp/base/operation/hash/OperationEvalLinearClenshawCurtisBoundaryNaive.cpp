@@ -4,9 +4,12 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/base/operation/hash/OperationEvalLinearClenshawCurtisBoundaryNaive.hpp>
+#include <sgpp/base/algorithm/AlgorithmMultipleOutputEvaluation.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <utility>
+
 namespace sgpp {
 namespace base {
 
@@ -45,13 +48,11 @@ void OperationEvalLinearClenshawCurtisBoundaryNaive::eval(const DataMatrix& alph
                                        DataVector& value) {
   const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
-  const size_t m = alpha.getNcols();
 
   pointInUnitCube = point;
   storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
 
-  value.resize(m);
-  value.setAll(0.0);
+  basisValues.clear();
 
   for (size_t i = 0; i < n; i++) {
     const GridPoint& gp = storage[i];
@@ -68,10 +69,12 @@ void OperationEvalLinearClenshawCurtisBoundaryNaive::eval(const DataMatrix& alph
       curValue *= val1d;
     }
 
-    for (size_t j = 0; j < m; j++) {
-      value[j] += alpha(i, j) * curValue;
+    if (curValue != 0.0) {
+      basisValues.push_back(std::make_pair(i, curValue));
     }
   }
+
+  AlgorithmMultipleOutputEvaluation::eval(alpha, basisValues, value);
 }
 
 }  // namespace base
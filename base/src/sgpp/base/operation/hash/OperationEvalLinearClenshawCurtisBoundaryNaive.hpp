@@ -11,6 +11,9 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearClenshawCurtisBoundaryBasis.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace sgpp {
 namespace base {
 
@@ -50,6 +53,8 @@ class OperationEvalLinearClenshawCurtisBoundaryNaive : public OperationEval {
   SLinearClenshawCurtisBoundaryBase base;
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
+  /// non-zero basis functions at the evaluation point (temporary vector)
+  std::vector<std::pair<size_t, double>> basisValues;
 };
 
 }  // namespace base
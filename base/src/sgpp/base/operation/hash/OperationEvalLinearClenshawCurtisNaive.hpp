@@ -12,6 +12,9 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearClenshawCurtisBasis.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace sgpp {
 namespace base {
 
@@ -48,6 +51,8 @@ class OperationEvalLinearClenshawCurtisNaive : public OperationEval {
   SLinearClenshawCurtisBase base;
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
+  /// non-zero basis functions at the evaluation point (temporary vector)
+  std::vector<std::pair<size_t, double>> basisValues;
 };
 
 }  // namespace base
@@ -12,6 +12,9 @@
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace sgpp {
 namespace base {
 
@@ -54,6 +57,8 @@ class OperationEvalLinearNaive : public OperationEval {
   SLinearBase base;
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
+  /// non-zero basis functions at the evaluation point (temporary vector)
+  std::vector<std::pair<size_t, double>> basisValues;
 };
 
 }  // namespace base
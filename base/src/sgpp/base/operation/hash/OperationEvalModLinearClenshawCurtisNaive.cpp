@@ -4,6 +4,9 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/base/operation/hash/OperationEvalModLinearClenshawCurtisNaive.hpp>
+#include <sgpp/base/algorithm/AlgorithmMultipleOutputEvaluation.hpp>
+
+#include <utility>
 
 namespace sgpp {
 namespace base {
@@ -42,13 +45,11 @@ void OperationEvalModLinearClenshawCurtisNaive::eval(const DataMatrix& alpha,
                                                      const DataVector& point, DataVector& value) {
   const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
-  const size_t m = alpha.getNcols();
 
   pointInUnitCube = point;
   storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
 
-  value.resize(m);
-  value.setAll(0.0);
+  basisValues.clear();
 
   for (size_t i = 0; i < n; i++) {
     const GridPoint& gp = storage[i];
@@ -65,10 +66,12 @@ void OperationEvalModLinearClenshawCurtisNaive::eval(const DataMatrix& alpha,
       curValue *= val1d;
     }
 
-    for (size_t j = 0; j < m; j++) {
-      value[j] += alpha(i, j) * curValue;
+    if (curValue != 0.0) {
+      basisValues.push_back(std::make_pair(i, curValue));
     }
   }
+
+  AlgorithmMultipleOutputEvaluation::eval(alpha, basisValues, value);
 }
 
 }  // namespace base
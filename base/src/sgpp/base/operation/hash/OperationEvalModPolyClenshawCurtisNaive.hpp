@@ -12,6 +12,9 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/operation/hash/common/basis/PolyModifiedClenshawCurtisBasis.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace sgpp {
 namespace base {
 
@@ -49,6 +52,8 @@ class OperationEvalModPolyClenshawCurtisNaive : public OperationEval {
   SPolyModifiedClenshawCurtisBase base;
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
+  /// non-zero basis functions at the evaluation point (temporary vector)
+  std::vector<std::pair<size_t, double>> basisValues;
 };
 
 }  // namespace base
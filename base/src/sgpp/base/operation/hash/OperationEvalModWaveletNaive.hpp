@@ -12,6 +12,9 @@
 #include <sgpp/base/operation/hash/common/basis/WaveletModifiedBasis.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace sgpp {
 namespace base {
 
@@ -57,6 +60,8 @@ class OperationEvalModWaveletNaive : public OperationEval {
   SWaveletModifiedBase base;
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
+  /// non-zero basis functions at the evaluation point (temporary vector)
+  std::vector<std::pair<size_t, double>> basisValues;
 };
 
 }  // namespace base
@@ -8,9 +8,13 @@
 
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/operation/hash/OperationEval.hpp>
+#include <sgpp/base/algorithm/AlgorithmLocalSupportEvaluation.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/WeaklyFundamentalNakSplineBasis.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+
+#include <limits>
 
 namespace sgpp {
 namespace base {
@@ -28,7 +32,8 @@ class OperationEvalWeaklyFundamentalNakSplineBoundaryNaive : public OperationEva
    * @param degree    B-spline degree
    */
   OperationEvalWeaklyFundamentalNakSplineBoundaryNaive(GridStorage& storage, size_t degree) :
-    storage(storage), base(degree), pointInUnitCube(storage.getDimension()) {
+    storage(storage), base(degree), pointInUnitCube(storage.getDimension()),
+    algorithm(storage, std::numeric_limits<double>::infinity()) {
   }
 
   /**
@@ -52,6 +57,14 @@ class OperationEvalWeaklyFundamentalNakSplineBoundaryNaive : public OperationEva
   void eval(const DataMatrix& alpha, const DataVector& point,
             DataVector& value) override;
 
+  /**
+   * @param      alpha  coefficient matrix (each column is a coefficient vector)
+   * @param      points evaluation points (row-wise)
+   * @param[out] value  values of linear combination (row-wise)
+   */
+  void eval(const DataMatrix& alpha, const DataMatrix& points,
+            DataMatrix& value) override;
+
  protected:
   /// storage of the sparse grid
   GridStorage& storage;
@@ -59,6 +72,8 @@ class OperationEvalWeaklyFundamentalNakSplineBoundaryNaive : public OperationEva
   SWeaklyFundamentalNakSplineBase base;
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
+  /// evaluation of the basis functions whose support contains the point
+  AlgorithmLocalSupportEvaluation<SWeaklyFundamentalNakSplineBase> algorithm;
 };
 
 }  // namespace base
@@ -101,6 +101,50 @@ class OperationMultipleEval {
     throw sgpp::base::not_implemented_exception();
   }
 
+  /**
+   * Multiplication of @f$B^T@f$ with several vectors at once, e.g., the coefficient vectors of
+   * several functions on the same grid.
+   * This default implementation multiplies one column after another, kernels may override it to
+   * evaluate the basis functions only once per data point.
+   *
+   * @param alphas matrix whose columns are the vectors, to which @f$B@f$ is applied
+   * @param results the results of the matrix vector multiplications, one per column
+   * (resized if necessary)
+   */
+  virtual void multMultiple(DataMatrix& alphas, DataMatrix& results) {
+    DataVector alpha(alphas.getNrows());
+    DataVector result(dataset.getNrows());
+    results.resizeZero(dataset.getNrows(), alphas.getNcols());
+
+    for (size_t j = 0; j < alphas.getNcols(); j++) {
+      alphas.getColumn(j, alpha);
+      this->mult(alpha, result);
+      results.setColumn(j, result);
+    }
+  }
+
+  /**
+   * Multiplication of @f$B@f$ with several vectors at once, e.g., the indicator vectors of
+   * several subsets of the data set.
+   * This default implementation multiplies one column after another, kernels may override it to
+   * evaluate the basis functions only once per data point.
+   *
+   * @param sources matrix whose columns are the vectors, to which @f$B^T@f$ is applied
+   * @param results the results of the matrix vector multiplications, one per column
+   * (resized if necessary)
+   */
+  virtual void multTransposeMultiple(DataMatrix& sources, DataMatrix& results) {
+    DataVector source(sources.getNrows());
+    DataVector result(grid.getSize());
+    results.resizeZero(grid.getSize(), sources.getNcols());
+
+    for (size_t j = 0; j < sources.getNcols(); j++) {
+      sources.getColumn(j, source);
+      this->multTranspose(source, result);
+      results.setColumn(j, result);
+    }
+  }
+
   /**
    * Evaluate multiple datapoints with the specified grid
    *
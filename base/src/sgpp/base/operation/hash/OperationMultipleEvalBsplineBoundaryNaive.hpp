@@ -6,6 +6,7 @@
 #pragma once
 
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/algorithm/AlgorithmLocalSupportEvaluation.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineBoundaryBasis.hpp>
 
@@ -17,7 +18,10 @@ namespace base {
 class OperationMultipleEvalBsplineBoundaryNaive : public OperationMultipleEval {
  public:
   OperationMultipleEvalBsplineBoundaryNaive(Grid& grid, size_t degree, DataMatrix& dataset)
-      : OperationMultipleEval(grid, dataset), storage(grid.getStorage()), base(degree) {}
+      : OperationMultipleEval(grid, dataset),
+        storage(grid.getStorage()),
+        base(degree),
+        algorithm(storage, (static_cast<double>(base.getDegree()) + 1.0) / 2.0) {}
 
   ~OperationMultipleEvalBsplineBoundaryNaive() override {}
 
@@ -33,6 +37,8 @@ class OperationMultipleEvalBsplineBoundaryNaive : public OperationMultipleEval {
   SBsplineBoundaryBase base;
   /// untransformed evaluation point (temporary vector)
   DataMatrix pointsInUnitCube;
+  /// evaluation of the basis functions whose support contains the points
+  AlgorithmLocalSupportEvaluation<SBsplineBoundaryBase> algorithm;
 };
 
 }  // namespace base
@@ -7,6 +7,7 @@
 #define OPERATIONMULTIPLEEVALBSPLINENAIVE_HPP
 
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/algorithm/AlgorithmLocalSupportEvaluation.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
 
@@ -18,7 +19,10 @@ namespace base {
 class OperationMultipleEvalBsplineNaive : public OperationMultipleEval {
  public:
   OperationMultipleEvalBsplineNaive(Grid& grid, size_t degree, DataMatrix& dataset)
-      : OperationMultipleEval(grid, dataset), storage(grid.getStorage()), base(degree) {}
+      : OperationMultipleEval(grid, dataset),
+        storage(grid.getStorage()),
+        base(degree),
+        algorithm(storage, (static_cast<double>(base.getDegree()) + 1.0) / 2.0) {}
 
   ~OperationMultipleEvalBsplineNaive() override {}
 
@@ -34,6 +38,8 @@ class OperationMultipleEvalBsplineNaive : public OperationMultipleEval {
   SBsplineBase base;
   /// untransformed evaluation point (temporary vector)
   DataMatrix pointsInUnitCube;
+  /// evaluation of the basis functions whose support contains the points
+  AlgorithmLocalSupportEvaluation<SBsplineBase> algorithm;
 };
 
 }  // namespace base
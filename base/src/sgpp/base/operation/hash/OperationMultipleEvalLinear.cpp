@@ -26,6 +26,23 @@ void OperationMultipleEvalLinear::multTranspose(DataVector& alpha, DataVector& r
   op.mult_transpose(storage, base, alpha, this->dataset, result);
 }
 
+void OperationMultipleEvalLinear::multMultiple(DataMatrix& alphas, DataMatrix& results) {
+  AlgorithmMultipleEvaluation<SLinearBase> op;
+  LinearBasis<unsigned int, unsigned int> base;
+
+  results.resizeZero(this->dataset.getNrows(), alphas.getNcols());
+  op.mult(storage, base, alphas, this->dataset, results);
+}
+
+void OperationMultipleEvalLinear::multTransposeMultiple(DataMatrix& sources,
+                                                        DataMatrix& results) {
+  AlgorithmMultipleEvaluation<SLinearBase> op;
+  LinearBasis<unsigned int, unsigned int> base;
+
+  results.resizeZero(storage.getSize(), sources.getNcols());
+  op.mult_transpose(storage, base, sources, this->dataset, results);
+}
+
 double OperationMultipleEvalLinear::getDuration() { return 0.0; }
 
 }  // namespace base
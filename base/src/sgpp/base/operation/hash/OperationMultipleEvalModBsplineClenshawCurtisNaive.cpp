@@ -12,67 +12,16 @@ namespace base {
 
 void OperationMultipleEvalModBsplineClenshawCurtisNaive::mult(DataVector& alpha,
                                                               DataVector& result) {
-  const size_t n = storage.getSize();
-  const size_t d = storage.getDimension();
-  const size_t m = dataset.getNrows();
-
-  result.setAll(0.0);
-
   pointsInUnitCube = dataset;
   storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
-
-  for (size_t j = 0; j < m; j++) {
-    for (size_t i = 0; i < n; i++) {
-      const GridPoint& gp = storage[i];
-      double curValue = 1.0;
-
-      for (size_t t = 0; t < d; t++) {
-        const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointsInUnitCube(j, t));
-
-        if (val1d == 0.0) {
-          curValue = 0.0;
-          break;
-        }
-
-        curValue *= val1d;
-      }
-
-      result[j] += alpha[i] * curValue;
-    }
-  }
+  algorithm.mult(base.getDegree(), alpha, pointsInUnitCube, result);
 }
 
-void OperationMultipleEvalModBsplineClenshawCurtisNaive::multTranspose(DataVector& alpha,
+void OperationMultipleEvalModBsplineClenshawCurtisNaive::multTranspose(DataVector& source,
                                                                        DataVector& result) {
-  const size_t n = storage.getSize();
-  const size_t d = storage.getDimension();
-  const size_t m = dataset.getNrows();
-
-  result.setAll(0.0);
-
   pointsInUnitCube = dataset;
   storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
-
-  for (size_t i = 0; i < n; i++) {
-    const GridPoint& gp = storage[i];
-
-    for (size_t j = 0; j < m; j++) {
-      double curValue = 1.0;
-
-      for (size_t t = 0; t < d; t++) {
-        const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointsInUnitCube(j, t));
-
-        if (val1d == 0.0) {
-          curValue = 0.0;
-          break;
-        }
-
-        curValue *= val1d;
-      }
-
-      result[i] += alpha[j] * curValue;
-    }
-  }
+  algorithm.multTranspose(base.getDegree(), source, pointsInUnitCube, result);
 }
 
 double OperationMultipleEvalModBsplineClenshawCurtisNaive::getDuration() { return 0.0; }
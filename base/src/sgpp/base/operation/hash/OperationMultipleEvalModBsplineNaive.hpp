@@ -7,6 +7,7 @@
 #define OPERATIONMULTIPLEEVALMODBSPLINENAIVE_HPP
 
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/algorithm/AlgorithmLocalSupportEvaluation.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineModifiedBasis.hpp>
 
@@ -18,7 +19,10 @@ namespace base {
 class OperationMultipleEvalModBsplineNaive : public OperationMultipleEval {
  public:
   OperationMultipleEvalModBsplineNaive(Grid& grid, size_t degree, DataMatrix& dataset)
-      : OperationMultipleEval(grid, dataset), storage(grid.getStorage()), base(degree) {}
+      : OperationMultipleEval(grid, dataset),
+        storage(grid.getStorage()),
+        base(degree),
+        algorithm(storage, (static_cast<double>(base.getDegree()) + 1.0) / 2.0, 1) {}
 
   ~OperationMultipleEvalModBsplineNaive() override {}
 
@@ -34,6 +38,8 @@ class OperationMultipleEvalModBsplineNaive : public OperationMultipleEval {
   SBsplineModifiedBase base;
   /// untransformed evaluation point (temporary vector)
   DataMatrix pointsInUnitCube;
+  /// evaluation of the basis functions whose support contains the points
+  AlgorithmLocalSupportEvaluation<SBsplineModifiedBase> algorithm;
 };
 
 }  // namespace base
@@ -108,10 +108,13 @@ bool Auto::solve(SLE& system, DataMatrix& B, DataMatrix& X) const {
 
     Printer::getInstance().printStatusUpdate("estimating sparsity pattern");
 
+    std::vector<size_t> columns;
+
     for (size_t i = 0; i < n; i += inc) {
       nrows++;
+      system.getRowSparsityPattern(i, columns);
 
-      for (size_t j = 0; j < n; j++) {
+      for (size_t j : columns) {
         if (system.isMatrixEntryNonZero(i, j)) {
           nnz++;
         }
@@ -15,6 +15,7 @@
 #include <cstddef>
 #include <iostream>
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace base {
@@ -89,11 +90,16 @@ bool Eigen::solve(SLE& system, DataMatrix& B, DataMatrix& X) const {
 
 #endif /* _OPENMP */
 
+    std::vector<size_t> columns;
+
 // copy system matrix to Eigen matrix object
-#pragma omp for ordered schedule(static)
+// (only entries in the sparsity pattern of the system have to be considered)
+#pragma omp for schedule(dynamic, 64)
 
     for (size_t i = 0; i < n; i++) {
-      for (size_t j = 0; j < n; j++) {
+      system2->getRowSparsityPattern(i, columns);
+
+      for (size_t j : columns) {
         A(i, j) = system2->getMatrixEntry(i, j);
 
         // count nonzero entries
@@ -134,11 +134,16 @@ bool Gmmpp::solve(SLE& system, DataVector& b, DataVector& x) const {
 
 #endif /* _OPENMP */
 
+      std::vector<size_t> columns;
+
 // copy system matrix to Gmm++ matrix object
-#pragma omp for ordered schedule(static)
+// (only entries in the sparsity pattern of the system have to be considered)
+#pragma omp for schedule(dynamic, 64)
 
       for (size_t i = 0; i < n; i++) {
-        for (size_t j = 0; j < n; j++) {
+        system2->getRowSparsityPattern(i, columns);
+
+        for (size_t j : columns) {
           double entry = system2->getMatrixEntry(i, j);
 
           if (entry != 0) {
@@ -30,10 +30,10 @@ typedef UF_long sslong;
 #endif
 
 /**
- * @param       numeric result of umfpack_dl_numeric()
- * @param       Ap      CCS column pointers
- * @param       Ai      CCS row indices
- * @param       Ax      CCS matrix entries
+ * @param       numeric result of umfpack_dl_numeric() for the transposed matrix
+ * @param       Ap      CCS column pointers of the transposed matrix
+ * @param       Ai      CCS row indices of the transposed matrix
+ * @param       Ax      CCS matrix entries of the transposed matrix
  * @param       b       right-hand side
  * @param[out]  x       solution to the system
  * @return              whether all went well (false if errors occurred)
@@ -45,7 +45,8 @@ bool solveInternal(void* numeric, const std::vector<sslong>& Ap, const std::vect
   x.resize(n);
   x.setAll(0.0);
 
-  sslong result = umfpack_dl_solve(UMFPACK_A, &Ap[0], &Ai[0], &Ax[0], x.getPointer(),
+  // solve A x = b by solving (A^T)^T x = b
+  sslong result = umfpack_dl_solve(UMFPACK_At, &Ap[0], &Ai[0], &Ax[0], x.getPointer(),
                                    b.getPointer(), numeric, nullptr, nullptr);
   return (result == UMFPACK_OK);
 }
@@ -73,15 +74,14 @@ bool UMFPACK::solve(SLE& system, DataMatrix& B, DataMatrix& X) const {
 
   const size_t n = system.getDimension();
 
-  size_t nnz = 0;
-  std::vector<uint32_t> Ti;
-  std::vector<uint32_t> Tj;
-  std::vector<double> Tx;
+  // column indices and values of the nonzero entries of each row
+  std::vector<std::vector<sslong>> rowIndices(n);
+  std::vector<std::vector<double>> rowValues(n);
   size_t rowsDone = 0;
 
 // parallelize only if the system is cloneable
 #pragma omp parallel if (system.isCloneable()) \
-shared(system, Ti, Tj, Tx, nnz, rowsDone) default(none)
+shared(system, rowIndices, rowValues, rowsDone) default(none)
   {
     SLE* system2 = &system;
 #ifdef _OPENMP
@@ -94,21 +94,21 @@ shared(system, Ti, Tj, Tx, nnz, rowsDone) default(none)
 
 #endif /* _OPENMP */
 
-    std::vector<uint32_t> curTi;
-    std::vector<uint32_t> curTj;
-    std::vector<double> curTx;
+    std::vector<size_t> columns;
 
 // get indices and values of nonzero entries
-#pragma omp for ordered schedule(static)
+// (only entries in the sparsity pattern of the system have to be considered)
+#pragma omp for schedule(dynamic, 64)
 
-    for (uint32_t i = 0; i < n; i++) {
-      for (uint32_t j = 0; j < n; j++) {
+    for (size_t i = 0; i < n; i++) {
+      system2->getRowSparsityPattern(i, columns);
+
+      for (size_t j : columns) {
         double entry = system2->getMatrixEntry(i, j);
 
         if (entry != 0) {
-          curTi.push_back(i);
-          curTj.push_back(j);
-          curTx.push_back(entry);
+          rowIndices[i].push_back(static_cast<sslong>(j));
+          rowValues[i].push_back(entry);
         }
       }
 
@@ -124,19 +124,31 @@ shared(system, Ti, Tj, Tx, nnz, rowsDone) default(none)
                                                  std::string(str) + ")");
       }
     }
-
-#pragma omp critical
-    {
-      Ti.insert(Ti.end(), curTi.begin(), curTi.end());
-      Tj.insert(Tj.end(), curTj.begin(), curTj.end());
-      Tx.insert(Tx.end(), curTx.begin(), curTx.end());
-      nnz += curTx.size();
-    }
   }
 
   Printer::getInstance().printStatusUpdate("constructing sparse matrix (100.0%)");
   Printer::getInstance().printStatusNewLine();
 
+  // compressed row storage (CRS) of the matrix,
+  // which is the compressed column storage (CCS) of the transposed matrix
+  std::vector<sslong> Ap(n + 1, 0);
+
+  for (size_t i = 0; i < n; i++) {
+    Ap[i + 1] = Ap[i] + static_cast<sslong>(rowIndices[i].size());
+  }
+
+  const size_t nnz = static_cast<size_t>(Ap[n]);
+  std::vector<sslong> Ai(nnz, 0);
+  std::vector<double> Ax(nnz, 0.0);
+
+#pragma omp parallel for
+  for (size_t i = 0; i < n; i++) {
+    std::copy(rowIndices[i].begin(), rowIndices[i].end(), Ai.begin() + Ap[i]);
+    std::copy(rowValues[i].begin(), rowValues[i].end(), Ax.begin() + Ap[i]);
+    std::vector<sslong>().swap(rowIndices[i]);
+    std::vector<double>().swap(rowValues[i]);
+  }
+
   // print ratio of nonzero entries
   {
     char str[10];
@@ -146,43 +158,13 @@ shared(system, Ti, Tj, Tx, nnz, rowsDone) default(none)
     Printer::getInstance().printStatusNewLine();
   }
 
-  std::vector<sslong> Ap(n + 1, 0);
-  std::vector<sslong> Ai(nnz, 0);
-  std::vector<double> Ax(nnz, 0.0);
-
   sslong result;
 
-  // convert matrix to CCS
-  {
-    std::vector<sslong> TiArray(nnz, 0);
-    std::vector<sslong> TjArray(nnz, 0);
-
-    for (size_t k = 0; k < nnz; k++) {
-      TiArray[k] = static_cast<sslong>(Ti[k]);
-      TjArray[k] = static_cast<sslong>(Tj[k]);
-    }
-
-    Printer::getInstance().printStatusUpdate("step 1: umfpack_dl_triplet_to_col");
-
-    result = umfpack_dl_triplet_to_col(static_cast<sslong>(n), static_cast<sslong>(n),
-                                       static_cast<sslong>(nnz), &TiArray[0], &TjArray[0], &Tx[0],
-                                       &Ap[0], &Ai[0], &Ax[0], nullptr);
-
-    if (result != UMFPACK_OK) {
-      Printer::getInstance().printStatusEnd(
-          "error: Could not convert to CCS via "
-          "umfpack_dl_triplet_to_col, error code " +
-          std::to_string(result));
-      return false;
-    }
-  }
-
   void *symbolic, *numeric;
 
-  Printer::getInstance().printStatusNewLine();
-  Printer::getInstance().printStatusUpdate("step 2: umfpack_dl_symbolic");
+  Printer::getInstance().printStatusUpdate("step 1: umfpack_dl_symbolic");
 
-  // call umfpack_dl_symbolic
+  // call umfpack_dl_symbolic (for the transposed matrix)
   result = umfpack_dl_symbolic(static_cast<sslong>(n), static_cast<sslong>(n), &Ap[0], &Ai[0],
                                &Ax[0], &symbolic, nullptr, nullptr);
 
@@ -195,7 +177,7 @@ shared(system, Ti, Tj, Tx, nnz, rowsDone) default(none)
   }
 
   Printer::getInstance().printStatusNewLine();
-  Printer::getInstance().printStatusUpdate("step 3: umfpack_dl_numeric");
+  Printer::getInstance().printStatusUpdate("step 2: umfpack_dl_numeric");
 
   // call umfpack_dl_numeric
   result = umfpack_dl_numeric(&Ap[0], &Ai[0], &Ax[0], symbolic, &numeric, nullptr, nullptr);
@@ -221,9 +203,9 @@ shared(system, Ti, Tj, Tx, nnz, rowsDone) default(none)
     Printer::getInstance().printStatusNewLine();
 
     if (B.getNcols() == 1) {
-      Printer::getInstance().printStatusUpdate("step 4: umfpack_dl_solve");
+      Printer::getInstance().printStatusUpdate("step 3: umfpack_dl_solve");
     } else {
-      Printer::getInstance().printStatusUpdate("step 4: umfpack_dl_solve (RHS " +
+      Printer::getInstance().printStatusUpdate("step 3: umfpack_dl_solve (RHS " +
                                                std::to_string(i + 1) + " of " +
                                                std::to_string(B.getNcols()) + ")");
     }
@@ -53,10 +53,13 @@
 #include <sgpp/base/grid/type/NaturalBsplineBoundaryGrid.hpp>
 #include <sgpp/base/grid/type/NakBsplineBoundaryGrid.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <cstring>
 #include <memory>
 #include <stdexcept>
+#include <vector>
 
 namespace sgpp {
 namespace base {
@@ -201,6 +204,8 @@ class HierarchisationSLE : public CloneableSLE {
     } else {
       throw std::invalid_argument("Grid type not supported.");
     }
+
+    initializeSupportIndex();
   }
 
   /**
@@ -222,6 +227,81 @@ class HierarchisationSLE : public CloneableSLE {
     return evalBasisFunctionAtGridPoint(j, i);
   }
 
+  /**
+   * Enumerate the basis functions whose support contains the i-th grid point.
+   * The candidates are found by intersecting the one-dimensional supports in terms of
+   * level and index, without evaluating any basis function. Falls back to all columns for
+   * bases with global support (fundamental splines and wavelets).
+   *
+   * @param       i         row index
+   * @param[out]  columns   column indices in ascending order
+   */
+  void getRowSparsityPattern(size_t i, std::vector<size_t>& columns) override {
+    if (supportRadius <= 0.0) {
+      SLE::getRowSparsityPattern(i, columns);
+      return;
+    }
+
+    const size_t d = gridStorage.getDimension();
+    const GridPoint& gpPoint = gridStorage[i];
+    std::vector<std::vector<double>> indexCoordinates(d);
+
+    // one-dimensional candidates are those whose index coordinate is close to the index
+    size_t bestDim = 0;
+    size_t bestCount = gridStorage.getSize() + 1;
+
+    for (size_t t = 0; t < d; t++) {
+      const double x = gridStorage.getUnitCoordinate(gpPoint, t);
+      const size_t numberOfLevels = pointsByLevelIndex[t].size();
+      size_t count = 0;
+      indexCoordinates[t].resize(numberOfLevels);
+
+      for (level_t l = 0; l < numberOfLevels; l++) {
+        indexCoordinates[t][l] = getIndexCoordinate(l, x);
+        const auto range = getCandidateRange(t, l, indexCoordinates[t][l]);
+        count += static_cast<size_t>(range.second - range.first);
+      }
+
+      if (count < bestCount) {
+        bestDim = t;
+        bestCount = count;
+      }
+    }
+
+    // iterate over the candidates of the dimension with fewest candidates,
+    // check the remaining dimensions
+    columns.clear();
+
+    for (level_t l = 0; l < pointsByLevelIndex[bestDim].size(); l++) {
+      const auto range = getCandidateRange(bestDim, l, indexCoordinates[bestDim][l]);
+
+      for (auto it = range.first; it != range.second; ++it) {
+        const GridPoint& gpBasis = gridStorage[it->second];
+        bool isCandidate = true;
+
+        for (size_t t = 0; t < d; t++) {
+          if (t == bestDim) {
+            continue;
+          }
+
+          const level_t lt = gpBasis.getLevel(t);
+
+          if (std::abs(indexCoordinates[t][lt] - static_cast<double>(gpBasis.getIndex(t))) >
+              getSupportRadius(lt) + SUPPORT_TOLERANCE) {
+            isCandidate = false;
+            break;
+          }
+        }
+
+        if (isCandidate) {
+          columns.push_back(it->second);
+        }
+      }
+    }
+
+    std::sort(columns.begin(), columns.end());
+  }
+
   /**
    * @return          sparse grid
    */
@@ -322,6 +402,144 @@ class HierarchisationSLE : public CloneableSLE {
     WAVELET_MODIFIED,
   } basisType;
 
+  /// absolute tolerance for the support checks in index coordinates
+  static constexpr double SUPPORT_TOLERANCE = 1e-8;
+
+  /// one-dimensional supports are contained in the interval of this radius around the index
+  /// (in index coordinates), non-positive if the basis functions have global support
+  double supportRadius;
+  /// the basis functions have global support on levels with \f$2^\ell \le\f$ lowLevelBound
+  double lowLevelBound;
+  /// whether the grid points are Clenshaw-Curtis points
+  bool isClenshawCurtis;
+  /// for every dimension and level, pairs of index and grid point index sorted by the index
+  std::vector<std::vector<std::vector<std::pair<index_t, size_t>>>> pointsByLevelIndex;
+
+  /**
+   * Determine the support radius of the basis and sort the grid points by their
+   * one-dimensional levels and indices.
+   */
+  void initializeSupportIndex() {
+    supportRadius = 0.0;
+    lowLevelBound = 0.0;
+    isClenshawCurtis = false;
+
+    if ((basisType == LINEAR) || (basisType == LINEAR_BOUNDARY) ||
+        (basisType == LINEAR_MODIFIED)) {
+      supportRadius = 1.0;
+    } else if ((basisType == LINEAR_CLENSHAW_CURTIS) ||
+               (basisType == LINEAR_CLENSHAW_CURTIS_BOUNDARY)) {
+      supportRadius = 1.0;
+      isClenshawCurtis = true;
+    } else if (basisType == BSPLINE) {
+      supportRadius = static_cast<double>(bsplineBasis->getDegree() + 1) / 2.0;
+    } else if (basisType == BSPLINE_BOUNDARY) {
+      supportRadius = static_cast<double>(bsplineBoundaryBasis->getDegree() + 1) / 2.0;
+    } else if (basisType == BSPLINE_CLENSHAW_CURTIS) {
+      supportRadius = static_cast<double>(bsplineClenshawCurtisBasis->getDegree() + 1) / 2.0;
+      isClenshawCurtis = true;
+    } else if (basisType == BSPLINE_MODIFIED) {
+      // the modified basis functions at the boundary extend the support to the boundary
+      supportRadius = static_cast<double>(modBsplineBasis->getDegree() + 1);
+    } else if (basisType == BSPLINE_MODIFIED_CLENSHAW_CURTIS) {
+      supportRadius = static_cast<double>(modBsplineClenshawCurtisBasis->getDegree() + 1);
+      isClenshawCurtis = true;
+    } else if ((basisType == NATURAL_BSPLINE) || (basisType == NAK_BSPLINE) ||
+               (basisType == NAK_BSPLINE_MODIFIED) ||
+               (basisType == NAK_BSPLINEBOUNDARY_COMBIGRID)) {
+      // the knots at the boundary are moved (and the basis functions are polynomials on
+      // coarse levels), which enlarges the support of the basis functions near the boundary
+      const size_t p = (basisType == NATURAL_BSPLINE)
+                           ? naturalBsplineBasis->getDegree()
+                           : ((basisType == NAK_BSPLINE)
+                                  ? nakBsplineBasis->getDegree()
+                                  : ((basisType == NAK_BSPLINE_MODIFIED)
+                                         ? modNakBsplineBasis->getDegree()
+                                         : nakBsplineBoundaryCombigridBasis->getDegree()));
+      supportRadius = static_cast<double>(p + 1);
+      lowLevelBound = static_cast<double>(2 * (p + 1));
+    } else {
+      // fundamental splines and wavelets have global support
+      return;
+    }
+
+    const size_t d = gridStorage.getDimension();
+    pointsByLevelIndex.assign(d, std::vector<std::vector<std::pair<index_t, size_t>>>());
+
+    for (size_t j = 0; j < gridStorage.getSize(); j++) {
+      const GridPoint& gp = gridStorage[j];
+
+      for (size_t t = 0; t < d; t++) {
+        const level_t l = gp.getLevel(t);
+
+        if (pointsByLevelIndex[t].size() <= l) {
+          pointsByLevelIndex[t].resize(l + 1);
+        }
+
+        pointsByLevelIndex[t][l].emplace_back(gp.getIndex(t), j);
+      }
+    }
+
+    for (size_t t = 0; t < d; t++) {
+      for (auto& points : pointsByLevelIndex[t]) {
+        std::sort(points.begin(), points.end());
+      }
+    }
+  }
+
+  /**
+   * @param l   level
+   * @return    radius (in index coordinates) of the supports of the basis functions of level l
+   */
+  inline double getSupportRadius(level_t l) const {
+    const double hInv = static_cast<double>(static_cast<index_t>(1) << l);
+    return (hInv <= lowLevelBound) ? hInv : supportRadius;
+  }
+
+  /**
+   * @param l   level
+   * @param x   coordinate in \f$[0, 1]\f$
+   * @return    index coordinate of x on level l (e.g., \f$x \cdot 2^\ell\f$ for equidistant grids)
+   */
+  inline double getIndexCoordinate(level_t l, double x) const {
+    const double hInv = static_cast<double>(static_cast<index_t>(1) << l);
+
+    if (isClenshawCurtis) {
+      // inverse of the Clenshaw-Curtis points x = (1 - cos(pi * i / 2^l)) / 2
+      return hInv * std::acos(std::max(std::min(1.0 - 2.0 * x, 1.0), -1.0)) / M_PI;
+    } else {
+      return hInv * x;
+    }
+  }
+
+  /**
+   * @param t                 dimension
+   * @param l                 level
+   * @param indexCoordinate   index coordinate of the grid point on level l
+   * @return                  range of grid points whose t-th level is l and whose t-th
+   *                          one-dimensional basis function might not vanish at the grid point
+   */
+  inline std::pair<std::vector<std::pair<index_t, size_t>>::const_iterator,
+                   std::vector<std::pair<index_t, size_t>>::const_iterator>
+  getCandidateRange(size_t t, level_t l, double indexCoordinate) const {
+    const std::vector<std::pair<index_t, size_t>>& points = pointsByLevelIndex[t][l];
+    const double radius = getSupportRadius(l) + SUPPORT_TOLERANCE;
+    const double lowerIndex = std::ceil(indexCoordinate - radius);
+    const double upperIndex = std::floor(indexCoordinate + radius);
+
+    if ((upperIndex < 0.0) || (upperIndex < lowerIndex)) {
+      return std::make_pair(points.end(), points.end());
+    }
+
+    const index_t lower = static_cast<index_t>(std::max(lowerIndex, 0.0));
+    const index_t upper = static_cast<index_t>(upperIndex);
+    const auto first = std::lower_bound(points.begin(), points.end(),
+                                        std::make_pair(lower, static_cast<size_t>(0)));
+    const auto last = std::upper_bound(first, points.end(),
+                                       std::make_pair(upper, gridStorage.getSize()));
+    return std::make_pair(first, last);
+  }
+
   /**
    * @param basisI    basis function index
    * @param pointJ    grid point index
@@ -9,6 +9,7 @@
 #include <sgpp/globaldef.hpp>
 
 #include <cstddef>
+#include <vector>
 
 namespace sgpp {
 namespace base {
@@ -47,21 +48,41 @@ class SLE {
    */
   virtual double getMatrixEntry(size_t i, size_t j) = 0;
 
+  /**
+   * Enumerate the columns of all entries of a row that might be non-zero,
+   * i.e., all entries of the row outside of the returned columns vanish.
+   * Standard implementation returning all \f$n\f$ columns.
+   *
+   * @param       i         row index
+   * @param[out]  columns   column indices in ascending order
+   */
+  virtual void getRowSparsityPattern(size_t i, std::vector<size_t>& columns) {
+    const size_t n = getDimension();
+    columns.resize(n);
+
+    for (size_t j = 0; j < n; j++) {
+      columns[j] = j;
+    }
+  }
+
   /**
    * Multiply the matrix with a vector.
    * Standard implementation with \f$\mathcal{O}(n^2)\f$ scalar
-   * multiplications.
+   * multiplications (if getRowSparsityPattern() is not overridden).
    *
    * @param       x   vector to be multiplied
    * @param[out]  y   \f$y = Ax\f$
    */
   virtual void matrixVectorMultiplication(const DataVector& x, DataVector& y) {
     const size_t n = getDimension();
+    std::vector<size_t> columns;
     y.resize(n);
     y.setAll(0.0);
 
     for (size_t i = 0; i < n; i++) {
-      for (size_t j = 0; j < n; j++) {
+      getRowSparsityPattern(i, columns);
+
+      for (size_t j : columns) {
         y[i] += getMatrixEntry(i, j) * x[j];
       }
     }
@@ -69,16 +90,20 @@ class SLE {
 
   /**
    * Count all non-zero entries.
-   * Standard implementation with \f$\mathcal{O}(n^2)\f$ checks.
+   * Standard implementation with \f$\mathcal{O}(n^2)\f$ checks
+   * (if getRowSparsityPattern() is not overridden).
    *
    * @return number of non-zero entries
    */
   virtual size_t countNNZ() {
     const size_t n = getDimension();
+    std::vector<size_t> columns;
     size_t nnz = 0;
 
     for (size_t i = 0; i < n; i++) {
-      for (size_t j = 0; j < n; j++) {
+      getRowSparsityPattern(i, columns);
+
+      for (size_t j : columns) {
         if (isMatrixEntryNonZero(i, j)) {
           nnz++;
         }
@@ -371,6 +371,39 @@ BOOST_AUTO_TEST_CASE(testSerializationLinearBoundaryWithLeaf) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(testSerializationBinary) {
+  // Uses a refined poly boundary grid, whose degree is written after the grid points
+  std::unique_ptr<Grid> factory(Grid::createPolyBoundaryGrid(3, 3));
+  factory->getGenerator().regular(4);
+
+  DataVector alpha(factory->getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = static_cast<double>(i % 7);
+  }
+
+  SurplusRefinementFunctor functor(alpha, 10);
+  factory->getGenerator().refine(functor);
+
+  std::string text = factory->serialize();
+  std::string binary = factory->serialize(SERIALIZATION_VERSION_BINARY);
+  BOOST_CHECK_LT(binary.size(), text.size());
+
+  std::unique_ptr<Grid> newfac(Grid::unserialize(binary));
+  BOOST_CHECK(newfac->getType() == factory->getType());
+  BOOST_CHECK_EQUAL(newfac->getSize(), factory->getSize());
+  BOOST_CHECK_EQUAL(newfac->serialize(), text);
+
+  GridStorage& storage = factory->getStorage();
+  GridStorage& newStorage = newfac->getStorage();
+
+  for (size_t i = 0; i < storage.getSize(); ++i) {
+    BOOST_CHECK(newStorage.getPoint(i).equals(storage.getPoint(i)));
+    BOOST_CHECK_EQUAL(newStorage.getPoint(i).isLeaf(), storage.getPoint(i).isLeaf());
+    BOOST_CHECK_EQUAL(newStorage.getSequenceNumber(storage.getPoint(i)), i);
+  }
+}
+
 // end test suite TestGridFactory
 BOOST_AUTO_TEST_SUITE_END()
 
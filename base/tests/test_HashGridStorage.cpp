@@ -14,10 +14,12 @@
 #include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
 #include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
 
+#include <list>
 #include <string>
 #include <vector>
 
 using sgpp::base::DataVector;
+using sgpp::base::GridPointMapType;
 using sgpp::base::HashGenerator;
 using sgpp::base::HashGridPoint;
 using sgpp::base::HashGridStorage;
@@ -194,6 +196,61 @@ BOOST_AUTO_TEST_CASE(testSeq) {
   BOOST_CHECK(s.isInvalidSequenceNumber(seq));
 }
 
+BOOST_AUTO_TEST_CASE(testIndexConsistency) {
+  for (GridPointMapType type :
+       {GridPointMapType::FlatHashMap, GridPointMapType::StdUnorderedMap}) {
+    // many points force several rehashes and long probe sequences of the grid point index
+    HashGridStorage s(3);
+    HashGenerator g;
+
+    s.setGridPointMapType(type);
+    g.regular(s, 7);
+    BOOST_CHECK(s.getGridPointMapType() == type);
+
+    const size_t gridSize = s.getSize();
+    size_t iterated = 0;
+
+    for (HashGridStorage::grid_map_iterator iter = s.begin(); iter != s.end(); iter++) {
+      BOOST_CHECK(iter->first == &s.getPoint(iter->second));
+      iterated++;
+    }
+
+    BOOST_CHECK_EQUAL(iterated, gridSize);
+
+    // remove every third point and check that the remaining points are still found
+    std::list<size_t> removePoints;
+
+    for (size_t i = 0; i < gridSize; i += 3) {
+      removePoints.push_back(i);
+    }
+
+    HashGridStorage copy(s);
+    BOOST_CHECK(copy.getGridPointMapType() == type);
+    std::vector<size_t> remaining = s.deletePoints(removePoints);
+    BOOST_CHECK_EQUAL(s.getSize(), gridSize - removePoints.size());
+
+    for (size_t i = 0; i < remaining.size(); i++) {
+      BOOST_CHECK_EQUAL(s.getSequenceNumber(copy.getPoint(remaining[i])), i);
+    }
+
+    for (std::list<size_t>::iterator iter = removePoints.begin(); iter != removePoints.end();
+         iter++) {
+      BOOST_CHECK(!s.isContaining(copy.getPoint(*iter)));
+    }
+
+    // switching the implementation keeps all sequence numbers
+    copy.setGridPointMapType((type == GridPointMapType::FlatHashMap)
+                                 ? GridPointMapType::StdUnorderedMap
+                                 : GridPointMapType::FlatHashMap);
+    BOOST_CHECK(copy.getGridPointMapType() != type);
+    BOOST_CHECK_EQUAL(copy.getSize(), gridSize);
+
+    for (size_t i = 0; i < gridSize; i++) {
+      BOOST_CHECK_EQUAL(copy.getSequenceNumber(copy.getPoint(i)), i);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(TestHashGridStorageWithT)
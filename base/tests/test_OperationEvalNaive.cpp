@@ -17,9 +17,12 @@
 #include <sgpp/base/operation/hash/common/basis/PolyBoundaryBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/PolyClenshawCurtisBoundaryBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/PolyClenshawCurtisBasis.hpp>
+#include <sgpp/base/function/scalar/InterpolantScalarFunctionHessian.hpp>
+#include <sgpp/base/function/vector/InterpolantVectorFunction.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 
+#include <cmath>
 #include <vector>
 #include <random>
 
@@ -33,10 +36,13 @@ using sgpp::base::Grid;
 using sgpp::base::GridGenerator;
 using sgpp::base::GridPoint;
 using sgpp::base::GridType;
+using sgpp::base::InterpolantScalarFunctionHessian;
+using sgpp::base::InterpolantVectorFunction;
 using sgpp::base::OperationEval;
 using sgpp::base::OperationEvalGradient;
 using sgpp::base::OperationEvalHessian;
 using sgpp::base::OperationEvalPartialDerivative;
+using sgpp::base::OperationMultipleEval;
 using sgpp::base::SBasis;
 using sgpp::base::SPolyBase;
 using sgpp::base::SPolyBoundaryBase;
@@ -506,3 +512,367 @@ BOOST_AUTO_TEST_CASE(TestOperationEvalNaive) {
     }
   }
 }
+
+BOOST_AUTO_TEST_CASE(TestOperationEvalNaiveLocalSupport) {
+  // higher level and degree than above, such that only a small fraction of the
+  // basis functions is non-zero at the evaluation points
+  const size_t d = 3;
+  const size_t l = 5;
+  const size_t p = 5;
+  const size_t m = 60;
+
+  std::mt19937 generator;
+  generator.seed(42);
+  std::uniform_real_distribution<double> uniformDistribution(0.0, 1.0);
+  std::normal_distribution<double> normalDistribution(0.0, 1.0);
+
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineBoundaryGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineClenshawCurtisGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModBsplineGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModBsplineClenshawCurtisGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createNakBsplineBoundaryGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModNakBsplineGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createNaturalBsplineBoundaryGrid(d, p)));
+
+  std::vector<std::unique_ptr<SBasis>> bases;
+  bases.push_back(std::unique_ptr<SBasis>(new sgpp::base::SBsplineBase(p)));
+  bases.push_back(std::unique_ptr<SBasis>(new sgpp::base::SBsplineBoundaryBase(p)));
+  bases.push_back(std::unique_ptr<SBasis>(new sgpp::base::SBsplineClenshawCurtisBase(p)));
+  bases.push_back(std::unique_ptr<SBasis>(new sgpp::base::SBsplineModifiedBase(p)));
+  bases.push_back(
+      std::unique_ptr<SBasis>(new sgpp::base::SBsplineModifiedClenshawCurtisBase(p)));
+  bases.push_back(std::unique_ptr<SBasis>(new sgpp::base::SNakBsplineBase(p)));
+  bases.push_back(std::unique_ptr<SBasis>(new sgpp::base::SNakBsplineModifiedBase(p)));
+  bases.push_back(std::unique_ptr<SBasis>(new sgpp::base::SNaturalBsplineBase(p)));
+
+  for (size_t k = 0; k < grids.size(); k++) {
+    Grid& grid = *grids[k];
+    SBasis& basis = *bases[k];
+    const bool hasMultipleEvalNaive = (grid.getType() == GridType::Bspline) ||
+                                      (grid.getType() == GridType::BsplineBoundary) ||
+                                      (grid.getType() == GridType::BsplineClenshawCurtis) ||
+                                      (grid.getType() == GridType::ModBspline) ||
+                                      (grid.getType() == GridType::ModBsplineClenshawCurtis);
+
+    grid.getGenerator().regular(l - 1);
+
+    // evaluation points, including points on the boundary and on grid points
+    DataMatrix points(m, d);
+
+    for (size_t j = 0; j < m; j++) {
+      for (size_t t = 0; t < d; t++) {
+        if (j % 10 == 0) {
+          points(j, t) = static_cast<double>((j + t) % 2);
+        } else if (j % 10 == 1) {
+          points(j, t) = static_cast<double>((j + 3 * t) % 32) / 32.0;
+        } else {
+          points(j, t) = uniformDistribution(generator);
+        }
+      }
+    }
+
+    std::unique_ptr<OperationEval> opEval(sgpp::op_factory::createOperationEvalNaive(grid));
+
+    // the second iteration checks that the operation notices the refined grid,
+    // the third one that it notices a changed grid of the same size
+    for (size_t iteration = 0; iteration < 3; iteration++) {
+      if (iteration == 1) {
+        grid.getStorage().clear();
+        grid.getGenerator().regular(l);
+      } else if (iteration == 2) {
+        sgpp::base::GridStorage& storage = grid.getStorage();
+        const size_t sizeBefore = storage.getSize();
+        size_t iMax = 0;
+
+        for (size_t i = 1; i < sizeBefore; i++) {
+          if (storage[i].getLevel(0) > storage[iMax].getLevel(0)) {
+            iMax = i;
+          }
+        }
+
+        // replace the last point by a child of a point of maximal level
+        GridPoint newPoint(storage[iMax]);
+        newPoint.set(0, newPoint.getLevel(0) + 1, 2 * newPoint.getIndex(0) - 1);
+        BOOST_CHECK(!storage.isContaining(newPoint));
+        storage.deleteLast();
+        storage.insert(newPoint);
+        BOOST_CHECK_EQUAL(storage.getSize(), sizeBefore);
+      }
+
+      const size_t n = grid.getSize();
+      DataVector alpha(n);
+
+      for (size_t i = 0; i < n; i++) {
+        alpha[i] = normalDistribution(generator);
+      }
+
+      // brute-force evaluation of all basis functions
+      DataMatrix basisValues(m, n);
+
+      for (size_t j = 0; j < m; j++) {
+        for (size_t i = 0; i < n; i++) {
+          double value = 1.0;
+
+          for (size_t t = 0; t < d; t++) {
+            const GridPoint& gp = grid.getStorage()[i];
+            value *= basisEval(basis, gp.getLevel(t), gp.getIndex(t), points(j, t));
+          }
+
+          basisValues(j, i) = value;
+        }
+      }
+
+      DataVector fx(m, 0.0);
+      DataVector y(d);
+
+      for (size_t j = 0; j < m; j++) {
+        for (size_t i = 0; i < n; i++) {
+          fx[j] += alpha[i] * basisValues(j, i);
+        }
+
+        points.getRow(j, y);
+        BOOST_CHECK_SMALL(opEval->eval(alpha, y) - fx[j], 1e-10);
+      }
+
+      if (hasMultipleEvalNaive) {
+        std::unique_ptr<OperationMultipleEval> opMultipleEval(
+            sgpp::op_factory::createOperationMultipleEvalNaive(grid, points));
+        DataVector fx2(m);
+        opMultipleEval->mult(alpha, fx2);
+
+        for (size_t j = 0; j < m; j++) {
+          BOOST_CHECK_SMALL(fx2[j] - fx[j], 1e-10);
+        }
+
+        DataVector source(m);
+
+        for (size_t j = 0; j < m; j++) {
+          source[j] = normalDistribution(generator);
+        }
+
+        DataVector result(n);
+        opMultipleEval->multTranspose(source, result);
+
+        for (size_t i = 0; i < n; i++) {
+          double resultRef = 0.0;
+
+          for (size_t j = 0; j < m; j++) {
+            resultRef += source[j] * basisValues(j, i);
+          }
+
+          BOOST_CHECK_SMALL(result[i] - resultRef, 1e-10);
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestOperationEvalNaiveBatch) {
+  const size_t d = 3;
+  const size_t l = 4;
+  const size_t p = 3;
+  const size_t m = 40;
+
+  std::mt19937 generator;
+  generator.seed(42);
+  std::uniform_real_distribution<double> uniformDistribution(0.0, 1.0);
+  std::normal_distribution<double> normalDistribution(0.0, 1.0);
+
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineBoundaryGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineClenshawCurtisGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModBsplineGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModBsplineClenshawCurtisGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createFundamentalSplineGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModFundamentalSplineGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createFundamentalNakSplineBoundaryGrid(d, p)));
+  // uses the default implementation of the batched evaluation
+  grids.push_back(std::unique_ptr<Grid>(Grid::createNakBsplineBoundaryGrid(d, p)));
+
+  for (size_t k = 0; k < grids.size(); k++) {
+    Grid& grid = *grids[k];
+    grid.getGenerator().regular(l);
+    const size_t n = grid.getSize();
+
+    // set random bounding box
+    BoundingBox& boundingBox = grid.getBoundingBox();
+
+    for (size_t t = 0; t < d; t++) {
+      const double left = normalDistribution(generator);
+      const double right = left + 0.5 + std::abs(normalDistribution(generator));
+      boundingBox.setBoundary(t, BoundingBox1D(left, right));
+    }
+
+    DataVector alpha(n);
+
+    for (size_t i = 0; i < n; i++) {
+      alpha[i] = normalDistribution(generator);
+    }
+
+    DataMatrix points(m, d);
+
+    for (size_t j = 0; j < m; j++) {
+      for (size_t t = 0; t < d; t++) {
+        const BoundingBox1D boundingBox1D = boundingBox.getBoundary(t);
+        const double x = ((j % 5 == 0) ? static_cast<double>((j + t) % 2)
+                                       : uniformDistribution(generator));
+        points(j, t) = boundingBox1D.leftBoundary +
+                       x * (boundingBox1D.rightBoundary - boundingBox1D.leftBoundary);
+      }
+    }
+
+    std::unique_ptr<OperationEvalGradient> opEvalGradient(
+        sgpp::op_factory::createOperationEvalGradientNaive(grid));
+    std::unique_ptr<OperationEvalHessian> opEvalHessian(
+        sgpp::op_factory::createOperationEvalHessianNaive(grid));
+
+    DataVector value(m);
+    DataMatrix gradient(m, d);
+    opEvalGradient->evalGradient(alpha, points, value, gradient);
+
+    DataVector value2(m);
+    DataMatrix gradient2(m, d);
+    std::vector<DataMatrix> hessian2;
+    opEvalHessian->evalHessian(alpha, points, value2, gradient2, hessian2);
+    BOOST_CHECK_EQUAL(hessian2.size(), m);
+
+    DataVector y(d);
+    DataVector gradientRef(d);
+    DataMatrix hessianRef(d, d);
+
+    for (size_t j = 0; j < m; j++) {
+      points.getRow(j, y);
+      const double valueRef = opEvalHessian->evalHessian(alpha, y, gradientRef, hessianRef);
+
+      BOOST_CHECK_SMALL(value[j] - valueRef, 1e-10);
+      BOOST_CHECK_SMALL(value2[j] - valueRef, 1e-10);
+
+      for (size_t t = 0; t < d; t++) {
+        BOOST_CHECK_SMALL(gradient(j, t) - gradientRef[t], 1e-8);
+        BOOST_CHECK_SMALL(gradient2(j, t) - gradientRef[t], 1e-8);
+
+        for (size_t t2 = 0; t2 < d; t2++) {
+          BOOST_CHECK_SMALL(hessian2[j](t, t2) - hessianRef(t, t2), 1e-6);
+        }
+      }
+    }
+  }
+
+  // interpolants forward batches to the operations, but reject points outside of the domain
+  std::unique_ptr<Grid> grid(Grid::createBsplineGrid(d, p));
+  grid->getGenerator().regular(l);
+  DataVector alpha(grid->getSize(), 1.0);
+  InterpolantScalarFunctionHessian fHessian(*grid, alpha);
+  DataMatrix points(2, d, 0.5);
+  points(1, 0) = 1.5;
+  DataVector value;
+  DataMatrix gradient;
+  std::vector<DataMatrix> hessian;
+  fHessian.eval(points, value, gradient, hessian);
+
+  DataVector y(d, 0.5);
+  DataVector gradientRef(d);
+  DataMatrix hessianRef(d, d);
+  BOOST_CHECK_SMALL(value[0] - fHessian.eval(y, gradientRef, hessianRef), 1e-10);
+  BOOST_CHECK(std::isinf(value[1]));
+}
+
+BOOST_AUTO_TEST_CASE(TestOperationEvalNaiveMultipleOutputs) {
+  const size_t d = 3;
+  const size_t l = 4;
+  const size_t p = 3;
+  // number of outputs not divisible by the SIMD width
+  const size_t m = 19;
+  const size_t N = 30;
+
+  std::mt19937 generator;
+  generator.seed(42);
+  std::uniform_real_distribution<double> uniformDistribution(0.0, 1.0);
+  std::normal_distribution<double> normalDistribution(0.0, 1.0);
+
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineBoundaryGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModBsplineClenshawCurtisGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createNakBsplineBoundaryGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createFundamentalSplineGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createLinearBoundaryGrid(d)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModPolyGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createWaveletGrid(d)));
+
+  for (size_t k = 0; k < grids.size(); k++) {
+    Grid& grid = *grids[k];
+    grid.getGenerator().regular(l);
+    const size_t n = grid.getSize();
+
+    BoundingBox& boundingBox = grid.getBoundingBox();
+
+    for (size_t t = 0; t < d; t++) {
+      const double left = normalDistribution(generator);
+      const double right = left + 0.5 + std::abs(normalDistribution(generator));
+      boundingBox.setBoundary(t, BoundingBox1D(left, right));
+    }
+
+    DataMatrix alpha(n, m);
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      alpha[i] = normalDistribution(generator);
+    }
+
+    DataMatrix points(N, d);
+
+    for (size_t j = 0; j < N; j++) {
+      for (size_t t = 0; t < d; t++) {
+        const BoundingBox1D boundingBox1D = boundingBox.getBoundary(t);
+        const double x = ((j % 5 == 0) ? static_cast<double>((j + t) % 2)
+                                       : uniformDistribution(generator));
+        points(j, t) = boundingBox1D.leftBoundary +
+                       x * (boundingBox1D.rightBoundary - boundingBox1D.leftBoundary);
+      }
+    }
+
+    std::unique_ptr<OperationEval> opEval(sgpp::op_factory::createOperationEvalNaive(grid));
+    DataMatrix value;
+    opEval->eval(alpha, points, value);
+    BOOST_CHECK_EQUAL(value.getNrows(), N);
+    BOOST_CHECK_EQUAL(value.getNcols(), m);
+
+    DataVector y(d);
+    DataVector curAlpha(n);
+    DataVector curValue(m);
+
+    for (size_t j = 0; j < N; j++) {
+      points.getRow(j, y);
+      opEval->eval(alpha, y, curValue);
+
+      for (size_t q = 0; q < m; q++) {
+        alpha.getColumn(q, curAlpha);
+        const double valueRef = opEval->eval(curAlpha, y);
+        BOOST_CHECK_SMALL(curValue[q] - valueRef, 1e-10);
+        BOOST_CHECK_SMALL(value(j, q) - valueRef, 1e-10);
+      }
+    }
+  }
+
+  // vector-valued interpolants forward batches, but reject points outside of the domain
+  std::unique_ptr<Grid> grid(Grid::createBsplineGrid(d, p));
+  grid->getGenerator().regular(l);
+  DataMatrix alpha(grid->getSize(), m, 1.0);
+  InterpolantVectorFunction f(*grid, alpha);
+  DataMatrix points(2, d, 0.5);
+  points(1, 0) = 1.5;
+  DataMatrix value;
+  f.eval(points, value);
+
+  DataVector y(d, 0.5);
+  DataVector valueRef(m);
+  f.eval(y, valueRef);
+
+  for (size_t q = 0; q < m; q++) {
+    BOOST_CHECK_SMALL(value(0, q) - valueRef[q], 1e-10);
+    BOOST_CHECK(std::isinf(value(1, q)));
+  }
+}
@@ -78,4 +78,111 @@ BOOST_AUTO_TEST_CASE(testOperationMultipleEval) {
   BOOST_CHECK_CLOSE(result[2], result_ref[2], 1e-7);
 }
 
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalTranspose) {
+  // enough data points to process several data blocks per thread
+  const size_t dim = 3;
+  const size_t numberDataPoints = 2000;
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(4);
+
+  GridStorage& gS = grid->getStorage();
+  const size_t N = gS.getSize();
+
+  DataMatrix dataset(numberDataPoints, dim);
+  DataVector source(numberDataPoints);
+
+  for (size_t i = 0; i < numberDataPoints; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      dataset.set(i, d, static_cast<double>((i * (2 * d + 3) + d) % 997) / 997.0);
+    }
+
+    source[i] = static_cast<double>(i % 7) - 3.0;
+  }
+
+  std::unique_ptr<OperationMultipleEval> opMultEval(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+
+  DataVector result(N);
+  opMultEval->multTranspose(source, result);
+
+  // reference: (B^T source)_i = <B e_i, source>
+  DataVector unitVector(N, 0.0);
+  DataVector column(numberDataPoints);
+
+  for (size_t i = 0; i < N; i++) {
+    unitVector[i] = 1.0;
+    opMultEval->mult(unitVector, column);
+    unitVector[i] = 0.0;
+
+    BOOST_CHECK_SMALL(result[i] - column.dotProduct(source), 1e-10);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalMultipleVectors) {
+  // the matrix variants have to coincide with one vector multiplication per column,
+  // both for the linear kernel and for the default implementation (modified linear)
+  const size_t dim = 3;
+  const size_t numberDataPoints = 1500;
+  const size_t numberOfColumns = 4;
+  std::unique_ptr<Grid> grids[] = {std::unique_ptr<Grid>(Grid::createLinearGrid(dim)),
+                                   std::unique_ptr<Grid>(Grid::createModLinearGrid(dim))};
+
+  DataMatrix dataset(numberDataPoints, dim);
+
+  for (size_t i = 0; i < numberDataPoints; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      dataset.set(i, d, static_cast<double>((i * (2 * d + 5) + d) % 991) / 991.0);
+    }
+  }
+
+  for (std::unique_ptr<Grid>& grid : grids) {
+    grid->getGenerator().regular(4);
+    const size_t N = grid->getSize();
+    std::unique_ptr<OperationMultipleEval> opMultEval(
+        sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+
+    DataMatrix alphas(N, numberOfColumns);
+    DataMatrix sources(numberDataPoints, numberOfColumns);
+
+    for (size_t j = 0; j < numberOfColumns; j++) {
+      for (size_t i = 0; i < N; i++) {
+        alphas.set(i, j, static_cast<double>((i * (j + 2)) % 13) - 6.0);
+      }
+
+      for (size_t i = 0; i < numberDataPoints; i++) {
+        sources.set(i, j, static_cast<double>((i + j) % 5 == 0));
+      }
+    }
+
+    DataMatrix results;
+    DataMatrix resultsTranspose;
+    opMultEval->multMultiple(alphas, results);
+    opMultEval->multTransposeMultiple(sources, resultsTranspose);
+    BOOST_CHECK_EQUAL(results.getNrows(), numberDataPoints);
+    BOOST_CHECK_EQUAL(results.getNcols(), numberOfColumns);
+    BOOST_CHECK_EQUAL(resultsTranspose.getNrows(), N);
+    BOOST_CHECK_EQUAL(resultsTranspose.getNcols(), numberOfColumns);
+
+    DataVector alpha(N);
+    DataVector source(numberDataPoints);
+    DataVector result(numberDataPoints);
+    DataVector resultTranspose(N);
+
+    for (size_t j = 0; j < numberOfColumns; j++) {
+      alphas.getColumn(j, alpha);
+      sources.getColumn(j, source);
+      opMultEval->mult(alpha, result);
+      opMultEval->multTranspose(source, resultTranspose);
+
+      for (size_t i = 0; i < numberDataPoints; i++) {
+        BOOST_CHECK_SMALL(results.get(i, j) - result[i], 1e-10);
+      }
+
+      for (size_t i = 0; i < N; i++) {
+        BOOST_CHECK_SMALL(resultsTranspose.get(i, j) - resultTranspose[i], 1e-10);
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -108,8 +108,13 @@ void testSLESystem(SLE& system, const sgpp::base::DataVector& x, const sgpp::bas
   A.resize(n, n);
   sgpp::base::DataVector Ax(n, 0.0);
 
+  std::vector<size_t> columns;
+
   // A*x calculated directly
   for (size_t i = 0; i < n; i++) {
+    system.getRowSparsityPattern(i, columns);
+    size_t k = 0;
+
     for (size_t j = 0; j < n; j++) {
       const double Aij = system.getMatrixEntry(i, j);
       A(i, j) = Aij;
@@ -117,7 +122,16 @@ void testSLESystem(SLE& system, const sgpp::base::DataVector& x, const sgpp::bas
 
       // test isMatrixEntryNonZero
       BOOST_CHECK_EQUAL(system.isMatrixEntryNonZero(i, j), Aij != 0);
+
+      // test getRowSparsityPattern (non-zero entries must be contained)
+      if ((k < columns.size()) && (columns[k] == j)) {
+        k++;
+      } else {
+        BOOST_CHECK_EQUAL(Aij, 0.0);
+      }
     }
+
+    BOOST_CHECK_EQUAL(k, columns.size());
   }
 
   // A*x calculated by sgpp::optimization
@@ -333,3 +347,68 @@ BOOST_AUTO_TEST_CASE(TestHierarchisationSLE) {
     }
   }
 }
+
+BOOST_AUTO_TEST_CASE(TestHierarchisationSLESparsityPattern) {
+  // Test sgpp::base::HierarchisationSLE::getRowSparsityPattern for bases with local support.
+  const size_t d = 2;
+  const size_t l = 5;
+
+  for (size_t p : {1, 3, 5}) {
+    std::vector<std::unique_ptr<sgpp::base::Grid>> grids;
+    grids.push_back(std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createBsplineGrid(d, p)));
+    grids.push_back(
+        std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createBsplineBoundaryGrid(d, p)));
+    grids.push_back(std::unique_ptr<sgpp::base::Grid>(
+        sgpp::base::Grid::createBsplineClenshawCurtisGrid(d, p)));
+    grids.push_back(
+        std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModBsplineGrid(d, p)));
+    grids.push_back(std::unique_ptr<sgpp::base::Grid>(
+        sgpp::base::Grid::createModBsplineClenshawCurtisGrid(d, p)));
+    grids.push_back(std::unique_ptr<sgpp::base::Grid>(
+        sgpp::base::Grid::createNaturalBsplineBoundaryGrid(d, p)));
+    grids.push_back(
+        std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createNakBsplineBoundaryGrid(d, p)));
+    grids.push_back(
+        std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModNakBsplineGrid(d, p)));
+    grids.push_back(std::unique_ptr<sgpp::base::Grid>(
+        sgpp::base::Grid::createNakBsplineBoundaryCombigridGrid(d, p)));
+    grids.push_back(std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createLinearGrid(d)));
+    grids.push_back(
+        std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createLinearBoundaryGrid(d)));
+    grids.push_back(std::unique_ptr<sgpp::base::Grid>(
+        sgpp::base::Grid::createLinearClenshawCurtisGrid(d)));
+    grids.push_back(std::unique_ptr<sgpp::base::Grid>(
+        sgpp::base::Grid::createLinearClenshawCurtisBoundaryGrid(d)));
+    grids.push_back(std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModLinearGrid(d)));
+
+    for (auto& grid : grids) {
+      grid->getGenerator().regular(l);
+      HierarchisationSLE system(*grid);
+      const size_t n = system.getDimension();
+      std::vector<size_t> columns;
+      size_t patternSize = 0;
+
+      for (size_t i = 0; i < n; i++) {
+        system.getRowSparsityPattern(i, columns);
+        patternSize += columns.size();
+        size_t k = 0;
+
+        for (size_t j = 0; j < n; j++) {
+          if ((k < columns.size()) && (columns[k] == j)) {
+            k++;
+          } else if (system.isMatrixEntryNonZero(i, j)) {
+            BOOST_ERROR("entry (" << i << ", " << j << ") of grid type "
+                                  << grid->getTypeAsString() << " with degree " << p
+                                  << " is non-zero, but not in the sparsity pattern");
+          }
+        }
+
+        BOOST_CHECK_EQUAL(k, columns.size());
+      }
+
+      // the pattern must be sparse
+      BOOST_CHECK_LT(patternSize, n * n);
+      BOOST_CHECK_GE(patternSize, system.countNNZ());
+    }
+  }
+}
@@ -0,0 +1,132 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+/**
+ * \page example_combigridMPI_cpp Distributed Combigrid Example (C++)
+ *
+ * In this example, we hierarchise the full grids of a combination grid on several MPI ranks
+ * and combine the hierarchical surpluses to sparse grid surpluses. Every rank only computes
+ * the function values on its own full grids. Run it, e.g., with
+ *
+ * \verbatim
+ * mpirun -np 4 ./combigridMPI
+ * \endverbatim
+ *
+ * First, we include the required modules.
+ */
+
+#include <mpi.h>
+
+#include <sgpp_base.hpp>
+#include <sgpp_combigrid.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+/**
+ * We define some parameters such as dimensionality and level of the regular sparse grid.
+ */
+int main(int argc, char* argv[]) {
+  MPI_Init(&argc, &argv);
+
+  int rank;
+  int size;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  // dimensionality
+  const size_t dim = 3;
+  // regular level
+  const size_t n = 7;
+  // test function
+  auto f = [](const sgpp::base::DataVector& x) {
+    return std::sin(7.0 * x[0] - 3.0) * std::cos(5.0 * x[1] - 5.0) * std::exp(x[2]);
+  };
+
+  // disable log output
+  sgpp::base::Printer::getInstance().setVerbosity(-1);
+
+  /**
+   * The combination grid and the combined sparse grid are constructed on every rank.
+   * They only contain the levels and coefficients of the full grids and the sparse grid points,
+   * respectively, but not the (much larger) values on the full grids.
+   */
+  sgpp::base::SLinearBase basis1d;
+  sgpp::combigrid::HeterogeneousBasis basis(dim, basis1d);
+  const sgpp::combigrid::CombinationGrid combiGrid =
+      sgpp::combigrid::CombinationGrid::fromRegularSparse(dim, n, basis);
+  sgpp::base::HashGridStorage gridStorage(dim);
+  combiGrid.combinePoints(gridStorage);
+
+  /**
+   * The operation assigns the full grids to the ranks such that the number of grid points per
+   * rank is balanced. Every rank evaluates the test function only on its full grids.
+   */
+  sgpp::combigrid::OperationPoleHierarchisationLinear opPole;
+  sgpp::combigrid::OperationUPCombinationGridMPI opHier(combiGrid, opPole);
+  const std::vector<sgpp::combigrid::FullGrid>& fullGrids = combiGrid.getFullGrids();
+  std::vector<sgpp::base::DataVector> surpluses(fullGrids.size());
+  sgpp::base::DataMatrix points;
+  sgpp::base::DataVector x(dim);
+  size_t numberOfLocalGridPoints = 0;
+
+  for (size_t i : opHier.getLocalFullGridIndices()) {
+    sgpp::combigrid::IndexVectorRange::getPoints(fullGrids[i], points);
+    surpluses[i].resize(points.getNrows());
+
+    for (size_t k = 0; k < points.getNrows(); k++) {
+      points.getRow(k, x);
+      surpluses[i][k] = f(x);
+    }
+
+    numberOfLocalGridPoints += points.getNrows();
+  }
+
+  /**
+   * Hierarchisation is done locally on every rank, the combination of the full grid surpluses
+   * needs the surpluses of all ranks and is performed as an allreduce operation.
+   */
+  opHier.apply(surpluses);
+  sgpp::base::DataVector sparseGridSurpluses;
+  opHier.combineSparseGridValues(gridStorage, surpluses, sparseGridSurpluses);
+
+  std::cout << "Rank " << rank << " of " << size << ": "
+            << opHier.getLocalFullGridIndices().size() << " full grids with "
+            << numberOfLocalGridPoints << " grid points\n";
+
+  /**
+   * For comparison, rank 0 repeats the computation sequentially with
+   * sgpp::combigrid::OperationUPCombinationGrid.
+   */
+  if (rank == 0) {
+    sgpp::base::DataVector fX(gridStorage.getSize());
+
+    for (size_t k = 0; k < gridStorage.getSize(); k++) {
+      gridStorage.getPoint(k).getStandardCoordinates(x);
+      fX[k] = f(x);
+    }
+
+    std::vector<sgpp::base::DataVector> values;
+    combiGrid.distributeValuesToFullGrids(gridStorage, fX, values);
+    sgpp::combigrid::OperationUPCombinationGrid(combiGrid, opPole).apply(values);
+    sgpp::base::DataVector sparseGridSurplusesSequential;
+    combiGrid.combineSparseGridValues(gridStorage, values, sparseGridSurplusesSequential);
+
+    double maxDifference = 0.0;
+
+    for (size_t k = 0; k < gridStorage.getSize(); k++) {
+      maxDifference = std::max(maxDifference, std::abs(sparseGridSurpluses[k] -
+                                                       sparseGridSurplusesSequential[k]));
+    }
+
+    std::cout << "Number of sparse grid points: " << gridStorage.getSize() << "\n";
+    std::cout << "Maximum difference to sequential computation: " << maxDifference << "\n";
+  }
+
+  MPI_Finalize();
+  return 0;
+}
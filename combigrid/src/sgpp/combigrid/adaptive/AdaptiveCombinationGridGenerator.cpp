@@ -18,6 +18,7 @@
 #include <map>
 #include <memory>
 #include <numeric>
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -47,9 +48,14 @@ AdaptiveCombinationGridGenerator::AdaptiveCombinationGridGenerator(
   const std::vector<LevelVector> downwardClosedLevelSet =
       LevelVectorTools::makeDownwardClosed(minimumLevelVector, levelVectors);
 
+  // insert all levels first, such that the lower hypercubes of the old set are complete when
+  // the priorities of the new active levels are estimated
   for (const LevelVector& level : downwardClosedLevelSet) {
     subspacesAndQoI[level] = std::numeric_limits<double>::quiet_NaN();
-    activeSet.push_back(level);
+  }
+
+  for (const LevelVector& level : downwardClosedLevelSet) {
+    activeSet.insert(level);
     adaptLevel(level);
   }
 }
@@ -75,18 +81,75 @@ CombinationGrid AdaptiveCombinationGridGenerator::getCombinationGrid(
   return CombinationGrid::fromSubspaces(oldSet, basis, hasBoundary);
 }
 
+void AdaptiveCombinationGridGenerator::setQoIInformation(const LevelVector& level, double qoi) {
+  subspacesAndQoI[level] = qoi;
+  levelVectorsInProgress.erase(level);
+  updatePriority(level);
+
+  // the QoI of level enters the deltas of the levels in the upper hypercube of level, which
+  // determine their relevances and the estimated priorities of their upward neighbors;
+  // enumerate these levels or scan the active set, whichever is smaller
+  const size_t dim = level.size();
+
+  if ((dim < 32) && (((dim + 1) << dim) < activeSet.size())) {
+    LevelVector levelPlusOne = level;
+
+    for (level_t& l : levelPlusOne) {
+      l++;
+    }
+
+    for (const LevelVector& upperLevel :
+         LevelVectorTools::generateHyperCube(level, levelPlusOne)) {
+      updateRelevance(upperLevel);
+      updatePriority(upperLevel);
+      LevelVector neighborLevel = upperLevel;
+
+      for (size_t d = 0; d < dim; ++d) {
+        neighborLevel[d] += 1;
+        updatePriority(neighborLevel);
+        neighborLevel[d] -= 1;
+      }
+    }
+  } else {
+    std::vector<LevelVector> affectedLevels;
+
+    for (const LevelVector& activeLevel : activeSet) {
+      // the level is affected if it lies in the upper hypercube of level, except for at most
+      // one entry which may exceed it by one
+      bool isAffected = true;
+      size_t numberOfExceedingEntries = 0;
+
+      for (size_t d = 0; d < dim; ++d) {
+        if ((activeLevel[d] < level[d]) || (activeLevel[d] > level[d] + 2)) {
+          isAffected = false;
+          break;
+        } else if (activeLevel[d] == level[d] + 2) {
+          numberOfExceedingEntries++;
+        }
+      }
+
+      if (isAffected && (numberOfExceedingEntries <= 1)) {
+        affectedLevels.push_back(activeLevel);
+      }
+    }
+
+    for (const LevelVector& affectedLevel : affectedLevels) {
+      updateRelevance(affectedLevel);
+      updatePriority(affectedLevel);
+    }
+  }
+}
+
 bool AdaptiveCombinationGridGenerator::adaptNextLevelVector(bool regular) {
   if (regular) {
     throw sgpp::base::not_implemented_exception("Parameter regular not yet implemented!");
   }
 
-  const std::map<LevelVector, double> relevance = getRelevanceOfActiveSet();
-  const auto pr = std::max_element(
-      relevance.begin(), relevance.end(),
-      [](const MapPairType& m1, const MapPairType& m2) { return m1.second < m2.second; });
-
-  if (pr != relevance.end()) {
-    adaptLevel(pr->first);
+  // the relevance queue contains exactly the levels of the active set with known delta;
+  // ties are broken in favor of the lexicographically smallest level
+  if (!relevanceQueue.empty()) {
+    const LevelVector level = relevanceQueue.top().first;
+    adaptLevel(level);
     return true;
   } else {
     return false;
@@ -142,18 +205,49 @@ double AdaptiveCombinationGridGenerator::getDelta(const LevelVector& levelVector
 }
 
 std::map<LevelVector, double> AdaptiveCombinationGridGenerator::getPriorityQueue() const {
-  throw sgpp::base::not_implemented_exception("getPriorityQueue() not yet implemented!");
+  std::map<LevelVector, double> priorities;
+
+  for (const IndexedPriorityQueue<LevelVector>::Entry& entry : priorityQueue.getEntries()) {
+    priorities[entry.first] = entry.second;
+  }
+
+  // the level vectors in progress are not kept in the queue
+  for (const LevelVector& levelVector : levelVectorsInProgress) {
+    if ((activeSet.find(levelVector) != activeSet.end()) && !hasQoI(levelVector)) {
+      priorities[levelVector] = estimatePriority(levelVector);
+    }
+  }
+
+  return priorities;
+}
+
+std::vector<LevelVector> AdaptiveCombinationGridGenerator::getNextLevelVectorsToCompute(
+    size_t numberOfLevelVectors) {
+  std::vector<LevelVector> result;
+
+  // the priority queue contains exactly the levels of the active set without known QoI that
+  // are not in progress; ties are broken in favor of the lexicographically smallest level
+  while ((result.size() < numberOfLevelVectors) && !priorityQueue.empty()) {
+    const LevelVector level = priorityQueue.top().first;
+    priorityQueue.pop();
+    levelVectorsInProgress.insert(level);
+    result.push_back(level);
+  }
+
+  return result;
+}
+
+void AdaptiveCombinationGridGenerator::cancelComputation(const LevelVector& level) {
+  if (levelVectorsInProgress.erase(level) > 0) {
+    updatePriority(level);
+  }
 }
 
 std::map<LevelVector, double> AdaptiveCombinationGridGenerator::getRelevanceOfActiveSet() const {
   std::map<LevelVector, double> relevance;
 
-  for (const LevelVector& levelVector : activeSet) {
-    const double delta = getDelta(levelVector);
-
-    if (!std::isnan(delta)) {
-      relevance[levelVector] = relevanceCalculator->calculate(levelVector, delta);
-    }
+  for (const IndexedPriorityQueue<LevelVector>::Entry& entry : relevanceQueue.getEntries()) {
+    relevance[entry.first] = entry.second;
   }
 
   return relevance;
@@ -172,10 +266,7 @@ bool AdaptiveCombinationGridGenerator::isAdmissible(const LevelVector& level) co
     if (level[d] > minimumLevelVector[d]) {
       LevelVector neighborLevel = level;
       neighborLevel[d] -= 1;
-      const bool isInOldSet = (std::find(oldSet.begin(), oldSet.end(), neighborLevel) !=
-                               oldSet.end());
-
-      if (!isInOldSet) {
+      if (oldSetLookup.find(neighborLevel) == oldSetLookup.end()) {
         return false;
       }
     }
@@ -190,19 +281,73 @@ void AdaptiveCombinationGridGenerator::addNeighborsToActiveSet(const LevelVector
     neighborLevel[d] += 1;
 
     if (isAdmissible(neighborLevel)) {
-      activeSet.push_back(neighborLevel);
+      activeSet.insert(neighborLevel);
+      // the QoI might have been set before the level became active
+      updateRelevance(neighborLevel);
+      updatePriority(neighborLevel);
     }
   }
 }
 
 void AdaptiveCombinationGridGenerator::adaptLevel(const LevelVector& level) {
-  assert(std::find(oldSet.begin(), oldSet.end(), level) == oldSet.end());
-  assert(std::find(activeSet.begin(), activeSet.end(), level) != activeSet.end());
+  assert(oldSetLookup.find(level) == oldSetLookup.end());
+  assert(activeSet.find(level) != activeSet.end());
 
   oldSet.push_back(level);
-  activeSet.remove(level);
+  oldSetLookup.insert(level);
+  activeSet.erase(level);
+  relevanceQueue.remove(level);
+  priorityQueue.remove(level);
   addNeighborsToActiveSet(level);
 }
 
+void AdaptiveCombinationGridGenerator::updateRelevance(const LevelVector& level) {
+  if (activeSet.find(level) == activeSet.end()) {
+    return;
+  }
+
+  const double delta = getDelta(level);
+
+  if (std::isnan(delta)) {
+    relevanceQueue.remove(level);
+  } else {
+    relevanceQueue.push(level, relevanceCalculator->calculate(level, delta));
+  }
+}
+
+bool AdaptiveCombinationGridGenerator::hasQoI(const LevelVector& level) const {
+  const auto it = subspacesAndQoI.find(level);
+  return (it != subspacesAndQoI.end()) && !std::isnan(it->second);
+}
+
+double AdaptiveCombinationGridGenerator::estimatePriority(const LevelVector& level) const {
+  std::map<LevelVector, double> deltasOfDownwardNeighbors;
+
+  for (size_t d = 0; d < level.size(); ++d) {
+    if (level[d] > minimumLevelVector[d]) {
+      LevelVector neighborLevel = level;
+      neighborLevel[d] -= 1;
+      const double delta = getDelta(neighborLevel);
+
+      if (!std::isnan(delta)) {
+        deltasOfDownwardNeighbors[neighborLevel] = delta;
+      }
+    }
+  }
+
+  return (deltasOfDownwardNeighbors.empty()
+              ? 0.
+              : priorityEstimator->estimatePriority(level, deltasOfDownwardNeighbors));
+}
+
+void AdaptiveCombinationGridGenerator::updatePriority(const LevelVector& level) {
+  if ((activeSet.find(level) == activeSet.end()) || hasQoI(level) ||
+      (levelVectorsInProgress.find(level) != levelVectorsInProgress.end())) {
+    priorityQueue.remove(level);
+  } else {
+    priorityQueue.push(level, estimatePriority(level));
+  }
+}
+
 }  // namespace combigrid
 }  // namespace sgpp
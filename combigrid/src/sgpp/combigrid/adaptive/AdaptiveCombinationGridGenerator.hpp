@@ -11,11 +11,13 @@
 #include <sgpp/combigrid/adaptive/RelevanceCalculator.hpp>
 #include <sgpp/combigrid/adaptive/WeightedRelevanceCalculator.hpp>
 #include <sgpp/combigrid/grid/CombinationGrid.hpp>
+#include <sgpp/combigrid/tools/IndexedPriorityQueue.hpp>
 
 #include <functional>
 #include <list>
 #include <map>
 #include <memory>
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -45,12 +47,20 @@ namespace combigrid {
  * a priority queue can be obtained by \c getPriorityQueue , which uses the \c priorityEstimator to
  * infer a priority for the active set levels from the QoIs of the downward neighbors.
  *
+ * For keeping a pool of workers busy, \c getNextLevelVectorsToCompute hands out the level vectors
+ * of the active set with the highest priorities whose QoIs are neither known nor being computed.
+ * The QoIs may then arrive in any order via \c setQoIInformation .
+ *
+ * The relevances and the estimated priorities of the active set are kept in indexed priority
+ * queues, whose affected entries are updated when QoIs arrive, such that selecting the next level
+ * vectors is cheap even for large active sets.
+ * The methods of this class are not thread-safe, i.e., concurrent calls (e.g., from threads
+ * collecting results) have to be synchronized by the caller.
+ *
  * Terminology is mostly taken from Gerstner, T. and Griebel, M., 2003. Dimension–adaptive
  * tensor–product quadrature. Computing, 71(1), pp.65-87.
  */
 class AdaptiveCombinationGridGenerator {
-  using MapPairType = std::pair<const std::vector<unsigned int>, double>;
-
  public:
   /**
    * @brief Construct a new AdaptiveCombinationGridGenerator object
@@ -107,7 +117,7 @@ class AdaptiveCombinationGridGenerator {
   /**
    * @brief set QoI information / a result for LevelVector level
    */
-  void setQoIInformation(const LevelVector& level, double qoi) { subspacesAndQoI[level] = qoi; }
+  void setQoIInformation(const LevelVector& level, double qoi);
 
   /**
    * @brief add the next most important subspace of known result to the old set
@@ -143,7 +153,9 @@ class AdaptiveCombinationGridGenerator {
    *
    * @return std::list<LevelVector> the active set
    */
-  std::list<LevelVector> getActiveSet() const { return activeSet; }
+  std::list<LevelVector> getActiveSet() const {
+    return std::list<LevelVector>(activeSet.begin(), activeSet.end());
+  }
 
   /**
    * @brief Get the minimum Level Vector object
@@ -162,10 +174,36 @@ class AdaptiveCombinationGridGenerator {
 
   /**
    * @brief get a priority queue of elements in the active set that don't have a result / QoI /
-   * delta yet //TODO(pollinta): implement
+   * delta yet; the priorities are estimated by the \c priorityEstimator from the deltas of the
+   * downward neighbors (zero if none of them is known)
    */
   std::map<LevelVector, double> getPriorityQueue() const;
 
+  /**
+   * @brief hand out the level vectors of the active set whose QoIs should be computed next
+   *
+   * The level vectors are chosen from those without a known QoI that have not been handed out
+   * before, in the order of decreasing priority (see \c getPriorityQueue ). They are marked as
+   * "in progress" until their QoI is passed via \c setQoIInformation (or until
+   * \c cancelComputation is called), so that the next call returns different level vectors.
+   *
+   * @param numberOfLevelVectors  maximum number of level vectors to return
+   * @return the level vectors to compute next, may be fewer than requested (or none) if the
+   *         active set does not contain enough level vectors
+   */
+  std::vector<LevelVector> getNextLevelVectorsToCompute(size_t numberOfLevelVectors);
+
+  /**
+   * @brief mark a level vector handed out by \c getNextLevelVectorsToCompute as no longer in
+   * progress (e.g., if the computation failed), such that it may be handed out again
+   */
+  void cancelComputation(const LevelVector& level);
+
+  /**
+   * @brief Get the level vectors that were handed out and whose QoIs did not arrive yet
+   */
+  const std::set<LevelVector>& getLevelVectorsInProgress() const { return levelVectorsInProgress; }
+
   /**
    * @brief get exact value of relevance / "error" of those elements in the active set
    * that already have a QoI value
@@ -195,6 +233,29 @@ class AdaptiveCombinationGridGenerator {
    */
   void adaptLevel(const LevelVector& level);
 
+  /**
+   * @brief update the relevance of \c level in the relevance queue (or remove it from the queue)
+   * after its delta might have changed
+   */
+  void updateRelevance(const LevelVector& level);
+
+  /**
+   * @brief whether the QoI of \c level is known (i.e., set and not NaN)
+   */
+  bool hasQoI(const LevelVector& level) const;
+
+  /**
+   * @brief estimate the priority of \c level from the deltas of its downward neighbors
+   * (zero if none of them is known)
+   */
+  double estimatePriority(const LevelVector& level) const;
+
+  /**
+   * @brief update the estimated priority of \c level in the priority queue (or remove it from
+   * the queue) after the deltas of its downward neighbors might have changed
+   */
+  void updatePriority(const LevelVector& level);
+
   // a map that holds all the levels / results
   // key: the downward-closed set of all level vectors / subspaces considered so far
   // value: the results obtained by evaluating the full grids, according to which the grid will be
@@ -211,10 +272,24 @@ class AdaptiveCombinationGridGenerator {
   LevelVector minimumLevelVector;
 
   // the old set = the level vectors that are definitely in our combigrid already
+  // (in the order of adaptation)
   std::vector<LevelVector> oldSet;
 
+  // the old set for fast lookup
+  std::set<LevelVector> oldSetLookup;
+
   // the active set = the level vectors that may be added to our combigrid next
-  std::list<LevelVector> activeSet;
+  std::set<LevelVector> activeSet;
+
+  // the relevances of the level vectors in the active set whose delta is known
+  IndexedPriorityQueue<LevelVector> relevanceQueue;
+
+  // the estimated priorities of the level vectors in the active set whose QoI is unknown and
+  // that are not in progress
+  IndexedPriorityQueue<LevelVector> priorityQueue;
+
+  // the level vectors handed out by getNextLevelVectorsToCompute whose QoIs did not arrive yet
+  std::set<LevelVector> levelVectorsInProgress;
 
   // the relevance calculator used to relate delta and level vector to an "error" / relevance
   std::unique_ptr<RelevanceCalculator> relevanceCalculator;
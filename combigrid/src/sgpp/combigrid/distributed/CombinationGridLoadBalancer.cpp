@@ -0,0 +1,79 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/combigrid/distributed/CombinationGridLoadBalancer.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+CombinationGridLoadBalancer::CombinationGridLoadBalancer(CostFunction costFunction) :
+    costFunction(costFunction) {
+}
+
+void CombinationGridLoadBalancer::assign(const CombinationGrid& grid, size_t numberOfProcesses,
+                                         std::vector<size_t>& assignment) const {
+  if (numberOfProcesses == 0) {
+    throw sgpp::base::application_exception(
+        "CombinationGridLoadBalancer::assign: Number of processes must be positive.");
+  }
+
+  const std::vector<FullGrid>& fullGrids = grid.getFullGrids();
+  const size_t n = fullGrids.size();
+  std::vector<double> costs(n);
+
+  for (size_t i = 0; i < n; i++) {
+    costs[i] = costFunction(fullGrids[i]);
+  }
+
+  // stable sort, such that the assignment is the same on all processes
+  std::vector<size_t> order(n);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&costs](size_t i, size_t j) { return costs[i] > costs[j]; });
+
+  // min-heap of (total costs, process), ties are broken by the process number
+  typedef std::pair<double, size_t> Load;
+  std::priority_queue<Load, std::vector<Load>, std::greater<Load>> loads;
+
+  for (size_t p = 0; p < numberOfProcesses; p++) {
+    loads.emplace(0.0, p);
+  }
+
+  assignment.resize(n);
+
+  for (size_t i : order) {
+    Load load = loads.top();
+    loads.pop();
+    assignment[i] = load.second;
+    load.first += costs[i];
+    loads.push(load);
+  }
+}
+
+double CombinationGridLoadBalancer::getDefaultCost(const FullGrid& fullGrid) {
+  return static_cast<double>(fullGrid.getNumberOfIndexVectors()) *
+         static_cast<double>(fullGrid.getDimension());
+}
+
+const CombinationGridLoadBalancer::CostFunction& CombinationGridLoadBalancer::getCostFunction()
+    const {
+  return costFunction;
+}
+
+void CombinationGridLoadBalancer::setCostFunction(CostFunction costFunction) {
+  this->costFunction = costFunction;
+}
+
+}  // namespace combigrid
+}  // namespace sgpp
@@ -0,0 +1,77 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/combigrid/grid/CombinationGrid.hpp>
+#include <sgpp/combigrid/grid/FullGrid.hpp>
+
+#include <functional>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * Assignment of the full grids of a combination grid to a number of processes
+ * (e.g., MPI ranks), such that the estimated costs of the processes are balanced.
+ *
+ * The full grids are assigned greedily in the order of decreasing costs, every full grid to the
+ * process with the currently smallest total costs ("longest processing time first").
+ * The assignment is deterministic, i.e., all processes compute the same assignment
+ * without communication.
+ */
+class CombinationGridLoadBalancer {
+ public:
+  /// type of functions estimating the costs of processing a full grid
+  typedef std::function<double(const FullGrid&)> CostFunction;
+
+  /**
+   * Constructor.
+   *
+   * @param costFunction  function estimating the costs of processing a full grid
+   *                      (default: getDefaultCost)
+   */
+  explicit CombinationGridLoadBalancer(CostFunction costFunction = getDefaultCost);
+
+  /**
+   * Assign the full grids of a combination grid to processes.
+   *
+   * @param[in] grid                combination grid
+   * @param[in] numberOfProcesses   number of processes (must be positive)
+   * @param[out] assignment         vector of process numbers, same size as the number of
+   *                                full grids (the i-th full grid is assigned to the
+   *                                process assignment[i])
+   */
+  void assign(const CombinationGrid& grid, size_t numberOfProcesses,
+              std::vector<size_t>& assignment) const;
+
+  /**
+   * Default cost estimate: the number of grid points times the dimensionality, which is
+   * proportional to the costs of applying the unidirectional principle.
+   *
+   * @param fullGrid  full grid
+   * @return estimated costs of processing the full grid
+   */
+  static double getDefaultCost(const FullGrid& fullGrid);
+
+  /**
+   * @return function estimating the costs of processing a full grid
+   */
+  const CostFunction& getCostFunction() const;
+
+  /**
+   * @param costFunction  function estimating the costs of processing a full grid
+   */
+  void setCostFunction(CostFunction costFunction);
+
+ protected:
+  /// function estimating the costs of processing a full grid
+  CostFunction costFunction;
+};
+
+}  // namespace combigrid
+}  // namespace sgpp
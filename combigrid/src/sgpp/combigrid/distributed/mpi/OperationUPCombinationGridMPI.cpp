@@ -0,0 +1,142 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/combigrid/LevelIndexTypes.hpp>
+#include <sgpp/combigrid/distributed/mpi/OperationUPCombinationGridMPI.hpp>
+#include <sgpp/combigrid/grid/FullGrid.hpp>
+#include <sgpp/combigrid/operation/OperationUPFullGrid.hpp>
+#include <sgpp/combigrid/tools/IndexVectorRange.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+OperationUPCombinationGridMPI::OperationUPCombinationGridMPI(const CombinationGrid& grid,
+    const std::vector<std::unique_ptr<OperationPole>>& operationPole, MPI_Comm comm,
+    const CombinationGridLoadBalancer& loadBalancer) :
+    grid(grid), operationPole(), comm(comm), rank(0), assignment(), localFullGridIndices() {
+  for (const std::unique_ptr<OperationPole>& operationPole1d : operationPole) {
+    this->operationPole.push_back(operationPole1d.get());
+  }
+
+  assignFullGrids(loadBalancer);
+}
+
+OperationUPCombinationGridMPI::OperationUPCombinationGridMPI(const CombinationGrid& grid,
+    const std::vector<OperationPole*>& operationPole, MPI_Comm comm,
+    const CombinationGridLoadBalancer& loadBalancer) :
+    grid(grid), operationPole(operationPole), comm(comm), rank(0), assignment(),
+    localFullGridIndices() {
+  assignFullGrids(loadBalancer);
+}
+
+OperationUPCombinationGridMPI::OperationUPCombinationGridMPI(const CombinationGrid& grid,
+    OperationPole& operationPole, MPI_Comm comm,
+    const CombinationGridLoadBalancer& loadBalancer) :
+    grid(grid), operationPole(grid.getDimension(), &operationPole), comm(comm), rank(0),
+    assignment(), localFullGridIndices() {
+  assignFullGrids(loadBalancer);
+}
+
+void OperationUPCombinationGridMPI::apply(std::vector<base::DataVector>& values) {
+  const std::vector<FullGrid>& fullGrids = grid.getFullGrids();
+
+  if (localFullGridIndices.empty()) {
+    return;
+  }
+
+  OperationUPFullGrid operationUPFullGrid(fullGrids[localFullGridIndices[0]], operationPole);
+
+  for (size_t i : localFullGridIndices) {
+    operationUPFullGrid.setGrid(fullGrids[i]);
+    operationUPFullGrid.apply(values[i]);
+  }
+}
+
+void OperationUPCombinationGridMPI::combineSparseGridValues(
+    const base::GridStorage& gridStorage, const std::vector<base::DataVector>& values,
+    base::DataVector& result) const {
+  const size_t N = gridStorage.getSize();
+  const std::vector<FullGrid>& fullGrids = grid.getFullGrids();
+  const base::DataVector& coefficients = grid.getCoefficients();
+  const size_t dim = grid.getDimension();
+  result.resize(N);
+  result.setAll(0.0);
+
+  // partial combination of the full grids of this rank
+#pragma omp parallel
+  {
+    IndexVector index(dim);
+    IndexVectorRange range;
+
+#pragma omp for schedule(static)
+    for (size_t k = 0; k < N; k++) {
+      for (size_t i : localFullGridIndices) {
+        if (fullGrids[i].findGridPointInFullGrid(gridStorage[k], index)) {
+          range.setGrid(fullGrids[i]);
+          result[k] += coefficients[i] * values[i][range.find(index)];
+        }
+      }
+    }
+  }
+
+  // sum of the partial combinations, in chunks as MPI counts are of type int
+  // (dense on purpose: the points touched by a rank are scattered over the whole storage, as
+  // the coarse points are shared by all full grids, so sending indices would cost as much as
+  // the values, and the result is small compared to the full grid values that stay local)
+  double* const data = result.getPointer();
+
+  for (size_t start = 0; start < N; start += INT_MAX) {
+    const int count = static_cast<int>(std::min(N - start, static_cast<size_t>(INT_MAX)));
+    MPI_Allreduce(MPI_IN_PLACE, data + start, count, MPI_DOUBLE, MPI_SUM, comm);
+  }
+}
+
+bool OperationUPCombinationGridMPI::isFullGridLocal(size_t i) const {
+  return (assignment[i] == static_cast<size_t>(rank));
+}
+
+const std::vector<size_t>& OperationUPCombinationGridMPI::getLocalFullGridIndices() const {
+  return localFullGridIndices;
+}
+
+const std::vector<size_t>& OperationUPCombinationGridMPI::getAssignment() const {
+  return assignment;
+}
+
+const CombinationGrid& OperationUPCombinationGridMPI::getGrid() const {
+  return grid;
+}
+
+const std::vector<OperationPole*>& OperationUPCombinationGridMPI::getOperationPole() const {
+  return operationPole;
+}
+
+MPI_Comm OperationUPCombinationGridMPI::getCommunicator() const {
+  return comm;
+}
+
+void OperationUPCombinationGridMPI::assignFullGrids(
+    const CombinationGridLoadBalancer& loadBalancer) {
+  int size;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &size);
+  loadBalancer.assign(grid, static_cast<size_t>(size), assignment);
+  localFullGridIndices.clear();
+
+  for (size_t i = 0; i < assignment.size(); i++) {
+    if (isFullGridLocal(i)) {
+      localFullGridIndices.push_back(i);
+    }
+  }
+}
+
+}  // namespace combigrid
+}  // namespace sgpp
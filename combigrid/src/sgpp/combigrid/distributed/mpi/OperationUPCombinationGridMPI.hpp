@@ -0,0 +1,166 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <mpi.h>
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/combigrid/distributed/CombinationGridLoadBalancer.hpp>
+#include <sgpp/combigrid/grid/CombinationGrid.hpp>
+#include <sgpp/combigrid/operation/OperationPole.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * Distributed version of OperationUPCombinationGrid for combination grids that do not fit into
+ * the memory of a single node.
+ *
+ * The full grids of the combination grid are assigned to the MPI ranks of a communicator by a
+ * CombinationGridLoadBalancer. Every rank only holds the values of its own full grids and
+ * applies the unidirectional principle to them. The combination of the values on the full
+ * grids to values on the combined sparse grid (combineSparseGridValues) is computed as a sum of
+ * the partial combinations of all ranks via MPI_Allreduce, such that every rank obtains the
+ * result. The combined grid (GridStorage) has to be the same on all ranks, which is the case
+ * if it is created via CombinationGrid::combinePoints.
+ *
+ * Only one value per sparse grid point is communicated, the values on the full grids never
+ * leave their rank. The reduction covers all sparse grid points, since the points of the full
+ * grids of a rank are spread over the whole combined grid.
+ *
+ * MPI has to be initialized before any method of this class is called.
+ */
+class OperationUPCombinationGridMPI {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param grid            combination grid (the same on all ranks)
+   * @param operationPole   vector of unique_ptr to 1D pole operators
+   *                        (do not destruct before this object)
+   * @param comm            MPI communicator
+   * @param loadBalancer    load balancer for the assignment of the full grids to the ranks
+   */
+  OperationUPCombinationGridMPI(const CombinationGrid& grid,
+      const std::vector<std::unique_ptr<OperationPole>>& operationPole,
+      MPI_Comm comm = MPI_COMM_WORLD,
+      const CombinationGridLoadBalancer& loadBalancer = CombinationGridLoadBalancer());
+
+  /**
+   * Constructor.
+   *
+   * @param grid            combination grid (the same on all ranks)
+   * @param operationPole   vector of pointers to 1D pole operators
+   *                        (do not delete before this object)
+   * @param comm            MPI communicator
+   * @param loadBalancer    load balancer for the assignment of the full grids to the ranks
+   */
+  OperationUPCombinationGridMPI(const CombinationGrid& grid,
+      const std::vector<OperationPole*>& operationPole, MPI_Comm comm = MPI_COMM_WORLD,
+      const CombinationGridLoadBalancer& loadBalancer = CombinationGridLoadBalancer());
+
+  /**
+   * Constructor for the special case where the same OperationPole should be used for all
+   * dimensions.
+   *
+   * @param grid            combination grid (the same on all ranks)
+   * @param operationPole   1D pole operator (do not destruct before this object)
+   * @param comm            MPI communicator
+   * @param loadBalancer    load balancer for the assignment of the full grids to the ranks
+   */
+  OperationUPCombinationGridMPI(const CombinationGrid& grid, OperationPole& operationPole,
+      MPI_Comm comm = MPI_COMM_WORLD,
+      const CombinationGridLoadBalancer& loadBalancer = CombinationGridLoadBalancer());
+
+  /**
+   * Apply the unidirectional principle in-place on the full grids of this rank.
+   *
+   * @param[in,out] values  vector of vectors with values on the full grids, every vector
+   *                        corresponds to one full grid of the combination grid; only the
+   *                        vectors of the full grids of this rank are accessed (the others
+   *                        may be empty), they have the same size as the number of grid
+   *                        points of the respective full grid (the order of DataVector entries
+   *                        is given by IndexVectorRange)
+   */
+  void apply(std::vector<base::DataVector>& values);
+
+  /**
+   * Combine scalars associated to every full grid point using a weighted sum
+   * (weighted by the coefficients of the combination grid), like
+   * CombinationGrid::combineSparseGridValues, but with the full grids distributed over the
+   * ranks. This is a collective operation, i.e., it has to be called on all ranks.
+   *
+   * @param[in] gridStorage   GridStorage containing the combined grid (the same on all ranks)
+   * @param[in] values        vector of vectors with values on the full grids, see apply
+   *                          (only the vectors of the full grids of this rank are accessed)
+   * @param[out] result       vector resulting from the combination, same order as
+   *                          \c gridStorage (the same on all ranks)
+   */
+  void combineSparseGridValues(const base::GridStorage& gridStorage,
+                               const std::vector<base::DataVector>& values,
+                               base::DataVector& result) const;
+
+  /**
+   * @param i   index of a full grid of the combination grid
+   * @return whether the full grid is assigned to this rank
+   */
+  bool isFullGridLocal(size_t i) const;
+
+  /**
+   * @return indices of the full grids assigned to this rank
+   */
+  const std::vector<size_t>& getLocalFullGridIndices() const;
+
+  /**
+   * @return vector of ranks, same size as the number of full grids (the i-th full grid is
+   *         assigned to the rank assignment[i])
+   */
+  const std::vector<size_t>& getAssignment() const;
+
+  /**
+   * @return combination grid
+   */
+  const CombinationGrid& getGrid() const;
+
+  /**
+   * @return vector of pointers to 1D pole operators (do not delete before this object)
+   */
+  const std::vector<OperationPole*>& getOperationPole() const;
+
+  /**
+   * @return MPI communicator
+   */
+  MPI_Comm getCommunicator() const;
+
+ protected:
+  /// combination grid
+  CombinationGrid grid;
+  /// vector of pointers to 1D pole operators
+  std::vector<OperationPole*> operationPole;
+  /// MPI communicator
+  MPI_Comm comm;
+  /// rank of this process in the communicator
+  int rank;
+  /// ranks of the full grids
+  std::vector<size_t> assignment;
+  /// indices of the full grids of this rank
+  std::vector<size_t> localFullGridIndices;
+
+  /**
+   * Assign the full grids to the ranks of the communicator.
+   *
+   * @param loadBalancer    load balancer
+   */
+  void assignFullGrids(const CombinationGridLoadBalancer& loadBalancer);
+};
+
+}  // namespace combigrid
+}  // namespace sgpp
@@ -8,11 +8,17 @@
 #include <sgpp/combigrid/operation/OperationEvalCombinationGrid.hpp>
 #include <sgpp/combigrid/operation/OperationEvalFullGrid.hpp>
 
+#include <algorithm>
 #include <vector>
 
 namespace sgpp {
 namespace combigrid {
 
+namespace {
+/// number of points evaluated by one task in multiEval
+const size_t POINT_BLOCK_SIZE = 64;
+}  // namespace
+
 OperationEvalCombinationGrid::OperationEvalCombinationGrid(const CombinationGrid& grid) :
     grid(grid) {
 }
@@ -34,17 +40,46 @@ double OperationEvalCombinationGrid::eval(const std::vector<base::DataVector>& s
 void OperationEvalCombinationGrid::multiEval(const std::vector<base::DataVector>& surpluses,
     const base::DataMatrix& points, base::DataVector& result) {
   const std::vector<FullGrid>& fullGrids = grid.getFullGrids();
-  base::DataMatrix values(points.getNrows(), fullGrids.size());
-  base::DataVector curValues(points.getNrows());
-  OperationEvalFullGrid operationEvalFullGrid;
+  const base::DataVector& coefficients = grid.getCoefficients();
+  const size_t numberOfFullGrids = fullGrids.size();
+  const size_t n = points.getNrows();
+  const size_t dim = points.getNcols();
+  const size_t numberOfBlocks = (n + POINT_BLOCK_SIZE - 1) / POINT_BLOCK_SIZE;
+  result.resize(n);
+  result.setAll(0.0);
 
-  for (size_t i = 0; i < fullGrids.size(); i++) {
-    operationEvalFullGrid.setGrid(fullGrids[i]);
-    operationEvalFullGrid.multiEval(surpluses[i], points, curValues);
-    values.setColumn(i, curValues);
-  }
+  // every task evaluates all full grids at one block of points and adds the weighted values
+  // to its part of the result in the order of the full grids, so no matrix of all full grid
+  // values is needed and the result does not depend on the scheduling of the tasks
+#pragma omp parallel
+  {
+    OperationEvalFullGrid operationEvalFullGrid;
+    base::DataMatrix blockPoints(0, dim);
+    base::DataVector blockValues;
 
-  grid.combineValues(values, result);
+#pragma omp for schedule(dynamic)
+    for (size_t block = 0; block < numberOfBlocks; block++) {
+      const size_t start = block * POINT_BLOCK_SIZE;
+      const size_t end = std::min(start + POINT_BLOCK_SIZE, n);
+
+      blockPoints.resizeRowsCols(end - start, dim);
+      std::copy(points.getPointer() + start * dim, points.getPointer() + end * dim,
+          blockPoints.getPointer());
+
+      for (size_t i = 0; i < numberOfFullGrids; i++) {
+        if (coefficients[i] == 0.0) {
+          continue;
+        }
+
+        operationEvalFullGrid.setGrid(fullGrids[i]);
+        operationEvalFullGrid.multiEval(surpluses[i], blockPoints, blockValues);
+
+        for (size_t j = start; j < end; j++) {
+          result[j] += coefficients[i] * blockValues[j - start];
+        }
+      }
+    }
+  }
 }
 
 const CombinationGrid& OperationEvalCombinationGrid::getGrid() const {
@@ -43,6 +43,9 @@ class OperationEvalCombinationGrid {
 
   /**
    * Evaluate a combination grid function at multiple points.
+   * The blocks of points are distributed among OpenMP threads, every thread accumulates the
+   * weighted values of all full grids for its blocks in a fixed order, such that the result is
+   * reproducible.
    *
    * @param[in] surpluses   coefficients for the basis functions (may be nodal/hierarchical),
    *                        every vector corresponds to one full grid (the order of DataVector
@@ -59,6 +59,36 @@ class OperationPole {
    */
   virtual void apply(base::DataVector& values, size_t start, size_t step, size_t count,
       level_t level, bool hasBoundary = true) = 0;
+
+  /**
+   * Apply the operator on multiple poles of the same length at once. The first grid points of
+   * the poles are start, start + poleStep, ..., start + (numberOfPoles - 1) * poleStep.
+   * For poleStep = 1 (adjacent poles in a dimension other than the first one), the grid points
+   * with the same 1D index are contiguous in memory, which implementations should exploit by
+   * processing all poles in the innermost loop.
+   *
+   * This method is called concurrently for disjoint sets of poles by OperationUPFullGrid, so
+   * implementations have to be thread-safe. The default implementation calls the single-pole
+   * apply for every pole.
+   *
+   * @param[in,out] values      data vector for all full grid points
+   *                            (the order is given by IndexVectorRange)
+   * @param[in] start           sequence number of the first grid point of the first pole
+   * @param[in] step            difference of sequence numbers of two subsequent grid points of
+   *                            a pole
+   * @param[in] count           number of grid points of every pole
+   * @param[in] numberOfPoles   number of poles
+   * @param[in] poleStep        difference of sequence numbers of the first grid points of two
+   *                            subsequent poles
+   * @param[in] level           level of the full grid
+   * @param[in] hasBoundary     whether the full grid has points on the boundary
+   */
+  virtual void applyToPoles(base::DataVector& values, size_t start, size_t step, size_t count,
+      size_t numberOfPoles, size_t poleStep, level_t level, bool hasBoundary = true) {
+    for (size_t p = 0; p < numberOfPoles; p++) {
+      apply(values, start + p * poleStep, step, count, level, hasBoundary);
+    }
+  }
 };
 
 }  // namespace combigrid
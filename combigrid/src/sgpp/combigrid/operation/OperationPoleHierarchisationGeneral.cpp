@@ -4,6 +4,7 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/combigrid/operation/OperationPoleHierarchisationGeneral.hpp>
 
 #include <cmath>
@@ -55,6 +56,34 @@ void OperationPoleHierarchisationGeneral::apply(base::DataVector& values, size_t
   }
 }
 
+void OperationPoleHierarchisationGeneral::applyToPoles(base::DataVector& values, size_t start,
+    size_t step, size_t count, size_t numberOfPoles, size_t poleStep, level_t level,
+    bool hasBoundary) {
+  // local copies of the system and the solver, as this method may be called concurrently
+  HierarchisationGeneralSLE curSLE(sle);
+  const base::sle_solver::Auto curSLESolver;
+  // solve for all poles at once, such that the system has to be set up only once
+  base::DataMatrix rhs(count, numberOfPoles);
+  base::DataMatrix solution(count, numberOfPoles);
+
+  for (size_t i = 0; i < count; i++) {
+    for (size_t p = 0; p < numberOfPoles; p++) {
+      rhs(i, p) = values[start + i * step + p * poleStep];
+    }
+  }
+
+  curSLE.setDimension(count);
+  curSLE.setLevel(level);
+  curSLE.setHasBoundary(hasBoundary);
+  curSLESolver.solve(curSLE, rhs, solution);
+
+  for (size_t i = 0; i < count; i++) {
+    for (size_t p = 0; p < numberOfPoles; p++) {
+      values[start + i * step + p * poleStep] = solution(i, p);
+    }
+  }
+}
+
 OperationPoleHierarchisationGeneral::HierarchisationGeneralSLE::HierarchisationGeneralSLE(
     base::Basis<level_t, index_t>& basis, size_t dim, level_t level,
     bool isBasisHierarchical, bool hasBoundary) :
@@ -68,7 +97,7 @@ OperationPoleHierarchisationGeneral::HierarchisationGeneralSLE::~Hierarchisation
 double OperationPoleHierarchisationGeneral::HierarchisationGeneralSLE::getMatrixEntry(
     size_t i, size_t j) {
   level_t levelBasis = level;
-  index_t indexBasis = static_cast<index_t>(j);
+  index_t indexBasis = static_cast<index_t>(j + (hasBoundary_ ? 0 : 1));
 
   if (isBasisHierarchical_) {
     HeterogeneousBasis::hierarchizeLevelIndex(levelBasis, indexBasis);
@@ -76,6 +76,14 @@ class OperationPoleHierarchisationGeneral : public OperationPole {
   void apply(base::DataVector& values, size_t start, size_t step, size_t count,
       level_t level, bool hasBoundary = true) override;
 
+  /**
+   * @copydoc OperationPole::applyToPoles
+   *
+   * The linear system is set up once and solved for all poles as multiple right-hand sides.
+   */
+  void applyToPoles(base::DataVector& values, size_t start, size_t step, size_t count,
+      size_t numberOfPoles, size_t poleStep, level_t level, bool hasBoundary = true) override;
+
  protected:
   /**
    * Class for the system of linear equations for hierarchising.
@@ -17,15 +17,44 @@ OperationPoleHierarchisationLinear::~OperationPoleHierarchisationLinear() {
 
 void OperationPoleHierarchisationLinear::apply(base::DataVector& values, size_t start, size_t step,
     size_t count, level_t level, bool hasBoundary) {
+  applyToPoles(values, start, step, count, 1, 1, level, hasBoundary);
+}
+
+void OperationPoleHierarchisationLinear::applyToPoles(base::DataVector& values, size_t start,
+    size_t step, size_t count, size_t numberOfPoles, size_t poleStep, level_t level,
+    bool hasBoundary) {
+  double* const data = values.getPointer();
   index_t hInv = static_cast<index_t>(1) << level;
   index_t h = 1;
 
   for (level_t l = level; l > 0; l--) {
+    const size_t offset = step * h;
     size_t k = start + step * (h - (hasBoundary ? 0 : 1));
 
     for (index_t i = 1; i < hInv; i += 2) {
-      values[k] -= (values[k - step * h] + values[k + step * h]) / 2.0;
-      k += 2 * h;
+      // without boundary points, the values on the boundary are zero
+      const bool hasLeftNeighbor = (hasBoundary || (i > 1));
+      const bool hasRightNeighbor = (hasBoundary || (i < hInv - 1));
+
+      // the poles are processed in the innermost loop, which is contiguous for poleStep = 1
+      if (hasLeftNeighbor && hasRightNeighbor) {
+        for (size_t p = 0; p < numberOfPoles; p++) {
+          const size_t j = k + p * poleStep;
+          data[j] -= (data[j - offset] + data[j + offset]) / 2.0;
+        }
+      } else if (hasLeftNeighbor) {
+        for (size_t p = 0; p < numberOfPoles; p++) {
+          const size_t j = k + p * poleStep;
+          data[j] -= data[j - offset] / 2.0;
+        }
+      } else if (hasRightNeighbor) {
+        for (size_t p = 0; p < numberOfPoles; p++) {
+          const size_t j = k + p * poleStep;
+          data[j] -= data[j + offset] / 2.0;
+        }
+      }
+
+      k += 2 * offset;
     }
 
     hInv /= 2;
@@ -42,6 +42,14 @@ class OperationPoleHierarchisationLinear : public OperationPole {
    */
   void apply(base::DataVector& values, size_t start, size_t step, size_t count,
       level_t level, bool hasBoundary = true) override;
+
+  /**
+   * @copydoc OperationPole::applyToPoles
+   *
+   * The poles are updated together level by level.
+   */
+  void applyToPoles(base::DataVector& values, size_t start, size_t step, size_t count,
+      size_t numberOfPoles, size_t poleStep, level_t level, bool hasBoundary = true) override;
 };
 
 }  // namespace combigrid
@@ -17,33 +17,52 @@ OperationPoleNodalisationBspline::~OperationPoleNodalisationBspline() {
 
 void OperationPoleNodalisationBspline::apply(base::DataVector& values, size_t start, size_t step,
     size_t count, level_t level, bool hasBoundary) {
+  applyToPoles(values, start, step, count, 1, 1, level, hasBoundary);
+}
+
+void OperationPoleNodalisationBspline::applyToPoles(base::DataVector& values, size_t start,
+    size_t step, size_t count, size_t numberOfPoles, size_t poleStep, level_t level,
+    bool hasBoundary) {
   switch (degree) {
     case 1: {
       // do nothing, as nodal coefficients equal values
       break;
     }
     case 3: {
+      // Thomas algorithm for the tridiagonal system, performed in-place for all poles at once
+      // (the modified diagonal does not depend on the right-hand side)
       const double a = 1.0/6.0;
       const double b = 2.0/3.0;
       const double c = a;
+      double* const data = values.getPointer();
       base::DataVector b2(count, b);
-      base::DataVector d2(count);
-      d2[0] = values[start];
       size_t j = start + step;
 
       for (size_t i = 1; i < count; i++) {
         const double w = a / b2[i-1];
         b2[i] -= w * c;
-        d2[i] = values[j] - w * d2[i-1];
+
+        for (size_t p = 0; p < numberOfPoles; p++) {
+          const size_t k = j + p * poleStep;
+          data[k] -= w * data[k-step];
+        }
+
         j += step;
       }
 
       j -= step;
-      values[j] = d2[count-1] / b2[count-1];
+
+      for (size_t p = 0; p < numberOfPoles; p++) {
+        data[j + p * poleStep] /= b2[count-1];
+      }
 
       for (size_t i = count-1; i-- > 0; ) {
         j -= step;
-        values[j] = (d2[i] - c * values[j+step]) / b2[i];
+
+        for (size_t p = 0; p < numberOfPoles; p++) {
+          const size_t k = j + p * poleStep;
+          data[k] = (data[k] - c * data[k+step]) / b2[i];
+        }
       }
 
       break;
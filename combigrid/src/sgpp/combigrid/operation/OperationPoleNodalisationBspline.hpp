@@ -48,6 +48,15 @@ class OperationPoleNodalisationBspline : public OperationPole {
   void apply(base::DataVector& values, size_t start, size_t step, size_t count,
       level_t level, bool hasBoundary = true) override;
 
+  /**
+   * @copydoc OperationPole::applyToPoles
+   *
+   * For cubic B-splines, the elimination factors of the Thomas algorithm are computed once
+   * for all poles.
+   */
+  void applyToPoles(base::DataVector& values, size_t start, size_t step, size_t count,
+      size_t numberOfPoles, size_t poleStep, level_t level, bool hasBoundary = true) override;
+
  protected:
   /// B-spline degree
   size_t degree;
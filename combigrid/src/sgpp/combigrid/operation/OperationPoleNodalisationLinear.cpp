@@ -20,5 +20,11 @@ void OperationPoleNodalisationLinear::apply(base::DataVector& values, size_t sta
   // do nothing, as nodal coefficients equal values
 }
 
+void OperationPoleNodalisationLinear::applyToPoles(base::DataVector& values, size_t start,
+    size_t step, size_t count, size_t numberOfPoles, size_t poleStep, level_t level,
+    bool hasBoundary) {
+  // do nothing, as nodal coefficients equal values
+}
+
 }  // namespace combigrid
 }  // namespace sgpp
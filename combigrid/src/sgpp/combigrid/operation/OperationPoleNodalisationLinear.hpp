@@ -48,6 +48,14 @@ class OperationPoleNodalisationLinear : public OperationPole {
    */
   void apply(base::DataVector& values, size_t start, size_t step, size_t count,
       level_t level, bool hasBoundary = true) override;
+
+  /**
+   * @copydoc OperationPole::applyToPoles
+   *
+   * Does nothing, as nodal coefficients equal values.
+   */
+  void applyToPoles(base::DataVector& values, size_t start, size_t step, size_t count,
+      size_t numberOfPoles, size_t poleStep, level_t level, bool hasBoundary = true) override;
 };
 
 }  // namespace combigrid
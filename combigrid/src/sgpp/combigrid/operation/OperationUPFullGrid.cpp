@@ -6,14 +6,19 @@
 #include <sgpp/globaldef.hpp>
 #include <sgpp/combigrid/LevelIndexTypes.hpp>
 #include <sgpp/combigrid/operation/OperationUPFullGrid.hpp>
-#include <sgpp/combigrid/tools/IndexVectorRange.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
 namespace sgpp {
 namespace combigrid {
 
+namespace {
+/// maximum number of poles processed by one task in apply
+const size_t POLE_BLOCK_SIZE = 32;
+}  // namespace
+
 OperationUPFullGrid::OperationUPFullGrid(const FullGrid& grid,
     const std::vector<std::unique_ptr<OperationPole>>& operationPole) :
     grid(grid), operationPole() {
@@ -33,38 +38,31 @@ OperationUPFullGrid::OperationUPFullGrid(const FullGrid& grid, OperationPole& op
 void OperationUPFullGrid::apply(base::DataVector& values) {
   const size_t dim = grid.getDimension();
   const bool hasBoundary = grid.hasBoundary();
-  FullGrid gridProjection(LevelVector(dim-1, 0), grid.getBasis(), grid.hasBoundary());
-  LevelVector& levelProjection = gridProjection.getLevel();
-  IndexVectorRange range(grid);
-  IndexVector indexStart(dim);
+  const LevelVector& level = grid.getLevel();
+  const size_t numberOfGridPoints = grid.getNumberOfIndexVectors();
+  // the first dimension is the fastest one in the order given by IndexVectorRange
   size_t step = 1;
 
   for (size_t d = 0; d < dim; d++) {
-    const LevelVector& level = grid.getLevel();
-
-    for (size_t d2 = 0; d2 < dim; d2++) {
-      if (d2 < d) {
-        levelProjection[d2] = level[d2];
-      } else if (d2 > d) {
-        levelProjection[d2-1] = level[d2];
-      }
-    }
-
-    range.setGrid(grid);
-    const index_t count = grid.getNumberOfIndexVectors(d);
-    IndexVectorRange rangeProjection(gridProjection);
-    indexStart[d] = grid.getMinIndex(d);
-
-    for (const IndexVector& indexProjection : rangeProjection) {
-      for (size_t d2 = 0; d2 < dim; d2++) {
-        if (d2 < d) {
-          indexStart[d2] = indexProjection[d2];
-      } else if (d2 > d) {
-          indexStart[d2] = indexProjection[d2-1];
-        }
-      }
-
-      operationPole[d]->apply(values, range.find(indexStart), step, count, level[d], hasBoundary);
+    const size_t count = grid.getNumberOfIndexVectors(d);
+    OperationPole& operationPole1d = *operationPole[d];
+    // the poles in the d-th dimension start at q * step * count + o with 0 <= o < step
+    const size_t numberOfOuterBlocks = numberOfGridPoints / (step * count);
+    // every task processes up to POLE_BLOCK_SIZE poles; in the first dimension, these are
+    // subsequent contiguous poles, otherwise adjacent poles with the same q, such that the
+    // innermost loop of the pole operation runs over contiguous memory
+    const size_t poleStep = ((step == 1) ? count : 1);
+    const size_t polesPerOuterBlock = ((step == 1) ? numberOfOuterBlocks : step);
+    const size_t tasksPerOuterBlock = (polesPerOuterBlock + POLE_BLOCK_SIZE - 1) / POLE_BLOCK_SIZE;
+    const size_t numberOfTasks = ((step == 1) ? 1 : numberOfOuterBlocks) * tasksPerOuterBlock;
+
+#pragma omp parallel for schedule(dynamic)
+    for (size_t task = 0; task < numberOfTasks; task++) {
+      const size_t q = task / tasksPerOuterBlock;
+      const size_t o = (task % tasksPerOuterBlock) * POLE_BLOCK_SIZE;
+      operationPole1d.applyToPoles(values, q * step * count + o * poleStep, step, count,
+                                   std::min(POLE_BLOCK_SIZE, polesPerOuterBlock - o), poleStep,
+                                   level[d], hasBoundary);
     }
 
     step *= count;
@@ -53,6 +53,10 @@ class OperationUPFullGrid {
   /**
    * Apply the unidirectional principle in-place.
    *
+   * The dimensions are processed one after another. Within a dimension, the poles are split
+   * into blocks of adjacent poles, which are processed in parallel via
+   * OperationPole::applyToPoles (the OperationPole objects must therefore be thread-safe).
+   *
    * @param[in,out] values  data vector, same size as the number of grid points of the full grid
    *                        (the order is given by IndexVectorRange)
    */
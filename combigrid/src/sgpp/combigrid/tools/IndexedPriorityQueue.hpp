@@ -0,0 +1,215 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/globaldef.hpp>
+
+#include <functional>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * Max-priority queue (binary heap) whose entries can be accessed, updated, and removed via their
+ * keys in \f$\mathcal{O}(\log n)\f$ time, where \f$n\f$ is the number of entries.
+ *
+ * Entries with equal priorities are ordered by their keys (smaller key first), such that the
+ * order of the entries does not depend on the order of insertion.
+ *
+ * @tparam Key      key type
+ * @tparam Compare  strict weak ordering of keys
+ */
+template <class Key, class Compare = std::less<Key>>
+class IndexedPriorityQueue {
+ public:
+  /// type of the entries (key and priority)
+  typedef std::pair<Key, double> Entry;
+
+  /**
+   * Default constructor, creates an empty queue.
+   */
+  IndexedPriorityQueue() : heap(), positions(), compare() {}
+
+  /**
+   * @return whether the queue is empty
+   */
+  bool empty() const { return heap.empty(); }
+
+  /**
+   * @return number of entries
+   */
+  size_t size() const { return heap.size(); }
+
+  /**
+   * @param key   key
+   * @return whether the queue contains an entry with the given key
+   */
+  bool contains(const Key& key) const { return (positions.find(key) != positions.end()); }
+
+  /**
+   * @param key   key (must be contained in the queue)
+   * @return priority of the entry with the given key
+   */
+  double getPriority(const Key& key) const { return heap[positions.at(key)].second; }
+
+  /**
+   * @return entry with the highest priority (the queue must not be empty)
+   */
+  const Entry& top() const { return heap.front(); }
+
+  /**
+   * Insert an entry or update the priority of an existing entry.
+   *
+   * @param key       key
+   * @param priority  priority
+   */
+  void push(const Key& key, double priority) {
+    const auto it = positions.find(key);
+
+    if (it == positions.end()) {
+      heap.emplace_back(key, priority);
+      positions[key] = heap.size() - 1;
+      siftUp(heap.size() - 1);
+    } else {
+      const size_t i = it->second;
+      heap[i].second = priority;
+      siftDown(siftUp(i));
+    }
+  }
+
+  /**
+   * Remove the entry with the highest priority (the queue must not be empty).
+   */
+  void pop() { removeAt(0); }
+
+  /**
+   * Remove the entry with the given key, if it exists.
+   *
+   * @param key   key
+   * @return whether an entry was removed
+   */
+  bool remove(const Key& key) {
+    const auto it = positions.find(key);
+
+    if (it == positions.end()) {
+      return false;
+    } else {
+      removeAt(it->second);
+      return true;
+    }
+  }
+
+  /**
+   * Remove all entries.
+   */
+  void clear() {
+    heap.clear();
+    positions.clear();
+  }
+
+  /**
+   * @return all entries in heap order (only the first entry has a defined position)
+   */
+  const std::vector<Entry>& getEntries() const { return heap; }
+
+ protected:
+  /// binary heap of entries
+  std::vector<Entry> heap;
+  /// positions of the entries in the heap, indexed by their keys
+  std::map<Key, size_t, Compare> positions;
+  /// ordering of keys
+  Compare compare;
+
+  /**
+   * @param i   position in the heap
+   * @param j   position in the heap
+   * @return whether the i-th entry has to be before the j-th entry
+   */
+  bool isBefore(size_t i, size_t j) const {
+    return (heap[i].second > heap[j].second) ||
+           ((heap[i].second == heap[j].second) && compare(heap[i].first, heap[j].first));
+  }
+
+  /**
+   * Swap two entries of the heap.
+   *
+   * @param i   position in the heap
+   * @param j   position in the heap
+   */
+  void swapEntries(size_t i, size_t j) {
+    std::swap(heap[i], heap[j]);
+    positions[heap[i].first] = i;
+    positions[heap[j].first] = j;
+  }
+
+  /**
+   * Move an entry towards the root until the heap property is restored.
+   *
+   * @param i   position in the heap
+   * @return new position of the entry
+   */
+  size_t siftUp(size_t i) {
+    while ((i > 0) && isBefore(i, (i - 1) / 2)) {
+      swapEntries(i, (i - 1) / 2);
+      i = (i - 1) / 2;
+    }
+
+    return i;
+  }
+
+  /**
+   * Move an entry towards the leaves until the heap property is restored.
+   *
+   * @param i   position in the heap
+   * @return new position of the entry
+   */
+  size_t siftDown(size_t i) {
+    const size_t n = heap.size();
+
+    while (true) {
+      size_t first = i;
+
+      for (size_t child = 2 * i + 1; (child <= 2 * i + 2) && (child < n); child++) {
+        if (isBefore(child, first)) {
+          first = child;
+        }
+      }
+
+      if (first == i) {
+        return i;
+      }
+
+      swapEntries(i, first);
+      i = first;
+    }
+  }
+
+  /**
+   * Remove an entry of the heap.
+   *
+   * @param i   position in the heap
+   */
+  void removeAt(size_t i) {
+    const size_t last = heap.size() - 1;
+
+    if (i != last) {
+      swapEntries(i, last);
+    }
+
+    positions.erase(heap[last].first);
+    heap.pop_back();
+
+    if (i < heap.size()) {
+      siftDown(siftUp(i));
+    }
+  }
+};
+
+}  // namespace combigrid
+}  // namespace sgpp
@@ -11,6 +11,11 @@
 
 #include <sgpp/combigrid/basis/HeterogeneousBasis.hpp>
 
+#include <sgpp/combigrid/distributed/CombinationGridLoadBalancer.hpp>
+#ifdef USE_MPI
+#include <sgpp/combigrid/distributed/mpi/OperationUPCombinationGridMPI.hpp>
+#endif /* USE_MPI */
+
 #include <sgpp/combigrid/grid/CombinationGrid.hpp>
 #include <sgpp/combigrid/grid/FullGrid.hpp>
 
@@ -26,4 +31,5 @@
 
 #include <sgpp/combigrid/tools/IndexVectorIterator.hpp>
 #include <sgpp/combigrid/tools/IndexVectorRange.hpp>
+#include <sgpp/combigrid/tools/IndexedPriorityQueue.hpp>
 #include <sgpp/combigrid/tools/LevelVectorTools.hpp>
@@ -6,6 +6,7 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE SGppCombigridModule
 
+#include <sgpp/base/exception/application_exception.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearBasis.hpp>
@@ -14,9 +15,11 @@
 #include <sgpp/combigrid/LevelIndexTypes.hpp>
 #include <sgpp/combigrid/adaptive/AdaptiveCombinationGridGenerator.hpp>
 #include <sgpp/combigrid/basis/HeterogeneousBasis.hpp>
+#include <sgpp/combigrid/distributed/CombinationGridLoadBalancer.hpp>
 #include <sgpp/combigrid/grid/CombinationGrid.hpp>
 #include <sgpp/combigrid/grid/FullGrid.hpp>
 #include <sgpp/combigrid/operation/OperationEvalCombinationGrid.hpp>
+#include <sgpp/combigrid/operation/OperationEvalFullGrid.hpp>
 #include <sgpp/combigrid/operation/OperationPole.hpp>
 #include <sgpp/combigrid/operation/OperationPoleHierarchisationGeneral.hpp>
 #include <sgpp/combigrid/operation/OperationPoleHierarchisationLinear.hpp>
@@ -25,27 +28,37 @@
 #include <sgpp/combigrid/operation/OperationUPCombinationGrid.hpp>
 #include <sgpp/combigrid/operation/OperationUPFullGrid.hpp>
 #include <sgpp/combigrid/tools/IndexVectorRange.hpp>
+#include <sgpp/combigrid/tools/IndexedPriorityQueue.hpp>
 #include <sgpp/combigrid/tools/LevelVectorTools.hpp>
 
 #include <boost/test/unit_test.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <functional>
+#include <list>
+#include <map>
 #include <memory>
 #include <numeric>
+#include <random>
+#include <set>
+#include <utility>
 #include <vector>
 
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
 using sgpp::combigrid::AdaptiveCombinationGridGenerator;
 using sgpp::combigrid::CombinationGrid;
+using sgpp::combigrid::CombinationGridLoadBalancer;
 using sgpp::combigrid::FullGrid;
 using sgpp::combigrid::HeterogeneousBasis;
 using sgpp::combigrid::IndexVector;
 using sgpp::combigrid::IndexVectorRange;
+using sgpp::combigrid::IndexedPriorityQueue;
 using sgpp::combigrid::LevelVector;
 using sgpp::combigrid::LevelVectorTools;
 using sgpp::combigrid::OperationEvalCombinationGrid;
+using sgpp::combigrid::OperationEvalFullGrid;
 using sgpp::combigrid::OperationPole;
 using sgpp::combigrid::OperationPoleHierarchisationGeneral;
 using sgpp::combigrid::OperationPoleHierarchisationLinear;
@@ -371,6 +384,44 @@ BOOST_AUTO_TEST_CASE(testOperationEvalCombinationGrid) {
   op.multiEval(surpluses, points, result);
   BOOST_CHECK_EQUAL(result[0], -3.9375);
   BOOST_CHECK_EQUAL(result[1], -3.9375);
+
+  // more points than fit into one block of the parallel evaluation
+  const HeterogeneousBasis basis3d(3, basis1d, false);
+  const CombinationGrid combinationGrid3d =
+      CombinationGrid::fromRegularSparse(3, 4, basis3d, false);
+  OperationEvalCombinationGrid op3d(combinationGrid3d);
+  std::vector<DataVector> surpluses3d;
+
+  for (const FullGrid& fullGrid : combinationGrid3d.getFullGrids()) {
+    DataVector curSurpluses(fullGrid.getNumberOfIndexVectors());
+
+    for (size_t k = 0; k < curSurpluses.getSize(); k++) {
+      curSurpluses[k] = std::sin(static_cast<double>(k + surpluses3d.size()));
+    }
+
+    surpluses3d.push_back(curSurpluses);
+  }
+
+  DataMatrix points3d(500, 3);
+
+  for (size_t k = 0; k < points3d.getSize(); k++) {
+    points3d[k] = 0.5 + 0.5 * std::sin(static_cast<double>(3 * k));
+  }
+
+  op3d.multiEval(surpluses3d, points3d, result);
+  BOOST_CHECK_EQUAL(result.getSize(), points3d.getNrows());
+
+  DataVector point3d(3);
+
+  for (size_t j = 0; j < points3d.getNrows(); j++) {
+    points3d.getRow(j, point3d);
+    BOOST_CHECK_SMALL(result[j] - op3d.eval(surpluses3d, point3d), 1e-12);
+  }
+
+  // the result must not depend on the scheduling of the threads
+  DataVector result2;
+  op3d.multiEval(surpluses3d, points3d, result2);
+  BOOST_CHECK_EQUAL_COLLECTIONS(result2.begin(), result2.end(), result.begin(), result.end());
 }
 
 BOOST_AUTO_TEST_CASE(testOperationUPFullGridLinear) {
@@ -423,6 +474,45 @@ BOOST_AUTO_TEST_CASE(testOperationUPFullGridGeneral) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(testOperationUPFullGridInterpolation) {
+  // grids with more poles than fit into one block of the parallel application, such that the
+  // coefficients are checked by evaluating the interpolant at the grid points
+  sgpp::base::SLinearBase linearBasis1d;
+  sgpp::base::SBsplineBase bsplineBasis1d(3);
+  OperationPoleHierarchisationLinear operationPoleLinear;
+  OperationPoleNodalisationBspline operationPoleBspline(3);
+  OperationPoleHierarchisationGeneral operationPoleGeneral(bsplineBasis1d);
+
+  const std::vector<std::pair<HeterogeneousBasis, OperationPole*>> cases = {
+      {HeterogeneousBasis(3, linearBasis1d), &operationPoleLinear},
+      {HeterogeneousBasis(3, bsplineBasis1d, false), &operationPoleBspline},
+      {HeterogeneousBasis(3, bsplineBasis1d), &operationPoleGeneral}};
+
+  for (const std::pair<HeterogeneousBasis, OperationPole*>& curCase : cases) {
+    for (bool hasBoundary : {true, false}) {
+      const FullGrid fullGrid({3, 4, 3}, curCase.first, hasBoundary);
+      const size_t n = fullGrid.getNumberOfIndexVectors();
+      DataVector values(n);
+
+      for (size_t k = 0; k < n; k++) {
+        values[k] = std::sin(static_cast<double>(k));
+      }
+
+      DataVector surpluses(values);
+      OperationUPFullGrid(fullGrid, *curCase.second).apply(surpluses);
+
+      DataMatrix points;
+      IndexVectorRange::getPoints(fullGrid, points);
+      DataVector result;
+      OperationEvalFullGrid(fullGrid).multiEval(surpluses, points, result);
+
+      for (size_t k = 0; k < n; k++) {
+        BOOST_CHECK_SMALL(result[k] - values[k], 1e-10);
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(testOperationUPCombinationGrid) {
   sgpp::base::SBsplineBase basis1d;
   const HeterogeneousBasis basis(2, basis1d);
@@ -482,6 +572,62 @@ BOOST_AUTO_TEST_CASE(testOperationUPCombinationGrid) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(testCombinationGridLoadBalancer) {
+  sgpp::base::SLinearBase basis1d;
+  const HeterogeneousBasis basis(3, basis1d);
+  const CombinationGrid combinationGrid = CombinationGrid::fromRegularSparse(3, 6, basis);
+  const std::vector<FullGrid>& fullGrids = combinationGrid.getFullGrids();
+  const CombinationGridLoadBalancer loadBalancer;
+  std::vector<size_t> assignment;
+
+  for (size_t numberOfProcesses : {1, 3, 4, 100}) {
+    loadBalancer.assign(combinationGrid, numberOfProcesses, assignment);
+    BOOST_CHECK_EQUAL(assignment.size(), fullGrids.size());
+
+    std::vector<double> loads(numberOfProcesses, 0.0);
+    double maxCost = 0.0;
+
+    for (size_t i = 0; i < fullGrids.size(); i++) {
+      BOOST_CHECK_LT(assignment[i], numberOfProcesses);
+      const double cost = CombinationGridLoadBalancer::getDefaultCost(fullGrids[i]);
+      loads[assignment[i]] += cost;
+      maxCost = std::max(maxCost, cost);
+    }
+
+    // greedy assignment: the loads differ by at most the largest cost of a full grid
+    const double minLoad = *std::min_element(loads.begin(), loads.end());
+    const double maxLoad = *std::max_element(loads.begin(), loads.end());
+    BOOST_CHECK_LE(maxLoad - minLoad, maxCost);
+
+    // the assignment is deterministic
+    std::vector<size_t> assignment2;
+    loadBalancer.assign(combinationGrid, numberOfProcesses, assignment2);
+    BOOST_CHECK(assignment == assignment2);
+  }
+
+  // custom cost function: only the full grids with the largest level sum have costs
+  auto isFinestFullGrid = [](const FullGrid& fullGrid) {
+    const LevelVector& level = fullGrid.getLevel();
+    return (std::accumulate(level.begin(), level.end(), 0u) == 6);
+  };
+  const CombinationGridLoadBalancer loadBalancerCustom(
+      [&isFinestFullGrid](const FullGrid& fullGrid) {
+        return (isFinestFullGrid(fullGrid) ? 1.0 : 0.0);
+      });
+  loadBalancerCustom.assign(combinationGrid, 2, assignment);
+  int difference = 0;
+
+  for (size_t i = 0; i < fullGrids.size(); i++) {
+    if (isFinestFullGrid(fullGrids[i])) {
+      difference += ((assignment[i] == 0) ? 1 : -1);
+    }
+  }
+
+  BOOST_CHECK_LE(std::abs(difference), 1);
+  BOOST_CHECK_THROW(loadBalancer.assign(combinationGrid, 0, assignment),
+                    sgpp::base::application_exception);
+}
+
 namespace std {
 // needed for BOOST_CHECK_EQUAL_COLLECTIONS in next test
 using sgpp::base::operator<<;
@@ -573,3 +719,191 @@ BOOST_AUTO_TEST_CASE(testAdaptiveCombinationGridGenerator) {
                                   largerSubspaces.begin(), largerSubspaces.end());
   }
 }
+
+BOOST_AUTO_TEST_CASE(testIndexedPriorityQueue) {
+  IndexedPriorityQueue<int> queue;
+  std::map<int, double> reference;
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<int> keyDistribution(0, 49);
+  std::uniform_int_distribution<int> priorityDistribution(0, 9);
+  std::uniform_int_distribution<int> operationDistribution(0, 3);
+
+  for (size_t i = 0; i < 2000; i++) {
+    const int key = keyDistribution(generator);
+
+    switch (operationDistribution(generator)) {
+      case 0:
+      case 1: {
+        // insert or update (with few distinct priorities to test the tie-breaking)
+        const double priority = static_cast<double>(priorityDistribution(generator));
+        queue.push(key, priority);
+        reference[key] = priority;
+        break;
+      }
+      case 2: {
+        BOOST_CHECK_EQUAL(queue.remove(key), reference.erase(key) > 0);
+        break;
+      }
+      case 3: {
+        if (!reference.empty()) {
+          // highest priority, smallest key for equal priorities
+          const auto expected = std::max_element(
+              reference.begin(), reference.end(),
+              [](const std::pair<const int, double>& a, const std::pair<const int, double>& b) {
+                return a.second < b.second;
+              });
+          BOOST_CHECK_EQUAL(queue.top().first, expected->first);
+          BOOST_CHECK_EQUAL(queue.top().second, expected->second);
+          reference.erase(queue.top().first);
+          queue.pop();
+        }
+
+        break;
+      }
+    }
+
+    BOOST_CHECK_EQUAL(queue.size(), reference.size());
+    BOOST_CHECK_EQUAL(queue.contains(key), reference.find(key) != reference.end());
+
+    if (queue.contains(key)) {
+      BOOST_CHECK_EQUAL(queue.getPriority(key), reference[key]);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testAdaptiveCombinationGridGeneratorIncremental) {
+  sgpp::base::SLinearBase basis1d;
+  const sgpp::combigrid::WeightedRelevanceCalculator relevanceCalculator;
+  const sgpp::combigrid::AveragingPriorityEstimator priorityEstimator;
+
+  // the large active set in two dimensions makes the generator enumerate the affected levels
+  // instead of scanning the active set
+  for (size_t dim : {2, 3}) {
+    const size_t n = (dim == 2) ? 12 : 2;
+    const sgpp::combigrid::level_t maxLevel = (dim == 2) ? 15 : 5;
+    HeterogeneousBasis basis(dim, basis1d);
+    const CombinationGrid combinationGrid = CombinationGrid::fromRegularSparse(dim, n, basis);
+    auto generator = AdaptiveCombinationGridGenerator::fromCombinationGrid(combinationGrid);
+    const size_t initialOldSetSize = generator.getOldSet().size();
+
+    // QoIs arrive in random order, also for levels that are not yet in the active set
+    std::vector<LevelVector> levels =
+        LevelVectorTools::generateHyperCube(LevelVector(dim, 0), LevelVector(dim, maxLevel));
+    std::mt19937 randomNumberGenerator(1);
+    std::shuffle(levels.begin(), levels.end(), randomNumberGenerator);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+    for (size_t i = 0; i < levels.size(); i++) {
+      generator.setQoIInformation(levels[i], distribution(randomNumberGenerator));
+
+      // every few QoIs, compare the relevances and estimated priorities with a recomputation
+      // from scratch, then adapt once and compare with the most relevant level of the active set
+      if (i % 5 == 4) {
+        std::map<LevelVector, double> expectedRelevance;
+        std::map<LevelVector, double> expectedPriorities;
+
+        for (const LevelVector& level : generator.getActiveSet()) {
+          const double delta = generator.getDelta(level);
+          const auto it = generator.getSubspacesAndQoIs().find(level);
+
+          if (!std::isnan(delta)) {
+            expectedRelevance[level] = relevanceCalculator.calculate(level, delta);
+          }
+
+          if ((it == generator.getSubspacesAndQoIs().end()) || std::isnan(it->second)) {
+            std::map<LevelVector, double> deltasOfDownwardNeighbors;
+
+            for (size_t d = 0; d < dim; d++) {
+              if (level[d] > generator.getMinimumLevelVector()[d]) {
+                LevelVector neighborLevel = level;
+                neighborLevel[d]--;
+                const double neighborDelta = generator.getDelta(neighborLevel);
+
+                if (!std::isnan(neighborDelta)) {
+                  deltasOfDownwardNeighbors[neighborLevel] = neighborDelta;
+                }
+              }
+            }
+
+            expectedPriorities[level] =
+                (deltasOfDownwardNeighbors.empty()
+                     ? 0.0
+                     : priorityEstimator.estimatePriority(level, deltasOfDownwardNeighbors));
+          }
+        }
+
+        const std::map<LevelVector, double> relevance = generator.getRelevanceOfActiveSet();
+        BOOST_CHECK(relevance == expectedRelevance);
+        const std::map<LevelVector, double> priorities = generator.getPriorityQueue();
+        BOOST_CHECK(priorities == expectedPriorities);
+
+        if (!expectedRelevance.empty()) {
+          const auto expected = std::max_element(
+              expectedRelevance.begin(), expectedRelevance.end(),
+              [](const std::pair<const LevelVector, double>& a,
+                 const std::pair<const LevelVector, double>& b) { return a.second < b.second; });
+          const LevelVector expectedLevel = expected->first;
+          BOOST_CHECK(generator.adaptNextLevelVector());
+          BOOST_CHECK(generator.getOldSet().back() == expectedLevel);
+        } else {
+          BOOST_CHECK(!generator.adaptNextLevelVector());
+        }
+      }
+    }
+
+    BOOST_CHECK_GT(generator.getOldSet().size(), initialOldSetSize + 5);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testAdaptiveCombinationGridGeneratorAsynchronous) {
+  sgpp::base::SLinearBase basis1d;
+  HeterogeneousBasis basis(2, basis1d);
+  const CombinationGrid combinationGrid = CombinationGrid::fromRegularSparse(2, 2, basis);
+  auto generator = AdaptiveCombinationGridGenerator::fromCombinationGrid(combinationGrid);
+
+  for (const LevelVector& level : generator.getOldSet()) {
+    generator.setQoIInformation(level, 1.0 / (1.0 + level[0] + 2.0 * level[1]));
+  }
+
+  const std::list<LevelVector> activeSet = generator.getActiveSet();
+  BOOST_CHECK_EQUAL(generator.getPriorityQueue().size(), activeSet.size());
+
+  // hand out the level vectors in two batches
+  const std::vector<LevelVector> firstBatch = generator.getNextLevelVectorsToCompute(2);
+  const std::vector<LevelVector> secondBatch = generator.getNextLevelVectorsToCompute(100);
+  BOOST_CHECK_EQUAL(firstBatch.size(), 2);
+  BOOST_CHECK_EQUAL(firstBatch.size() + secondBatch.size(), activeSet.size());
+  BOOST_CHECK(generator.getNextLevelVectorsToCompute(1).empty());
+  BOOST_CHECK_EQUAL(generator.getLevelVectorsInProgress().size(), activeSet.size());
+
+  const std::map<LevelVector, double> priorities = generator.getPriorityQueue();
+  BOOST_CHECK_GE(priorities.at(firstBatch[0]), priorities.at(firstBatch[1]));
+
+  for (const LevelVector& level : secondBatch) {
+    BOOST_CHECK(std::find(firstBatch.begin(), firstBatch.end(), level) == firstBatch.end());
+    BOOST_CHECK_LE(priorities.at(level), priorities.at(firstBatch[1]));
+  }
+
+  // a cancelled level vector is handed out again
+  generator.cancelComputation(secondBatch.back());
+  const std::vector<LevelVector> retry = generator.getNextLevelVectorsToCompute(3);
+  BOOST_CHECK_EQUAL(retry.size(), 1);
+  BOOST_CHECK(retry[0] == secondBatch.back());
+
+  // the QoI of the second level vector arrives first
+  generator.setQoIInformation(firstBatch[1], 0.5);
+  BOOST_CHECK_EQUAL(generator.getLevelVectorsInProgress().size(), activeSet.size() - 1);
+  BOOST_CHECK(generator.adaptNextLevelVector());
+  BOOST_CHECK(generator.getOldSet().back() == firstBatch[1]);
+  BOOST_CHECK(!generator.adaptNextLevelVector());
+
+  // only new level vectors of the active set are handed out while the others are in progress
+  const std::list<LevelVector> newActiveSet = generator.getActiveSet();
+
+  for (const LevelVector& level : generator.getNextLevelVectorsToCompute(100)) {
+    BOOST_CHECK(std::find(newActiveSet.begin(), newActiveSet.end(), level) != newActiveSet.end());
+    BOOST_CHECK(std::find(activeSet.begin(), activeSet.end(), level) == activeSet.end());
+  }
+
+  BOOST_CHECK_EQUAL(generator.getLevelVectorsInProgress().size(), newActiveSet.size());
+}
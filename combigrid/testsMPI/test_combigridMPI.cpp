@@ -0,0 +1,147 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE SGppCombigridMPIModule
+
+#include <mpi.h>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/LinearBasis.hpp>
+#include <sgpp/base/tools/Printer.hpp>
+
+#include <sgpp/combigrid/LevelIndexTypes.hpp>
+#include <sgpp/combigrid/basis/HeterogeneousBasis.hpp>
+#include <sgpp/combigrid/distributed/CombinationGridLoadBalancer.hpp>
+#include <sgpp/combigrid/distributed/mpi/OperationUPCombinationGridMPI.hpp>
+#include <sgpp/combigrid/grid/CombinationGrid.hpp>
+#include <sgpp/combigrid/grid/FullGrid.hpp>
+#include <sgpp/combigrid/operation/OperationPole.hpp>
+#include <sgpp/combigrid/operation/OperationPoleHierarchisationGeneral.hpp>
+#include <sgpp/combigrid/operation/OperationPoleHierarchisationLinear.hpp>
+#include <sgpp/combigrid/operation/OperationUPCombinationGrid.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/version.hpp>
+
+#include <cmath>
+#include <vector>
+
+using sgpp::base::DataVector;
+using sgpp::combigrid::CombinationGrid;
+using sgpp::combigrid::CombinationGridLoadBalancer;
+using sgpp::combigrid::FullGrid;
+using sgpp::combigrid::HeterogeneousBasis;
+using sgpp::combigrid::OperationPole;
+using sgpp::combigrid::OperationUPCombinationGrid;
+using sgpp::combigrid::OperationUPCombinationGridMPI;
+
+/**
+ * Initializes MPI for all tests, run the test executable with mpirun.
+ */
+struct FixtureMPI {
+  FixtureMPI() {
+    MPI_Init(&boost::unit_test::framework::master_test_suite().argc,
+             &boost::unit_test::framework::master_test_suite().argv);
+    sgpp::base::Printer::getInstance().setVerbosity(-1);
+  }
+
+  ~FixtureMPI() { MPI_Finalize(); }
+};
+
+#if BOOST_VERSION >= 105900
+BOOST_GLOBAL_FIXTURE(FixtureMPI);
+#else
+BOOST_GLOBAL_FIXTURE(FixtureMPI)
+#endif /* BOOST_VERSION >= 105900 */
+
+/**
+ * Hierarchises the values of a test function on the full grids and combines the surpluses,
+ * once distributed over the ranks of MPI_COMM_WORLD and once sequentially on every rank, and
+ * checks that both results coincide.
+ */
+void checkDistributedCombination(const CombinationGrid& combinationGrid,
+                                 OperationPole& operationPole,
+                                 const CombinationGridLoadBalancer& loadBalancer) {
+  const std::vector<FullGrid>& fullGrids = combinationGrid.getFullGrids();
+  const size_t dim = combinationGrid.getDimension();
+  sgpp::base::GridStorage gridStorage(dim);
+  combinationGrid.combinePoints(gridStorage);
+
+  DataVector fX(gridStorage.getSize());
+  DataVector x(dim);
+
+  for (size_t k = 0; k < gridStorage.getSize(); k++) {
+    gridStorage.getPoint(k).getStandardCoordinates(x);
+    fX[k] = std::sin(7.0 * x[0] - 3.0) * std::exp(x[dim - 1]);
+  }
+
+  std::vector<DataVector> values;
+  combinationGrid.distributeValuesToFullGrids(gridStorage, fX, values);
+
+  // sequential reference
+  std::vector<DataVector> sequentialValues(values);
+  OperationUPCombinationGrid(combinationGrid, operationPole).apply(sequentialValues);
+  DataVector sequentialResult;
+  combinationGrid.combineSparseGridValues(gridStorage, sequentialValues, sequentialResult);
+
+  // distributed computation, every rank only holds its own full grids
+  OperationUPCombinationGridMPI operation(combinationGrid, operationPole, MPI_COMM_WORLD,
+                                          loadBalancer);
+  std::vector<DataVector> distributedValues(fullGrids.size());
+
+  for (size_t i : operation.getLocalFullGridIndices()) {
+    distributedValues[i] = values[i];
+  }
+
+  operation.apply(distributedValues);
+  DataVector distributedResult;
+  operation.combineSparseGridValues(gridStorage, distributedValues, distributedResult);
+
+  // every full grid has to be assigned to exactly one rank
+  int numberOfLocalFullGrids = static_cast<int>(operation.getLocalFullGridIndices().size());
+  int numberOfFullGrids = 0;
+  MPI_Allreduce(&numberOfLocalFullGrids, &numberOfFullGrids, 1, MPI_INT, MPI_SUM,
+                MPI_COMM_WORLD);
+  BOOST_CHECK_EQUAL(static_cast<size_t>(numberOfFullGrids), fullGrids.size());
+
+  BOOST_CHECK_EQUAL(distributedResult.getSize(), sequentialResult.getSize());
+
+  for (size_t k = 0; k < sequentialResult.getSize(); k++) {
+    BOOST_CHECK_SMALL(distributedResult[k] - sequentialResult[k], 1e-10);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationUPCombinationGridMPILinear) {
+  sgpp::base::SLinearBase basis1d;
+
+  for (size_t dim : {1, 2, 3}) {
+    const HeterogeneousBasis basis(dim, basis1d);
+    sgpp::combigrid::OperationPoleHierarchisationLinear operationPole;
+
+    for (bool hasBoundary : {true, false}) {
+      const CombinationGrid combinationGrid =
+          CombinationGrid::fromRegularSparse(dim, 5, basis, hasBoundary);
+      checkDistributedCombination(combinationGrid, operationPole,
+                                  CombinationGridLoadBalancer());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationUPCombinationGridMPIBspline) {
+  const size_t dim = 2;
+  sgpp::base::SBsplineBase basis1d(3);
+  const HeterogeneousBasis basis(dim, basis1d);
+  sgpp::combigrid::OperationPoleHierarchisationGeneral operationPole(basis1d);
+  const CombinationGrid combinationGrid = CombinationGrid::fromRegularSparse(dim, 4, basis);
+
+  // all full grids on one rank, the other ranks only contribute zeros to the reduction
+  const CombinationGridLoadBalancer loadBalancerSingleRank([](const FullGrid&) { return 0.0; });
+
+  checkDistributedCombination(combinationGrid, operationPole, CombinationGridLoadBalancer());
+  checkDistributedCombination(combinationGrid, operationPole, loadBalancerSingleRank);
+}
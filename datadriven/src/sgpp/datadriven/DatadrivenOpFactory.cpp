@@ -440,7 +440,7 @@ base::OperationMultipleEval* createOperationMultipleEval(
     if (configuration.getType() == datadriven::OperationMultipleEvalType::DEFAULT ||
         configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING) {
       if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
-        return new datadriven::OperationMultiEvalStreaming(grid, dataset);
+        return new datadriven::OperationMultiEvalStreaming(grid, dataset, configuration);
       }
       if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::OCLMP) {
 #ifdef USE_OCL
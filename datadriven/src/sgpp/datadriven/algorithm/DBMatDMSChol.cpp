@@ -50,6 +50,90 @@ void DBMatDMSChol::solve(sgpp::base::DataMatrix& decompMatrix, sgpp::base::DataV
   // std::cout << alpha.toString() << std::endl;
 }
 
+void DBMatDMSChol::solveMultipleRHS(sgpp::base::DataMatrix& decompMatrix,
+                                    sgpp::base::DataMatrix& alphas,
+                                    const sgpp::base::DataMatrix& bs, double lambda_old,
+                                    double lambda_new) const {
+  size_t size = decompMatrix.getNcols();
+  size_t numberOfRHS = bs.getNcols();
+
+  if (bs.getNrows() != size) {
+    throw sgpp::base::data_exception(
+        "DBMatDMSChol::solveMultipleRHS: Size of DecomposedMatrix and right hand sides don't "
+        "match");
+  }
+
+  double lambda_up = lambda_new - lambda_old;
+
+  // If regularization paramter is changed enter
+  if (lambda_up != 0.0) {
+    choleskyUpdateLambda(decompMatrix, lambda_up);
+  }
+
+  // the substitutions work in place on the right hand sides
+  alphas = bs;
+
+  if (numberOfRHS == 0) {
+    return;
+  }
+
+#ifdef USE_GSL
+  gsl_matrix_view l_view = gsl_matrix_view_array(decompMatrix.getPointer(), size, size);
+  gsl_matrix_view alphas_view = gsl_matrix_view_array(alphas.getPointer(), size, numberOfRHS);
+
+  // Forward Substitution: L Y = B
+  gsl_blas_dtrsm(CblasLeft, CblasLower, CblasNoTrans, CblasNonUnit, 1.0, &l_view.matrix,
+                 &alphas_view.matrix);
+
+  // Backward Substitution: L' X = Y
+  gsl_blas_dtrsm(CblasLeft, CblasLower, CblasTrans, CblasNonUnit, 1.0, &l_view.matrix,
+                 &alphas_view.matrix);
+#else
+  // rows of the (row-major) right hand side matrix are updated as a whole
+  double* x = alphas.getPointer();
+
+  // Forward Substitution: L Y = B
+  for (size_t i = 0; i < size; i++) {
+    double* xi = x + i * numberOfRHS;
+
+    for (size_t j = 0; j < i; j++) {
+      const double lij = decompMatrix.get(i, j);
+      const double* xj = x + j * numberOfRHS;
+
+      for (size_t k = 0; k < numberOfRHS; k++) {
+        xi[k] -= lij * xj[k];
+      }
+    }
+
+    const double lii = decompMatrix.get(i, i);
+
+    for (size_t k = 0; k < numberOfRHS; k++) {
+      xi[k] /= lii;
+    }
+  }
+
+  // Backward Substitution: L' X = Y
+  for (size_t i = size; i-- > 0;) {
+    double* xi = x + i * numberOfRHS;
+
+    for (size_t j = i + 1; j < size; j++) {
+      const double lji = decompMatrix.get(j, i);
+      const double* xj = x + j * numberOfRHS;
+
+      for (size_t k = 0; k < numberOfRHS; k++) {
+        xi[k] -= lji * xj[k];
+      }
+    }
+
+    const double lii = decompMatrix.get(i, i);
+
+    for (size_t k = 0; k < numberOfRHS; k++) {
+      xi[k] /= lii;
+    }
+  }
+#endif /* USE_GSL */
+}
+
 void DBMatDMSChol::solveParallel(DataMatrixDistributed& decompMatrix, DataVectorDistributed& x,
                                  double lambda_old, double lambda_new) const {
 #ifdef USE_SCALAPACK
@@ -36,6 +36,23 @@ class DBMatDMSChol : public DBMatDecompMatrixSolver {
   virtual void solve(sgpp::base::DataMatrix& decompMatrix, sgpp::base::DataVector& alpha,
                      const sgpp::base::DataVector& b, double lambda_old, double lambda_new) const;
 
+  /**
+   * Solves a system of equations for several right hand sides at once. The triangular solves
+   * process all right hand sides together (level-3 BLAS if GSL is available), such that each
+   * entry of the factor is loaded once per solve instead of once per right hand side.
+   *
+   * @param decompMatrix the LL' lower triangular cholesky factor
+   * @param alphas the matrix of unknowns, one column per right hand side (the result is stored
+   * there)
+   * @param bs the right hand sides of the equation system, one per column
+   * @param lambda_old the current regularization paramter
+   * @param lambda_new the new regularization paramter (e.g. if cross-validation
+   * is applied)
+   */
+  virtual void solveMultipleRHS(sgpp::base::DataMatrix& decompMatrix,
+                                sgpp::base::DataMatrix& alphas, const sgpp::base::DataMatrix& bs,
+                                double lambda_old, double lambda_new) const;
+
   /**
    * Parallel (distributed) version of solve.
    * @param decompMatrix the LL' lower triangular cholesky factor
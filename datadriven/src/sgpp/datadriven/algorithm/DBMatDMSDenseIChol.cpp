@@ -31,6 +31,21 @@ DBMatDMSDenseIChol::DBMatDMSDenseIChol(
   }
 }
 
+void DBMatDMSDenseIChol::solveMultipleRHS(DataMatrix& decompMatrix, DataMatrix& alphas,
+                                          const DataMatrix& bs, double lambda_old,
+                                          double lambda_new) const {
+  DataVector alpha(decompMatrix.getNcols());
+  DataVector b(bs.getNrows());
+  alphas.resizeZero(decompMatrix.getNcols(), bs.getNcols());
+
+  for (size_t j = 0; j < bs.getNcols(); j++) {
+    bs.getColumn(j, b);
+    // the regularization parameter is updated with the first right hand side only
+    solve(decompMatrix, alpha, b, (j == 0) ? lambda_old : lambda_new, lambda_new);
+    alphas.setColumn(j, alpha);
+  }
+}
+
 void DBMatDMSDenseIChol::choleskyUpdateLambda(sgpp::base::DataMatrix& decompMatrix,
                                               double lambdaUpdate) const {
   updateProxyMatrixLambda(lambdaUpdate);
@@ -26,6 +26,19 @@ class DBMatDMSDenseIChol : public DBMatDMSChol {
       const sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig,
       Grid& grid, double lambda, bool doCV);
 
+  /**
+   * The Jacobi sweeps of the substitutions work on single vectors, hence the right hand sides are
+   * solved for one after another.
+   *
+   * @param decompMatrix the LL' lower triangular incomplete cholesky factor
+   * @param alphas the matrix of unknowns, one column per right hand side
+   * @param bs the right hand sides of the equation system, one per column
+   * @param lambda_old the current regularization paramter
+   * @param lambda_new the new regularization paramter
+   */
+  void solveMultipleRHS(DataMatrix& decompMatrix, DataMatrix& alphas, const DataMatrix& bs,
+                        double lambda_old, double lambda_new) const override;
+
  protected:
   /**
    * Update the regularization factor of the decomposition. This is a very costly operation as the
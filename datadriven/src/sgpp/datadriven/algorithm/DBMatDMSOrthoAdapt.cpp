@@ -92,6 +92,71 @@ void DBMatDMSOrthoAdapt::solve(sgpp::base::DataMatrix& T_inv, sgpp::base::DataMa
 #endif /* USE_GSL */
 }
 
+void DBMatDMSOrthoAdapt::solveMultipleRHS(sgpp::base::DataMatrix& T_inv,
+                                          sgpp::base::DataMatrix& Q, sgpp::base::DataMatrix& B,
+                                          sgpp::base::DataMatrix& bs,
+                                          sgpp::base::DataMatrix& alphas) {
+#ifdef USE_GSL
+  // assert dimensions
+  bool prior_refined = (B.getNcols() > 1);  // if B.getNcols <= 1, then no refining yet
+
+  if (prior_refined && (B.getNcols() != bs.getNrows())) {
+    throw sgpp::base::algorithm_exception(
+        "In DBMatDMSOrthoAdapt::solveMultipleRHS: Matrix B and right hand sides don't match for "
+        "mult.");
+  }
+
+  if (!prior_refined && (Q.getNrows() != bs.getNrows())) {
+    throw sgpp::base::algorithm_exception(
+        "In DBMatDMSOrthoAdapt::solveMultipleRHS: right hand sides do not match Q * T^{-1} * Q^t");
+  }
+
+  size_t size = Q.getNrows();
+  size_t numberOfRHS = bs.getNcols();
+  alphas = sgpp::base::DataMatrix(bs.getNrows(), numberOfRHS, 0.0);
+
+  if (numberOfRHS == 0) {
+    return;
+  }
+
+  // as in solve, Q * T_inv * Q_t * bs is capped to the size of the non refined grid, whose rows
+  // are the first rows of the (row-major) right hand sides
+  gsl_matrix_view q_view = gsl_matrix_view_array(Q.getPointer(), Q.getNrows(), Q.getNcols());
+  gsl_matrix_view t_inv_view =
+      gsl_matrix_view_array(T_inv.getPointer(), T_inv.getNrows(), T_inv.getNcols());
+  gsl_matrix_view bs_view_cut = gsl_matrix_view_array(bs.getPointer(), size, numberOfRHS);
+  gsl_matrix_view alphas_view_cut = gsl_matrix_view_array(alphas.getPointer(), size, numberOfRHS);
+
+  sgpp::base::DataMatrix interim(size, numberOfRHS);
+  gsl_matrix_view interim_view = gsl_matrix_view_array(interim.getPointer(), size, numberOfRHS);
+
+  // calculating Q^t * bs
+  gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, &q_view.matrix, &bs_view_cut.matrix, 0.0,
+                 &alphas_view_cut.matrix);
+
+  // calculating T^{-1} * Q^t * bs
+  gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, &t_inv_view.matrix, &alphas_view_cut.matrix,
+                 0.0, &interim_view.matrix);
+
+  // calculating Q * T^{-1} * Q^t * bs
+  gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, &q_view.matrix, &interim_view.matrix, 0.0,
+                 &alphas_view_cut.matrix);
+
+  // add the B*bs term, if B should be considered
+  if (prior_refined && B.getNcols() != Q.getNcols()) {
+    gsl_matrix_view b_matrix_view =
+        gsl_matrix_view_array(B.getPointer(), B.getNrows(), B.getNcols());
+    gsl_matrix_view bs_view = gsl_matrix_view_array(bs.getPointer(), bs.getNrows(), numberOfRHS);
+    gsl_matrix_view alphas_view =
+        gsl_matrix_view_array(alphas.getPointer(), alphas.getNrows(), numberOfRHS);
+    gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, &b_matrix_view.matrix, &bs_view.matrix, 1.0,
+                   &alphas_view.matrix);
+  }
+#else
+  throw sgpp::base::algorithm_exception("USE_GSL not set");
+#endif /* USE_GSL */
+}
+
 void DBMatDMSOrthoAdapt::solveParallel(DataMatrixDistributed& T_inv, DataMatrixDistributed& Q,
                                        DataMatrixDistributed& B, DataVectorDistributed& b,
                                        DataVectorDistributed& alpha) {
@@ -40,6 +40,20 @@ class DBMatDMSOrthoAdapt : public DBMatDecompMatrixSolver {
   void solve(sgpp::base::DataMatrix& T_inv, sgpp::base::DataMatrix& Q, sgpp::base::DataMatrix& B,
              sgpp::base::DataVector& b, sgpp::base::DataVector& alpha);
 
+  /**
+   * Solves the system for several right hand sides at once with matrix-matrix products.
+   * The computation done: alphas = Q*T_inv*Q^t*bs + B*bs
+   *
+   * @param T_inv Inverse of a tridiagonal matrix
+   * @param Q     Orthogonal matrix, part of hessenberg_decomp of the lhs matrix
+   * @param B     Storage of the online objects refined/coarsened points
+   * @param bs    The right sides of the system, one per column
+   * @param alphas The solutions of the system, one per column, computed values go there
+   */
+  void solveMultipleRHS(sgpp::base::DataMatrix& T_inv, sgpp::base::DataMatrix& Q,
+                        sgpp::base::DataMatrix& B, sgpp::base::DataMatrix& bs,
+                        sgpp::base::DataMatrix& alphas);
+
   /**
    * Parallel (distributed) version of solve.
    *
@@ -18,10 +18,6 @@
 #include <sgpp/pde/operation/hash/OperationMatrixLTwoDotExplicitModLinear.hpp>
 #include <sgpp/base/tools/StringTokenizer.hpp>
 
-#ifdef USE_GSL
-#include <gsl/gsl_matrix_double.h>
-#endif /* USE_GSL */
-
 #include <math.h>
 #include <stdio.h>
 #include <algorithm>
@@ -72,8 +68,10 @@ DBMatOffline& sgpp::datadriven::DBMatOffline::operator=(const DBMatOffline& rhs)
 
 DBMatOffline::DBMatOffline(const std::string& filepath)
     : lhsMatrix(), isConstructed(true), isDecomposed(true), lhsInverse() {
-  // Parse the interactions
-  parseInter(filepath, interactions);
+  // Parse the interactions, binary files are read completely by load() in the subclasses
+  if (!DBMatOfflineBinaryFile::isBinaryFile(filepath)) {
+    parseInter(filepath, interactions);
+  }
 
   // Parsing of lhsMatrix will be done in subclass implementations
 }
@@ -166,46 +164,31 @@ void DBMatOffline::buildMatrix(Grid* grid,
 }
 
 void DBMatOffline::store(const std::string& fileName) {
-#ifdef USE_GSL
   if (!isDecomposed) {
     throw algorithm_exception("Matrix not decomposed yet");
   }
 
-  // Write configuration
-  std::ofstream outputFile(fileName, std::ofstream::out);
-
-  if (!outputFile) {
-    throw algorithm_exception{"cannot open file for writing"};
-  }
+  std::vector<DBMatOfflineBinaryFile::Block> blocks;
+  getStoredBlocks(blocks);
+  DBMatOfflineBinaryFile::write(fileName, getDecompositionType(), interactions, blocks);
 
-  std::string inter = "," + std::to_string(interactions.size());
-  for (const std::set<size_t>& i : interactions) {
-    inter.append("," + std::to_string(i.size()));
-    for (size_t j : i) {
-      inter.append("," + std::to_string(j));
-    }
-  }
+  std::cout << "Stored " << lhsMatrix.getNrows() << "x" << lhsMatrix.getNcols() << " matrix"
+            << std::endl;
+}
 
-  outputFile << lhsMatrix.getNrows() << "," << lhsMatrix.getNcols() << ","
-             << static_cast<int>(getDecompositionType()) << inter << "\n";
-  outputFile.close();
+void DBMatOffline::getStoredBlocks(std::vector<DBMatOfflineBinaryFile::Block>& blocks) {
+  blocks.push_back(DBMatOfflineBinaryFile::Block::fromMatrix(lhsMatrix));
+}
 
-  // write matrix
-  // switch to c FILE API for GSL
-  FILE* outputCFile = fopen(fileName.c_str(), "ab");
-  if (!outputCFile) {
-    throw algorithm_exception{"cannot open file for writing"};
-  }
-  gsl_matrix_view matrixView =
-      gsl_matrix_view_array(lhsMatrix.getPointer(), lhsMatrix.getNrows(), lhsMatrix.getNcols());
-  gsl_matrix_fwrite(outputCFile, &matrixView.matrix);
+void DBMatOffline::load(const DBMatOfflineBinaryFile& file) {
+  interactions = file.getInteractions();
+  readStoredBlocks(file);
+  isConstructed = true;
+  isDecomposed = true;
+}
 
-  fclose(outputCFile);
-  std::cout << "Stored " << lhsMatrix.getNrows() << "x" << lhsMatrix.getNcols() << " matrix"
-            << std::endl;
-#else
-  throw base::not_implemented_exception("built without GSL");
-#endif /* USE_GSL */
+void DBMatOffline::readStoredBlocks(const DBMatOfflineBinaryFile& file) {
+  file.readMatrix(0, lhsMatrix);
 }
 
 void DBMatOffline::decomposeMatrixParallel(RegularizationConfiguration& regularizationConfig,
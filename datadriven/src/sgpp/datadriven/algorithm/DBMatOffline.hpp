@@ -6,6 +6,7 @@
 #pragma once
 
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineBinaryFile.hpp>
 #include <sgpp/datadriven/configuration/DensityEstimationConfiguration.hpp>
 #include <sgpp/datadriven/configuration/ParallelConfiguration.hpp>
 #include <sgpp/datadriven/configuration/RegularizationConfiguration.hpp>
@@ -39,7 +40,8 @@ class DBMatOffline {
  public:
   /**
    * Constructor
-   * Create offline object from serialized offline object
+   * Create offline object from serialized offline object (either in the binary format written
+   * by store() or in the legacy text header format)
    *
    * @param fileName path to the file that stores serialized offline object
    */
@@ -227,11 +229,20 @@ class DBMatOffline {
                                         const ParallelConfiguration& parallelConfig);
 
   /**
-   * Serialize the DBMatOffline Object
+   * Serialize the DBMatOffline Object into a versioned binary file (see DBMatOfflineBinaryFile).
+   * The blocks written are determined by getStoredBlocks().
    * @param fileName path where to store the file.
    */
   virtual void store(const std::string& fileName);
 
+  /**
+   * Replaces the matrices and interactions by the ones stored in an opened binary file (see
+   * store()). The file is mapped only once per load, the blocks are copied straight from the
+   * mapping into the matrices of this object.
+   * @param file binary file whose decomposition type matches this object
+   */
+  void load(const DBMatOfflineBinaryFile& file);
+
   /**
    * Returns the dimensionality of the quadratic lhs matrix (i.e. the number of rows)
    * @return the grid size
@@ -266,6 +277,20 @@ class DBMatOffline {
    * @param interactions the interactions to populate
    */
   void parseInter(const std::string& fileName, std::set<std::set<size_t>>& interactions) const;
+
+  /**
+   * Collects the matrices (and index arrays) that make up the serialized object. The default
+   * implementation stores the decomposed lhs matrix only; subclasses storing additional data
+   * append it and read it back in readStoredBlocks() in the same order.
+   * @param[out] blocks blocks to write, referencing members of this object
+   */
+  virtual void getStoredBlocks(std::vector<DBMatOfflineBinaryFile::Block>& blocks);
+
+  /**
+   * Reads the blocks written by getStoredBlocks() from a binary file.
+   * @param file opened binary file
+   */
+  virtual void readStoredBlocks(const DBMatOfflineBinaryFile& file);
 };
 
 }  // namespace datadriven
@@ -0,0 +1,337 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/algorithm/DBMatOfflineBinaryFile.hpp>
+
+#include <sgpp/base/exception/algorithm_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+using sgpp::base::algorithm_exception;
+using sgpp::base::DataMatrix;
+using sgpp::base::file_exception;
+
+namespace {
+
+const char magicBytes[8] = {'S', 'G', 'P', 'P', 'D', 'B', 'M', 'T'};
+
+/// written in native byte order, reads differently on machines with another byte order
+const uint32_t byteOrderMark = 0x01020304;
+
+/// alignment of the blocks in bytes
+const size_t blockAlignment = 64;
+
+/// size of the segments that are hashed independently
+const size_t checksumSegmentSize = 1 << 20;
+
+inline size_t alignOffset(size_t offset) {
+  return (offset + blockAlignment - 1) / blockAlignment * blockAlignment;
+}
+
+inline uint64_t mixWord(uint64_t hash, uint64_t word) {
+  hash ^= word;
+  hash *= 0x9e3779b97f4a7c15ULL;
+  return hash ^ (hash >> 32);
+}
+
+void writePadding(std::ofstream& stream, size_t from, size_t to) {
+  static const char zeros[blockAlignment] = {};
+  stream.write(zeros, static_cast<std::streamsize>(to - from));
+}
+
+}  // namespace
+
+DBMatOfflineBinaryFile::Block DBMatOfflineBinaryFile::Block::fromMatrix(
+    const DataMatrix& matrix) {
+  Block block;
+  block.type = BlockType::Float64;
+  block.rows = matrix.getNrows();
+  block.cols = matrix.getNcols();
+  block.data = matrix.data();
+  return block;
+}
+
+DBMatOfflineBinaryFile::Block DBMatOfflineBinaryFile::Block::fromIndices(const size_t* indices,
+                                                                         size_t size) {
+  Block block;
+  block.type = BlockType::UInt64;
+  block.rows = 1;
+  block.cols = size;
+  block.data = indices;
+  return block;
+}
+
+uint64_t DBMatOfflineBinaryFile::checksum(const char* data, size_t size) {
+  const size_t numberOfSegments = (size + checksumSegmentSize - 1) / checksumSegmentSize;
+  std::vector<uint64_t> segmentHashes(numberOfSegments);
+
+#pragma omp parallel for schedule(static)
+  for (size_t s = 0; s < numberOfSegments; s++) {
+    const char* segment = data + s * checksumSegmentSize;
+    const size_t segmentSize = std::min(checksumSegmentSize, size - s * checksumSegmentSize);
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    size_t i = 0;
+
+    for (; i + sizeof(uint64_t) <= segmentSize; i += sizeof(uint64_t)) {
+      uint64_t word;
+      std::memcpy(&word, segment + i, sizeof(uint64_t));
+      hash = mixWord(hash, word);
+    }
+
+    for (; i < segmentSize; i++) {
+      hash = mixWord(hash, static_cast<unsigned char>(segment[i]));
+    }
+
+    segmentHashes[s] = hash;
+  }
+
+  uint64_t result = mixWord(0xcbf29ce484222325ULL, static_cast<uint64_t>(size));
+
+  for (size_t s = 0; s < numberOfSegments; s++) {
+    result = mixWord(result, segmentHashes[s]);
+  }
+
+  return result;
+}
+
+void DBMatOfflineBinaryFile::write(const std::string& fileName,
+                                   MatrixDecompositionType decompositionType,
+                                   const std::set<std::set<size_t>>& interactions,
+                                   const std::vector<Block>& blocks) {
+  // encode interactions
+  std::vector<uint64_t> interactionWords{interactions.size()};
+
+  for (const std::set<size_t>& term : interactions) {
+    interactionWords.push_back(term.size());
+    interactionWords.insert(interactionWords.end(), term.begin(), term.end());
+  }
+
+  // index blocks are stored as 64 bit integers independently of sizeof(size_t)
+  std::vector<std::vector<uint64_t>> indexBlocks(blocks.size());
+  std::vector<BlockDescriptor> table(blocks.size());
+  size_t offset = alignOffset(sizeof(Header) + blocks.size() * sizeof(BlockDescriptor) +
+                              interactionWords.size() * sizeof(uint64_t));
+
+  for (size_t b = 0; b < blocks.size(); b++) {
+    const size_t size = blocks[b].rows * blocks[b].cols;
+    const char* data = static_cast<const char*>(blocks[b].data);
+
+    if (blocks[b].type == BlockType::UInt64) {
+      const size_t* indices = static_cast<const size_t*>(blocks[b].data);
+      indexBlocks[b].assign(indices, indices + size);
+      data = reinterpret_cast<const char*>(indexBlocks[b].data());
+    }
+
+    table[b].type = static_cast<uint32_t>(blocks[b].type);
+    table[b].reserved = 0;
+    table[b].rows = blocks[b].rows;
+    table[b].cols = blocks[b].cols;
+    table[b].offset = offset;
+    table[b].checksum = checksum(data, size * sizeof(double));
+    offset = alignOffset(offset + size * sizeof(double));
+  }
+
+  Header header;
+  std::memcpy(header.magic, magicBytes, sizeof(magicBytes));
+  header.version = version;
+  header.byteOrderMark = byteOrderMark;
+  header.decompositionType = static_cast<uint32_t>(decompositionType);
+  header.reserved = 0;
+  header.numberOfBlocks = blocks.size();
+  header.numberOfInteractionWords = interactionWords.size();
+  header.fileSize = offset;
+  header.reserved2 = 0;
+
+  std::vector<char> metadata(table.size() * sizeof(BlockDescriptor) +
+                             interactionWords.size() * sizeof(uint64_t));
+  std::memcpy(metadata.data(), table.data(), table.size() * sizeof(BlockDescriptor));
+  std::memcpy(metadata.data() + table.size() * sizeof(BlockDescriptor), interactionWords.data(),
+              interactionWords.size() * sizeof(uint64_t));
+  header.metadataChecksum = checksum(metadata.data(), metadata.size());
+
+  std::ofstream stream(fileName, std::ofstream::out | std::ofstream::binary);
+
+  if (!stream) {
+    throw algorithm_exception{"cannot open file for writing"};
+  }
+
+  stream.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+  stream.write(metadata.data(), static_cast<std::streamsize>(metadata.size()));
+  size_t position = sizeof(Header) + metadata.size();
+
+  for (size_t b = 0; b < blocks.size(); b++) {
+    const size_t bytes = table[b].rows * table[b].cols * sizeof(double);
+    const char* data = (blocks[b].type == BlockType::UInt64)
+                           ? reinterpret_cast<const char*>(indexBlocks[b].data())
+                           : static_cast<const char*>(blocks[b].data);
+
+    writePadding(stream, position, table[b].offset);
+    stream.write(data, static_cast<std::streamsize>(bytes));
+    position = table[b].offset + bytes;
+  }
+
+  writePadding(stream, position, offset);
+
+  if (!stream) {
+    throw algorithm_exception{"failed to write file"};
+  }
+}
+
+bool DBMatOfflineBinaryFile::isBinaryFile(const std::string& fileName) {
+  std::ifstream stream(fileName, std::ifstream::in | std::ifstream::binary);
+  char magic[sizeof(magicBytes)];
+
+  if (!stream.read(magic, sizeof(magic))) {
+    return false;
+  }
+
+  return std::memcmp(magic, magicBytes, sizeof(magicBytes)) == 0;
+}
+
+DBMatOfflineBinaryFile::DBMatOfflineBinaryFile(const std::string& fileName)
+    : file(fileName), header(), blockTable(), interactionWords() {
+  if (file.size() < sizeof(Header)) {
+    throw file_exception("DBMatOfflineBinaryFile: file too small");
+  }
+
+  std::memcpy(&header, file.begin(), sizeof(Header));
+
+  if (std::memcmp(header.magic, magicBytes, sizeof(magicBytes)) != 0) {
+    throw file_exception("DBMatOfflineBinaryFile: not a binary offline object");
+  } else if (header.byteOrderMark != byteOrderMark) {
+    throw file_exception("DBMatOfflineBinaryFile: file was written with another byte order");
+  } else if (header.version > version) {
+    throw file_exception("DBMatOfflineBinaryFile: unsupported version");
+  } else if (header.fileSize != file.size()) {
+    throw file_exception("DBMatOfflineBinaryFile: file is truncated");
+  }
+
+  // check sizes before multiplying to rule out overflows
+  const size_t maxWords = file.size() / sizeof(uint64_t);
+
+  if ((header.numberOfBlocks > maxWords) || (header.numberOfInteractionWords > maxWords) ||
+      (sizeof(Header) + header.numberOfBlocks * sizeof(BlockDescriptor) +
+           header.numberOfInteractionWords * sizeof(uint64_t) >
+       file.size())) {
+    throw file_exception("DBMatOfflineBinaryFile: invalid header");
+  }
+
+  const char* metadata = file.begin() + sizeof(Header);
+  const size_t tableSize = header.numberOfBlocks * sizeof(BlockDescriptor);
+  const size_t interactionSize = header.numberOfInteractionWords * sizeof(uint64_t);
+
+  if (checksum(metadata, tableSize + interactionSize) != header.metadataChecksum) {
+    throw file_exception("DBMatOfflineBinaryFile: checksum mismatch in metadata");
+  }
+
+  blockTable.resize(header.numberOfBlocks);
+  std::memcpy(blockTable.data(), metadata, tableSize);
+  interactionWords.resize(header.numberOfInteractionWords);
+  std::memcpy(interactionWords.data(), metadata + tableSize, interactionSize);
+
+  for (const BlockDescriptor& descriptor : blockTable) {
+    if ((descriptor.offset % sizeof(double) != 0) || (descriptor.rows > maxWords) ||
+        (descriptor.cols > maxWords) || (descriptor.offset > file.size()) ||
+        ((descriptor.rows != 0) && (descriptor.cols > maxWords / descriptor.rows)) ||
+        (descriptor.rows * descriptor.cols * sizeof(double) > file.size() - descriptor.offset)) {
+      throw file_exception("DBMatOfflineBinaryFile: invalid block table");
+    }
+  }
+}
+
+MatrixDecompositionType DBMatOfflineBinaryFile::getDecompositionType() const {
+  return static_cast<MatrixDecompositionType>(header.decompositionType);
+}
+
+std::set<std::set<size_t>> DBMatOfflineBinaryFile::getInteractions() const {
+  std::set<std::set<size_t>> interactions;
+
+  if (interactionWords.empty()) {
+    return interactions;
+  }
+
+  size_t position = 1;
+
+  for (uint64_t term = 0; term < interactionWords[0]; term++) {
+    if ((position >= interactionWords.size()) ||
+        (interactionWords[position] > interactionWords.size() - position - 1)) {
+      throw file_exception("DBMatOfflineBinaryFile: invalid interactions");
+    }
+
+    const size_t termSize = interactionWords[position];
+    interactions.insert(std::set<size_t>(interactionWords.begin() + position + 1,
+                                         interactionWords.begin() + position + 1 + termSize));
+    position += termSize + 1;
+  }
+
+  return interactions;
+}
+
+size_t DBMatOfflineBinaryFile::getNumberOfBlocks() const { return blockTable.size(); }
+
+size_t DBMatOfflineBinaryFile::getRows(size_t block) const { return blockTable.at(block).rows; }
+
+size_t DBMatOfflineBinaryFile::getCols(size_t block) const { return blockTable.at(block).cols; }
+
+const double* DBMatOfflineBinaryFile::getMatrixData(size_t block) const {
+  if (blockTable.at(block).type != static_cast<uint32_t>(BlockType::Float64)) {
+    throw file_exception("DBMatOfflineBinaryFile: block is not a matrix");
+  }
+
+  return reinterpret_cast<const double*>(file.begin() + blockTable[block].offset);
+}
+
+const DBMatOfflineBinaryFile::BlockDescriptor& DBMatOfflineBinaryFile::verifyBlock(
+    size_t block, BlockType type) const {
+  if (block >= blockTable.size()) {
+    throw file_exception("DBMatOfflineBinaryFile: block does not exist");
+  }
+
+  const BlockDescriptor& descriptor = blockTable[block];
+
+  if (descriptor.type != static_cast<uint32_t>(type)) {
+    throw file_exception("DBMatOfflineBinaryFile: unexpected block type");
+  }
+
+  if (checksum(file.begin() + descriptor.offset,
+               descriptor.rows * descriptor.cols * sizeof(double)) != descriptor.checksum) {
+    throw file_exception("DBMatOfflineBinaryFile: checksum mismatch in block");
+  }
+
+  return descriptor;
+}
+
+void DBMatOfflineBinaryFile::readMatrix(size_t block, DataMatrix& matrix) const {
+  const BlockDescriptor& descriptor = verifyBlock(block, BlockType::Float64);
+  const double* data = reinterpret_cast<const double*>(file.begin() + descriptor.offset);
+
+  matrix.resize(descriptor.rows, descriptor.cols);
+  std::copy(data, data + descriptor.rows * descriptor.cols, matrix.data());
+}
+
+void DBMatOfflineBinaryFile::readIndices(size_t block, size_t* indices,
+                                         size_t numberOfIndices) const {
+  const BlockDescriptor& descriptor = verifyBlock(block, BlockType::UInt64);
+
+  if (descriptor.rows * descriptor.cols != numberOfIndices) {
+    throw file_exception("DBMatOfflineBinaryFile: unexpected number of indices in block");
+  }
+
+  const uint64_t* data = reinterpret_cast<const uint64_t*>(file.begin() + descriptor.offset);
+
+  std::copy(data, data + descriptor.rows * descriptor.cols, indices);
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
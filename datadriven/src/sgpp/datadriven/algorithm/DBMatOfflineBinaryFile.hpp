@@ -0,0 +1,202 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/datadriven/configuration/DensityEstimationConfiguration.hpp>
+#include <sgpp/datadriven/tools/MemoryMappedFile.hpp>
+
+#include <stdint.h>
+
+#include <cstddef>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Versioned binary container for serialized DBMatOffline objects.
+ *
+ * Layout (native byte order, recorded in the header):
+ * - 64 byte header: magic, version, byte order mark, decomposition type, number of blocks,
+ *   number of interaction words, checksum of the metadata, file size
+ * - block table: element type, shape, offset and checksum of every block
+ * - interactions as 64 bit words (number of terms, then size and dimensions of every term)
+ * - blocks (matrices in row major order or index arrays), each aligned to 64 bytes
+ *
+ * Files are read through a read-only memory mapping, so processes loading the same file share
+ * the page cache and no separate read buffer is needed. Only the header and the metadata are
+ * checked when opening a file; the checksum of a block is verified when the block is read.
+ */
+class DBMatOfflineBinaryFile {
+ public:
+  /**
+   * Element type of a block
+   */
+  enum class BlockType : uint32_t { Float64 = 1, UInt64 = 2 };
+
+  /**
+   * Description of a block to be written
+   */
+  struct Block {
+    /// element type
+    BlockType type;
+    /// number of rows
+    size_t rows;
+    /// number of columns
+    size_t cols;
+    /// pointer to rows * cols elements (double or size_t, depending on type)
+    const void* data;
+
+    /**
+     * @param matrix matrix to write (has to stay valid until the file is written)
+     * @return block describing the matrix
+     */
+    static Block fromMatrix(const sgpp::base::DataMatrix& matrix);
+
+    /**
+     * @param indices indices to write (have to stay valid until the file is written)
+     * @param size number of indices
+     * @return block describing the indices
+     */
+    static Block fromIndices(const size_t* indices, size_t size);
+  };
+
+  /**
+   * Writes a binary file.
+   *
+   * @param fileName path of the file
+   * @param decompositionType decomposition type of the offline object
+   * @param interactions interaction terms of the offline object
+   * @param blocks blocks to write
+   */
+  static void write(const std::string& fileName, MatrixDecompositionType decompositionType,
+                    const std::set<std::set<size_t>>& interactions,
+                    const std::vector<Block>& blocks);
+
+  /**
+   * Checks whether a file starts with the magic bytes of the binary format (and not with the
+   * comma-separated text header of the legacy format).
+   *
+   * @param fileName path of the file
+   * @return true if the file is a binary file
+   */
+  static bool isBinaryFile(const std::string& fileName);
+
+  /**
+   * Opens a binary file by mapping it into memory and checks its header and metadata.
+   *
+   * @param fileName path of the file
+   * @throws sgpp::base::file_exception if the file is not a valid binary file of a supported
+   *         version
+   */
+  explicit DBMatOfflineBinaryFile(const std::string& fileName);
+
+  /**
+   * @return decomposition type of the stored offline object
+   */
+  MatrixDecompositionType getDecompositionType() const;
+
+  /**
+   * @return interaction terms of the stored offline object
+   */
+  std::set<std::set<size_t>> getInteractions() const;
+
+  /**
+   * @return number of blocks
+   */
+  size_t getNumberOfBlocks() const;
+
+  /**
+   * @param block index of the block
+   * @return number of rows of the block
+   */
+  size_t getRows(size_t block) const;
+
+  /**
+   * @param block index of the block
+   * @return number of columns of the block
+   */
+  size_t getCols(size_t block) const;
+
+  /**
+   * Returns a pointer to the data of a Float64 block inside the mapping (without copying and
+   * without verifying the checksum). The pointer is valid as long as this object exists.
+   *
+   * @param block index of the block
+   * @return pointer to the row major data of the block
+   */
+  const double* getMatrixData(size_t block) const;
+
+  /**
+   * Verifies the checksum of a Float64 block and copies it into a matrix.
+   *
+   * @param block index of the block
+   * @param[out] matrix matrix, resized to the shape of the block
+   */
+  void readMatrix(size_t block, sgpp::base::DataMatrix& matrix) const;
+
+  /**
+   * Verifies the checksum of a UInt64 block and copies it into an index array.
+   * Throws a file_exception if the block does not contain exactly numberOfIndices elements.
+   *
+   * @param block index of the block
+   * @param[out] indices array of numberOfIndices elements
+   * @param numberOfIndices expected number of elements of the block
+   */
+  void readIndices(size_t block, size_t* indices, size_t numberOfIndices) const;
+
+  /// version of the format written by write()
+  static const uint32_t version = 1;
+
+ private:
+  /// fixed size header at the beginning of the file
+  struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrderMark;
+    uint32_t decompositionType;
+    uint32_t reserved;
+    uint64_t numberOfBlocks;
+    uint64_t numberOfInteractionWords;
+    uint64_t metadataChecksum;
+    uint64_t fileSize;
+    uint64_t reserved2;
+  };
+
+  /// entry of the block table
+  struct BlockDescriptor {
+    uint32_t type;
+    uint32_t reserved;
+    uint64_t rows;
+    uint64_t cols;
+    uint64_t offset;
+    uint64_t checksum;
+  };
+
+  /**
+   * Computes the checksum of a byte range. The range is split into segments of fixed size that
+   * are hashed in parallel; the result does not depend on the number of threads.
+   */
+  static uint64_t checksum(const char* data, size_t size);
+
+  /// checks the type of a block and its checksum and returns its descriptor
+  const BlockDescriptor& verifyBlock(size_t block, BlockType type) const;
+
+  /// the mapped file
+  MemoryMappedFile file;
+  /// copy of the header
+  Header header;
+  /// copy of the block table
+  std::vector<BlockDescriptor> blockTable;
+  /// copy of the interaction words
+  std::vector<uint64_t> interactionWords;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
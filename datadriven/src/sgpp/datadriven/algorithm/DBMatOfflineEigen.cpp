@@ -34,7 +34,12 @@ DBMatOfflineEigen::DBMatOfflineEigen() {}
 
 sgpp::datadriven::DBMatOfflineEigen::DBMatOfflineEigen(const std::string& fileName)
     : DBMatOffline{fileName} {
-  // Read grid size from header (number of rows in lhsMatrix)
+  if (DBMatOfflineBinaryFile::isBinaryFile(fileName)) {
+    load(DBMatOfflineBinaryFile(fileName));
+    return;
+  }
+
+  // legacy format: read grid size from header (number of rows in lhsMatrix)
   std::ifstream filestream(fileName, std::istream::in);
   // Read configuration
   if (!filestream) {
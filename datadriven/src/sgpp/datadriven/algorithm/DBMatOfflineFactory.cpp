@@ -6,6 +6,7 @@
 #include <sgpp/datadriven/algorithm/DBMatOfflineFactory.hpp>
 
 #include <sgpp/base/exception/factory_exception.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineBinaryFile.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineChol.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineDenseIChol.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineEigen.hpp>
@@ -13,6 +14,7 @@
 #include <sgpp/datadriven/algorithm/DBMatOfflineOrthoAdapt.hpp>
 #include <sgpp/base/tools/StringTokenizer.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -69,6 +71,38 @@ DBMatOffline* DBMatOfflineFactory::buildOfflineObject(
 
 DBMatOffline* DBMatOfflineFactory::buildFromFile(const std::string& fileName) {
 #ifdef USE_GSL
+  if (DBMatOfflineBinaryFile::isBinaryFile(fileName)) {
+    // map the file once and read the blocks into an empty object of the stored type
+    DBMatOfflineBinaryFile file(fileName);
+    std::unique_ptr<DBMatOffline> offline;
+
+    switch (file.getDecompositionType()) {
+      case (MatrixDecompositionType::Eigen):
+        offline.reset(new DBMatOfflineEigen());
+        break;
+      case (MatrixDecompositionType::LU):
+        offline.reset(new DBMatOfflineLU());
+        break;
+      case (MatrixDecompositionType::Chol):
+      case (MatrixDecompositionType::SMW_chol):
+        offline.reset(new DBMatOfflineChol());
+        break;
+      case (MatrixDecompositionType::DenseIchol):
+        offline.reset(new DBMatOfflineDenseIChol());
+        break;
+      case (MatrixDecompositionType::OrthoAdapt):
+      case (MatrixDecompositionType::SMW_ortho):
+        offline.reset(new DBMatOfflineOrthoAdapt());
+        break;
+      default:
+        throw factory_exception("Trying to build offline object from unknown decomposition type");
+    }
+
+    offline->load(file);
+    return offline.release();
+  }
+
+  // legacy format with comma separated text header
   std::ifstream file(fileName, std::istream::in);
 
   if (!file) {
@@ -79,16 +113,9 @@ DBMatOffline* DBMatOfflineFactory::buildFromFile(const std::string& fileName) {
   std::getline(file, str);
   file.close();
 
-  std::cout << str;
   std::vector<std::string> tokens;
   sgpp::base::StringTokenizer::tokenize(str, ",", tokens);
-  std::cout << "tokens: ";
-  for (auto& item : tokens) {
-    std::cout << item << ",";
-  }
-  std::cout << std::endl;
-
-  MatrixDecompositionType type = static_cast<MatrixDecompositionType>(std::stoi(tokens[2]));
+  auto type = static_cast<MatrixDecompositionType>(std::stoi(tokens[2]));
 
   std::cout << "type: " << static_cast<int>(type) << std::endl;
 
@@ -6,6 +6,7 @@
 #ifdef USE_GSL
 
 #include <sgpp/base/exception/algorithm_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineLU.hpp>
 #include <sgpp/base/tools/StringTokenizer.hpp>
 
@@ -76,7 +77,12 @@ DBMatOfflineLU::DBMatOfflineLU(const std::string& fileName)
   isConstructed = true;
   isDecomposed = true;
 
-  // Read grid size from header (number of rows in lhsMatrix)
+  if (DBMatOfflineBinaryFile::isBinaryFile(fileName)) {
+    load(DBMatOfflineBinaryFile(fileName));
+    return;
+  }
+
+  // legacy format: read grid size from header (number of rows in lhsMatrix)
   std::ifstream filestream(fileName, std::istream::in);
   // Read configuration
   if (!filestream) {
@@ -126,17 +132,24 @@ void DBMatOfflineLU::permuteVector(DataVector& b) {
   }
 }
 
-void DBMatOfflineLU::store(const std::string& fileName) {
-  // first store header and matrix
-  DBMatOffline::store(fileName);
-  // then store permutation.
-  // c file API needed for GSL
-  FILE* outputCFile = fopen(fileName.c_str(), "ab");
-  if (!outputCFile) {
-    throw algorithm_exception{"cannot open file for writing"};
+void DBMatOfflineLU::getStoredBlocks(std::vector<DBMatOfflineBinaryFile::Block>& blocks) {
+  // store the permutation after the matrix
+  DBMatOffline::getStoredBlocks(blocks);
+  blocks.push_back(
+      DBMatOfflineBinaryFile::Block::fromIndices(permutation->data, permutation->size));
+}
+
+void DBMatOfflineLU::readStoredBlocks(const DBMatOfflineBinaryFile& file) {
+  DBMatOffline::readStoredBlocks(file);
+  const size_t n = lhsMatrix.getNrows();
+  permutation = std::unique_ptr<gsl_permutation>{gsl_permutation_alloc(n)};
+  file.readIndices(1, permutation->data, n);
+
+  for (size_t i = 0; i < n; i++) {
+    if (permutation->data[i] >= n) {
+      throw sgpp::base::file_exception("DBMatOfflineLU: permutation index out of range");
+    }
   }
-  gsl_permutation_fwrite(outputCFile, permutation.get());
-  fclose(outputCFile);
 }
 
 sgpp::datadriven::MatrixDecompositionType DBMatOfflineLU::getDecompositionType() {
@@ -12,6 +12,7 @@
 #include <gsl/gsl_permutation.h>
 
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -109,7 +110,18 @@ class DBMatOfflineLU : public DBMatOfflineGE {
    */
   void permuteVector(DataVector& b);
 
-  void store(const std::string& fname) override;
+ protected:
+  /**
+   * Stores the permutation in addition to the decomposed matrix.
+   * @param[out] blocks blocks to write
+   */
+  void getStoredBlocks(std::vector<DBMatOfflineBinaryFile::Block>& blocks) override;
+
+  /**
+   * Reads the permutation in addition to the decomposed matrix.
+   * @param file opened binary file
+   */
+  void readStoredBlocks(const DBMatOfflineBinaryFile& file) override;
 
  private:
   /**
@@ -25,7 +25,12 @@ DBMatOfflineOrthoAdapt::DBMatOfflineOrthoAdapt() : DBMatOfflinePermutable() {
 
 DBMatOfflineOrthoAdapt::DBMatOfflineOrthoAdapt(const std::string& fileName)
     : DBMatOfflinePermutable(fileName) {
-  // Read grid size from header (number of rows in lhsMatrix)
+  if (DBMatOfflineBinaryFile::isBinaryFile(fileName)) {
+    load(DBMatOfflineBinaryFile(fileName));
+    return;
+  }
+
+  // legacy format: read grid size from header (number of rows in lhsMatrix)
   std::ifstream filestream(fileName, std::istream::in);
   // Read configuration
   if (!filestream) {
@@ -328,27 +333,17 @@ void DBMatOfflineOrthoAdapt::invert_symmetric_tridiag(sgpp::base::DataVector& di
 #endif /* USE_GSL */
 }
 
-void DBMatOfflineOrthoAdapt::store(const std::string& fileName) {
-#ifdef USE_GSL
-  DBMatOffline::store(fileName);
-
-  FILE* outCFile = fopen(fileName.c_str(), "ab");
-  if (!outCFile) {
-    throw sgpp::base::algorithm_exception{"cannot open file for writing"};
-  }
-
-  auto dim_a = getGridSize();
-  // store q_ortho_matrix_
-  gsl_matrix_view q_view = gsl_matrix_view_array(this->q_ortho_matrix_.getPointer(), dim_a, dim_a);
-  gsl_matrix_fwrite(outCFile, &q_view.matrix);
-
-  // store t_inv_tridiag_
-  gsl_matrix_view t_inv_view =
-      gsl_matrix_view_array(this->t_tridiag_inv_matrix_.getPointer(), dim_a, dim_a);
-  gsl_matrix_fwrite(outCFile, &t_inv_view.matrix);
+void DBMatOfflineOrthoAdapt::getStoredBlocks(
+    std::vector<DBMatOfflineBinaryFile::Block>& blocks) {
+  DBMatOffline::getStoredBlocks(blocks);
+  blocks.push_back(DBMatOfflineBinaryFile::Block::fromMatrix(this->q_ortho_matrix_));
+  blocks.push_back(DBMatOfflineBinaryFile::Block::fromMatrix(this->t_tridiag_inv_matrix_));
+}
 
-  fclose(outCFile);
-#endif /* USE_GSL */
+void DBMatOfflineOrthoAdapt::readStoredBlocks(const DBMatOfflineBinaryFile& file) {
+  DBMatOffline::readStoredBlocks(file);
+  file.readMatrix(1, this->q_ortho_matrix_);
+  file.readMatrix(2, this->t_tridiag_inv_matrix_);
 }
 
 void DBMatOfflineOrthoAdapt::syncDistributedDecomposition(
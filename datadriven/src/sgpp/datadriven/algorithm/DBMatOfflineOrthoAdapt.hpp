@@ -17,6 +17,7 @@
 #include <sgpp/datadriven/algorithm/DBMatOfflinePermutable.hpp>
 
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -142,17 +143,6 @@ class DBMatOfflineOrthoAdapt : public DBMatOfflinePermutable {
    */
   void invert_symmetric_tridiag(sgpp::base::DataVector& diag, sgpp::base::DataVector& subdiag);
 
-  /**
-   * Serializes the DBMatOfflineOrthoAdapt object
-   *
-   * q_ortho_matrix_ and t_inv_tridiag_ are stored into the specified file,
-   * which is the explicit representation of the decomposition needed for the
-   * online phase
-   *
-   * @param fileName path where to store the file
-   */
-  void store(const std::string& fileName) override;
-
   /**
    * Override to sync Q and Tinv
    */
@@ -196,6 +186,24 @@ class DBMatOfflineOrthoAdapt : public DBMatOfflinePermutable {
   DataMatrixDistributed t_tridiag_inv_matrix_distributed_;
 
   bool lhsDistributedSynced = false;
+
+  /**
+   * Collects the blocks of the serialized object
+   *
+   * q_ortho_matrix_ and t_inv_tridiag_ are stored after the lhs matrix,
+   * which is the explicit representation of the decomposition needed for the
+   * online phase
+   *
+   * @param[out] blocks blocks to write
+   */
+  void getStoredBlocks(std::vector<DBMatOfflineBinaryFile::Block>& blocks) override;
+
+  /**
+   * Reads the blocks written by getStoredBlocks()
+   *
+   * @param file opened binary file
+   */
+  void readStoredBlocks(const DBMatOfflineBinaryFile& file) override;
 };
 }  // namespace datadriven
 }  // namespace sgpp
@@ -213,6 +213,20 @@ void DBMatOnlineDE::computeDensityFunction(DataVector& alpha, DataMatrix& m, Gri
   }
 }
 
+void DBMatOnlineDE::computeDensityFunctions(
+    DataMatrix& alphas, const std::vector<DataMatrix*>& batches, Grid& grid,
+    DensityEstimationConfiguration& densityEstimationConfig, bool do_cv) {
+  if (batches.empty()) {
+    return;
+  }
+
+  // (1. / M_j) * Bt_j * 1 in the j-th column
+  DataMatrix bs = computeWeightedBFromBatches(batches, grid, densityEstimationConfig);
+  solveSLEMultipleRHS(alphas, bs, grid, densityEstimationConfig, do_cv);
+
+  functionComputed = true;
+}
+
 void DBMatOnlineDE::computeDensityDifferenceFunction(
     DataVector& alpha, DataMatrix& mp, DataMatrix& mq, Grid& grid,
     DensityEstimationConfiguration& densityEstimationConfig, bool save_b, bool do_cv) {
@@ -352,9 +366,9 @@ DataVector DBMatOnlineDE::computeWeightedBFromBatch(
         densityEstimationConfig.decomposition_ ==
             sgpp::datadriven::MatrixDecompositionType::SMW_chol) {
       this_SMW_pointer = static_cast<sgpp::datadriven::DBMatOnlineDE_SMW*>(&*this);
-      if (this_SMW_pointer->getB().getNcols() > 1) {
+      if (this_SMW_pointer->getBSize() > 1) {
         use_B_size = true;
-        B_size = this_SMW_pointer->getB().getNcols();
+        B_size = this_SMW_pointer->getBSize();
       }
     }
 
@@ -397,6 +411,74 @@ DataVector DBMatOnlineDE::computeWeightedBFromBatch(
   return DataVector();
 }
 
+DataMatrix DBMatOnlineDE::computeWeightedBFromBatches(
+    const std::vector<DataMatrix*>& batches, Grid& grid,
+    DensityEstimationConfiguration& densityEstimationConfig) {
+  DataMatrix& lhsMatrix = offlineObject.getDecomposedMatrix();
+
+  // in case OrthoAdapt or both SMW_, the current size is not lhs size, but B size
+  size_t systemSize = lhsMatrix.getNcols();
+
+  if (densityEstimationConfig.decomposition_ ==
+      sgpp::datadriven::MatrixDecompositionType::OrthoAdapt) {
+    auto this_OrthoAdapt_pointer = static_cast<sgpp::datadriven::DBMatOnlineDEOrthoAdapt*>(this);
+    if (this_OrthoAdapt_pointer->getB().getNcols() > 1) {
+      systemSize = this_OrthoAdapt_pointer->getB().getNcols();
+    }
+  }
+
+  if (densityEstimationConfig.decomposition_ ==
+          sgpp::datadriven::MatrixDecompositionType::SMW_ortho ||
+      densityEstimationConfig.decomposition_ ==
+          sgpp::datadriven::MatrixDecompositionType::SMW_chol) {
+    auto this_SMW_pointer = static_cast<sgpp::datadriven::DBMatOnlineDE_SMW*>(this);
+    if (this_SMW_pointer->getBSize() > 1) {
+      systemSize = this_SMW_pointer->getBSize();
+    }
+  }
+
+  if (systemSize != grid.getSize()) {
+    throw sgpp::base::algorithm_exception(
+        "In DBMatOnlineDE::computeWeightedBFromBatches: b doesn't match size of system matrix");
+  }
+
+  DataMatrix bs(grid.getSize(), batches.size(), 0.0);
+  DataVector b(grid.getSize());
+
+  for (size_t j = 0; j < batches.size(); j++) {
+    DataMatrix& batch = *batches[j];
+    const size_t numberOfBatchPoints = batch.getNrows();
+
+    if (numberOfBatchPoints == 0) {
+      continue;
+    }
+
+    std::unique_ptr<sgpp::base::OperationMultipleEval> B(
+        (offlineObject.interactions.size() == 0)
+            ? sgpp::op_factory::createOperationMultipleEval(grid, batch)
+            : sgpp::op_factory::createOperationMultipleEvalInter(grid, batch,
+                                                                 offlineObject.interactions));
+
+    // (1. / M_j) * Bt_j * 1
+    DataVector y(numberOfBatchPoints, 1.0);
+    B->multTranspose(y, b);
+    b.mult(1. / static_cast<double>(numberOfBatchPoints));
+
+    // Perform permutation because of decomposition (LU)
+    if (densityEstimationConfig.decomposition_ == MatrixDecompositionType::LU) {
+#ifdef USE_GSL
+      static_cast<DBMatOfflineLU&>(offlineObject).permuteVector(b);
+#else
+      throw algorithm_exception("built without GSL");
+#endif /*USE_GSL*/
+    }
+
+    bs.setColumn(j, b);
+  }
+
+  return bs;
+}
+
 std::vector<DataVector> DBMatOnlineDE::computeWeightedBFromBatchTwoDatasets(
     DataMatrix& mp, DataMatrix& mq, Grid& grid,
     DensityEstimationConfiguration& densityEstimationConfig, bool weighted) {
@@ -423,9 +505,9 @@ std::vector<DataVector> DBMatOnlineDE::computeWeightedBFromBatchTwoDatasets(
         densityEstimationConfig.decomposition_ ==
             sgpp::datadriven::MatrixDecompositionType::SMW_chol) {
       this_SMW_pointer = static_cast<sgpp::datadriven::DBMatOnlineDE_SMW*>(&*this);
-      if (this_SMW_pointer->getB().getNcols() > 1) {
+      if (this_SMW_pointer->getBSize() > 1) {
         use_B_size = true;
-        B_size = this_SMW_pointer->getB().getNcols();
+        B_size = this_SMW_pointer->getBSize();
       }
     }
 
@@ -565,6 +647,20 @@ DataVectorDistributed DBMatOnlineDE::computeWeightedBFromBatchParallel(
   return DataVectorDistributed(processGrid, 0, 1);
 }
 
+void DBMatOnlineDE::solveSLEMultipleRHS(DataMatrix& alphas, DataMatrix& bs, Grid& grid,
+                                        DensityEstimationConfiguration& densityEstimationConfig,
+                                        bool do_cv) {
+  DataVector alpha(bs.getNrows());
+  DataVector b(bs.getNrows());
+  alphas.resizeZero(bs.getNrows(), bs.getNcols());
+
+  for (size_t j = 0; j < bs.getNcols(); j++) {
+    bs.getColumn(j, b);
+    solveSLE(alpha, b, grid, densityEstimationConfig, do_cv);
+    alphas.setColumn(j, alpha);
+  }
+}
+
 double DBMatOnlineDE::resDensity(DataVector& alpha, Grid& grid) {
   auto C = sgpp::op_factory::createOperationIdentity(grid);
   DataVector rhs(grid.getSize());
@@ -620,6 +716,21 @@ void DBMatOnlineDE::eval(DataVector& alpha, DataMatrix& values, DataVector& resu
   }
 }
 
+void DBMatOnlineDE::eval(DataMatrix& alphas, DataMatrix& values, DataMatrix& results, Grid& grid,
+                         bool force) {
+  if (functionComputed || force == true) {
+    std::unique_ptr<sgpp::base::OperationMultipleEval> opEval(
+        (offlineObject.interactions.size() == 0)
+            ? sgpp::op_factory::createOperationMultipleEval(grid, values)
+            : sgpp::op_factory::createOperationMultipleEvalInter(grid, values,
+                                                                 offlineObject.interactions));
+    opEval->multMultiple(alphas, results);
+    results.mult(normFactor);
+  } else {
+    throw algorithm_exception("Density function not computed, yet!");
+  }
+}
+
 bool DBMatOnlineDE::isComputed() { return functionComputed; }
 
 void DBMatOnlineDE::evalParallel(DataVector& alpha, DataMatrix& values,
@@ -92,6 +92,21 @@ class DBMatOnlineDE : public DBMatOnline {
                               DensityEstimationConfiguration& densityEstimationConfig,
                               bool save_b = false, bool do_cv = false);
 
+  /**
+   * Computes one density function per data matrix with a single multi-RHS solve against the
+   * decomposition, e.g., for the classes of a classification problem that share grid and offline
+   * object. The saved right hand sides for streaming are not touched.
+   *
+   * @param alphas matrix whose j-th column will contain the surplusses of the j-th density function
+   * @param batches the matrices that contain the data points (one per density function)
+   * @param grid The underlying grid
+   * @param densityEstimationConfig Configuration for the density estimation
+   * @param do_cv Indicates whether crossvalidation should take place
+   */
+  void computeDensityFunctions(DataMatrix& alphas, const std::vector<DataMatrix*>& batches,
+                               Grid& grid, DensityEstimationConfiguration& densityEstimationConfig,
+                               bool do_cv = false);
+
   /**
    * Computes the density difference function for two data matrix instances
    *
@@ -165,6 +180,19 @@ class DBMatOnlineDE : public DBMatOnline {
                                        DensityEstimationConfiguration& densityEstimationConfig,
                                        bool weighted);
 
+  /**
+   * Computes the weighted b vectors (1. / M_j) * Bt_j * 1 of several batches of data at once,
+   * such that the corresponding systems can be solved together.
+   * Each b vector is assembled from the points of its own batch only.
+   *
+   * @param batches the matrices that contain the data points (one per right hand side)
+   * @param grid The underlying grid
+   * @param densityEstimationConfig Configuration for the density estimation
+   * @return matrix whose j-th column is the b vector of the j-th batch (zero for empty batches)
+   */
+  DataMatrix computeWeightedBFromBatches(const std::vector<DataMatrix*>& batches, Grid& grid,
+                                         DensityEstimationConfiguration& densityEstimationConfig);
+
   /**
    * Initializes the b vector for the given batch of data in two datasets scenarios.
    * Does not compute the actual b, but initializes it and computes the two dataset contributions bp
@@ -220,6 +248,18 @@ class DBMatOnlineDE : public DBMatOnline {
   void eval(DataVector& alpha, DataMatrix& values, DataVector& results, Grid& grid,
             bool force = false);
 
+  /**
+   * Evaluates several density functions on multiple points in one multiple evaluation pass
+   *
+   * @param alphas matrix whose columns are the vectors of surplusses
+   * @param values the points at which the functions are evaluated
+   * @param results matrix whose j-th column will contain the evaluations of the j-th function
+   * @param grid the underlying grid
+   * @param force if set, it will even try to evaluate if the internal state recommends otherwise
+   */
+  void eval(DataMatrix& alphas, DataMatrix& values, DataMatrix& results, Grid& grid,
+            bool force = false);
+
   /**
    * Evaluates the density function on multiple points using parallelization
    *
@@ -285,6 +325,21 @@ class DBMatOnlineDE : public DBMatOnline {
                                 DensityEstimationConfiguration& densityEstimationConfig,
                                 bool do_cv = 0) = 0;
 
+  /**
+   * Solves the system for several right hand sides at once. The default implementation calls
+   * solveSLE for each column, decompositions that can apply their factors to a whole block of
+   * right hand sides (matrix-matrix instead of matrix-vector products) override it.
+   *
+   * @param alphas matrix whose columns will contain the solutions
+   * @param bs matrix whose columns are the right hand sides
+   * @param grid the underlying grid
+   * @param densityEstimationConfig configuration for the density estimation
+   * @param do_cv Indicates whether crossvalidation should take place
+   */
+  virtual void solveSLEMultipleRHS(DataMatrix& alphas, DataMatrix& bs, Grid& grid,
+                                   DensityEstimationConfiguration& densityEstimationConfig,
+                                   bool do_cv);
+
   double computeL2Error(DataVector& alpha, Grid& grid);
   double resDensity(DataVector& alpha, Grid& grid);
 
@@ -49,6 +49,17 @@ void DBMatOnlineDEChol::solveSLE(
   //            << "\n";
 }
 
+void DBMatOnlineDEChol::solveSLEMultipleRHS(
+    DataMatrix& alphas, DataMatrix& bs, Grid& grid,
+    DensityEstimationConfiguration& densityEstimationConfig, bool do_cv) {
+  DataMatrix& lhsMatrix = offlineObject.getDecomposedMatrix();
+
+  auto cholsolver = std::unique_ptr<DBMatDMSChol>{
+      buildCholSolver(offlineObject, grid, densityEstimationConfig, do_cv)};
+
+  cholsolver->solveMultipleRHS(lhsMatrix, alphas, bs, lambda, lambda);
+}
+
 void DBMatOnlineDEChol::solveSLEParallel(
     DataVectorDistributed& alpha, DataVectorDistributed& b, Grid& grid,
     DensityEstimationConfiguration& densityEstimationConfig, bool do_cv) {
@@ -57,6 +57,13 @@ class DBMatOnlineDEChol : public DBMatOnlineDE {
                 DensityEstimationConfiguration& densityEstimationConfig,
                 bool do_cv) override;
 
+  /**
+   * Solves for all right hand sides with one pair of triangular solves.
+   */
+  void solveSLEMultipleRHS(DataMatrix& alphas, DataMatrix& bs, Grid& grid,
+                           DensityEstimationConfiguration& densityEstimationConfig,
+                           bool do_cv) override;
+
   /**
    * Parallel and distributed version of solveSLE.
    */
@@ -105,6 +105,17 @@ void DBMatOnlineDEOrthoAdapt::solveSLE(
   free(solver);
 }
 
+void DBMatOnlineDEOrthoAdapt::solveSLEMultipleRHS(
+    DataMatrix& alphas, DataMatrix& bs, Grid& grid,
+    DensityEstimationConfiguration& densityEstimationConfig, bool do_cv) {
+  sgpp::datadriven::DBMatOfflineOrthoAdapt* offline =
+      static_cast<sgpp::datadriven::DBMatOfflineOrthoAdapt*>(
+          &this->offlineObject);
+  sgpp::datadriven::DBMatDMSOrthoAdapt solver;
+  solver.solveMultipleRHS(offline->getTinv(), offline->getQ(), this->getB(), bs,
+                          alphas);
+}
+
 void DBMatOnlineDEOrthoAdapt::solveSLEParallel(
     DataVectorDistributed& alpha, DataVectorDistributed& b, Grid& grid,
     DensityEstimationConfiguration& densityEstimationConfig, bool do_cv) {
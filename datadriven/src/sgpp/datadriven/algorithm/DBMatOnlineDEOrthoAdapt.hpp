@@ -126,6 +126,20 @@ class DBMatOnlineDEOrthoAdapt : public DBMatOnlineDE {
                 DensityEstimationConfiguration& densityEstimationConfig,
                 bool do_cv) override;
 
+  /**
+   * Solves the system for several right hand sides at once, see solveSLE.
+   *
+   * @param alphas matrix whose columns will contain the surplusses
+   * @param bs matrix whose columns are the right hand sides
+   * @param grid the underlying grid
+   * @param densityEstimationConfig configuration for the density estimation
+   * @param do_cv Specifies, if cross-validation should be done (todo: currently
+   * not implemented)
+   */
+  void solveSLEMultipleRHS(DataMatrix& alphas, DataMatrix& bs, Grid& grid,
+                           DensityEstimationConfiguration& densityEstimationConfig,
+                           bool do_cv) override;
+
   /**
    * Solves the distributed system (R + lambda*I) * alpha = b in parallel and
    * obtains alpha.
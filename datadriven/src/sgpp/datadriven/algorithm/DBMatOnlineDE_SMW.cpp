@@ -47,6 +47,10 @@ DBMatOnlineDE_SMW::DBMatOnlineDE_SMW(DBMatOffline& offline, Grid& grid,
     this->b_is_refined = false;
     this->refined_points_ = {};
     this->current_refine_index = 0;
+    this->b_size_ = this->b_adapt_matrix_.getNcols();
+    this->low_rank_factor_ = sgpp::base::DataMatrix(0, 0);
+    this->low_rank_core_ = sgpp::base::DataMatrix(0, 0);
+    this->low_rank_threshold_ = 256;
   }
 }
 
@@ -157,13 +161,18 @@ std::vector<size_t> DBMatOnlineDE_SMW::updateSystemMatrixDecompositionParallel(
 void DBMatOnlineDE_SMW::solveSLE(
     DataVector& alpha, DataVector& b, Grid& grid,
     DensityEstimationConfiguration& densityEstimationConfig, bool do_cv) {
-  // create solver
-  sgpp::datadriven::DBMatDMS_SMW* solver = new sgpp::datadriven::DBMatDMS_SMW();
-  // solve the created system
-  alpha.resizeZero(b.getSize());
-  solver->solve(this->offlineObject.getInverseMatrix(), this->getB(), b, alpha);
+  // alpha = (A^-1 + B + U C U^t) * b, without merging the low-rank correction
+  DataMatrix rhs(b.getPointer(), b.getSize(), 1);
+  DataMatrix result(b.getSize(), 1);
+  this->applyInverse(rhs, result);
+  alpha = DataVector(result.getPointer(), b.getSize());
+}
 
-  free(solver);
+void DBMatOnlineDE_SMW::solveSLEMultipleRHS(
+    DataMatrix& alphas, DataMatrix& bs, Grid& grid,
+    DensityEstimationConfiguration& densityEstimationConfig, bool do_cv) {
+  // alphas = (A^-1 + B + U C U^t) * bs
+  this->applyInverse(bs, alphas);
 }
 
 void DBMatOnlineDE_SMW::solveSLEParallel(
@@ -194,35 +203,34 @@ void DBMatOnlineDE_SMW::smw_adapt(DataMatrix& X, size_t newPoints, bool refine,
 
   // determine the final size of the B matrix (additive component in smw
   // formula)
-  size_t oldSize =
-      this->b_is_refined ? this->b_adapt_matrix_.getNcols() : offMatrixSize;
+  size_t oldSize = this->b_is_refined ? this->b_size_ : offMatrixSize;
   size_t newSize =
       refine ? (oldSize + newPoints) : (oldSize - coarsenIndices.size());
   size_t adaptSteps =
       (newSize > oldSize) ? (newSize - oldSize) : (oldSize - newSize);
 
-  // allocate additional space for b_adapt_matrix_ and fill new diagonal entries
-  // with ones
+  // the new rows/columns of B are those of the identity, which is implied
+  // for all rows/columns not stored in b_adapt_matrix_
   // note: only done in refining! Coarsening will resize at the end of function
   if (refine) {
-    this->b_adapt_matrix_.resizeQuadratic(newSize);
-    for (size_t i = oldSize; i < newSize; i++) {
-      this->b_adapt_matrix_.set(i, i, 1.0);
+    this->b_size_ = newSize;
+    if (this->low_rank_core_.getNcols() > 0) {
+      this->low_rank_factor_.resizeRows(newSize);
     }
   }
 
   /************************************************************
    * BEGIN OF SHERMAN-MORRISON-WOODBURRY
    *
-   * Phase 1: B~ = B - (A^-1 + B) X (I + E^t (A^-1 + B) X)^-1 E^t (A^-1 + B)
+   * The update of the system matrix M is X E^t + E X^t = W S W^t with
+   * W = [X E] and S = [0 I; I 0], hence (S^-1 = S)
+   *
+   * (M + W S W^t)^-1 = M^-1 - G (S + W^t G)^-1 G^t,  G = M^-1 W,
+   *
+   * which equals the two successive Woodbury updates with X E^t and E X^t.
    *
    ************************************************************/
 
-  // create view of B, will store values of B~
-  gsl_matrix_view b_adapt_full_view = gsl_matrix_view_array(
-      this->b_adapt_matrix_.getPointer(), this->b_adapt_matrix_.getNrows(),
-      this->b_adapt_matrix_.getNcols());
-
   // adapt X's diagonal, lambda already added before
   for (size_t k = X.getNrows() - X.getNcols(); k < X.getNrows(); k++) {
     // <x, x> = 0 => x=0, therefore:
@@ -233,114 +241,75 @@ void DBMatOnlineDE_SMW::smw_adapt(DataMatrix& X, size_t newPoints, bool refine,
     X.set(k, k - X.getNrows() + X.getNcols(), val);
   }
 
-  // create E
-  // todo(): maybe replace operations done with E/E^t by matrix_subviews for
-  // better performance?
-  DataMatrix E(X.getNrows(), X.getNcols(), 0.0);
-  for (size_t k = E.getNrows() - E.getNcols(); k < E.getNrows(); k++) {
-    E.set(k, k - E.getNrows() + E.getNcols(), 1.0);
-  }
-
-  // create view of A^-1
-  gsl_matrix_view A_inv_view =
-      gsl_matrix_view_array(this->offlineObject.getInverseMatrix().getPointer(),
-                            offMatrixSize, offMatrixSize);
-
-  // A^-1 + B (calculate in size of A^-1, store in size of B)
-  DataMatrix AB(this->b_adapt_matrix_);
-  gsl_matrix_view AB_view =
-      gsl_matrix_view_array(AB.getPointer(), this->b_adapt_matrix_.getNrows(),
-                            this->b_adapt_matrix_.getNcols());
-  gsl_matrix_view AB_sub_view =
-      gsl_matrix_submatrix(&AB_view.matrix, 0, 0, offMatrixSize, offMatrixSize);
-  gsl_matrix_add(&AB_sub_view.matrix, &A_inv_view.matrix);
-
-  // (A^-1 + B) * X
-  gsl_matrix* AX = gsl_matrix_alloc(X.getNrows(), X.getNcols());
-  gsl_matrix_view X_view =
-      gsl_matrix_view_array(X.getPointer(), X.getNrows(), X.getNcols());
-  gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, &AB_view.matrix,
-                 &X_view.matrix, 0.0, AX);
-
-  // E^t * (A^-1 + B)
-  gsl_matrix* EA = gsl_matrix_alloc(X.getNcols(), X.getNrows());
-  gsl_matrix_view E_view =
-      gsl_matrix_view_array(E.getPointer(), X.getNrows(), X.getNcols());
-  gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, &E_view.matrix, &AB_view.matrix,
-                 0.0, EA);
-
-  // I + E^t * (A^-1 + B) * X
-  gsl_matrix* TO_INV = gsl_matrix_alloc(X.getNcols(), X.getNcols());
-  gsl_matrix_set_identity(TO_INV);
-  gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, &E_view.matrix, AX, 1.0,
-                 TO_INV);
-
-  // (I + E^t * (A^-1 + B) * X)^-1
-  gsl_permutation* P = gsl_permutation_alloc(X.getNcols());
-  int* signum = new int[X.getNcols()];
-  gsl_linalg_LU_decomp(TO_INV, P, signum);
-  gsl_matrix* INV = gsl_matrix_alloc(X.getNcols(), X.getNcols());
-  gsl_linalg_LU_invert(TO_INV, P, INV);
-
-  // (A^-1 + B) X (I + E^t (A^-1 + B) X)^-1
-  gsl_matrix* AXINV = gsl_matrix_alloc(X.getNrows(), X.getNcols());
-  gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, AX, INV, 0.0, AXINV);
+  const size_t rows = X.getNrows();
+  const size_t cols = X.getNcols();
 
-  // (A^-1 + B) X (I + E^t (A^-1 + B) X)^-1 E^t (A^-1 + B)
-  gsl_matrix* AXINVEA = gsl_matrix_alloc(X.getNrows(), X.getNrows());
-  gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, AXINV, EA, 0.0, AXINVEA);
-
-  // B - (A^-1 + B) X (I + E^t (A^-1 + B) X)^-1 E^t (A^-1 + B)
-  // effectively stores final values of Phase 1 in b_adapt_matrix_
-  gsl_matrix_sub(&b_adapt_full_view.matrix, AXINVEA);
-
-  /************************************************************
-   *
-   * Phase 2: B = B~ - (A^-1 + B~) E (I + X^t (A^-1 + B~) E)^-1 X^t (A^-1 + B~)
-   *
-   ************************************************************/
-
-  // A^-1 + B~ (calculate in size of A^-1, store in size of B~)
-  DataMatrix ABtilde(this->b_adapt_matrix_);
-  gsl_matrix_view ABtilde_view = gsl_matrix_view_array(
-      ABtilde.getPointer(), this->b_adapt_matrix_.getNrows(),
-      this->b_adapt_matrix_.getNcols());
-  gsl_matrix_view ABtilde_sub_view = gsl_matrix_submatrix(
-      &ABtilde_view.matrix, 0, 0, offMatrixSize, offMatrixSize);
-  gsl_matrix_add(&ABtilde_sub_view.matrix, &A_inv_view.matrix);
-
-  // (A^-1 + B~) * E
-  gsl_matrix* AE = gsl_matrix_alloc(X.getNrows(), X.getNcols());
-  gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, &ABtilde_view.matrix,
-                 &E_view.matrix, 0.0, AE);
-
-  // X^t * (A^-1 + B~)
-  gsl_matrix* XA = gsl_matrix_alloc(X.getNcols(), X.getNrows());
-  gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, &X_view.matrix,
-                 &ABtilde_view.matrix, 0.0, XA);
-
-  // I + X^t * (A^-1 + B~) * E
-  gsl_matrix_set_identity(TO_INV);
-  gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, &X_view.matrix, AE, 1.0,
-                 TO_INV);
-
-  // (I + X^t * (A^-1 + B~) * E)^-1
-  gsl_permutation* Ptilde = gsl_permutation_alloc(X.getNcols());
-  int* signumtilde = new int[X.getNcols()];
-  gsl_linalg_LU_decomp(TO_INV, Ptilde, signumtilde);
-  gsl_linalg_LU_invert(TO_INV, Ptilde, INV);
+  // create W = [X E]
+  DataMatrix W(rows, 2 * cols, 0.0);
+  for (size_t i = 0; i < rows; i++) {
+    std::copy(X.getPointer() + i * cols, X.getPointer() + (i + 1) * cols,
+              W.getPointer() + i * 2 * cols);
+  }
+  for (size_t k = 0; k < cols; k++) {
+    W.set(rows - cols + k, cols + k, 1.0);
+  }
 
-  // (A^-1 + B~) E (I + X^t * (A^-1 + B~) * E)^-1
-  gsl_matrix* AEINV = gsl_matrix_alloc(X.getNrows(), X.getNcols());
-  gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, AE, INV, 0.0, AEINV);
+  // G = M^-1 W
+  DataMatrix G(rows, 2 * cols);
+  this->applyInverse(W, G);
 
-  // (A^-1 + B~) E (I + X^t (A^-1 + B~) E)^-1 X^t (A^-1 + B~)
-  gsl_matrix* AEINVXA = gsl_matrix_alloc(X.getNrows(), X.getNrows());
-  gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, AEINV, XA, 0.0, AEINVXA);
-
-  // B~ - (A^-1 + B~) E (I + X^t (A^-1 + B~) E)^-1 X^t (A^-1 + B~)
-  // effectively stores final values of Phase 2 in b_adapt_matrix_
-  gsl_matrix_sub(&b_adapt_full_view.matrix, AEINVXA);
+  // S + W^t G
+  DataMatrix TO_INV(2 * cols, 2 * cols, 0.0);
+  for (size_t k = 0; k < cols; k++) {
+    TO_INV.set(k, cols + k, 1.0);
+    TO_INV.set(cols + k, k, 1.0);
+  }
+  gsl_matrix_view W_view =
+      gsl_matrix_view_array(W.getPointer(), rows, 2 * cols);
+  gsl_matrix_view G_view =
+      gsl_matrix_view_array(G.getPointer(), rows, 2 * cols);
+  gsl_matrix_view TO_INV_view =
+      gsl_matrix_view_array(TO_INV.getPointer(), 2 * cols, 2 * cols);
+  gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, &W_view.matrix, &G_view.matrix,
+                 1.0, &TO_INV_view.matrix);
+
+  // (S + W^t G)^-1
+  DataMatrix INV(2 * cols, 2 * cols);
+  gsl_matrix_view INV_view =
+      gsl_matrix_view_array(INV.getPointer(), 2 * cols, 2 * cols);
+  gsl_permutation* P = gsl_permutation_alloc(2 * cols);
+  int signum;
+  gsl_linalg_LU_decomp(&TO_INV_view.matrix, P, &signum);
+  gsl_linalg_LU_invert(&TO_INV_view.matrix, P, &INV_view.matrix);
+  gsl_permutation_free(P);
+
+  // append G to U and -(S + W^t G)^-1 to the block diagonal of C
+  const size_t oldRank = this->low_rank_core_.getNcols();
+  const size_t newRank = oldRank + 2 * cols;
+  DataMatrix U(rows, newRank);
+  DataMatrix C(newRank, newRank, 0.0);
+  for (size_t i = 0; i < rows; i++) {
+    if (oldRank > 0) {
+      std::copy(this->low_rank_factor_.getPointer() + i * oldRank,
+                this->low_rank_factor_.getPointer() + (i + 1) * oldRank,
+                U.getPointer() + i * newRank);
+    }
+    std::copy(G.getPointer() + i * 2 * cols,
+              G.getPointer() + (i + 1) * 2 * cols,
+              U.getPointer() + i * newRank + oldRank);
+  }
+  for (size_t i = 0; i < oldRank; i++) {
+    std::copy(this->low_rank_core_.getPointer() + i * oldRank,
+              this->low_rank_core_.getPointer() + (i + 1) * oldRank,
+              C.getPointer() + i * newRank);
+  }
+  for (size_t i = 0; i < 2 * cols; i++) {
+    for (size_t j = 0; j < 2 * cols; j++) {
+      C.set(oldRank + i, oldRank + j, -INV.get(i, j));
+    }
+  }
+  this->low_rank_factor_ = U;
+  this->low_rank_core_ = C;
 
   /*****
    *
@@ -348,6 +317,11 @@ void DBMatOnlineDE_SMW::smw_adapt(DataMatrix& X, size_t newPoints, bool refine,
    *
    *****/
 
+  // coarsening needs the dense matrix to remove rows and columns
+  if (!refine || (newRank > this->low_rank_threshold_)) {
+    this->compactLowRankCorrection();
+  }
+
   // If points were coarsened the b_adapt_matrix will now have empty rows and
   // columns
   // on the indices of the coarsened points. In the following algorithm, the
@@ -376,6 +350,7 @@ void DBMatOnlineDE_SMW::smw_adapt(DataMatrix& X, size_t newPoints, bool refine,
     }
 
     this->b_adapt_matrix_.resizeQuadratic(newSize);
+    this->b_size_ = newSize;
     // size fitting ends here
 
     // remove coarsened points from online's internal storage of
@@ -395,12 +370,137 @@ void DBMatOnlineDE_SMW::smw_adapt(DataMatrix& X, size_t newPoints, bool refine,
   }
 
   // determine, if any refined information now is contained in matrix b_adapt
-  this->b_is_refined = this->b_adapt_matrix_.getNcols() > offMatrixSize;
+  this->b_is_refined = this->b_size_ > offMatrixSize;
 
   return;
 #endif /* USE_GSL */
 }
 
+void DBMatOnlineDE_SMW::compactLowRankCorrection() {
+  const size_t rank = this->low_rank_core_.getNcols();
+
+  if ((rank == 0) && (this->b_adapt_matrix_.getNcols() == this->b_size_)) {
+    return;
+  }
+
+#ifdef USE_GSL
+  size_t offMatrixSize = this->offlineObject.getGridSize();
+
+  // add the rows/columns of the identity, which are not stored yet
+  const size_t oldSize = this->b_adapt_matrix_.getNcols();
+  if (oldSize < this->b_size_) {
+    DataMatrix B(this->b_size_, this->b_size_, 0.0);
+    for (size_t i = 0; i < oldSize; i++) {
+      std::copy(this->b_adapt_matrix_.getPointer() + i * oldSize,
+                this->b_adapt_matrix_.getPointer() + (i + 1) * oldSize,
+                B.getPointer() + i * this->b_size_);
+    }
+    for (size_t i = std::max(oldSize, offMatrixSize); i < this->b_size_; i++) {
+      B.set(i, i, 1.0);
+    }
+    this->b_adapt_matrix_ = B;
+  }
+
+  // B + U C U^t
+  if (rank > 0) {
+    DataMatrix UC(this->b_size_, rank);
+    gsl_matrix_view U_view = gsl_matrix_view_array(
+        this->low_rank_factor_.getPointer(), this->b_size_, rank);
+    gsl_matrix_view C_view =
+        gsl_matrix_view_array(this->low_rank_core_.getPointer(), rank, rank);
+    gsl_matrix_view UC_view =
+        gsl_matrix_view_array(UC.getPointer(), this->b_size_, rank);
+    gsl_matrix_view B_view =
+        gsl_matrix_view_array(this->b_adapt_matrix_.getPointer(),
+                              this->b_size_, this->b_size_);
+    gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, &U_view.matrix,
+                   &C_view.matrix, 0.0, &UC_view.matrix);
+    gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, &UC_view.matrix,
+                   &U_view.matrix, 1.0, &B_view.matrix);
+
+    this->low_rank_factor_ = DataMatrix(0, 0);
+    this->low_rank_core_ = DataMatrix(0, 0);
+  }
+#endif /* USE_GSL */
+}
+
+void DBMatOnlineDE_SMW::applyInverse(const DataMatrix& V, DataMatrix& result) {
+  const size_t rows = V.getNrows();
+  const size_t cols = V.getNcols();
+  result.resizeRowsCols(rows, cols);
+  result.setAll(0.0);
+
+#ifdef USE_GSL
+  size_t offMatrixSize = this->offlineObject.getGridSize();
+  const size_t denseSize = this->b_adapt_matrix_.getNcols();
+  const size_t rank = this->low_rank_core_.getNcols();
+
+  if ((rows < offMatrixSize) || (rows < denseSize) ||
+      ((rank > 0) && (rows != this->low_rank_factor_.getNrows()))) {
+    throw sgpp::base::algorithm_exception(
+        "In DBMatOnlineDE_SMW::applyInverse:\nmatrix doesn't match B");
+  }
+
+  // A^-1 acts on the first offMatrixSize rows, the rows are stored
+  // contiguously
+  gsl_matrix_view A_inv_view =
+      gsl_matrix_view_array(this->offlineObject.getInverseMatrix().getPointer(),
+                            offMatrixSize, offMatrixSize);
+  gsl_matrix_const_view V_off_view =
+      gsl_matrix_const_view_array(V.getPointer(), offMatrixSize, cols);
+  gsl_matrix_view result_off_view =
+      gsl_matrix_view_array(result.getPointer(), offMatrixSize, cols);
+  gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, &A_inv_view.matrix,
+                 &V_off_view.matrix, 0.0, &result_off_view.matrix);
+
+  // B acts on its stored rows/columns (the initial dummy is skipped), the
+  // identity on the remaining ones
+  size_t identityStart = offMatrixSize;
+  if (denseSize >= offMatrixSize) {
+    gsl_matrix_view B_view = gsl_matrix_view_array(
+        this->b_adapt_matrix_.getPointer(), denseSize, denseSize);
+    gsl_matrix_const_view V_dense_view =
+        gsl_matrix_const_view_array(V.getPointer(), denseSize, cols);
+    gsl_matrix_view result_dense_view =
+        gsl_matrix_view_array(result.getPointer(), denseSize, cols);
+    gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, &B_view.matrix,
+                   &V_dense_view.matrix, 1.0, &result_dense_view.matrix);
+    identityStart = denseSize;
+  }
+  for (size_t i = identityStart; i < rows; i++) {
+    for (size_t j = 0; j < cols; j++) {
+      result.set(i, j, result.get(i, j) + V.get(i, j));
+    }
+  }
+
+  // U C U^t, evaluated from the right to stay in O(rows * rank)
+  if (rank > 0) {
+    DataMatrix UtV(rank, cols);
+    DataMatrix CUtV(rank, cols);
+    gsl_matrix_view U_view = gsl_matrix_view_array(
+        this->low_rank_factor_.getPointer(), rows, rank);
+    gsl_matrix_view C_view =
+        gsl_matrix_view_array(this->low_rank_core_.getPointer(), rank, rank);
+    gsl_matrix_const_view V_view =
+        gsl_matrix_const_view_array(V.getPointer(), rows, cols);
+    gsl_matrix_view result_view =
+        gsl_matrix_view_array(result.getPointer(), rows, cols);
+    gsl_matrix_view UtV_view =
+        gsl_matrix_view_array(UtV.getPointer(), rank, cols);
+    gsl_matrix_view CUtV_view =
+        gsl_matrix_view_array(CUtV.getPointer(), rank, cols);
+    gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, &U_view.matrix,
+                   &V_view.matrix, 0.0, &UtV_view.matrix);
+    gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, &C_view.matrix,
+                   &UtV_view.matrix, 0.0, &CUtV_view.matrix);
+    gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, &U_view.matrix,
+                   &CUtV_view.matrix, 1.0, &result_view.matrix);
+  }
+#else
+  throw sgpp::base::algorithm_exception("USE_GSL not set");
+#endif /* USE_GSL */
+}
+
 void DBMatOnlineDE_SMW::smw_adapt_parallel(
     DataMatrixDistributed& X, size_t newPoints, bool refine,
     std::shared_ptr<BlacsProcessGrid> processGrid,
@@ -418,6 +518,9 @@ void DBMatOnlineDE_SMW::smw_adapt_parallel(
         "yet, so can't perform refinement/coarsening.");
   }
 
+  // the distributed variant works on the dense matrix only
+  this->compactLowRankCorrection();
+
   // determine the final size of the B matrix (additive component in smw
   // formula)
   size_t oldSize = this->b_is_refined
@@ -436,6 +539,7 @@ void DBMatOnlineDE_SMW::smw_adapt_parallel(
     for (size_t i = oldSize; i < newSize; i++) {
       this->b_adapt_matrix_.set(i, i, 1.0);
     }
+    this->b_size_ = newSize;
   }
 
   this->syncDistributedDecomposition(processGrid, parallelConfig);
@@ -702,6 +806,7 @@ void DBMatOnlineDE_SMW::smw_adapt_parallel(
     }
 
     this->b_adapt_matrix_.resizeQuadratic(newSize);
+    this->b_size_ = newSize;
     // size fitting ends here
 
     // remove coarsened points from online's internal storage of
@@ -768,7 +873,7 @@ void DBMatOnlineDE_SMW::compute_L2_refine_matrix(DataMatrix& X, Grid& grid,
 
 void DBMatOnlineDE_SMW::compute_L2_coarsen_matrix(
     DataMatrix& X, Grid& grid, std::vector<size_t> coarsen_indices) {
-  if (X.getNrows() != this->b_adapt_matrix_.getNrows()) {
+  if (X.getNrows() != this->b_size_) {
     throw sgpp::base::algorithm_exception(
         "in DBMatOnlineDE_SMW::compute_L2_coarsen_matrix:\n matrix X doesn't "
         "match B");
@@ -783,6 +888,7 @@ void DBMatOnlineDE_SMW::syncDistributedDecomposition(
     std::shared_ptr<BlacsProcessGrid> processGrid,
     const ParallelConfiguration& parallelConfig) {
 #ifdef USE_SCALAPACK
+  this->compactLowRankCorrection();
   b_adapt_matrix_distributed_ = DataMatrixDistributed::fromSharedData(
       b_adapt_matrix_.data(), processGrid, b_adapt_matrix_.getNrows(),
       b_adapt_matrix_.getNcols(), parallelConfig.rowBlockSize_,
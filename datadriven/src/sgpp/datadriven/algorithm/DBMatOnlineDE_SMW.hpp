@@ -30,9 +30,39 @@ class DBMatOnlineDE_SMW : public DBMatOnlineDE {
 
   /**
    * Returns the additive component of the sherman-morrison-formula, which
-   * yields all the information about the refined points
+   * yields all the information about the refined points.
+   * Pending low-rank corrections are merged into the dense matrix first, which
+   * costs O(N^2) memory and O(N^2 r) time for a correction of rank r.
    */
-  sgpp::base::DataMatrix& getB() { return this->b_adapt_matrix_; }
+  sgpp::base::DataMatrix& getB() {
+    this->compactLowRankCorrection();
+    return this->b_adapt_matrix_;
+  }
+
+  /**
+   * @returns number of columns of the additive component B (1 prior to the
+   * first refinement), without merging pending low-rank corrections
+   */
+  size_t getBSize() const { return this->b_size_; }
+
+  /**
+   * @returns rank of the low-rank correction that has not been merged into B
+   * yet
+   */
+  size_t getLowRankCorrectionRank() const {
+    return this->low_rank_core_.getNcols();
+  }
+
+  /**
+   * Sets the rank up to which corrections are kept in factored form.
+   * Once the rank exceeds the threshold, the correction is merged into B.
+   * A threshold of 0 merges every update immediately (like the dense variant).
+   *
+   * @param threshold maximal rank of the pending low-rank correction
+   */
+  void setLowRankThreshold(size_t threshold) {
+    this->low_rank_threshold_ = threshold;
+  }
 
   /**
    * @returns distributed version of matrix B
@@ -63,6 +93,10 @@ class DBMatOnlineDE_SMW : public DBMatOnlineDE {
    * Sherman-Morrison-formula
    * In the current version of the function, the refinePts already are adapted
    * to the regularization parameter lambda.
+   * The symmetric update X E^t + E X^t of the system matrix is handled as one
+   * Woodbury step of rank 2k (k: number of columns of X), whose correction
+   * -G K^-1 G^t of the inverse is kept in factored form until the rank
+   * threshold is reached (coarsening always merges it into B).
    *
    * @param X Refine/Coarsen Matrix of L2-Products
    * @param newPoints number of refined points
@@ -147,6 +181,34 @@ class DBMatOnlineDE_SMW : public DBMatOnlineDE {
   // b_adapt_matrix_ yet
   bool b_is_refined;
 
+  // size of B including the pending low-rank correction; b_adapt_matrix_ may
+  // be smaller, its missing rows/columns are those of the identity
+  size_t b_size_;
+
+  // pending low-rank correction U C U^t of B, U has b_size_ rows and C is
+  // block diagonal (one block per adaptation step)
+  sgpp::base::DataMatrix low_rank_factor_;
+  sgpp::base::DataMatrix low_rank_core_;
+
+  // rank of the pending correction, above which it is merged into B
+  size_t low_rank_threshold_;
+
+  /**
+   * Merges the pending low-rank correction into b_adapt_matrix_ and resizes it
+   * to the current size of B.
+   */
+  void compactLowRankCorrection();
+
+  /**
+   * Applies the inverse of the current system matrix, i.e.,
+   * A^-1 (padded with the identity) + B + U C U^t, to the columns of V.
+   *
+   * @param V matrix with one row per grid point
+   * @param result matrix of the same size as V, will contain the product
+   */
+  void applyInverse(const sgpp::base::DataMatrix& V,
+                    sgpp::base::DataMatrix& result);
+
   /**
    * Solves the system (R + lambda*I) * alpha = b, and obtains alpha
    * The solving is done after offline and online phase and works as follows:
@@ -164,6 +226,20 @@ class DBMatOnlineDE_SMW : public DBMatOnlineDE {
                 DensityEstimationConfiguration& densityEstimationConfig,
                 bool do_cv) override;
 
+  /**
+   * Solves the system for several right hand sides at once, see solveSLE.
+   *
+   * @param alphas matrix whose columns will contain the surplusses
+   * @param bs matrix whose columns are the right hand sides
+   * @param grid the underlying grid
+   * @param densityEstimationConfig configuration for the density estimation
+   * @param do_cv Specifies, if cross-validation should be done (todo: currently
+   * not implemented)
+   */
+  void solveSLEMultipleRHS(DataMatrix& alphas, DataMatrix& bs, Grid& grid,
+                           DensityEstimationConfiguration& densityEstimationConfig,
+                           bool do_cv) override;
+
   /**
    * Solves the distributed system (R + lambda*I) * alpha = b in parallel and
    * obtains alpha.
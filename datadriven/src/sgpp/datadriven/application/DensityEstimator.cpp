@@ -49,14 +49,14 @@ void DensityEstimator::corrcoef(base::DataMatrix& corr, base::DataMatrix* bounds
 
 double DensityEstimator::crossEntropy(sgpp::base::DataMatrix& samples) {
   size_t numSamples = samples.getNrows();
-  size_t numDims = samples.getNcols();
 
   if (numSamples > 0) {
-    base::DataVector sample(numDims);
+    // evaluate all samples at once to benefit from parallel implementations
+    base::DataVector values(numSamples);
+    pdf(samples, values);
     double sum = 0.0;
     for (size_t i = 0; i < numSamples; i++) {
-      samples.getRow(i, sample);
-      sum += std::log2(std::max(1e-10, pdf(sample)));
+      sum += std::log2(std::max(1e-10, values[i]));
     }
 
     return -1.0 * sum / static_cast<double>(numSamples);
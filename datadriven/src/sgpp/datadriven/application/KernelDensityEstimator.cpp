@@ -37,7 +37,9 @@ KernelDensityEstimator::KernelDensityEstimator(KernelType kernelType,
       norm(0),
       cond(0),
       sumCondInv(1.0),
-      bandwidthOptimizationType(bandwidthOptimizationType) {
+      bandwidthOptimizationType(bandwidthOptimizationType),
+      evaluationTolerance(0.0),
+      treeValid(false) {
   initializeKernel(kernelType);
 }
 
@@ -50,7 +52,9 @@ KernelDensityEstimator::KernelDensityEstimator(
       norm(samplesVec.size()),
       cond(0.0),
       sumCondInv(0.0),
-      bandwidthOptimizationType(bandwidthOptimizationType) {
+      bandwidthOptimizationType(bandwidthOptimizationType),
+      evaluationTolerance(0.0),
+      treeValid(false) {
   initializeKernel(kernelType);
   initialize(samplesVec);
 }
@@ -63,7 +67,9 @@ KernelDensityEstimator::KernelDensityEstimator(base::DataMatrix& samples, Kernel
       norm(samples.getNcols()),
       cond(samples.getNrows()),
       sumCondInv(0.0),
-      bandwidthOptimizationType(bandwidthOptimizationType) {
+      bandwidthOptimizationType(bandwidthOptimizationType),
+      evaluationTolerance(0.0),
+      treeValid(false) {
   initializeKernel(kernelType);
   initialize(samples);
 }
@@ -77,6 +83,12 @@ KernelDensityEstimator::KernelDensityEstimator(const KernelDensityEstimator& kde
   cond = base::DataVector(kde.cond);
   sumCondInv = kde.sumCondInv;
   bandwidthOptimizationType = kde.bandwidthOptimizationType;
+  evaluationTolerance = kde.evaluationTolerance;
+  treeValid = kde.treeValid;
+  treeNodes = kde.treeNodes;
+  treeBounds = kde.treeBounds;
+  treeSamples = kde.treeSamples;
+  treeWeights = kde.treeWeights;
 
   initializeKernel(kde.kernel->getType());
 }
@@ -113,6 +125,7 @@ void KernelDensityEstimator::initialize(base::DataMatrix& samples) {
       }
 
       // initialize conditionalization factor
+      treeValid = false;
       cond.resize(nsamples);
       cond.setAll(1.0);
       sumCondInv = 1. / static_cast<double>(nsamples);
@@ -151,6 +164,7 @@ void KernelDensityEstimator::initialize(std::vector<std::shared_ptr<base::DataVe
       }
 
       // initialize conditionalization factors
+      treeValid = false;
       cond.resize(nsamples);
       cond.setAll(1.0);
       sumCondInv = 1. / static_cast<double>(nsamples);
@@ -217,26 +231,53 @@ void KernelDensityEstimator::setBandwidths(const base::DataVector& sigma) {
   }
 }
 
-void KernelDensityEstimator::pdf(base::DataMatrix& data, base::DataVector& res) {
-  // init variables
-  base::DataVector x(ndim);
+void KernelDensityEstimator::setEvaluationTolerance(double relativeTolerance) {
+  if (relativeTolerance < 0.0) {
+    throw base::data_exception(
+        "KernelDensityEstimator::setEvaluationTolerance : tolerance has to be non-negative");
+  }
+
+  evaluationTolerance = relativeTolerance;
+}
+
+double KernelDensityEstimator::getEvaluationTolerance() { return evaluationTolerance; }
 
+void KernelDensityEstimator::pdf(base::DataMatrix& data, base::DataVector& res) {
   // resize result vector
   res.resize(data.getNrows());
   res.setAll(0.0);
 
+  // build the tree before the threads share it
+  if ((evaluationTolerance > 0.0) && !treeValid) {
+    buildTree();
+  }
+
   // run over all data points
-  for (size_t idata = 0; idata < data.getNrows(); idata++) {
-    // copy samples
-    for (size_t idim = 0; idim < ndim; idim++) {
-      x[idim] = data.get(idata, idim);
-    }
+#pragma omp parallel
+  {
+    base::DataVector x(ndim);
+
+#pragma omp for schedule(dynamic, 16)
+    for (size_t idata = 0; idata < data.getNrows(); idata++) {
+      // copy samples
+      for (size_t idim = 0; idim < ndim; idim++) {
+        x[idim] = data.get(idata, idim);
+      }
 
-    res[idata] = pdf(x);
+      res[idata] = pdf(x);
+    }
   }
 }
 
 double KernelDensityEstimator::pdf(base::DataVector& x) {
+  if (evaluationTolerance > 0.0) {
+    if (!treeValid) {
+      buildTree();
+    }
+
+    return evalTree(x.getPointer()) * sumCondInv;
+  }
+
   // init variables
   double res = 0.0;
 
@@ -283,6 +324,164 @@ double KernelDensityEstimator::evalKernel(base::DataVector& x, size_t i) {
   return cond[i] * res;
 }
 
+void KernelDensityEstimator::buildTree() {
+  std::vector<size_t> indices(nsamples);
+
+  for (size_t isample = 0; isample < nsamples; isample++) {
+    indices[isample] = isample;
+  }
+
+  treeNodes.clear();
+  treeBounds.clear();
+  buildTreeNode(0, nsamples, indices);
+
+  // store the samples in tree order to traverse the leaves contiguously
+  treeSamples.resize(nsamples * ndim);
+  treeWeights.resize(nsamples);
+
+  for (size_t isample = 0; isample < nsamples; isample++) {
+    for (size_t idim = 0; idim < ndim; idim++) {
+      treeSamples[isample * ndim + idim] = samplesVec[idim]->get(indices[isample]);
+    }
+
+    treeWeights[isample] = cond[indices[isample]];
+  }
+
+  treeValid = true;
+}
+
+size_t KernelDensityEstimator::buildTreeNode(size_t begin, size_t end,
+                                             std::vector<size_t>& indices) {
+  const size_t maxLeafSize = 32;
+  const size_t node = treeNodes.size();
+  TreeNode treeNode = {begin, end, 0, 0, 0.0};
+  treeNodes.push_back(treeNode);
+  treeBounds.resize(treeBounds.size() + 2 * ndim);
+
+  // compute the bounding box and split along the dimension of largest extent (in bandwidths)
+  size_t splitDim = 0;
+  double maxExtent = -1.0;
+
+  for (size_t idim = 0; idim < ndim; idim++) {
+    const base::DataVector& samples1d = *samplesVec[idim];
+    double lower = samples1d[indices[begin]];
+    double upper = lower;
+
+    for (size_t i = begin + 1; i < end; i++) {
+      lower = std::min(lower, samples1d[indices[i]]);
+      upper = std::max(upper, samples1d[indices[i]]);
+    }
+
+    treeBounds[2 * ndim * node + 2 * idim] = lower;
+    treeBounds[2 * ndim * node + 2 * idim + 1] = upper;
+
+    const double extent = (upper - lower) / bandwidths[idim];
+
+    if (extent > maxExtent) {
+      maxExtent = extent;
+      splitDim = idim;
+    }
+  }
+
+  for (size_t i = begin; i < end; i++) {
+    treeNodes[node].weight += cond[indices[i]];
+  }
+
+  if ((end - begin <= maxLeafSize) || (maxExtent <= 0.0)) {
+    return node;
+  }
+
+  const size_t middle = begin + (end - begin) / 2;
+  const base::DataVector& splitSamples = *samplesVec[splitDim];
+  std::nth_element(indices.begin() + begin, indices.begin() + middle, indices.begin() + end,
+                   [&splitSamples](size_t i, size_t j) { return splitSamples[i] < splitSamples[j]; });
+
+  // treeNodes may be reallocated by the recursive calls
+  const size_t left = buildTreeNode(begin, middle, indices);
+  const size_t right = buildTreeNode(middle, end, indices);
+  treeNodes[node].left = left;
+  treeNodes[node].right = right;
+  return node;
+}
+
+void KernelDensityEstimator::computeKernelBounds(size_t node, const double* x, double& kernelMin,
+                                                 double& kernelMax) {
+  kernelMin = 1.0;
+  kernelMax = 1.0;
+
+  for (size_t idim = 0; idim < ndim; idim++) {
+    const double lower = treeBounds[2 * ndim * node + 2 * idim];
+    const double upper = treeBounds[2 * ndim * node + 2 * idim + 1];
+    const double minDistance = std::max(0.0, std::max(lower - x[idim], x[idim] - upper));
+    const double maxDistance = std::max(std::abs(x[idim] - lower), std::abs(x[idim] - upper));
+
+    // both kernels decrease monotonically with the distance
+    kernelMax *= norm[idim] * kernel->eval(minDistance / bandwidths[idim]);
+    kernelMin *= norm[idim] * kernel->eval(maxDistance / bandwidths[idim]);
+  }
+}
+
+double KernelDensityEstimator::evalTree(const double* x) {
+  double kernelMin, kernelMax;
+  computeKernelBounds(0, x, kernelMin, kernelMax);
+
+  // lower bound of the kernel sum, which is tightened during the traversal
+  double lowerBound = treeNodes[0].weight * kernelMin;
+  double sum = 0.0;
+  evalTreeNode(0, x, kernelMin, kernelMax, sum, lowerBound);
+  return sum;
+}
+
+void KernelDensityEstimator::evalTreeNode(size_t node, const double* x, double kernelMin,
+                                          double kernelMax, double& sum, double& lowerBound) {
+  const TreeNode& treeNode = treeNodes[node];
+
+  // approximating all kernels of the node by the mean of the bounds has an error of at most
+  // weight * (kernelMax - kernelMin) / 2, which is bounded by the node's share of the tolerated
+  // error (relative to the current lower bound of the sum, hence to the sum itself)
+  if (kernelMax - kernelMin <= 2.0 * evaluationTolerance * lowerBound / treeNodes[0].weight) {
+    sum += treeNode.weight * 0.5 * (kernelMin + kernelMax);
+    return;
+  }
+
+  if (treeNode.left == 0) {
+    double leafSum = 0.0;
+
+    for (size_t i = treeNode.begin; i < treeNode.end; i++) {
+      const double* sample = &treeSamples[i * ndim];
+      double res = treeWeights[i];
+
+      for (size_t idim = 0; idim < ndim; idim++) {
+        res *= norm[idim] * kernel->eval((x[idim] - sample[idim]) / bandwidths[idim]);
+      }
+
+      leafSum += res;
+    }
+
+    sum += leafSum;
+    lowerBound += leafSum - treeNode.weight * kernelMin;
+    return;
+  }
+
+  // replace the lower bound of the node by the ones of the children
+  double leftMin, leftMax, rightMin, rightMax;
+  const size_t left = treeNode.left;
+  const size_t right = treeNode.right;
+  computeKernelBounds(left, x, leftMin, leftMax);
+  computeKernelBounds(right, x, rightMin, rightMax);
+  lowerBound += treeNodes[left].weight * leftMin + treeNodes[right].weight * rightMin -
+                treeNode.weight * kernelMin;
+
+  // visit the closer child first to tighten the lower bound early
+  if (leftMax >= rightMax) {
+    evalTreeNode(left, x, leftMin, leftMax, sum, lowerBound);
+    evalTreeNode(right, x, rightMin, rightMax, sum, lowerBound);
+  } else {
+    evalTreeNode(right, x, rightMin, rightMax, sum, lowerBound);
+    evalTreeNode(left, x, leftMin, leftMax, sum, lowerBound);
+  }
+}
+
 void KernelDensityEstimator::cov(base::DataMatrix& cov, base::DataMatrix* bounds) {
   if ((cov.getNrows() != ndim) || (cov.getNcols() != ndim)) {
     // covariance matrix has wrong size -> resize
@@ -407,6 +606,7 @@ void KernelDensityEstimator::setConditionalizationFactor(base::DataVector& pcond
   }
 
   sumCondInv = 1. / sumCond;
+  treeValid = false;
 }
 
 void KernelDensityEstimator::updateConditionalizationFactors(base::DataVector& x,
@@ -675,6 +875,7 @@ double KDEMaximumLikelihoodCrossValidation::eval(const base::DataVector& x) {
     KernelDensityEstimator localKDE(*trainSamples, kde.getKernel().getType(),
                                     BandwidthOptimizationType::NONE);
     localKDE.setBandwidths(x);
+    localKDE.setEvaluationTolerance(kde.getEvaluationTolerance());
 
     // compute the cross entropy
     result += localKDE.crossEntropy(*testSamples);
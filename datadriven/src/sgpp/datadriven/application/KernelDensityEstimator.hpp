@@ -106,6 +106,20 @@ class KernelDensityEstimator : public DensityEstimator {
   void getBandwidths(base::DataVector& sigma);
   void setBandwidths(const base::DataVector& sigma);
 
+  /**
+   * Sets the error tolerance of the density evaluation. For a positive tolerance, pdf traverses a
+   * k-d tree of the samples and replaces the kernels of a whole subtree by the mean of their
+   * lower and upper bound on its bounding box if these bounds are tight enough. The relative
+   * error of every evaluated density is then bounded by the tolerance. For a tolerance of zero
+   * (default), all kernels are evaluated exactly.
+   * The tree is built on the first evaluation; evaluating single points concurrently requires
+   * calling pdf(base::DataMatrix&, base::DataVector&) once before.
+   *
+   * @param relativeTolerance maximal relative error of the evaluated densities
+   */
+  void setEvaluationTolerance(double relativeTolerance);
+  double getEvaluationTolerance();
+
   std::shared_ptr<base::DataMatrix> getSamples() override;
   std::shared_ptr<base::DataVector> getSamples(size_t dim) override;
   void getSample(size_t isample, base::DataVector& sample);
@@ -117,8 +131,27 @@ class KernelDensityEstimator : public DensityEstimator {
   size_t getNsamples() override;
 
  private:
+  /// node of the k-d tree used for the approximate evaluation
+  struct TreeNode {
+    /// range of the samples of the node (in tree order)
+    size_t begin;
+    size_t end;
+    /// index of the children (0 for leaves)
+    size_t left;
+    size_t right;
+    /// sum of the conditionalization factors of the samples
+    double weight;
+  };
+
   double evalKernel(base::DataVector& x, size_t i);
 
+  void buildTree();
+  size_t buildTreeNode(size_t begin, size_t end, std::vector<size_t>& indices);
+  double evalTree(const double* x);
+  void evalTreeNode(size_t node, const double* x, double kernelMin, double kernelMax,
+                    double& sum, double& lowerBound);
+  void computeKernelBounds(size_t node, const double* x, double& kernelMin, double& kernelMax);
+
   /// samples
   std::vector<std::shared_ptr<base::DataVector>> samplesVec;
 
@@ -139,6 +172,19 @@ class KernelDensityEstimator : public DensityEstimator {
   /// bandwith optimization type
   BandwidthOptimizationType bandwidthOptimizationType;
 
+  /// relative error tolerance of pdf (0 for exact evaluation)
+  double evaluationTolerance;
+  /// whether the k-d tree matches the samples and conditionalization factors
+  bool treeValid;
+  /// nodes of the k-d tree, the root is the first node
+  std::vector<TreeNode> treeNodes;
+  /// bounding boxes of the nodes (lower and upper bounds for every dimension)
+  std::vector<double> treeBounds;
+  /// samples in tree order (row major)
+  std::vector<double> treeSamples;
+  /// conditionalization factors in tree order
+  std::vector<double> treeWeights;
+
   void computeAndSetOptKDEbdwth();
   void computeNormalizationFactors();
 };
@@ -16,6 +16,7 @@
 
 #include <sgpp/solver/sle/BiCGStab.hpp>
 #include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
 #include <sgpp/solver/sle/fista/ElasticNetFunction.hpp>
 #include <sgpp/solver/sle/fista/Fista.hpp>
 #include <sgpp/solver/sle/fista/GroupLassoFunction.hpp>
@@ -223,6 +224,9 @@ RegressionLearner::Solver RegressionLearner::createSolver(size_t n_rows) {
           std::make_unique<solver::BiCGStab>(solverConfig.maxIterations_, solverConfig.eps_));
     case SLESolverType::FISTA:
       return createSolverFista(n_rows);
+    case SLESolverType::PipelinedCG:
+      return Solver(std::make_unique<solver::PipelinedConjugateGradients>(
+          solverConfig.maxIterations_, solverConfig.eps_));
   }
 
   throw base::application_exception(
@@ -54,6 +54,11 @@ DataSourceBuilder& DataSourceBuilder::withCompression(bool isCompressed) {
   return *this;
 }
 
+DataSourceBuilder& DataSourceBuilder::withStreaming(bool isStreamed) {
+  config.isStreamed_ = isStreamed;
+  return *this;
+}
+
 DataSourceBuilder& DataSourceBuilder::withPath(const std::string& filePath) {
   config.filePath_ = filePath;
   if (config.fileType_ == DataSourceFileType::NONE) {
@@ -82,7 +87,8 @@ DataSourceSplitting* DataSourceBuilder::splittingAssemble() const {
     throw sgpp::base::application_exception{
         "sgpp has been built without zlib support. Reading compressed files is not possible"};
 #else
-    sampleProvider = new GzipFileSampleDecorator(static_cast<FileSampleProvider*>(sampleProvider));
+    sampleProvider = new GzipFileSampleDecorator(static_cast<FileSampleProvider*>(sampleProvider),
+                                                 config.isStreamed_);
 #endif
   }
 
@@ -120,7 +126,8 @@ DataSourceCrossValidation* DataSourceBuilder::crossValidationAssemble() const {
     throw sgpp::base::application_exception{
         "sgpp has been built without zlib support. Reading compressed files is not possible"};
 #else
-    sampleProvider = new GzipFileSampleDecorator(static_cast<FileSampleProvider*>(sampleProvider));
+    sampleProvider = new GzipFileSampleDecorator(static_cast<FileSampleProvider*>(sampleProvider),
+                                                 config.isStreamed_);
 #endif
   }
   auto t = new DataSourceCrossValidation(config, crossValidationConfig, crossValidationShuffling,
@@ -44,6 +44,14 @@ class DataSourceBuilder {
    */
   DataSourceBuilder& withCompression(bool isCompressed);
 
+  /**
+   * Optionally Specify if a compressed file is decompressed and parsed in chunks on demand
+   * instead of at once. This bounds the memory needed for reading the file in batches.
+   * @param isStreamed true if the file is streamed, false otherwise.
+   * @return Reference to this object, used for chaining.
+   */
+  DataSourceBuilder& withStreaming(bool isStreamed);
+
   /**
    * Optionally Specify the file type if files are used. If data source does not use any files,
    * this is set to none by default. See DataSourceFileType for supported file types.
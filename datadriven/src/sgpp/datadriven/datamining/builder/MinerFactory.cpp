@@ -38,13 +38,29 @@ SparseGridMiner* MinerFactory::buildMiner(const std::string& path) const {
 sgpp::datadriven::HyperparameterOptimizer* MinerFactory::buildHPO(const std::string& path) const {
   DataMiningConfigParser parser(path);
   if (parser.getHPOMethod("bayesian") == "harmonica") {
-    return new HarmonicaHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser),
-                                                parser);
+    return addWorkerMiners(new HarmonicaHyperparameterOptimizer(
+                               buildMiner(path), createFitterFactory(parser), parser),
+                           path);
   } else {
-    return new BoHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser), parser);
+    return addWorkerMiners(
+        new BoHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser), parser),
+        path);
   }
 }
 
+HyperparameterOptimizer* MinerFactory::addWorkerMiners(HyperparameterOptimizer* hpo,
+                                                       const std::string& path) const {
+  DataMiningConfigParser parser(path);
+  HPOConfig config;
+  config.setupDefaults();
+  parser.getHPOConfig(config);
+
+  for (int64_t i = 1; i < config.getNParallelTrials(); i++) {
+    hpo->addWorkerMiner(buildMiner(path));
+  }
+  return hpo;
+}
+
 DataSourceSplitting* MinerFactory::createDataSourceSplitting(
     const DataMiningConfigParser& parser) const {
   DataSourceConfig config{};
@@ -42,6 +42,17 @@ class MinerFactory {
   virtual sgpp::datadriven::HyperparameterOptimizer* buildHPO(const std::string& path) const;
 
  protected:
+  /**
+   * Adds as many worker miners to a hyperparameter optimizer as hpo[parallelTrials] requests
+   * (in addition to the miner the optimizer was constructed with), each built from the same
+   * configuration file, such that configurations can be learned in parallel.
+   * @param hpo hyperparameter optimizer
+   * @param path Path to the configuration file
+   * @return the hyperparameter optimizer
+   */
+  HyperparameterOptimizer* addWorkerMiners(HyperparameterOptimizer* hpo,
+                                           const std::string& path) const;
+
   /**
    * Factory method to build a splitting based data source, i.e. a data source that splits data into
    * validation and training data.
@@ -126,6 +126,8 @@ bool DataMiningConfigParser::getDataSourceConfig(DataSourceConfig &config,
     config.filePath_ = parseString(*dataSourceConfig, "filePath", defaults.filePath_, "dataSource");
     config.isCompressed_ =
         parseBool(*dataSourceConfig, "compression", defaults.isCompressed_, "dataSource");
+    config.isStreamed_ =
+        parseBool(*dataSourceConfig, "streaming", defaults.isStreamed_, "dataSource");
     config.numBatches_ =
         parseUInt(*dataSourceConfig, "numBatches", defaults.numBatches_, "dataSource");
     config.batchSize_ =
@@ -229,6 +231,8 @@ bool DataMiningConfigParser::getMultiDataSourceConfig(
     // Fill in all parameters for first dataset (except the filePath)
     config[0].isCompressed_ =
         parseBool(*dataSourceConfig, "compression", defaults[0].isCompressed_, "dataSource");
+    config[0].isStreamed_ =
+        parseBool(*dataSourceConfig, "streaming", defaults[0].isStreamed_, "dataSource");
     config[0].numBatches_ =
         parseUInt(*dataSourceConfig, "numBatches", defaults[0].numBatches_, "dataSource");
     config[0].batchSize_ =
@@ -1075,6 +1079,8 @@ void DataMiningConfigParser::getHPOConfig(HPOConfig &config) {
     auto node = static_cast<DictNode *>(&(*configFile)["hpo"]);
     config.setSeed(parseInt(*node, "randomSeed", config.getSeed(), "hpo"));
     config.setNTrainSamples(parseInt(*node, "trainSize", config.getNTrainSamples(), "hpo"));
+    config.setNParallelTrials(
+        parseInt(*node, "parallelTrials", config.getNParallelTrials(), "hpo"));
     if (node->contains("harmonica")) {
       auto harmonica = static_cast<DictNode *>(&(*node)["harmonica"]);
       config.setLambda(parseDouble(*harmonica, "lambda", config.getLambda(), "hpo"));
@@ -1090,6 +1096,7 @@ void DataMiningConfigParser::getHPOConfig(HPOConfig &config) {
       auto bo = static_cast<DictNode *>(&(*node)["bayesianOptimization"]);
       config.setNRandom(parseInt(*bo, "nRandom", config.getNRandom(), "hpo"));
       config.setNRuns(parseInt(*bo, "nRuns", config.getNRuns(), "hpo"));
+      config.setBatchSize(parseInt(*bo, "batchSize", config.getBatchSize(), "hpo"));
     } else {
       std::cout << "# Could not find specification of hpo[bayesianOptimization]. Falling Back to "
                    "default values."
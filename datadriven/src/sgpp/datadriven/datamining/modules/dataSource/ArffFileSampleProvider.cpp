@@ -45,8 +45,8 @@ void ArffFileSampleProvider::readFile(const std::string& fileName, bool hasTarge
                                       size_t readinCutoff, std::vector<size_t> readinColumns,
                                       std::vector<double> readinClasses) {
   try {
-    dataset = ARFFTools::readARFFFromFile(fileName, hasTargets, readinCutoff, readinColumns,
-                                          readinClasses);
+    dataset = ARFFTools::readARFFFromMappedFile(fileName, hasTargets, readinCutoff,
+                                                readinColumns, readinClasses);
   } catch (...) {
     // TODO(lettrich): catching all exceptions is bad design. Replace call to ARFFTools with
     // exception safe implementation.
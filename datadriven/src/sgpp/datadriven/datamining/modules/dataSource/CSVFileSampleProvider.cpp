@@ -46,8 +46,8 @@ void CSVFileSampleProvider::readFile(const std::string& fileName, bool hasTarget
                                      std::vector<double> readinClasses) {
   try {
     // call readCSV with skipfirstline set to true
-    dataset = CSVTools::readCSVFromFile(fileName, true, hasTargets, readinCutoff, readinColumns,
-                                        readinClasses);
+    dataset = CSVTools::readCSVFromMappedFile(fileName, true, hasTargets, readinCutoff,
+                                              readinColumns, readinClasses);
   } catch (...) {
     // TODO(lettrich): catching all exceptions is bad design. Replace call to CSVTools with
     // exception safe implementation.
@@ -74,13 +74,15 @@ Dataset* CSVFileSampleProvider::getAllSamples() {
 void CSVFileSampleProvider::readString(const std::string& input, bool hasTargets,
                                        size_t readinCutoff, std::vector<size_t> readinColumns,
                                        std::vector<double> readinClasses) {
-  // try {
-  //   dataset = CSVTools::readCSVFromString(input);
-  // } catch (...) {
-  // TODO(lettrich): catching all exceptions is bad design. Replace call to CSVTools with
-  // exception safe implementation.
-  throw base::data_exception{"Failed to parse CSV data. Reading from string is not implemented."};
-  // }
+  try {
+    // as in readFile, the first line contains the column titles
+    dataset = CSVTools::readCSVFromString(input, true, hasTargets, readinCutoff, readinColumns,
+                                          readinClasses);
+  } catch (...) {
+    // TODO(lettrich): catching all exceptions is bad design. Replace call to CSVTools with
+    // exception safe implementation.
+    throw base::data_exception{"Failed to parse CSV data."};
+  }
 }
 
 Dataset* CSVFileSampleProvider::splitDataset(size_t howMany) {
@@ -59,7 +59,8 @@ class CSVFileSampleProvider : public FileSampleProvider {
                 std::vector<double> readinClasses = std::vector<double>()) override;
 
   /**
-   * Currently not implemented.
+   * Parse a string in CSV format and store its contents inside this class. As for files, the
+   * first line has to contain the column titles. Throws if the string can not be parsed.
    * @param input string containing information in CSV file format
    * @param hasTargets whether the file has targest (i.e. supervised learning)
    * @param readinCutoff see FileSampleProvider.hpp
@@ -42,6 +42,11 @@ struct DataSourceConfig {
    * The dataset is gzip compressed
    */
   bool isCompressed_ = false;
+  /**
+   * Decompress and parse a compressed dataset in chunks on demand instead of decompressing it
+   * completely before parsing (bounded memory when reading in batches)
+   */
+  bool isStreamed_ = false;
   /**
    * How many batches should the dataset be split into for batch learning - if 1, take the
    * entire dataset
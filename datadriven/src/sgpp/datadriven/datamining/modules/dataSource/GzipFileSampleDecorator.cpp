@@ -11,14 +11,82 @@
 #include <sgpp/datadriven/datamining/modules/dataSource/SampleProvider.hpp>
 
 #include <zlib.h>
+#include <algorithm>
+#include <limits>
+#include <memory>
 #include <string>
 #include <vector>
 
 namespace sgpp {
 namespace datadriven {
 
-GzipFileSampleDecorator::GzipFileSampleDecorator(FileSampleProvider* const fileSampleProvider)
-    : FileSampleDecorator(fileSampleProvider) {}
+GzipFileSampleDecorator::GzipFileSampleDecorator(FileSampleProvider* const fileSampleProvider,
+                                                 bool streaming, size_t chunkSize)
+    : FileSampleDecorator(fileSampleProvider),
+      streaming(streaming),
+      chunkSize(std::max<size_t>(chunkSize, 1)),
+      fileName(),
+      hasTargets(true),
+      readinCutoff(-1),
+      readinColumns(),
+      readinClasses(),
+      file(nullptr),
+      firstLine(),
+      remainder(),
+      endOfFile(false),
+      dimension(0),
+      numReturnedSamples(0),
+      bufferedSamples(),
+      bufferedTargets(),
+      numSamples(-1) {}
+
+GzipFileSampleDecorator::GzipFileSampleDecorator(const GzipFileSampleDecorator& rhs)
+    : FileSampleDecorator(rhs),
+      streaming(rhs.streaming),
+      chunkSize(rhs.chunkSize),
+      fileName(rhs.fileName),
+      hasTargets(rhs.hasTargets),
+      readinCutoff(rhs.readinCutoff),
+      readinColumns(rhs.readinColumns),
+      readinClasses(rhs.readinClasses),
+      file(nullptr),
+      firstLine(),
+      remainder(),
+      endOfFile(false),
+      dimension(0),
+      numReturnedSamples(0),
+      bufferedSamples(),
+      bufferedTargets(),
+      numSamples(rhs.numSamples) {
+  if (rhs.file != nullptr) {
+    openStream();
+  }
+}
+
+GzipFileSampleDecorator& GzipFileSampleDecorator::operator=(const GzipFileSampleDecorator& rhs) {
+  if (&rhs == this) {
+    return *this;
+  }
+
+  closeStream();
+  FileSampleDecorator::operator=(rhs);
+  streaming = rhs.streaming;
+  chunkSize = rhs.chunkSize;
+  fileName = rhs.fileName;
+  hasTargets = rhs.hasTargets;
+  readinCutoff = rhs.readinCutoff;
+  readinColumns = rhs.readinColumns;
+  readinClasses = rhs.readinClasses;
+  numSamples = rhs.numSamples;
+
+  if (rhs.file != nullptr) {
+    openStream();
+  }
+
+  return *this;
+}
+
+GzipFileSampleDecorator::~GzipFileSampleDecorator() { closeStream(); }
 
 SampleProvider* GzipFileSampleDecorator::clone() const {
   return dynamic_cast<SampleProvider*>(new GzipFileSampleDecorator{*this});
@@ -29,6 +97,17 @@ void GzipFileSampleDecorator::readFile(const std::string& fileName,
                                        size_t readinCutoff,
                                        std::vector<size_t> readinColumns,
                                        std::vector<double> readinClasses) {
+  if (streaming) {
+    this->fileName = fileName;
+    this->hasTargets = hasTargets;
+    this->readinCutoff = readinCutoff;
+    this->readinColumns = readinColumns;
+    this->readinClasses = readinClasses;
+    numSamples = -1;
+    openStream();
+    return;
+  }
+
   gzFile inFileZ = gzopen(fileName.c_str(), "rb");
 
   if (inFileZ == nullptr) {
@@ -57,7 +136,210 @@ void GzipFileSampleDecorator::readFile(const std::string& fileName,
     readinCutoff, readinColumns, readinClasses);
 }
 
+Dataset* GzipFileSampleDecorator::getNextSamples(size_t howMany) {
+  if (!streaming) {
+    return FileSampleDecorator::getNextSamples(howMany);
+  }
+
+  if (file == nullptr) {
+    throw base::file_exception("No dataset loaded.");
+  }
+
+  howMany = std::min(howMany, readinCutoff - numReturnedSamples);
+
+  while ((bufferedTargets.size() < howMany) && bufferNextChunk()) {
+  }
+
+  const size_t size = std::min(howMany, bufferedTargets.size());
+  auto dataset = std::make_unique<Dataset>(size, dimension);
+
+  std::copy(bufferedSamples.begin(), bufferedSamples.begin() + size * dimension,
+            dataset->getData().getPointer());
+  std::copy(bufferedTargets.begin(), bufferedTargets.begin() + size,
+            dataset->getTargets().getPointer());
+  bufferedSamples.erase(bufferedSamples.begin(), bufferedSamples.begin() + size * dimension);
+  bufferedTargets.erase(bufferedTargets.begin(), bufferedTargets.begin() + size);
+  numReturnedSamples += size;
+
+  return dataset.release();
+}
+
+Dataset* GzipFileSampleDecorator::getAllSamples() {
+  if (!streaming) {
+    return FileSampleDecorator::getAllSamples();
+  }
+
+  return getNextSamples(std::numeric_limits<size_t>::max());
+}
+
+size_t GzipFileSampleDecorator::getDim() const {
+  if (!streaming) {
+    return FileSampleDecorator::getDim();
+  }
+
+  if (dimension == 0) {
+    throw base::file_exception("No dataset loaded.");
+  }
+
+  return dimension;
+}
+
+size_t GzipFileSampleDecorator::getNumSamples() const {
+  if (!streaming) {
+    return FileSampleDecorator::getNumSamples();
+  }
+
+  if (numSamples == static_cast<size_t>(-1)) {
+    gzFile countFile = gzopen(fileName.c_str(), "rb");
+
+    if (countFile == nullptr) {
+      throw base::file_exception("failed to open Gzip compressed file.");
+    }
+
+    std::string countFirstLine;
+    std::string countRemainder;
+    std::string lines;
+    size_t count = 0;
+
+    try {
+      while (decompressLines(countFile, countRemainder, lines)) {
+        std::unique_ptr<Dataset> samples = parseLines(lines, countFirstLine);
+
+        if (samples != nullptr) {
+          count += samples->getNumberInstances();
+        }
+      }
+    } catch (...) {
+      gzclose(countFile);
+      throw;
+    }
+
+    gzclose(countFile);
+    numSamples = std::min(count, readinCutoff);
+  }
+
+  return numSamples;
+}
+
 void GzipFileSampleDecorator::reset() {
+  if (streaming && (file != nullptr)) {
+    gzrewind(file);
+    firstLine.clear();
+    remainder.clear();
+    endOfFile = false;
+    numReturnedSamples = 0;
+    bufferedSamples.clear();
+    bufferedTargets.clear();
+  }
+}
+
+void GzipFileSampleDecorator::openStream() {
+  closeStream();
+  file = gzopen(fileName.c_str(), "rb");
+
+  if (file == nullptr) {
+    throw base::file_exception("failed to open Gzip compressed file.");
+  }
+
+  firstLine.clear();
+  remainder.clear();
+  endOfFile = false;
+  dimension = 0;
+  numReturnedSamples = 0;
+  bufferedSamples.clear();
+  bufferedTargets.clear();
+
+  // parse the first chunk to determine the dimensionality (and to fail early)
+  while ((dimension == 0) && bufferNextChunk()) {
+  }
+}
+
+void GzipFileSampleDecorator::closeStream() {
+  if (file != nullptr) {
+    gzclose(file);
+    file = nullptr;
+  }
+}
+
+bool GzipFileSampleDecorator::decompressLines(gzFile_s* file, std::string& remainder,
+                                              std::string& lines) const {
+  std::vector<char> unzippedData(chunkSize);
+
+  while (true) {
+    const int unzippedBytes =
+        gzread(file, unzippedData.data(), static_cast<unsigned int>(unzippedData.size()));
+
+    if (unzippedBytes < 0) {
+      throw base::file_exception("failed to decompress Gzip compressed file.");
+    } else if (unzippedBytes == 0) {
+      // end of file: the remainder is the last line
+      lines.swap(remainder);
+      remainder.clear();
+      return !lines.empty();
+    }
+
+    remainder.append(unzippedData.begin(), unzippedData.begin() + unzippedBytes);
+    const size_t lastLineBreak = remainder.rfind('\n');
+
+    // continue reading if the chunk does not even contain a complete line
+    if (lastLineBreak != std::string::npos) {
+      lines.assign(remainder, 0, lastLineBreak + 1);
+      remainder.erase(0, lastLineBreak + 1);
+      return true;
+    }
+  }
+}
+
+std::unique_ptr<Dataset> GzipFileSampleDecorator::parseLines(const std::string& lines,
+                                                             std::string& firstLine) const {
+  if (firstLine.empty()) {
+    // the first chunk contains the first line of the file (column titles or ARFF header)
+    const size_t firstLineBegin = lines.find_first_not_of("\r\n");
+
+    if (firstLineBegin == std::string::npos) {
+      return nullptr;
+    }
+
+    const size_t firstLineEnd = lines.find('\n', firstLineBegin);
+    firstLine = lines.substr(firstLineBegin, firstLineEnd - firstLineBegin) + "\n";
+    fileSampleProvider->readString(lines, hasTargets, -1, readinColumns, readinClasses);
+  } else {
+    fileSampleProvider->readString(firstLine + lines, hasTargets, -1, readinColumns,
+                                   readinClasses);
+  }
+
+  fileSampleProvider->reset();
+
+  try {
+    return std::unique_ptr<Dataset>(fileSampleProvider->getAllSamples());
+  } catch (base::file_exception&) {
+    // the decorated providers throw if the lines do not contain any samples (e.g., only ARFF
+    // header lines)
+    return nullptr;
+  }
+}
+
+bool GzipFileSampleDecorator::bufferNextChunk() {
+  std::string lines;
+
+  if (endOfFile || !decompressLines(file, remainder, lines)) {
+    endOfFile = true;
+    return false;
+  }
+
+  std::unique_ptr<Dataset> samples = parseLines(lines, firstLine);
+
+  if (samples != nullptr) {
+    dimension = samples->getDimension();
+    const double* data = samples->getData().getPointer();
+    const double* targets = samples->getTargets().getPointer();
+    bufferedSamples.insert(bufferedSamples.end(), data,
+                           data + samples->getNumberInstances() * dimension);
+    bufferedTargets.insert(bufferedTargets.end(), targets,
+                           targets + samples->getNumberInstances());
+  }
+
+  return true;
 }
 
 } /* namespace datadriven */
@@ -8,9 +8,13 @@
 
 #include <sgpp/datadriven/datamining/modules/dataSource/FileSampleDecorator.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
+// opaque zlib file handle, see zlib.h
+struct gzFile_s;
+
 namespace sgpp {
 namespace datadriven {
 /**
@@ -18,6 +22,14 @@ namespace datadriven {
  *
  * This class wraps any valid #sgpp::datadriven::FileSampleProvider object and adds a decompression
  * step to the #readFile member function before trying to parse the contents of the file.
+ *
+ * By default, the whole file is decompressed into memory and parsed at once. In streaming mode,
+ * the file is only opened by #readFile and decompressed in chunks of bounded size on demand
+ * instead. Every chunk of complete lines (preceded by the first line of the file, i.e., the CSV
+ * column titles or the ARFF relation, which therefore must not be a data line) is parsed by the
+ * decorated provider's #readString and buffered until it is requested by #getNextSamples. Hence,
+ * reading a file in batches requires memory proportional to the batch and chunk size only.
+ * Shuffling of the decorated provider is applied within every chunk.
  */
 class GzipFileSampleDecorator : public FileSampleDecorator {
  public:
@@ -25,14 +37,37 @@ class GzipFileSampleDecorator : public FileSampleDecorator {
    * Constructor decorating a FileSampleProvider object.
    *
    * @param fileSampleProvider: pointer to the object to be used as a delegate.
+   * @param streaming whether to decompress and parse the file in chunks on demand
+   * @param chunkSize number of decompressed bytes read at once in streaming mode
+   */
+  explicit GzipFileSampleDecorator(FileSampleProvider* fileSampleProvider,
+                                   bool streaming = false, size_t chunkSize = 1 << 20);
+
+  /**
+   * Copy constructor. In streaming mode, the copy reopens the file and starts at its beginning.
+   *
+   * @param rhs object to copy
    */
-  explicit GzipFileSampleDecorator(FileSampleProvider* fileSampleProvider);
+  GzipFileSampleDecorator(const GzipFileSampleDecorator& rhs);
+
+  /**
+   * Assignment operator. In streaming mode, the file is reopened and read from its beginning.
+   *
+   * @param rhs object to copy
+   * @return reference to this object
+   */
+  GzipFileSampleDecorator& operator=(const GzipFileSampleDecorator& rhs);
+
+  /**
+   * Destructor, closes the file in streaming mode.
+   */
+  ~GzipFileSampleDecorator() override;
 
   SampleProvider* clone() const override;
 
   /**
    * Decompresses a .gz file and delegates the contents down to the
-   * sample provider.
+   * sample provider. In streaming mode, only the first chunk is decompressed and parsed.
    * @param fileName path to the file
    * @param hasTargets whether the file has targets (i.e. supervised learning)
    * @param readinCutoff see FileSampleProvider.hpp
@@ -46,9 +81,104 @@ class GzipFileSampleDecorator : public FileSampleDecorator {
                 std::vector<double> readinClasses = std::vector<double>()) override;
 
   /**
-   * Resets the state of the sample provider (e.g. to start a new epoch)
+   * Returns the next samples. In streaming mode, chunks are decompressed and parsed until
+   * enough samples are available or the end of the file is reached.
+   * @param howMany number of requested samples
+   * @return new #sgpp::datadriven::Dataset containing at most howMany samples, owned by the
+   * caller
+   */
+  Dataset *getNextSamples(size_t howMany) override;
+
+  /**
+   * Returns all remaining samples. In streaming mode, this decompresses the rest of the file.
+   * @return new #sgpp::datadriven::Dataset, owned by the caller
+   */
+  Dataset *getAllSamples() override;
+
+  size_t getDim() const override;
+
+  /**
+   * Returns the number of samples. In streaming mode, the file is decompressed and parsed once
+   * in a separate pass (without storing the samples) to count them.
+   * @return number of samples
+   */
+  size_t getNumSamples() const override;
+
+  /**
+   * Resets the state of the sample provider (e.g. to start a new epoch). In streaming mode,
+   * the file is rewound.
    */
   void reset() override;
+
+ private:
+  /**
+   * Opens the file in streaming mode and reads the first chunk.
+   */
+  void openStream();
+
+  /**
+   * Closes the file in streaming mode.
+   */
+  void closeStream();
+
+  /**
+   * Decompresses the next chunk of complete lines from a file.
+   * @param file the file to read from
+   * @param[in,out] remainder incomplete last line of the previous chunk
+   * @param[out] lines complete lines of this chunk
+   * @return false if the end of the file was reached and no lines are left
+   */
+  bool decompressLines(gzFile_s* file, std::string &remainder, std::string &lines) const;
+
+  /**
+   * Parses complete lines with the decorated provider.
+   * @param lines complete lines of the file (the first line of the file is prepended if it is
+   * not contained)
+   * @param[in,out] firstLine first line of the file, determined from the first chunk
+   * @return parsed samples (nullptr if the lines do not contain any samples)
+   */
+  std::unique_ptr<Dataset> parseLines(const std::string &lines, std::string &firstLine) const;
+
+  /**
+   * Decompresses and parses the next chunk and appends its samples to the buffer.
+   * @return false if the end of the file was reached
+   */
+  bool bufferNextChunk();
+
+  /// whether the file is decompressed and parsed in chunks on demand
+  bool streaming;
+  /// number of decompressed bytes read at once in streaming mode
+  size_t chunkSize;
+
+  /// path to the file (streaming mode)
+  std::string fileName;
+  /// whether the file has targets (streaming mode)
+  bool hasTargets;
+  /// maximal number of samples (streaming mode)
+  size_t readinCutoff;
+  /// selected columns (streaming mode)
+  std::vector<size_t> readinColumns;
+  /// selected classes (streaming mode)
+  std::vector<double> readinClasses;
+
+  /// handle of the opened file (streaming mode)
+  gzFile_s* file;
+  /// first line of the file
+  std::string firstLine;
+  /// incomplete last line of the last decompressed chunk
+  std::string remainder;
+  /// whether the end of the file has been reached
+  bool endOfFile;
+  /// dimensionality of the samples (0 if unknown yet)
+  size_t dimension;
+  /// number of samples returned since the last reset
+  size_t numReturnedSamples;
+  /// samples parsed but not returned yet (row major)
+  std::vector<double> bufferedSamples;
+  /// targets of the samples parsed but not returned yet
+  std::vector<double> bufferedTargets;
+  /// cached result of getNumSamples in streaming mode (-1 if not counted yet)
+  mutable size_t numSamples;
 };
 
 } /* namespace datadriven */
@@ -12,6 +12,7 @@
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 #include <sgpp/solver/sle/BiCGStab.hpp>
 #include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
 
 #include <set>
 #include <string>
@@ -30,6 +31,7 @@ using base::GridPoint;
 using base::GridType;
 using sgpp::solver::BiCGStab;
 using sgpp::solver::ConjugateGradients;
+using sgpp::solver::PipelinedConjugateGradients;
 using sgpp::solver::SLESolver;
 using sgpp::solver::SLESolverConfiguration;
 using sgpp::solver::SLESolverType;
@@ -88,6 +90,8 @@ SLESolver *ModelFittingBase::buildSolver(const SLESolverConfiguration &sleConfig
     return new ConjugateGradients(sleConfig.maxIterations_, sleConfig.eps_);
   } else if (sleConfig.type_ == SLESolverType::BiCGSTAB) {
     return new BiCGStab(sleConfig.maxIterations_, sleConfig.eps_);
+  } else if (sleConfig.type_ == SLESolverType::PipelinedCG) {
+    return new PipelinedConjugateGradients(sleConfig.maxIterations_, sleConfig.eps_);
   } else {
     throw factory_exception(
         "ModelFittingBase: An unsupported SLE solver type was "
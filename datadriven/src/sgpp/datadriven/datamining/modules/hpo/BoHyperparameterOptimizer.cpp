@@ -7,9 +7,10 @@
 #include <sgpp/datadriven/datamining/modules/hpo/BoHyperparameterOptimizer.hpp>
 #include <sgpp/datadriven/datamining/modules/hpo/bo/BayesianOptimization.hpp>
 
-#include <vector>
-#include <string>
+#include <algorithm>
 #include <limits>
+#include <string>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -55,70 +56,77 @@ double BoHyperparameterOptimizer::run(bool writeToFile) {
 
 
 
-  // list/vector of configs, start setup
-  std::vector<BOConfig> initialConfigs{};
-  initialConfigs.reserve(static_cast<size_t>(config.getNRandom()));
-  std::mt19937 generator(static_cast<size_t>(config.getSeed()));
-
-  // random warmup phase
-  for (int i = 0; i < config.getNRandom(); ++i) {
-    initialConfigs.emplace_back(prototype);
-    initialConfigs[i].randomize(generator);
-    fitterFactory->setBO(initialConfigs[i]);
-    std::string configString = fitterFactory->printConfig();
-    // std::unique_ptr<ModelFittingBase> fitter(fitterFactory->buildFitter());
-    miner->setModel(fitterFactory->buildFitter());
-    double result = miner->learn(false);
-    // hpoScorer->calculateScore(*fitter, *trainData, &stdDeviation);
-    initialConfigs[i].setScore(transformScore(result));
-    std::cout << (i + 1) << configString << ", " << result;
+  // prints a result and keeps track of the best one
+  auto report = [&](int sampleNo, const std::string &configString, double result) {
+    std::cout << sampleNo << configString << ", " << result;
     if (writeToFile) {
       myfile.open(fn.str(), std::ios_base::app);
       if (myfile.is_open()) {
-        myfile << (i + 1) << configString << ", " << result << std::endl;
+        myfile << sampleNo << configString << ", " << result << std::endl;
       }
       myfile.close();
     }
     if (result < best) {
       best = result;
-      bestscnt = i + 1;
+      bestscnt = sampleNo;
       bestconfigstring = configString;
       std::cout << " new best!";
     }
     std::cout << std::endl;
+  };
+
+  // builds the fitters of a batch of configs (the fitter factory is not thread-safe)
+  auto prepareTrials = [&](std::vector<BOConfig> &configs, std::vector<ModelFittingBase *> &fitters,
+                           std::vector<std::string> &configStrings) {
+    fitters.resize(configs.size());
+    configStrings.resize(configs.size());
+    for (size_t i = 0; i < configs.size(); ++i) {
+      fitterFactory->setBO(configs[i]);
+      configStrings[i] = fitterFactory->printConfig();
+      fitters[i] = fitterFactory->buildFitter();
+    }
+  };
+
+  std::vector<ModelFittingBase *> fitters;
+  std::vector<std::string> configStrings;
+  base::DataVector scores;
+
+  // list/vector of configs, start setup
+  std::vector<BOConfig> initialConfigs{};
+  initialConfigs.reserve(static_cast<size_t>(config.getNRandom()));
+  std::mt19937 generator(static_cast<size_t>(config.getSeed()));
+
+  // random warmup phase (all samples are independent and may be learned in parallel)
+  for (int i = 0; i < config.getNRandom(); ++i) {
+    initialConfigs.emplace_back(prototype);
+    initialConfigs[i].randomize(generator);
   }
+  prepareTrials(initialConfigs, fitters, configStrings);
+  runTrials(fitters, scores, [&](size_t i, double result) {
+    initialConfigs[i].setScore(transformScore(result));
+    report(static_cast<int>(i + 1), configStrings[i], result);
+  });
 
   std::cout << "############# Random Phase finished! #############" << std::endl;
 
   BayesianOptimization bo(initialConfigs);
   bo.setScales(bo.fitScales(), 0.7);
 
-
-  // main loop
-  for (int q = 0; q < config.getNRuns(); q++) {
-    BOConfig nextConfig = bo.main(prototype);
-    fitterFactory->setBO(nextConfig);
-    std::string configString = fitterFactory->printConfig();
-    miner->setModel(fitterFactory->buildFitter());
-    double result = miner->learn(false);
-    nextConfig.setScore(transformScore(result));
-    bo.updateGP(nextConfig, true);
-    bo.setScales(bo.fitScales(), 0.1);
-    std::cout << (q + config.getNRandom() + 1) << configString << ", " << result;
-    if (writeToFile) {
-      myfile.open(fn.str(), std::ios_base::app);
-      if (myfile.is_open()) {
-        myfile << (q + config.getNRandom() + 1) << configString << ", " << result << std::endl;
-      }
-      myfile.close();
+  // main loop, proposing batches of configs that are learned in parallel
+  const size_t nRuns = static_cast<size_t>(std::max<int64_t>(config.getNRuns(), 0));
+  const size_t batchSize = static_cast<size_t>(std::max<int64_t>(1, config.getBatchSize()));
+  for (size_t q = 0; q < nRuns; q += batchSize) {
+    std::vector<BOConfig> nextConfigs = bo.main(prototype, std::min(batchSize, nRuns - q));
+    prepareTrials(nextConfigs, fitters, configStrings);
+    const size_t firstSample = q + static_cast<size_t>(config.getNRandom()) + 1;
+    runTrials(fitters, scores, [&](size_t i, double result) {
+      report(static_cast<int>(firstSample + i), configStrings[i], result);
+    });
+    for (size_t i = 0; i < nextConfigs.size(); ++i) {
+      nextConfigs[i].setScore(transformScore(scores[i]));
+      bo.updateGP(nextConfigs[i], true);
     }
-    if (result < best) {
-      best = result;
-      bestscnt = static_cast<int>(q + config.getNRandom() + 1);
-      bestconfigstring = configString;
-      std::cout << " new best!";
-    }
-    std::cout << std::endl;
+    bo.setScales(bo.fitScales(), 0.1);
   }
   if (writeToFile) {
     myfile.open(fn.str(), std::ios_base::app);
@@ -18,6 +18,8 @@ void HPOConfig::setupDefaults() {
   constraints = {2, 2};
   lambda = 1;
   nRandom = 10;
+  nParallelTrials = 1;
+  batchSize = 1;
 }
 
 int64_t HPOConfig::getSeed() const {
@@ -75,5 +77,21 @@ int64_t HPOConfig::getNTrainSamples() const {
 void HPOConfig::setNTrainSamples(int64_t nTrainSamples) {
   HPOConfig::nTrainSamples = nTrainSamples;
 }
+
+int64_t HPOConfig::getNParallelTrials() const {
+  return nParallelTrials;
+}
+
+void HPOConfig::setNParallelTrials(int64_t nParallelTrials) {
+  HPOConfig::nParallelTrials = nParallelTrials;
+}
+
+int64_t HPOConfig::getBatchSize() const {
+  return batchSize;
+}
+
+void HPOConfig::setBatchSize(int64_t batchSize) {
+  HPOConfig::batchSize = batchSize;
+}
 } /* namespace datadriven */
 } /* namespace sgpp */
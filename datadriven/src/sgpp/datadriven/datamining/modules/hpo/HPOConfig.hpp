@@ -48,6 +48,14 @@ class HPOConfig {
 
   void setNTrainSamples(int64_t nTrainSamples);
 
+  int64_t getNParallelTrials() const;
+
+  void setNParallelTrials(int64_t nParallelTrials);
+
+  int64_t getBatchSize() const;
+
+  void setBatchSize(int64_t batchSize);
+
  private:
   /**
    * Seed for random sampling in both harmonica and bayesian optimization
@@ -77,6 +85,14 @@ class HPOConfig {
    * number of samples bayesian optimization is run for
    */
   int64_t nRuns;
+  /**
+   * Number of configurations that are learned in parallel (each by its own miner)
+   */
+  int64_t nParallelTrials;
+  /**
+   * Number of sample points bayesian optimization proposes at once
+   */
+  int64_t batchSize;
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -60,15 +60,14 @@ double HarmonicaHyperparameterOptimizer::run(bool writeToFile) {
     std::vector<std::string> configStrings(nRuns);
     harmonica.prepareConfigs(fitters, static_cast<int>(config.getSeed()), configStrings);
 
-    // run samples (parallelize here)
-    for (size_t i = 0; i < nRuns; i++) {
-      miner->setModel(fitters[i]);
-      scores[i] = miner->learn(false);
-      // hpoScorer->calculateScore(*(fitters[i]), *trainData, &stdDeviation);
-      std::cout << scnt << configStrings[i] << ", " << scores[i];
-      if (scores[i] < best) {
-        best = scores[i];
-        bestscnt = scnt;
+    // run samples (in parallel if multiple workers are available)
+    const int firstSample = scnt;
+    runTrials(fitters, scores, [&](size_t i, double score) {
+      const int sampleNo = firstSample + static_cast<int>(i);
+      std::cout << sampleNo << configStrings[i] << ", " << score;
+      if (score < best) {
+        best = score;
+        bestscnt = sampleNo;
         bestconfigstring = configStrings[i];
         std::cout << " new best!";
       }
@@ -76,14 +75,14 @@ double HarmonicaHyperparameterOptimizer::run(bool writeToFile) {
       if (writeToFile) {
         myfile.open(fn.str(), std::ios_base::app);
         if (myfile.is_open()) {
-          myfile << scnt << configStrings[i] << ", " << scores[i] << std::endl;
+          myfile << sampleNo << configStrings[i] << ", " << score << std::endl;
         } else {
           std::cout << "Output File '" << fn.str() << "' can't be written to." << std::endl;
         }
         myfile.close();
       }
-      scnt++;
-    }
+    });
+    scnt += static_cast<int>(nRuns);
 
     // constraint introduction
     if (q < config.getStages().size() - 1) {
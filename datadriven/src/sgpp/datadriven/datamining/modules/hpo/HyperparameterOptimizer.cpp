@@ -5,7 +5,12 @@
 
 #include <sgpp/datadriven/datamining/modules/hpo/HyperparameterOptimizer.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
+#include <algorithm>
+#include <exception>
 #include <vector>
 #include <string>
 #include <limits>
@@ -20,5 +25,66 @@ HyperparameterOptimizer::HyperparameterOptimizer(SparseGridMiner* miner,
   config.setupDefaults();
   parser.getHPOConfig(config);
 }
+
+void HyperparameterOptimizer::addWorkerMiner(SparseGridMiner* miner) {
+  workerMiners.emplace_back(miner);
+}
+
+size_t HyperparameterOptimizer::getNumberOfWorkers() const {
+  const size_t maxWorkers = static_cast<size_t>(std::max<int64_t>(1, config.getNParallelTrials()));
+  return std::min(maxWorkers, workerMiners.size() + 1);
+}
+
+void HyperparameterOptimizer::runTrials(const std::vector<ModelFittingBase*>& fitters,
+                                        base::DataVector& scores,
+                                        const std::function<void(size_t, double)>& onResult) {
+  const size_t nTrials = fitters.size();
+  const size_t nWorkers = std::min(getNumberOfWorkers(), nTrials);
+  scores.resize(nTrials);
+
+  if (nWorkers <= 1) {
+    // keep the parallelism inside of the trials
+    for (size_t i = 0; i < nTrials; i++) {
+      miner->setModel(fitters[i]);
+      scores[i] = miner->learn(false);
+      onResult(i, scores[i]);
+    }
+
+    return;
+  }
+
+  std::exception_ptr exception = nullptr;
+
+#pragma omp parallel num_threads(static_cast<int>(nWorkers))
+  {
+    size_t worker = 0;
+#ifdef _OPENMP
+    worker = static_cast<size_t>(omp_get_thread_num());
+#endif
+    SparseGridMiner& workerMiner = (worker == 0) ? *miner : *workerMiners[worker - 1];
+
+#pragma omp for schedule(dynamic, 1)
+    for (size_t i = 0; i < nTrials; i++) {
+      try {
+        workerMiner.setModel(fitters[i]);
+        scores[i] = workerMiner.learn(false);
+
+#pragma omp critical(HyperparameterOptimizerResult)
+        { onResult(i, scores[i]); }
+      } catch (...) {
+#pragma omp critical(HyperparameterOptimizerException)
+        {
+          if (exception == nullptr) {
+            exception = std::current_exception();
+          }
+        }
+      }
+    }
+  }
+
+  if (exception != nullptr) {
+    std::rethrow_exception(exception);
+  }
+}
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -5,13 +5,16 @@
 
 #pragma once
 
+#include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSource.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingBase.hpp>
 #include <sgpp/datadriven/datamining/modules/scoring/Scorer.hpp>
 #include <sgpp/datadriven/datamining/modules/hpo/FitterFactory.hpp>
 #include <sgpp/datadriven/datamining/base/SparseGridMiner.hpp>
 
+#include <functional>
 #include <memory>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -69,13 +72,47 @@ class HyperparameterOptimizer {
    */
   virtual double run(bool writeToFile) = 0;
 
+  /**
+   * Adds a miner that learns hyperparameter configurations in parallel to the miner passed to
+   * the constructor. Every miner needs its own data source and scorer, as both are stateful; the
+   * miners should be configured identically (e.g., built from the same configuration file).
+   * At most hpo[parallelTrials] miners are used.
+   * @param miner configured instance of SGMiner object. The HyperparameterOptimizer instance will
+   * take ownership of the passed object.
+   */
+  void addWorkerMiner(SparseGridMiner *miner);
+
+  /**
+   * @return number of configurations that are learned in parallel, i.e., the number of miners
+   * limited by hpo[parallelTrials]
+   */
+  size_t getNumberOfWorkers() const;
+
 
  protected:
+  /**
+   * Learns multiple configurations and collects their scores. If more than one worker is
+   * available, the fitters are distributed dynamically among the workers, which learn in parallel
+   * (fitting and scoring within one trial are then sequential). The workers take ownership of the
+   * fitters.
+   * @param fitters fitters to learn
+   * @param scores scores of the fitters (output, resized to the number of fitters)
+   * @param onResult called with the index and the score of every fitter as soon as it has been
+   * learned (one call at a time, in order of completion)
+   */
+  void runTrials(const std::vector<ModelFittingBase *> &fitters, base::DataVector &scores,
+                 const std::function<void(size_t, double)> &onResult);
+
   /**
    * Miner providing all testing facilities
    */
   std::unique_ptr<SparseGridMiner> miner;
 
+  /**
+   * Additional miners for learning configurations in parallel
+   */
+  std::vector<std::unique_ptr<SparseGridMiner>> workerMiners;
+
   /**
    * FitterFactory to provide fitters for running different hyperparameter configurations.
    */
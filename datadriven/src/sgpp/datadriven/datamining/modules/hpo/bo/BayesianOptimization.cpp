@@ -12,9 +12,10 @@
 #include <sgpp/datadriven/datamining/modules/hpo/bo/BayesianOptimization.hpp>
 #include <sgpp/optimization/optimizer/unconstrained/MultiStart.hpp>
 
-#include <vector>
+#include <algorithm>
 #include <iostream>
 #include <limits>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -101,6 +102,28 @@ BOConfig BayesianOptimization::main(BOConfig &prototype) {
   return bestConfig;
 }
 
+std::vector<BOConfig> BayesianOptimization::main(BOConfig &prototype, size_t batchSize) {
+  std::vector<BOConfig> batch;
+  batch.reserve(batchSize);
+  BayesianOptimization believer(*this);
+  double lie = std::numeric_limits<double>::infinity();
+
+  for (auto &config : allConfigs) {
+    lie = std::min(lie, config.getScore());
+  }
+
+  for (size_t i = 0; i < batchSize; i++) {
+    batch.push_back(believer.main(prototype));
+
+    if (i + 1 < batchSize) {
+      BOConfig liar(batch.back());
+      liar.setScore(lie);
+      believer.updateGP(liar, true);
+    }
+  }
+  return batch;
+}
+
 double BayesianOptimization::acquisitionOuter(const base::DataVector &inp) {
   base::DataVector kernelrow(allConfigs.size());
   for (size_t i = 0; i < allConfigs.size(); i++) {
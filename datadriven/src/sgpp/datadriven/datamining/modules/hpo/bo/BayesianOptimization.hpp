@@ -65,6 +65,18 @@ class BayesianOptimization {
    */
   BOConfig main(BOConfig &prototype);
 
+  /**
+   * Finds multiple new sample points that can be evaluated in parallel. The points are
+   * determined one after another by main() on a copy of the Gaussian Process, into which every
+   * new point is inserted with the best score so far ("constant liar" heuristic). This lowers
+   * the expected improvement around the points already chosen, so that the next point explores
+   * a different region. This object is not modified.
+   * @param prototype baseline BOConfig
+   * @param batchSize number of sample points
+   * @return new sample points
+   */
+  std::vector<BOConfig> main(BOConfig &prototype, size_t batchSize);
+
 
   /**
    * kernel function
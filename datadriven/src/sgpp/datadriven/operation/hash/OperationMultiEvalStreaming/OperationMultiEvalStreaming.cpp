@@ -7,6 +7,10 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
+#include <cctype>
+#include <string>
+
 namespace sgpp {
 namespace datadriven {
 
@@ -15,7 +19,36 @@ OperationMultiEvalStreaming::OperationMultiEvalStreaming(base::Grid& grid,
     : OperationMultipleEval(grid, dataset),
       preparedDataset(dataset),
       myTimer_(sgpp::base::SGppStopwatch()),
-      duration(-1.0) {
+      duration(-1.0),
+      requestedInstructionSet(StreamingInstructionSet::AUTO),
+      instructionSet(StreamingInstructionSet::GENERIC),
+      multKernel(nullptr),
+      multTransposeKernel(nullptr) {
+  this->storage = &grid.getStorage();
+  this->padDataset(this->preparedDataset);
+  this->preparedDataset.transpose();
+
+  // create the kernel specific data structures for the current grid
+  this->prepare();
+}
+
+OperationMultiEvalStreaming::OperationMultiEvalStreaming(
+    base::Grid& grid, base::DataMatrix& dataset,
+    OperationMultipleEvalConfiguration& configuration)
+    : OperationMultipleEval(grid, dataset),
+      preparedDataset(dataset),
+      myTimer_(sgpp::base::SGppStopwatch()),
+      duration(-1.0),
+      requestedInstructionSet(StreamingInstructionSet::AUTO),
+      instructionSet(StreamingInstructionSet::GENERIC),
+      multKernel(nullptr),
+      multTransposeKernel(nullptr) {
+  if (configuration.getParameters() &&
+      configuration.getParameters()->contains("INSTRUCTION_SET")) {
+    this->requestedInstructionSet =
+        parseInstructionSet((*configuration.getParameters())["INSTRUCTION_SET"].get());
+  }
+
   this->storage = &grid.getStorage();
   this->padDataset(this->preparedDataset);
   this->preparedDataset.transpose();
@@ -82,11 +115,22 @@ size_t OperationMultiEvalStreaming::getChunkGridPoints() {
   return 12;
 }
 size_t OperationMultiEvalStreaming::getChunkDataPoints() {
-#if defined(__MIC__) || defined(__AVX512F__)
-  return STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH;
-#else
-  return 24;  // must be divisible by 24
-#endif
+  if (this->instructionSet == StreamingInstructionSet::AVX512) {
+    return StreamingKernels::CHUNK_DATA_POINTS_AVX512;
+  } else {
+    return StreamingKernels::CHUNK_DATA_POINTS;
+  }
+}
+
+size_t OperationMultiEvalStreaming::getPaddingWidth() {
+  // the padding has to fit the chunk size of every kernel that might be selected
+  size_t width = StreamingKernels::CHUNK_DATA_POINTS_AVX512;
+
+  while (width % StreamingKernels::CHUNK_DATA_POINTS != 0) {
+    width += StreamingKernels::CHUNK_DATA_POINTS_AVX512;
+  }
+
+  return width;
 }
 
 void OperationMultiEvalStreaming::mult(sgpp::base::DataVector& alpha,
@@ -156,7 +200,7 @@ void OperationMultiEvalStreaming::recalculateLevelAndIndex() {
 }
 
 size_t OperationMultiEvalStreaming::padDataset(sgpp::base::DataMatrix& dataset) {
-  size_t vecWidth = this->getChunkDataPoints();
+  size_t vecWidth = getPaddingWidth();
 
   // Assure that data has a even number of instances -> padding might be needed
   size_t remainder = dataset.getNrows() % vecWidth;
@@ -178,6 +222,160 @@ size_t OperationMultiEvalStreaming::padDataset(sgpp::base::DataMatrix& dataset)
 
 double OperationMultiEvalStreaming::getDuration() { return this->duration; }
 
-void OperationMultiEvalStreaming::prepare() { this->recalculateLevelAndIndex(); }
+void OperationMultiEvalStreaming::prepare() {
+  this->recalculateLevelAndIndex();
+  this->selectKernels();
+}
+
+void OperationMultiEvalStreaming::multImpl(
+    sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
+    sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
+  this->multKernel(level->getPointer(), index->getPointer(), dataset->getPointer(),
+                   alpha.getPointer(), result.getPointer(), dataset->getNrows(), result.getSize(),
+                   start_index_grid, end_index_grid, start_index_data, end_index_data);
+}
+
+void OperationMultiEvalStreaming::multTransposeImpl(
+    sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
+    sgpp::base::DataVector& source, sgpp::base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
+  this->multTransposeKernel(level->getPointer(), index->getPointer(), dataset->getPointer(),
+                            source.getPointer(), result.getPointer(), dataset->getNrows(),
+                            source.getSize(), start_index_grid, end_index_grid,
+                            start_index_data, end_index_data);
+}
+
+void OperationMultiEvalStreaming::selectKernels() {
+  StreamingInstructionSet selected = this->requestedInstructionSet;
+
+  if (selected == StreamingInstructionSet::AUTO) {
+    selected = getBestInstructionSet();
+  } else if (!isInstructionSetSupported(selected)) {
+    throw sgpp::base::operation_exception(
+        "OperationMultiEvalStreaming: the requested instruction set is not supported by this "
+        "CPU or the library was built without it");
+  }
+
+  this->instructionSet = selected;
+  this->multKernel = StreamingKernels::multGeneric;
+  this->multTransposeKernel = StreamingKernels::multTransposeGeneric;
+
+  switch (selected) {
+#ifdef STREAMING_LINEAR_KERNEL_SSE3
+    case StreamingInstructionSet::SSE3:
+      this->multKernel = StreamingKernels::multSSE3;
+      this->multTransposeKernel = StreamingKernels::multTransposeSSE3;
+      break;
+#endif
+#ifdef STREAMING_LINEAR_KERNEL_AVX
+    case StreamingInstructionSet::AVX:
+      this->multKernel = StreamingKernels::multAVX;
+      this->multTransposeKernel = StreamingKernels::multTransposeAVX;
+      break;
+#endif
+#ifdef STREAMING_LINEAR_KERNEL_AVX2
+    case StreamingInstructionSet::AVX2:
+      this->multKernel = StreamingKernels::multAVX2;
+      this->multTransposeKernel = StreamingKernels::multTransposeAVX2;
+      break;
+#endif
+#ifdef STREAMING_LINEAR_KERNEL_AVX512
+    case StreamingInstructionSet::AVX512:
+      this->multKernel = StreamingKernels::multAVX512;
+      this->multTransposeKernel = StreamingKernels::multTransposeAVX512;
+      break;
+#endif
+    default:
+      this->instructionSet = StreamingInstructionSet::GENERIC;
+      break;
+  }
+}
+
+StreamingInstructionSet OperationMultiEvalStreaming::getInstructionSet() {
+  return this->instructionSet;
+}
+
+bool OperationMultiEvalStreaming::isInstructionSetSupported(
+    StreamingInstructionSet instructionSet) {
+#ifdef STREAMING_LINEAR_RUNTIME_DISPATCH
+  __builtin_cpu_init();
+#endif
+
+  switch (instructionSet) {
+    case StreamingInstructionSet::AUTO:
+    case StreamingInstructionSet::GENERIC:
+      return true;
+#ifdef STREAMING_LINEAR_KERNEL_SSE3
+    case StreamingInstructionSet::SSE3:
+#ifdef STREAMING_LINEAR_RUNTIME_DISPATCH
+      return __builtin_cpu_supports("sse3");
+#else
+      return true;
+#endif
+#endif
+#ifdef STREAMING_LINEAR_KERNEL_AVX
+    case StreamingInstructionSet::AVX:
+#ifdef STREAMING_LINEAR_RUNTIME_DISPATCH
+      return __builtin_cpu_supports("avx");
+#else
+      return true;
+#endif
+#endif
+#ifdef STREAMING_LINEAR_KERNEL_AVX2
+    case StreamingInstructionSet::AVX2:
+#ifdef STREAMING_LINEAR_RUNTIME_DISPATCH
+      return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#else
+      return true;
+#endif
+#endif
+#ifdef STREAMING_LINEAR_KERNEL_AVX512
+    case StreamingInstructionSet::AVX512:
+#ifdef STREAMING_LINEAR_RUNTIME_DISPATCH
+      return __builtin_cpu_supports("avx512f");
+#else
+      return true;
+#endif
+#endif
+    default:
+      return false;
+  }
+}
+
+StreamingInstructionSet OperationMultiEvalStreaming::getBestInstructionSet() {
+  for (StreamingInstructionSet instructionSet :
+       {StreamingInstructionSet::AVX512, StreamingInstructionSet::AVX2,
+        StreamingInstructionSet::AVX, StreamingInstructionSet::SSE3}) {
+    if (isInstructionSetSupported(instructionSet)) {
+      return instructionSet;
+    }
+  }
+
+  return StreamingInstructionSet::GENERIC;
+}
+
+StreamingInstructionSet OperationMultiEvalStreaming::parseInstructionSet(const std::string& name) {
+  std::string lowerName(name);
+  std::transform(lowerName.begin(), lowerName.end(), lowerName.begin(),
+                 [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+  if (lowerName == "auto") {
+    return StreamingInstructionSet::AUTO;
+  } else if (lowerName == "generic") {
+    return StreamingInstructionSet::GENERIC;
+  } else if (lowerName == "sse3") {
+    return StreamingInstructionSet::SSE3;
+  } else if (lowerName == "avx") {
+    return StreamingInstructionSet::AVX;
+  } else if (lowerName == "avx2") {
+    return StreamingInstructionSet::AVX2;
+  } else if (lowerName == "avx512") {
+    return StreamingInstructionSet::AVX512;
+  } else {
+    throw sgpp::base::operation_exception(
+        "OperationMultiEvalStreaming: unknown instruction set \"" + name + "\"");
+  }
+}
 }  // namespace datadriven
 }  // namespace sgpp
@@ -12,16 +12,23 @@
 #include <sgpp/base/exception/operation_exception.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 #include <sgpp/base/tools/SGppStopwatch.hpp>
+#include <sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreamingKernels.hpp>
 #include <sgpp/globaldef.hpp>
 
-#ifndef STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH
-// #define STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH 24
-#define STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH 96
-#endif
+#include <string>
 
 namespace sgpp {
 namespace datadriven {
 
+/**
+ * Streaming (matrix-free) multiple evaluation for linear grids.
+ *
+ * The kernels for all instruction sets the library was built with are available, the one that is
+ * used is selected at runtime by prepare(): by default the best one the CPU supports. It can be
+ * overridden with the parameter "INSTRUCTION_SET" of the operation configuration ("auto",
+ * "generic", "sse3", "avx", "avx2" or "avx512").
+ */
 class OperationMultiEvalStreaming : public base::OperationMultipleEval {
  protected:
   sgpp::base::DataMatrix preparedDataset;
@@ -36,9 +43,26 @@ class OperationMultiEvalStreaming : public base::OperationMultipleEval {
 
   double duration;
 
+  /// instruction set requested by the configuration
+  StreamingInstructionSet requestedInstructionSet;
+  /// instruction set of the kernels selected by prepare()
+  StreamingInstructionSet instructionSet;
+  /// selected mult kernel
+  StreamingKernels::KernelFunction multKernel;
+  /// selected multTranspose kernel
+  StreamingKernels::KernelFunction multTransposeKernel;
+
  public:
   OperationMultiEvalStreaming(base::Grid& grid, base::DataMatrix& dataset);
 
+  /**
+   * @param grid grid
+   * @param dataset dataset
+   * @param configuration configuration, the parameter "INSTRUCTION_SET" selects the kernels
+   */
+  OperationMultiEvalStreaming(base::Grid& grid, base::DataMatrix& dataset,
+                              OperationMultipleEvalConfiguration& configuration);
+
   ~OperationMultiEvalStreaming() override;
 
   size_t getChunkGridPoints();
@@ -53,6 +77,29 @@ class OperationMultiEvalStreaming : public base::OperationMultipleEval {
 
   double getDuration() override;
 
+  /**
+   * @return instruction set of the kernels in use
+   */
+  StreamingInstructionSet getInstructionSet();
+
+  /**
+   * @param instructionSet instruction set
+   * @return whether kernels for the instruction set are compiled into the library and the CPU
+   * supports the instruction set (always true for AUTO and GENERIC)
+   */
+  static bool isInstructionSetSupported(StreamingInstructionSet instructionSet);
+
+  /**
+   * @return most capable instruction set that is supported
+   */
+  static StreamingInstructionSet getBestInstructionSet();
+
+  /**
+   * @param name name of an instruction set as used in the configuration (case-insensitive)
+   * @return instruction set
+   */
+  static StreamingInstructionSet parseInstructionSet(const std::string& name);
+
  private:
   void getPartitionSegment(size_t start, size_t end, size_t segmentCount, size_t segmentNumber,
                            size_t* segmentStart, size_t* segmentEnd, size_t blockSize);
@@ -75,6 +122,10 @@ class OperationMultiEvalStreaming : public base::OperationMultipleEval {
                          const size_t end_index_data);
 
   void recalculateLevelAndIndex();
+
+  void selectKernels();
+
+  static size_t getPaddingWidth();
 };
 
 }  // namespace datadriven
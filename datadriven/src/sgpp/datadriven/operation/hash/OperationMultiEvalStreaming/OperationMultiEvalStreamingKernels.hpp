@@ -0,0 +1,157 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+// keep this header free of code that could be instantiated inside of the ISA-specific sections
+// of the kernel files
+#include <cstddef>
+
+#ifndef STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH
+// #define STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH 24
+#define STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH 96
+#endif
+
+/*
+ * With GCC-compatible compilers on x86, all kernel variants are compiled into the library
+ * (each one for its own instruction set) and the best one supported by the CPU is selected at
+ * runtime. Otherwise, only the variant matching the compiler flags is available (besides the
+ * generic one), as before.
+ */
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(__MIC__)
+#define STREAMING_LINEAR_RUNTIME_DISPATCH
+#endif
+
+#if defined(STREAMING_LINEAR_RUNTIME_DISPATCH) && !defined(__INTEL_COMPILER)
+#define STREAMING_LINEAR_PRAGMA(x) _Pragma(#x)
+#if defined(__clang__)
+#define STREAMING_LINEAR_TARGET_BEGIN(isa) \
+  STREAMING_LINEAR_PRAGMA(clang attribute push(__attribute__((target(isa))), apply_to = function))
+#define STREAMING_LINEAR_TARGET_END STREAMING_LINEAR_PRAGMA(clang attribute pop)
+#else
+#define STREAMING_LINEAR_TARGET_BEGIN(isa) \
+  STREAMING_LINEAR_PRAGMA(GCC push_options) STREAMING_LINEAR_PRAGMA(GCC target(isa))
+#define STREAMING_LINEAR_TARGET_END STREAMING_LINEAR_PRAGMA(GCC pop_options)
+#endif
+#else
+#define STREAMING_LINEAR_TARGET_BEGIN(isa)
+#define STREAMING_LINEAR_TARGET_END
+#endif
+
+#if defined(STREAMING_LINEAR_RUNTIME_DISPATCH) || defined(__SSE3__)
+#define STREAMING_LINEAR_KERNEL_SSE3
+#endif
+#if defined(STREAMING_LINEAR_RUNTIME_DISPATCH) || defined(__AVX__)
+#define STREAMING_LINEAR_KERNEL_AVX
+#endif
+#if defined(STREAMING_LINEAR_RUNTIME_DISPATCH) || (defined(__AVX2__) && defined(__FMA__))
+#define STREAMING_LINEAR_KERNEL_AVX2
+#endif
+#if defined(STREAMING_LINEAR_RUNTIME_DISPATCH) || defined(__AVX512F__) || defined(__MIC__)
+#define STREAMING_LINEAR_KERNEL_AVX512
+#endif
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Instruction sets for which OperationMultiEvalStreaming provides kernels.
+ * AVX512 denotes the IMCI kernel if compiled for the Xeon Phi (MIC).
+ */
+enum class StreamingInstructionSet { AUTO, GENERIC, SSE3, AVX, AVX2, AVX512 };
+
+namespace StreamingKernels {
+
+/// number of grid points processed per block
+const size_t CHUNK_GRID_POINTS = 12;
+/// number of data points processed per block (generic, SSE3 and AVX(2) kernels)
+const size_t CHUNK_DATA_POINTS = 24;
+/// number of data points processed per block (AVX-512 kernels)
+const size_t CHUNK_DATA_POINTS_AVX512 = STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH;
+
+/**
+ * Signature of the mult and multTranspose kernels of OperationMultiEvalStreaming.
+ * The dataset is stored transposed (one row per dimension, datasetSize padded data points per
+ * row). The kernels add their results to result.
+ *
+ * @param level levels of the grid points (row-wise)
+ * @param index indices of the grid points (row-wise)
+ * @param dataset transposed dataset
+ * @param source surpluses (mult) or values at the data points (multTranspose)
+ * @param result values at the data points (mult) or grid points (multTranspose)
+ * @param dims dimensionality
+ * @param datasetSize number of (padded) data points
+ * @param start_index_grid first grid point to process
+ * @param end_index_grid end of the range of grid points to process
+ * @param start_index_data first data point to process
+ * @param end_index_data end of the range of data points to process
+ */
+typedef void (*KernelFunction)(const double* level, const double* index, const double* dataset,
+                               const double* source, double* result, size_t dims,
+                               size_t datasetSize, size_t start_index_grid,
+                               size_t end_index_grid, size_t start_index_data,
+                               size_t end_index_data);
+
+void multGeneric(const double* level, const double* index, const double* dataset,
+                 const double* source, double* result, size_t dims, size_t datasetSize,
+                 size_t start_index_grid, size_t end_index_grid, size_t start_index_data,
+                 size_t end_index_data);
+
+void multTransposeGeneric(const double* level, const double* index, const double* dataset,
+                          const double* source, double* result, size_t dims, size_t datasetSize,
+                          size_t start_index_grid, size_t end_index_grid,
+                          size_t start_index_data, size_t end_index_data);
+
+#ifdef STREAMING_LINEAR_KERNEL_SSE3
+void multSSE3(const double* level, const double* index, const double* dataset,
+              const double* source, double* result, size_t dims, size_t datasetSize,
+              size_t start_index_grid, size_t end_index_grid, size_t start_index_data,
+              size_t end_index_data);
+
+void multTransposeSSE3(const double* level, const double* index, const double* dataset,
+                       const double* source, double* result, size_t dims, size_t datasetSize,
+                       size_t start_index_grid, size_t end_index_grid, size_t start_index_data,
+                       size_t end_index_data);
+#endif
+
+#ifdef STREAMING_LINEAR_KERNEL_AVX
+void multAVX(const double* level, const double* index, const double* dataset,
+             const double* source, double* result, size_t dims, size_t datasetSize,
+             size_t start_index_grid, size_t end_index_grid, size_t start_index_data,
+             size_t end_index_data);
+
+void multTransposeAVX(const double* level, const double* index, const double* dataset,
+                      const double* source, double* result, size_t dims, size_t datasetSize,
+                      size_t start_index_grid, size_t end_index_grid, size_t start_index_data,
+                      size_t end_index_data);
+#endif
+
+#ifdef STREAMING_LINEAR_KERNEL_AVX2
+void multAVX2(const double* level, const double* index, const double* dataset,
+              const double* source, double* result, size_t dims, size_t datasetSize,
+              size_t start_index_grid, size_t end_index_grid, size_t start_index_data,
+              size_t end_index_data);
+
+void multTransposeAVX2(const double* level, const double* index, const double* dataset,
+                       const double* source, double* result, size_t dims, size_t datasetSize,
+                       size_t start_index_grid, size_t end_index_grid, size_t start_index_data,
+                       size_t end_index_data);
+#endif
+
+#ifdef STREAMING_LINEAR_KERNEL_AVX512
+void multAVX512(const double* level, const double* index, const double* dataset,
+                const double* source, double* result, size_t dims, size_t datasetSize,
+                size_t start_index_grid, size_t end_index_grid, size_t start_index_data,
+                size_t end_index_data);
+
+void multTransposeAVX512(const double* level, const double* index, const double* dataset,
+                         const double* source, double* result, size_t dims,
+                         size_t datasetSize, size_t start_index_grid, size_t end_index_grid,
+                         size_t start_index_data, size_t end_index_data);
+#endif
+
+}  // namespace StreamingKernels
+}  // namespace datadriven
+}  // namespace sgpp
@@ -3,57 +3,79 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreamingKernels.hpp>
+
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 
-#if defined(__SSE3__) && !defined(__AVX__)
-#include <pmmintrin.h>
+#if defined(STREAMING_LINEAR_RUNTIME_DISPATCH) || defined(__SSE3__) || defined(__MIC__)
+#include <immintrin.h>  // NOLINT(build/include)
 #endif
 
-#if defined(__SSE3__) && defined(__AVX__)
-#include <immintrin.h>
-#endif
+namespace sgpp {
+namespace datadriven {
+namespace StreamingKernels {
 
-#if defined(__MIC__)
-#include <immintrin.h>  // NOLINT(build/include)
+// internal linkage, such that no instruction set specific instantiation can leak into other code
+static inline size_t minSize(size_t a, size_t b) { return (a < b) ? a : b; }
+
+void multGeneric(const double* ptrLevel, const double* ptrIndex, const double* ptrData,
+                 const double* ptrAlpha, double* ptrResult, size_t dims, size_t result_size,
+                 size_t start_index_grid, size_t end_index_grid, size_t start_index_data,
+                 size_t end_index_data) {
+  for (size_t c = start_index_data; c < end_index_data;
+       c += minSize(CHUNK_DATA_POINTS, (end_index_data - c))) {
+    size_t data_end = minSize(CHUNK_DATA_POINTS + c, end_index_data);
+
+#ifdef __ICC
+#pragma ivdep
 #endif
 
-#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
-#include <sgpp/globaldef.hpp>
+    for (size_t m = start_index_grid; m < end_index_grid;
+         m += minSize(CHUNK_GRID_POINTS, (end_index_grid - m))) {
+      size_t grid_end = minSize(CHUNK_GRID_POINTS + m, end_index_grid);
 
-namespace sgpp {
-namespace datadriven {
+      for (size_t i = c; i < data_end; i++) {
+        for (size_t j = m; j < grid_end; j++) {
+          double curSupport = ptrAlpha[j];
 
-#if defined(__SSE3__) && !defined(__AVX__) && !defined(__AVX512F__)
-void OperationMultiEvalStreaming::multImpl(
-    sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
-    sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, const size_t start_index_grid,
-    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
-  double* ptrLevel = level->getPointer();
-  double* ptrIndex = index->getPointer();
-  double* ptrAlpha = alpha.getPointer();
-  double* ptrData = dataset->getPointer();
-  double* ptrResult = result.getPointer();
-  size_t result_size = result.getSize();
-  size_t dims = dataset->getNrows();
+          for (size_t d = 0; d < dims; d++) {
+            double eval = ((ptrLevel[(j * dims) + d]) * (ptrData[(d * result_size) + i]));
+            double index_calc = eval - (ptrIndex[(j * dims) + d]);
+            double abs = std::fabs(index_calc);
+            double last = 1.0 - abs;
+            double localSupport = std::max<double>(last, 0.0);
+            curSupport *= localSupport;
+          }
+
+          ptrResult[i] += curSupport;
+        }
+      }
+    }
+  }
+}
 
+#ifdef STREAMING_LINEAR_KERNEL_SSE3
+STREAMING_LINEAR_TARGET_BEGIN("sse3")
+void multSSE3(const double* ptrLevel, const double* ptrIndex, const double* ptrData,
+              const double* ptrAlpha, double* ptrResult, size_t dims, size_t result_size,
+              size_t start_index_grid, size_t end_index_grid, size_t start_index_data,
+              size_t end_index_data) {
   for (size_t c = start_index_data; c < end_index_data;
-       c += std::min<size_t>(getChunkDataPoints(), (end_index_data - c))) {
+       c += minSize(CHUNK_DATA_POINTS, (end_index_data - c))) {
 #ifdef __ICC
 #pragma ivdep
-#pragma vector aligned
 #endif
 
     for (size_t m = start_index_grid; m < end_index_grid;
-         m += std::min<size_t>(static_cast<size_t>(getChunkGridPoints()),
-                               (end_index_grid - m))) {
-      size_t grid_inc = std::min<size_t>(
-          static_cast<size_t>(getChunkGridPoints()), (end_index_grid - m));
+         m += minSize(CHUNK_GRID_POINTS, (end_index_grid - m))) {
+      size_t grid_inc = minSize(CHUNK_GRID_POINTS, (end_index_grid - m));
 
       uint64_t imask = 0x7FFFFFFFFFFFFFFF;
       double* fmask = reinterpret_cast<double*>(&imask);
 
-      for (size_t i = c; i < c + getChunkDataPoints(); i += 12) {
+      for (size_t i = c; i < c + CHUNK_DATA_POINTS; i += 12) {
         for (size_t j = m; j < m + grid_inc; j++) {
           __m128d support_0 = _mm_loaddup_pd(&(ptrAlpha[j]));
           __m128d support_1 = _mm_loaddup_pd(&(ptrAlpha[j]));
@@ -67,12 +89,12 @@ void OperationMultiEvalStreaming::multImpl(
           __m128d zero = _mm_set1_pd(0.0);
 
           for (size_t d = 0; d < dims; d++) {
-            __m128d eval_0 = _mm_load_pd(&(ptrData[(d * result_size) + i]));
-            __m128d eval_1 = _mm_load_pd(&(ptrData[(d * result_size) + i + 2]));
-            __m128d eval_2 = _mm_load_pd(&(ptrData[(d * result_size) + i + 4]));
-            __m128d eval_3 = _mm_load_pd(&(ptrData[(d * result_size) + i + 6]));
-            __m128d eval_4 = _mm_load_pd(&(ptrData[(d * result_size) + i + 8]));
-            __m128d eval_5 = _mm_load_pd(&(ptrData[(d * result_size) + i + 10]));
+            __m128d eval_0 = _mm_loadu_pd(&(ptrData[(d * result_size) + i]));
+            __m128d eval_1 = _mm_loadu_pd(&(ptrData[(d * result_size) + i + 2]));
+            __m128d eval_2 = _mm_loadu_pd(&(ptrData[(d * result_size) + i + 4]));
+            __m128d eval_3 = _mm_loadu_pd(&(ptrData[(d * result_size) + i + 6]));
+            __m128d eval_4 = _mm_loadu_pd(&(ptrData[(d * result_size) + i + 8]));
+            __m128d eval_5 = _mm_loadu_pd(&(ptrData[(d * result_size) + i + 10]));
 
             __m128d level = _mm_loaddup_pd(&(ptrLevel[(j * dims) + d]));
             __m128d index = _mm_loaddup_pd(&(ptrIndex[(j * dims) + d]));
@@ -120,12 +142,12 @@ void OperationMultiEvalStreaming::multImpl(
             support_5 = _mm_mul_pd(support_5, eval_5);
           }
 
-          __m128d res_0 = _mm_load_pd(&(ptrResult[i]));
-          __m128d res_1 = _mm_load_pd(&(ptrResult[i + 2]));
-          __m128d res_2 = _mm_load_pd(&(ptrResult[i + 4]));
-          __m128d res_3 = _mm_load_pd(&(ptrResult[i + 6]));
-          __m128d res_4 = _mm_load_pd(&(ptrResult[i + 8]));
-          __m128d res_5 = _mm_load_pd(&(ptrResult[i + 10]));
+          __m128d res_0 = _mm_loadu_pd(&(ptrResult[i]));
+          __m128d res_1 = _mm_loadu_pd(&(ptrResult[i + 2]));
+          __m128d res_2 = _mm_loadu_pd(&(ptrResult[i + 4]));
+          __m128d res_3 = _mm_loadu_pd(&(ptrResult[i + 6]));
+          __m128d res_4 = _mm_loadu_pd(&(ptrResult[i + 8]));
+          __m128d res_5 = _mm_loadu_pd(&(ptrResult[i + 10]));
 
           res_0 = _mm_add_pd(res_0, support_0);
           res_1 = _mm_add_pd(res_1, support_1);
@@ -134,47 +156,40 @@ void OperationMultiEvalStreaming::multImpl(
           res_4 = _mm_add_pd(res_4, support_4);
           res_5 = _mm_add_pd(res_5, support_5);
 
-          _mm_store_pd(&(ptrResult[i]), res_0);
-          _mm_store_pd(&(ptrResult[i + 2]), res_1);
-          _mm_store_pd(&(ptrResult[i + 4]), res_2);
-          _mm_store_pd(&(ptrResult[i + 6]), res_3);
-          _mm_store_pd(&(ptrResult[i + 8]), res_4);
-          _mm_store_pd(&(ptrResult[i + 10]), res_5);
+          _mm_storeu_pd(&(ptrResult[i]), res_0);
+          _mm_storeu_pd(&(ptrResult[i + 2]), res_1);
+          _mm_storeu_pd(&(ptrResult[i + 4]), res_2);
+          _mm_storeu_pd(&(ptrResult[i + 6]), res_3);
+          _mm_storeu_pd(&(ptrResult[i + 8]), res_4);
+          _mm_storeu_pd(&(ptrResult[i + 10]), res_5);
         }
       }
     }
   }
 }
+STREAMING_LINEAR_TARGET_END
 #endif
 
-#if defined(__SSE3__) && defined(__AVX__) && !defined(__AVX512F__)
-void OperationMultiEvalStreaming::multImpl(
-    sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
-    sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, const size_t start_index_grid,
-    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
-  double* ptrLevel = level->getPointer();
-  double* ptrIndex = index->getPointer();
-  double* ptrAlpha = alpha.getPointer();
-  double* ptrData = dataset->getPointer();
-  double* ptrResult = result.getPointer();
-  size_t result_size = result.getSize();
-  size_t dims = dataset->getNrows();
-
+#ifdef STREAMING_LINEAR_KERNEL_AVX
+STREAMING_LINEAR_TARGET_BEGIN("avx")
+void multAVX(const double* ptrLevel, const double* ptrIndex, const double* ptrData,
+             const double* ptrAlpha, double* ptrResult, size_t dims, size_t result_size,
+             size_t start_index_grid, size_t end_index_grid, size_t start_index_data,
+             size_t end_index_data) {
   for (size_t c = start_index_data; c < end_index_data;
-       c += std::min<size_t>(getChunkDataPoints(), (end_index_data - c))) {
+       c += minSize(CHUNK_DATA_POINTS, (end_index_data - c))) {
 #ifdef __ICC
 #pragma ivdep
-#pragma vector aligned
 #endif
 
     for (size_t m = start_index_grid; m < end_index_grid;
-         m += std::min<size_t>((size_t)getChunkGridPoints(), (end_index_grid - m))) {
-      size_t grid_inc = std::min<size_t>((size_t)getChunkGridPoints(), (end_index_grid - m));
+         m += minSize(CHUNK_GRID_POINTS, (end_index_grid - m))) {
+      size_t grid_inc = minSize(CHUNK_GRID_POINTS, (end_index_grid - m));
 
       int64_t imask = 0x7FFFFFFFFFFFFFFF;
       double* fmask = reinterpret_cast<double*>(&imask);
 
-      for (size_t i = c; i < c + getChunkDataPoints(); i += 24) {
+      for (size_t i = c; i < c + CHUNK_DATA_POINTS; i += 24) {
         for (size_t j = m; j < m + grid_inc; j++) {
           __m256d support_0 = _mm256_broadcast_sd(&(ptrAlpha[j]));
           __m256d support_1 = _mm256_broadcast_sd(&(ptrAlpha[j]));
@@ -188,12 +203,12 @@ void OperationMultiEvalStreaming::multImpl(
           __m256d zero = _mm256_set1_pd(0.0);
 
           for (size_t d = 0; d < dims; d++) {
-            __m256d eval_0 = _mm256_load_pd(&(ptrData[(d * result_size) + i]));
-            __m256d eval_1 = _mm256_load_pd(&(ptrData[(d * result_size) + i + 4]));
-            __m256d eval_2 = _mm256_load_pd(&(ptrData[(d * result_size) + i + 8]));
-            __m256d eval_3 = _mm256_load_pd(&(ptrData[(d * result_size) + i + 12]));
-            __m256d eval_4 = _mm256_load_pd(&(ptrData[(d * result_size) + i + 16]));
-            __m256d eval_5 = _mm256_load_pd(&(ptrData[(d * result_size) + i + 20]));
+            __m256d eval_0 = _mm256_loadu_pd(&(ptrData[(d * result_size) + i]));
+            __m256d eval_1 = _mm256_loadu_pd(&(ptrData[(d * result_size) + i + 4]));
+            __m256d eval_2 = _mm256_loadu_pd(&(ptrData[(d * result_size) + i + 8]));
+            __m256d eval_3 = _mm256_loadu_pd(&(ptrData[(d * result_size) + i + 12]));
+            __m256d eval_4 = _mm256_loadu_pd(&(ptrData[(d * result_size) + i + 16]));
+            __m256d eval_5 = _mm256_loadu_pd(&(ptrData[(d * result_size) + i + 20]));
 
             __m256d level = _mm256_broadcast_sd(&(ptrLevel[(j * dims) + d]));
             __m256d index = _mm256_broadcast_sd(&(ptrIndex[(j * dims) + d]));
@@ -250,12 +265,12 @@ void OperationMultiEvalStreaming::multImpl(
             support_5 = _mm256_mul_pd(support_5, eval_5);
           }
 
-          __m256d res_0 = _mm256_load_pd(&(ptrResult[i]));
-          __m256d res_1 = _mm256_load_pd(&(ptrResult[i + 4]));
-          __m256d res_2 = _mm256_load_pd(&(ptrResult[i + 8]));
-          __m256d res_3 = _mm256_load_pd(&(ptrResult[i + 12]));
-          __m256d res_4 = _mm256_load_pd(&(ptrResult[i + 16]));
-          __m256d res_5 = _mm256_load_pd(&(ptrResult[i + 20]));
+          __m256d res_0 = _mm256_loadu_pd(&(ptrResult[i]));
+          __m256d res_1 = _mm256_loadu_pd(&(ptrResult[i + 4]));
+          __m256d res_2 = _mm256_loadu_pd(&(ptrResult[i + 8]));
+          __m256d res_3 = _mm256_loadu_pd(&(ptrResult[i + 12]));
+          __m256d res_4 = _mm256_loadu_pd(&(ptrResult[i + 16]));
+          __m256d res_5 = _mm256_loadu_pd(&(ptrResult[i + 20]));
 
           res_0 = _mm256_add_pd(res_0, support_0);
           res_1 = _mm256_add_pd(res_1, support_1);
@@ -264,44 +279,145 @@ void OperationMultiEvalStreaming::multImpl(
           res_4 = _mm256_add_pd(res_4, support_4);
           res_5 = _mm256_add_pd(res_5, support_5);
 
-          _mm256_store_pd(&(ptrResult[i]), res_0);
-          _mm256_store_pd(&(ptrResult[i + 4]), res_1);
-          _mm256_store_pd(&(ptrResult[i + 8]), res_2);
-          _mm256_store_pd(&(ptrResult[i + 12]), res_3);
-          _mm256_store_pd(&(ptrResult[i + 16]), res_4);
-          _mm256_store_pd(&(ptrResult[i + 20]), res_5);
+          _mm256_storeu_pd(&(ptrResult[i]), res_0);
+          _mm256_storeu_pd(&(ptrResult[i + 4]), res_1);
+          _mm256_storeu_pd(&(ptrResult[i + 8]), res_2);
+          _mm256_storeu_pd(&(ptrResult[i + 12]), res_3);
+          _mm256_storeu_pd(&(ptrResult[i + 16]), res_4);
+          _mm256_storeu_pd(&(ptrResult[i + 20]), res_5);
         }
       }
     }
   }
 }
+STREAMING_LINEAR_TARGET_END
 #endif
 
-#if defined(__MIC__) || defined(__AVX512F__)
-void OperationMultiEvalStreaming::multImpl(
-    sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
-    sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, const size_t start_index_grid,
-    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
-  double* ptrLevel = level->getPointer();
-  double* ptrIndex = index->getPointer();
-  double* ptrAlpha = alpha.getPointer();
-  double* ptrData = dataset->getPointer();
-  double* ptrResult = result.getPointer();
-  size_t result_size = result.getSize();
-  size_t dims = dataset->getNrows();
+#ifdef STREAMING_LINEAR_KERNEL_AVX2
+STREAMING_LINEAR_TARGET_BEGIN("avx2,fma")
+void multAVX2(const double* ptrLevel, const double* ptrIndex, const double* ptrData,
+              const double* ptrAlpha, double* ptrResult, size_t dims, size_t result_size,
+              size_t start_index_grid, size_t end_index_grid, size_t start_index_data,
+              size_t end_index_data) {
+  for (size_t c = start_index_data; c < end_index_data;
+       c += minSize(CHUNK_DATA_POINTS, (end_index_data - c))) {
+#ifdef __ICC
+#pragma ivdep
+#endif
+
+    for (size_t m = start_index_grid; m < end_index_grid;
+         m += minSize(CHUNK_GRID_POINTS, (end_index_grid - m))) {
+      size_t grid_inc = minSize(CHUNK_GRID_POINTS, (end_index_grid - m));
+
+      int64_t imask = 0x7FFFFFFFFFFFFFFF;
+      double* fmask = reinterpret_cast<double*>(&imask);
+
+      for (size_t i = c; i < c + CHUNK_DATA_POINTS; i += 24) {
+        for (size_t j = m; j < m + grid_inc; j++) {
+          __m256d support_0 = _mm256_broadcast_sd(&(ptrAlpha[j]));
+          __m256d support_1 = _mm256_broadcast_sd(&(ptrAlpha[j]));
+          __m256d support_2 = _mm256_broadcast_sd(&(ptrAlpha[j]));
+          __m256d support_3 = _mm256_broadcast_sd(&(ptrAlpha[j]));
+          __m256d support_4 = _mm256_broadcast_sd(&(ptrAlpha[j]));
+          __m256d support_5 = _mm256_broadcast_sd(&(ptrAlpha[j]));
+
+          __m256d mask = _mm256_broadcast_sd(fmask);
+          __m256d one = _mm256_set1_pd(1.0);
+          __m256d zero = _mm256_set1_pd(0.0);
+
+          for (size_t d = 0; d < dims; d++) {
+            __m256d eval_0 = _mm256_loadu_pd(&(ptrData[(d * result_size) + i]));
+            __m256d eval_1 = _mm256_loadu_pd(&(ptrData[(d * result_size) + i + 4]));
+            __m256d eval_2 = _mm256_loadu_pd(&(ptrData[(d * result_size) + i + 8]));
+            __m256d eval_3 = _mm256_loadu_pd(&(ptrData[(d * result_size) + i + 12]));
+            __m256d eval_4 = _mm256_loadu_pd(&(ptrData[(d * result_size) + i + 16]));
+            __m256d eval_5 = _mm256_loadu_pd(&(ptrData[(d * result_size) + i + 20]));
+
+            __m256d level = _mm256_broadcast_sd(&(ptrLevel[(j * dims) + d]));
+            __m256d index = _mm256_broadcast_sd(&(ptrIndex[(j * dims) + d]));
+            eval_0 = _mm256_fmsub_pd(eval_0, level, index);
+            eval_1 = _mm256_fmsub_pd(eval_1, level, index);
+            eval_2 = _mm256_fmsub_pd(eval_2, level, index);
+            eval_3 = _mm256_fmsub_pd(eval_3, level, index);
+            eval_4 = _mm256_fmsub_pd(eval_4, level, index);
+            eval_5 = _mm256_fmsub_pd(eval_5, level, index);
+            eval_0 = _mm256_and_pd(mask, eval_0);
+            eval_1 = _mm256_and_pd(mask, eval_1);
+            eval_2 = _mm256_and_pd(mask, eval_2);
+            eval_3 = _mm256_and_pd(mask, eval_3);
+            eval_4 = _mm256_and_pd(mask, eval_4);
+            eval_5 = _mm256_and_pd(mask, eval_5);
+
+            eval_0 = _mm256_sub_pd(one, eval_0);
+            eval_1 = _mm256_sub_pd(one, eval_1);
+            eval_2 = _mm256_sub_pd(one, eval_2);
+            eval_3 = _mm256_sub_pd(one, eval_3);
+            eval_4 = _mm256_sub_pd(one, eval_4);
+            eval_5 = _mm256_sub_pd(one, eval_5);
+
+            eval_0 = _mm256_max_pd(zero, eval_0);
+            eval_1 = _mm256_max_pd(zero, eval_1);
+            eval_2 = _mm256_max_pd(zero, eval_2);
+            eval_3 = _mm256_max_pd(zero, eval_3);
+            eval_4 = _mm256_max_pd(zero, eval_4);
+            eval_5 = _mm256_max_pd(zero, eval_5);
+
+            support_0 = _mm256_mul_pd(support_0, eval_0);
+            support_1 = _mm256_mul_pd(support_1, eval_1);
+            support_2 = _mm256_mul_pd(support_2, eval_2);
+            support_3 = _mm256_mul_pd(support_3, eval_3);
+            support_4 = _mm256_mul_pd(support_4, eval_4);
+            support_5 = _mm256_mul_pd(support_5, eval_5);
+          }
+
+          __m256d res_0 = _mm256_loadu_pd(&(ptrResult[i]));
+          __m256d res_1 = _mm256_loadu_pd(&(ptrResult[i + 4]));
+          __m256d res_2 = _mm256_loadu_pd(&(ptrResult[i + 8]));
+          __m256d res_3 = _mm256_loadu_pd(&(ptrResult[i + 12]));
+          __m256d res_4 = _mm256_loadu_pd(&(ptrResult[i + 16]));
+          __m256d res_5 = _mm256_loadu_pd(&(ptrResult[i + 20]));
+
+          res_0 = _mm256_add_pd(res_0, support_0);
+          res_1 = _mm256_add_pd(res_1, support_1);
+          res_2 = _mm256_add_pd(res_2, support_2);
+          res_3 = _mm256_add_pd(res_3, support_3);
+          res_4 = _mm256_add_pd(res_4, support_4);
+          res_5 = _mm256_add_pd(res_5, support_5);
 
+          _mm256_storeu_pd(&(ptrResult[i]), res_0);
+          _mm256_storeu_pd(&(ptrResult[i + 4]), res_1);
+          _mm256_storeu_pd(&(ptrResult[i + 8]), res_2);
+          _mm256_storeu_pd(&(ptrResult[i + 12]), res_3);
+          _mm256_storeu_pd(&(ptrResult[i + 16]), res_4);
+          _mm256_storeu_pd(&(ptrResult[i + 20]), res_5);
+        }
+      }
+    }
+  }
+}
+STREAMING_LINEAR_TARGET_END
+#endif
+
+#ifdef STREAMING_LINEAR_KERNEL_AVX512
+STREAMING_LINEAR_TARGET_BEGIN("avx512f")
+void multAVX512(const double* ptrLevel, const double* ptrIndex, const double* ptrData,
+                const double* ptrAlpha, double* ptrResult, size_t dims, size_t result_size,
+                size_t start_index_grid, size_t end_index_grid, size_t start_index_data,
+                size_t end_index_data) {
 #if defined(__MIC__)
 #define _mm512_broadcast_sd(A) \
   _mm512_extload_pd(A, _MM_UPCONV_PD_NONE, _MM_BROADCAST_1X8, _MM_HINT_NONE)
 #define _mm512_max_pd(A, B) _mm512_gmax_pd(A, B)
 #define _mm512_set1_epi64(A) _mm512_set_1to8_epi64(A)
 #define _mm512_set1_pd(A) _mm512_set_1to8_pd(A)
-#endif
-#if defined(__AVX512F__)
+// KNC has no unaligned variants, MIC builds keep the aligned accesses
+#define _mm512_loadu_pd(A) _mm512_load_pd(A)
+#define _mm512_storeu_pd(A, B) _mm512_store_pd(A, B)
+#else
 #define _mm512_broadcast_sd(A) _mm512_broadcastsd_pd(_mm_load_sd(A))
 #endif
 
-  for (size_t i = start_index_data; i < end_index_data; i += getChunkDataPoints()) {
+  for (size_t i = start_index_data; i < end_index_data; i += CHUNK_DATA_POINTS_AVX512) {
     for (size_t j = start_index_grid; j < end_index_grid; j++) {
       _mm_prefetch((const char*)&(ptrAlpha[j + 1]), _MM_HINT_T0);
       _mm_prefetch((const char*)&(ptrLevel[((j + 1) * dims)]), _MM_HINT_T0);
@@ -333,29 +449,29 @@ void OperationMultiEvalStreaming::multImpl(
 #endif
 
       for (size_t d = 0; d < dims; d++) {
-        __m512d eval_0 = _mm512_load_pd(&(ptrData[(d * result_size) + i + 0]));
-        __m512d eval_1 = _mm512_load_pd(&(ptrData[(d * result_size) + i + 8]));
-        __m512d eval_2 = _mm512_load_pd(&(ptrData[(d * result_size) + i + 16]));
+        __m512d eval_0 = _mm512_loadu_pd(&(ptrData[(d * result_size) + i + 0]));
+        __m512d eval_1 = _mm512_loadu_pd(&(ptrData[(d * result_size) + i + 8]));
+        __m512d eval_2 = _mm512_loadu_pd(&(ptrData[(d * result_size) + i + 16]));
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 24)
-        __m512d eval_3 = _mm512_load_pd(&(ptrData[(d * result_size) + i + 24]));
+        __m512d eval_3 = _mm512_loadu_pd(&(ptrData[(d * result_size) + i + 24]));
 #endif
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 32)
-        __m512d eval_4 = _mm512_load_pd(&(ptrData[(d * result_size) + i + 32]));
-        __m512d eval_5 = _mm512_load_pd(&(ptrData[(d * result_size) + i + 40]));
+        __m512d eval_4 = _mm512_loadu_pd(&(ptrData[(d * result_size) + i + 32]));
+        __m512d eval_5 = _mm512_loadu_pd(&(ptrData[(d * result_size) + i + 40]));
 #endif
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 48)
-        __m512d eval_6 = _mm512_load_pd(&(ptrData[(d * result_size) + i + 48]));
-        __m512d eval_7 = _mm512_load_pd(&(ptrData[(d * result_size) + i + 56]));
+        __m512d eval_6 = _mm512_loadu_pd(&(ptrData[(d * result_size) + i + 48]));
+        __m512d eval_7 = _mm512_loadu_pd(&(ptrData[(d * result_size) + i + 56]));
 #endif
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 64)
-        __m512d eval_8 = _mm512_load_pd(&(ptrData[(d * result_size) + i + 64]));
+        __m512d eval_8 = _mm512_loadu_pd(&(ptrData[(d * result_size) + i + 64]));
 #endif
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 72)
-        __m512d eval_9 = _mm512_load_pd(&(ptrData[(d * result_size) + i + 72]));
+        __m512d eval_9 = _mm512_loadu_pd(&(ptrData[(d * result_size) + i + 72]));
 #endif
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 80)
-        __m512d eval_10 = _mm512_load_pd(&(ptrData[(d * result_size) + i + 80]));
-        __m512d eval_11 = _mm512_load_pd(&(ptrData[(d * result_size) + i + 88]));
+        __m512d eval_10 = _mm512_loadu_pd(&(ptrData[(d * result_size) + i + 80]));
+        __m512d eval_11 = _mm512_loadu_pd(&(ptrData[(d * result_size) + i + 88]));
 #endif
         __m512d level = _mm512_broadcast_sd(&(ptrLevel[(j * dims) + d]));
         __m512d index = _mm512_broadcast_sd(&(ptrIndex[(j * dims) + d]));
@@ -489,15 +605,15 @@ void OperationMultiEvalStreaming::multImpl(
 #endif
       }
 
-      __m512d res_0 = _mm512_load_pd(&(ptrResult[i + 0]));
-      __m512d res_1 = _mm512_load_pd(&(ptrResult[i + 8]));
-      __m512d res_2 = _mm512_load_pd(&(ptrResult[i + 16]));
+      __m512d res_0 = _mm512_loadu_pd(&(ptrResult[i + 0]));
+      __m512d res_1 = _mm512_loadu_pd(&(ptrResult[i + 8]));
+      __m512d res_2 = _mm512_loadu_pd(&(ptrResult[i + 16]));
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 24)
-      __m512d res_3 = _mm512_load_pd(&(ptrResult[i + 24]));
+      __m512d res_3 = _mm512_loadu_pd(&(ptrResult[i + 24]));
 #endif
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 32)
-      __m512d res_4 = _mm512_load_pd(&(ptrResult[i + 32]));
-      __m512d res_5 = _mm512_load_pd(&(ptrResult[i + 40]));
+      __m512d res_4 = _mm512_loadu_pd(&(ptrResult[i + 32]));
+      __m512d res_5 = _mm512_loadu_pd(&(ptrResult[i + 40]));
 #endif
 
       res_0 = _mm512_add_pd(res_0, support_0);
@@ -511,30 +627,30 @@ void OperationMultiEvalStreaming::multImpl(
       res_5 = _mm512_add_pd(res_5, support_5);
 #endif
 
-      _mm512_store_pd(&(ptrResult[i + 0]), res_0);
-      _mm512_store_pd(&(ptrResult[i + 8]), res_1);
-      _mm512_store_pd(&(ptrResult[i + 16]), res_2);
+      _mm512_storeu_pd(&(ptrResult[i + 0]), res_0);
+      _mm512_storeu_pd(&(ptrResult[i + 8]), res_1);
+      _mm512_storeu_pd(&(ptrResult[i + 16]), res_2);
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 24)
-      _mm512_store_pd(&(ptrResult[i + 24]), res_3);
+      _mm512_storeu_pd(&(ptrResult[i + 24]), res_3);
 #endif
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 32)
-      _mm512_store_pd(&(ptrResult[i + 32]), res_4);
-      _mm512_store_pd(&(ptrResult[i + 40]), res_5);
+      _mm512_storeu_pd(&(ptrResult[i + 32]), res_4);
+      _mm512_storeu_pd(&(ptrResult[i + 40]), res_5);
 #endif
 
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 48)
-      __m512d res_6 = _mm512_load_pd(&(ptrResult[i + 48]));
-      __m512d res_7 = _mm512_load_pd(&(ptrResult[i + 56]));
+      __m512d res_6 = _mm512_loadu_pd(&(ptrResult[i + 48]));
+      __m512d res_7 = _mm512_loadu_pd(&(ptrResult[i + 56]));
 #endif
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 64)
-      __m512d res_8 = _mm512_load_pd(&(ptrResult[i + 64]));
+      __m512d res_8 = _mm512_loadu_pd(&(ptrResult[i + 64]));
 #endif
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 72)
-      __m512d res_9 = _mm512_load_pd(&(ptrResult[i + 72]));
+      __m512d res_9 = _mm512_loadu_pd(&(ptrResult[i + 72]));
 #endif
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 80)
-      __m512d res_10 = _mm512_load_pd(&(ptrResult[i + 80]));
-      __m512d res_11 = _mm512_load_pd(&(ptrResult[i + 88]));
+      __m512d res_10 = _mm512_loadu_pd(&(ptrResult[i + 80]));
+      __m512d res_11 = _mm512_loadu_pd(&(ptrResult[i + 88]));
 #endif
 
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 48)
@@ -553,74 +669,27 @@ void OperationMultiEvalStreaming::multImpl(
 #endif
 
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 48)
-      _mm512_store_pd(&(ptrResult[i + 48]), res_6);
-      _mm512_store_pd(&(ptrResult[i + 56]), res_7);
+      _mm512_storeu_pd(&(ptrResult[i + 48]), res_6);
+      _mm512_storeu_pd(&(ptrResult[i + 56]), res_7);
 #endif
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 64)
-      _mm512_store_pd(&(ptrResult[i + 64]), res_8);
+      _mm512_storeu_pd(&(ptrResult[i + 64]), res_8);
 #endif
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 72)
-      _mm512_store_pd(&(ptrResult[i + 72]), res_9);
+      _mm512_storeu_pd(&(ptrResult[i + 72]), res_9);
 #endif
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 80)
-      _mm512_store_pd(&(ptrResult[i + 80]), res_10);
-      _mm512_store_pd(&(ptrResult[i + 88]), res_11);
+      _mm512_storeu_pd(&(ptrResult[i + 80]), res_10);
+      _mm512_storeu_pd(&(ptrResult[i + 88]), res_11);
 #endif
     }
   }
   //}
   //}
 }
+STREAMING_LINEAR_TARGET_END
 #endif
 
-#if !defined(__SSE3__) && !defined(__AVX__) && !defined(__MIC__) && !defined(__AVX512F__)
-void OperationMultiEvalStreaming::multImpl(
-    sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
-    sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, const size_t start_index_grid,
-    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
-  double* ptrLevel = level->getPointer();
-  double* ptrIndex = index->getPointer();
-  double* ptrAlpha = alpha.getPointer();
-  double* ptrData = dataset->getPointer();
-  double* ptrResult = result.getPointer();
-  size_t result_size = result.getSize();
-  size_t dims = dataset->getNrows();
-
-#warning "warning: using fallback implementation for OperationMultiEvalStreaming mult kernel"
-
-  for (size_t c = start_index_data; c < end_index_data;
-       c += std::min<size_t>(getChunkDataPoints(), (end_index_data - c))) {
-    size_t data_end = std::min<size_t>((size_t)getChunkDataPoints() + c, end_index_data);
-
-#ifdef __ICC
-#pragma ivdep
-#pragma vector aligned
-#endif
-
-    for (size_t m = start_index_grid; m < end_index_grid;
-         m += std::min<size_t>((size_t)getChunkGridPoints(), (end_index_grid - m))) {
-      size_t grid_end = std::min<size_t>((size_t)getChunkGridPoints() + m, end_index_grid);
-
-      for (size_t i = c; i < data_end; i++) {
-        for (size_t j = m; j < grid_end; j++) {
-          double curSupport = ptrAlpha[j];
-
-          for (size_t d = 0; d < dims; d++) {
-            double eval = ((ptrLevel[(j * dims) + d]) * (ptrData[(d * result_size) + i]));
-            double index_calc = eval - (ptrIndex[(j * dims) + d]);
-            double abs = std::fabs(index_calc);
-            double last = 1.0 - abs;
-            double localSupport = std::max<double>(last, 0.0);
-            curSupport *= localSupport;
-          }
-
-          ptrResult[i] += curSupport;
-        }
-      }
-    }
-  }
-}
-#endif
-
+}  // namespace StreamingKernels
 }  // namespace datadriven
 }  // namespace sgpp
@@ -3,68 +3,83 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
-#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
-#include <sgpp/globaldef.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreamingKernels.hpp>
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
 
-#if defined(__SSE3__) && !defined(__AVX__)
-#include <pmmintrin.h>
-#endif
-
-#if defined(__SSE3__) && defined(__AVX__)
-#include <immintrin.h>
-#endif
-
-#if defined(__MIC__)
+#if defined(STREAMING_LINEAR_RUNTIME_DISPATCH) || defined(__SSE3__) || defined(__MIC__)
 #include <immintrin.h>  // NOLINT(build/include)
 #endif
 
 namespace sgpp {
 namespace datadriven {
+namespace StreamingKernels {
 
-void OperationMultiEvalStreaming::multTransposeImpl(
-    sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
-    sgpp::base::DataVector& source, sgpp::base::DataVector& result, const size_t start_index_grid,
-    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
-  double* ptrLevel = level->getPointer();
-  double* ptrIndex = index->getPointer();
-  double* ptrSource = source.getPointer();
-  double* ptrData = dataset->getPointer();
-  double* ptrResult = result.getPointer();
-  size_t sourceSize = source.getSize();
-  size_t dims = dataset->getNrows();
+// internal linkage, such that no instruction set specific instantiation can leak into other code
+static inline size_t minSize(size_t a, size_t b) { return (a < b) ? a : b; }
 
-#if defined(__SSE3__) && !defined(__AVX__) && !defined(__AVX512F__)
+void multTransposeGeneric(const double* ptrLevel, const double* ptrIndex, const double* ptrData,
+                          const double* ptrSource, double* ptrResult, size_t dims,
+                          size_t sourceSize, size_t start_index_grid, size_t end_index_grid,
+                          size_t start_index_data, size_t end_index_data) {
+  for (size_t k = start_index_grid; k < end_index_grid;
+       k += minSize(CHUNK_GRID_POINTS, (end_index_grid - k))) {
+    size_t grid_inc = minSize(CHUNK_GRID_POINTS, (end_index_grid - k));
 
+    for (size_t i = start_index_data; i < end_index_data; i++) {
+      for (size_t j = k; j < k + grid_inc; j++) {
+        double curSupport = ptrSource[i];
+
+        for (size_t d = 0; d < dims; d++) {
+          double eval = ((ptrLevel[(j * dims) + d]) * (ptrData[(d * sourceSize) + i]));
+          double index_calc = eval - (ptrIndex[(j * dims) + d]);
+          double abs = std::fabs(index_calc);
+          double last = 1.0 - abs;
+          double localSupport = std::max<double>(last, 0.0);
+          curSupport *= localSupport;
+        }
+
+        ptrResult[j] += curSupport;
+      }
+    }
+  }
+}
+
+#ifdef STREAMING_LINEAR_KERNEL_SSE3
+STREAMING_LINEAR_TARGET_BEGIN("sse3")
+void multTransposeSSE3(const double* ptrLevel, const double* ptrIndex, const double* ptrData,
+                       const double* ptrSource, double* ptrResult, size_t dims, size_t sourceSize,
+                       size_t start_index_grid, size_t end_index_grid, size_t start_index_data,
+                       size_t end_index_data) {
   for (size_t k = start_index_grid; k < end_index_grid;
-       k += std::min<size_t>(getChunkGridPoints(), (end_index_grid - k))) {
-    size_t grid_inc = std::min<size_t>(
-        static_cast<size_t>(getChunkGridPoints()), (end_index_grid - k));
+       k += minSize(CHUNK_GRID_POINTS, (end_index_grid - k))) {
+    size_t grid_inc = minSize(CHUNK_GRID_POINTS, (end_index_grid - k));
 
     uint64_t imask = 0x7FFFFFFFFFFFFFFF;
     double* fmask = reinterpret_cast<double*>(&imask);
 
     for (size_t i = start_index_data; i < end_index_data; i += 12) {
       for (size_t j = k; j < k + grid_inc; j++) {
-        __m128d support_0 = _mm_load_pd(&(ptrSource[i]));
-        __m128d support_1 = _mm_load_pd(&(ptrSource[i + 2]));
-        __m128d support_2 = _mm_load_pd(&(ptrSource[i + 4]));
-        __m128d support_3 = _mm_load_pd(&(ptrSource[i + 6]));
-        __m128d support_4 = _mm_load_pd(&(ptrSource[i + 8]));
-        __m128d support_5 = _mm_load_pd(&(ptrSource[i + 10]));
+        __m128d support_0 = _mm_loadu_pd(&(ptrSource[i]));
+        __m128d support_1 = _mm_loadu_pd(&(ptrSource[i + 2]));
+        __m128d support_2 = _mm_loadu_pd(&(ptrSource[i + 4]));
+        __m128d support_3 = _mm_loadu_pd(&(ptrSource[i + 6]));
+        __m128d support_4 = _mm_loadu_pd(&(ptrSource[i + 8]));
+        __m128d support_5 = _mm_loadu_pd(&(ptrSource[i + 10]));
 
         __m128d mask = _mm_set1_pd(*fmask);
         __m128d one = _mm_set1_pd(1.0);
         __m128d zero = _mm_set1_pd(0.0);
 
         for (size_t d = 0; d < dims; d++) {
-          __m128d eval_0 = _mm_load_pd(&(ptrData[(d * sourceSize) + i]));
-          __m128d eval_1 = _mm_load_pd(&(ptrData[(d * sourceSize) + i + 2]));
-          __m128d eval_2 = _mm_load_pd(&(ptrData[(d * sourceSize) + i + 4]));
-          __m128d eval_3 = _mm_load_pd(&(ptrData[(d * sourceSize) + i + 6]));
-          __m128d eval_4 = _mm_load_pd(&(ptrData[(d * sourceSize) + i + 8]));
-          __m128d eval_5 = _mm_load_pd(&(ptrData[(d * sourceSize) + i + 10]));
+          __m128d eval_0 = _mm_loadu_pd(&(ptrData[(d * sourceSize) + i]));
+          __m128d eval_1 = _mm_loadu_pd(&(ptrData[(d * sourceSize) + i + 2]));
+          __m128d eval_2 = _mm_loadu_pd(&(ptrData[(d * sourceSize) + i + 4]));
+          __m128d eval_3 = _mm_loadu_pd(&(ptrData[(d * sourceSize) + i + 6]));
+          __m128d eval_4 = _mm_loadu_pd(&(ptrData[(d * sourceSize) + i + 8]));
+          __m128d eval_5 = _mm_loadu_pd(&(ptrData[(d * sourceSize) + i + 10]));
 
           __m128d level = _mm_loaddup_pd(&(ptrLevel[(j * dims) + d]));
           __m128d index = _mm_loaddup_pd(&(ptrIndex[(j * dims) + d]));
@@ -128,37 +143,43 @@ void OperationMultiEvalStreaming::multTransposeImpl(
       }
     }
   }
+}
+STREAMING_LINEAR_TARGET_END
 #endif
 
-#if defined(__SSE3__) && defined(__AVX__) && !defined(__AVX512F__)
-
+#ifdef STREAMING_LINEAR_KERNEL_AVX
+STREAMING_LINEAR_TARGET_BEGIN("avx")
+void multTransposeAVX(const double* ptrLevel, const double* ptrIndex, const double* ptrData,
+                      const double* ptrSource, double* ptrResult, size_t dims, size_t sourceSize,
+                      size_t start_index_grid, size_t end_index_grid, size_t start_index_data,
+                      size_t end_index_data) {
   for (size_t k = start_index_grid; k < end_index_grid;
-       k += std::min<size_t>(getChunkGridPoints(), (end_index_grid - k))) {
-    size_t grid_inc = std::min<size_t>((size_t)getChunkGridPoints(), (end_index_grid - k));
+       k += minSize(CHUNK_GRID_POINTS, (end_index_grid - k))) {
+    size_t grid_inc = minSize(CHUNK_GRID_POINTS, (end_index_grid - k));
 
     int64_t imask = 0x7FFFFFFFFFFFFFFF;
     double* fmask = reinterpret_cast<double*>(&imask);
 
     for (size_t i = start_index_data; i < end_index_data; i += 24) {
       for (size_t j = k; j < k + grid_inc; j++) {
-        __m256d support_0 = _mm256_load_pd(&(ptrSource[i]));
-        __m256d support_1 = _mm256_load_pd(&(ptrSource[i + 4]));
-        __m256d support_2 = _mm256_load_pd(&(ptrSource[i + 8]));
-        __m256d support_3 = _mm256_load_pd(&(ptrSource[i + 12]));
-        __m256d support_4 = _mm256_load_pd(&(ptrSource[i + 16]));
-        __m256d support_5 = _mm256_load_pd(&(ptrSource[i + 20]));
+        __m256d support_0 = _mm256_loadu_pd(&(ptrSource[i]));
+        __m256d support_1 = _mm256_loadu_pd(&(ptrSource[i + 4]));
+        __m256d support_2 = _mm256_loadu_pd(&(ptrSource[i + 8]));
+        __m256d support_3 = _mm256_loadu_pd(&(ptrSource[i + 12]));
+        __m256d support_4 = _mm256_loadu_pd(&(ptrSource[i + 16]));
+        __m256d support_5 = _mm256_loadu_pd(&(ptrSource[i + 20]));
 
         __m256d mask = _mm256_broadcast_sd(fmask);
         __m256d one = _mm256_set1_pd(1.0);
         __m256d zero = _mm256_set1_pd(0.0);
 
         for (size_t d = 0; d < dims; d++) {
-          __m256d eval_0 = _mm256_load_pd(&(ptrData[(d * sourceSize) + i]));
-          __m256d eval_1 = _mm256_load_pd(&(ptrData[(d * sourceSize) + i + 4]));
-          __m256d eval_2 = _mm256_load_pd(&(ptrData[(d * sourceSize) + i + 8]));
-          __m256d eval_3 = _mm256_load_pd(&(ptrData[(d * sourceSize) + i + 12]));
-          __m256d eval_4 = _mm256_load_pd(&(ptrData[(d * sourceSize) + i + 16]));
-          __m256d eval_5 = _mm256_load_pd(&(ptrData[(d * sourceSize) + i + 20]));
+          __m256d eval_0 = _mm256_loadu_pd(&(ptrData[(d * sourceSize) + i]));
+          __m256d eval_1 = _mm256_loadu_pd(&(ptrData[(d * sourceSize) + i + 4]));
+          __m256d eval_2 = _mm256_loadu_pd(&(ptrData[(d * sourceSize) + i + 8]));
+          __m256d eval_3 = _mm256_loadu_pd(&(ptrData[(d * sourceSize) + i + 12]));
+          __m256d eval_4 = _mm256_loadu_pd(&(ptrData[(d * sourceSize) + i + 16]));
+          __m256d eval_5 = _mm256_loadu_pd(&(ptrData[(d * sourceSize) + i + 20]));
 
           __m256d level = _mm256_broadcast_sd(&(ptrLevel[(j * dims) + d]));
           __m256d index = _mm256_broadcast_sd(&(ptrIndex[(j * dims) + d]));
@@ -241,45 +262,155 @@ void OperationMultiEvalStreaming::multTransposeImpl(
       }
     }
   }
+}
+STREAMING_LINEAR_TARGET_END
 #endif
 
-#if defined(__MIC__) || defined(__AVX512F__)
+#ifdef STREAMING_LINEAR_KERNEL_AVX2
+STREAMING_LINEAR_TARGET_BEGIN("avx2,fma")
+void multTransposeAVX2(const double* ptrLevel, const double* ptrIndex, const double* ptrData,
+                       const double* ptrSource, double* ptrResult, size_t dims, size_t sourceSize,
+                       size_t start_index_grid, size_t end_index_grid, size_t start_index_data,
+                       size_t end_index_data) {
+  for (size_t k = start_index_grid; k < end_index_grid;
+       k += minSize(CHUNK_GRID_POINTS, (end_index_grid - k))) {
+    size_t grid_inc = minSize(CHUNK_GRID_POINTS, (end_index_grid - k));
+
+    int64_t imask = 0x7FFFFFFFFFFFFFFF;
+    double* fmask = reinterpret_cast<double*>(&imask);
+
+    for (size_t i = start_index_data; i < end_index_data; i += 24) {
+      for (size_t j = k; j < k + grid_inc; j++) {
+        __m256d support_0 = _mm256_loadu_pd(&(ptrSource[i]));
+        __m256d support_1 = _mm256_loadu_pd(&(ptrSource[i + 4]));
+        __m256d support_2 = _mm256_loadu_pd(&(ptrSource[i + 8]));
+        __m256d support_3 = _mm256_loadu_pd(&(ptrSource[i + 12]));
+        __m256d support_4 = _mm256_loadu_pd(&(ptrSource[i + 16]));
+        __m256d support_5 = _mm256_loadu_pd(&(ptrSource[i + 20]));
+
+        __m256d mask = _mm256_broadcast_sd(fmask);
+        __m256d one = _mm256_set1_pd(1.0);
+        __m256d zero = _mm256_set1_pd(0.0);
+
+        for (size_t d = 0; d < dims; d++) {
+          __m256d eval_0 = _mm256_loadu_pd(&(ptrData[(d * sourceSize) + i]));
+          __m256d eval_1 = _mm256_loadu_pd(&(ptrData[(d * sourceSize) + i + 4]));
+          __m256d eval_2 = _mm256_loadu_pd(&(ptrData[(d * sourceSize) + i + 8]));
+          __m256d eval_3 = _mm256_loadu_pd(&(ptrData[(d * sourceSize) + i + 12]));
+          __m256d eval_4 = _mm256_loadu_pd(&(ptrData[(d * sourceSize) + i + 16]));
+          __m256d eval_5 = _mm256_loadu_pd(&(ptrData[(d * sourceSize) + i + 20]));
+
+          __m256d level = _mm256_broadcast_sd(&(ptrLevel[(j * dims) + d]));
+          __m256d index = _mm256_broadcast_sd(&(ptrIndex[(j * dims) + d]));
+          eval_0 = _mm256_fmsub_pd(eval_0, level, index);
+          eval_1 = _mm256_fmsub_pd(eval_1, level, index);
+          eval_2 = _mm256_fmsub_pd(eval_2, level, index);
+          eval_3 = _mm256_fmsub_pd(eval_3, level, index);
+          eval_4 = _mm256_fmsub_pd(eval_4, level, index);
+          eval_5 = _mm256_fmsub_pd(eval_5, level, index);
+          eval_0 = _mm256_and_pd(mask, eval_0);
+          eval_1 = _mm256_and_pd(mask, eval_1);
+          eval_2 = _mm256_and_pd(mask, eval_2);
+          eval_3 = _mm256_and_pd(mask, eval_3);
+          eval_4 = _mm256_and_pd(mask, eval_4);
+          eval_5 = _mm256_and_pd(mask, eval_5);
+
+          eval_0 = _mm256_sub_pd(one, eval_0);
+          eval_1 = _mm256_sub_pd(one, eval_1);
+          eval_2 = _mm256_sub_pd(one, eval_2);
+          eval_3 = _mm256_sub_pd(one, eval_3);
+          eval_4 = _mm256_sub_pd(one, eval_4);
+          eval_5 = _mm256_sub_pd(one, eval_5);
+
+          eval_0 = _mm256_max_pd(zero, eval_0);
+          eval_1 = _mm256_max_pd(zero, eval_1);
+          eval_2 = _mm256_max_pd(zero, eval_2);
+          eval_3 = _mm256_max_pd(zero, eval_3);
+          eval_4 = _mm256_max_pd(zero, eval_4);
+          eval_5 = _mm256_max_pd(zero, eval_5);
+
+          support_0 = _mm256_mul_pd(support_0, eval_0);
+          support_1 = _mm256_mul_pd(support_1, eval_1);
+          support_2 = _mm256_mul_pd(support_2, eval_2);
+          support_3 = _mm256_mul_pd(support_3, eval_3);
+          support_4 = _mm256_mul_pd(support_4, eval_4);
+          support_5 = _mm256_mul_pd(support_5, eval_5);
+        }
+
+        const __m256i ldStMaskAVX = _mm256_set_epi64x(0x0000000000000000, 0x0000000000000000,
+                                                      0x0000000000000000, 0xFFFFFFFFFFFFFFFF);
+
+        support_0 = _mm256_add_pd(support_0, support_1);
+        support_2 = _mm256_add_pd(support_2, support_3);
+        support_4 = _mm256_add_pd(support_4, support_5);
+        support_0 = _mm256_add_pd(support_0, support_2);
+        support_0 = _mm256_add_pd(support_0, support_4);
+
+        support_0 = _mm256_hadd_pd(support_0, support_0);
+        __m256d tmp = _mm256_permute2f128_pd(support_0, support_0, 0x81);
+        support_0 = _mm256_add_pd(support_0, tmp);
+
+// Workaround: bug with maskload in GCC (4.6.1)
+#ifdef __ICC
+        __m256d res_0 = _mm256_maskload_pd(&(ptrResult[j]), ldStMaskAVX);
+        res_0 = _mm256_add_pd(res_0, support_0);
+        _mm256_maskstore_pd(&(ptrResult[j]), ldStMaskAVX, res_0);
+#else
+        double tmp_reduce;
+        _mm256_maskstore_pd(&(tmp_reduce), ldStMaskAVX, support_0);
+        ptrResult[j] += tmp_reduce;
+#endif
+      }
+    }
+  }
+}
+STREAMING_LINEAR_TARGET_END
+#endif
+
+#ifdef STREAMING_LINEAR_KERNEL_AVX512
+STREAMING_LINEAR_TARGET_BEGIN("avx512f")
+void multTransposeAVX512(const double* ptrLevel, const double* ptrIndex, const double* ptrData,
+                         const double* ptrSource, double* ptrResult, size_t dims, size_t sourceSize,
+                         size_t start_index_grid, size_t end_index_grid, size_t start_index_data,
+                         size_t end_index_data) {
 #if defined(__MIC__)
 #define _mm512_broadcast_sd(A) \
   _mm512_extload_pd(A, _MM_UPCONV_PD_NONE, _MM_BROADCAST_1X8, _MM_HINT_NONE)
 #define _mm512_max_pd(A, B) _mm512_gmax_pd(A, B)
 #define _mm512_set1_epi64(A) _mm512_set_1to8_epi64(A)
 #define _mm512_set1_pd(A) _mm512_set_1to8_pd(A)
-#endif
-#if defined(__AVX512F__)
+// KNC has no unaligned variants, MIC builds keep the aligned accesses
+#define _mm512_loadu_pd(A) _mm512_load_pd(A)
+#define _mm512_storeu_pd(A, B) _mm512_store_pd(A, B)
+#else
 #define _mm512_broadcast_sd(A) _mm512_broadcastsd_pd(_mm_load_sd(A))
 #endif
 
-  for (size_t i = start_index_data; i < end_index_data; i += getChunkDataPoints()) {
+  for (size_t i = start_index_data; i < end_index_data; i += CHUNK_DATA_POINTS_AVX512) {
     for (size_t j = start_index_grid; j < end_index_grid; j++) {
-      __m512d support_0 = _mm512_load_pd(&(ptrSource[i + 0]));
-      __m512d support_1 = _mm512_load_pd(&(ptrSource[i + 8]));
-      __m512d support_2 = _mm512_load_pd(&(ptrSource[i + 16]));
+      __m512d support_0 = _mm512_loadu_pd(&(ptrSource[i + 0]));
+      __m512d support_1 = _mm512_loadu_pd(&(ptrSource[i + 8]));
+      __m512d support_2 = _mm512_loadu_pd(&(ptrSource[i + 16]));
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 24)
-      __m512d support_3 = _mm512_load_pd(&(ptrSource[i + 24]));
+      __m512d support_3 = _mm512_loadu_pd(&(ptrSource[i + 24]));
 #endif
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 32)
-      __m512d support_4 = _mm512_load_pd(&(ptrSource[i + 32]));
-      __m512d support_5 = _mm512_load_pd(&(ptrSource[i + 40]));
+      __m512d support_4 = _mm512_loadu_pd(&(ptrSource[i + 32]));
+      __m512d support_5 = _mm512_loadu_pd(&(ptrSource[i + 40]));
 #endif
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 48)
-      __m512d support_6 = _mm512_load_pd(&(ptrSource[i + 48]));
-      __m512d support_7 = _mm512_load_pd(&(ptrSource[i + 56]));
+      __m512d support_6 = _mm512_loadu_pd(&(ptrSource[i + 48]));
+      __m512d support_7 = _mm512_loadu_pd(&(ptrSource[i + 56]));
 #endif
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 64)
-      __m512d support_8 = _mm512_load_pd(&(ptrSource[i + 64]));
+      __m512d support_8 = _mm512_loadu_pd(&(ptrSource[i + 64]));
 #endif
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 72)
-      __m512d support_9 = _mm512_load_pd(&(ptrSource[i + 72]));
+      __m512d support_9 = _mm512_loadu_pd(&(ptrSource[i + 72]));
 #endif
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 80)
-      __m512d support_10 = _mm512_load_pd(&(ptrSource[i + 80]));
-      __m512d support_11 = _mm512_load_pd(&(ptrSource[i + 88]));
+      __m512d support_10 = _mm512_loadu_pd(&(ptrSource[i + 80]));
+      __m512d support_11 = _mm512_loadu_pd(&(ptrSource[i + 88]));
 #endif
 
       _mm_prefetch((const char*)&(ptrLevel[((j + 1) * dims)]), _MM_HINT_T0);
@@ -288,29 +419,29 @@ void OperationMultiEvalStreaming::multTransposeImpl(
       _mm_prefetch((const char*)&(ptrResult[j]), _MM_HINT_ET0);
 
       for (size_t d = 0; d < dims; d++) {
-        __m512d eval_0 = _mm512_load_pd(&(ptrData[(d * sourceSize) + i + 0]));
-        __m512d eval_1 = _mm512_load_pd(&(ptrData[(d * sourceSize) + i + 8]));
-        __m512d eval_2 = _mm512_load_pd(&(ptrData[(d * sourceSize) + i + 16]));
+        __m512d eval_0 = _mm512_loadu_pd(&(ptrData[(d * sourceSize) + i + 0]));
+        __m512d eval_1 = _mm512_loadu_pd(&(ptrData[(d * sourceSize) + i + 8]));
+        __m512d eval_2 = _mm512_loadu_pd(&(ptrData[(d * sourceSize) + i + 16]));
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 24)
-        __m512d eval_3 = _mm512_load_pd(&(ptrData[(d * sourceSize) + i + 24]));
+        __m512d eval_3 = _mm512_loadu_pd(&(ptrData[(d * sourceSize) + i + 24]));
 #endif
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 32)
-        __m512d eval_4 = _mm512_load_pd(&(ptrData[(d * sourceSize) + i + 32]));
-        __m512d eval_5 = _mm512_load_pd(&(ptrData[(d * sourceSize) + i + 40]));
+        __m512d eval_4 = _mm512_loadu_pd(&(ptrData[(d * sourceSize) + i + 32]));
+        __m512d eval_5 = _mm512_loadu_pd(&(ptrData[(d * sourceSize) + i + 40]));
 #endif
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 48)
-        __m512d eval_6 = _mm512_load_pd(&(ptrData[(d * sourceSize) + i + 48]));
-        __m512d eval_7 = _mm512_load_pd(&(ptrData[(d * sourceSize) + i + 56]));
+        __m512d eval_6 = _mm512_loadu_pd(&(ptrData[(d * sourceSize) + i + 48]));
+        __m512d eval_7 = _mm512_loadu_pd(&(ptrData[(d * sourceSize) + i + 56]));
 #endif
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 64)
-        __m512d eval_8 = _mm512_load_pd(&(ptrData[(d * sourceSize) + i + 64]));
+        __m512d eval_8 = _mm512_loadu_pd(&(ptrData[(d * sourceSize) + i + 64]));
 #endif
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 72)
-        __m512d eval_9 = _mm512_load_pd(&(ptrData[(d * sourceSize) + i + 72]));
+        __m512d eval_9 = _mm512_loadu_pd(&(ptrData[(d * sourceSize) + i + 72]));
 #endif
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 80)
-        __m512d eval_10 = _mm512_load_pd(&(ptrData[(d * sourceSize) + i + 80]));
-        __m512d eval_11 = _mm512_load_pd(&(ptrData[(d * sourceSize) + i + 88]));
+        __m512d eval_10 = _mm512_loadu_pd(&(ptrData[(d * sourceSize) + i + 80]));
+        __m512d eval_11 = _mm512_loadu_pd(&(ptrData[(d * sourceSize) + i + 88]));
 #endif
 
         __m512d level = _mm512_broadcast_sd(&(ptrLevel[(j * dims) + d]));
@@ -478,34 +609,10 @@ void OperationMultiEvalStreaming::multTransposeImpl(
       ptrResult[j] += _mm512_reduce_add_pd(support_0);
     }
   }
+}
+STREAMING_LINEAR_TARGET_END
 #endif
 
-#if (!defined(__SSE3__) && !defined(__AVX__)) && !defined(__MIC__) && !defined(__AVX512F__)
-#warning \
-    "warning: using fallback implementation for OperationMultiEvalStreaming multTranspose kernel"
-
-  for (size_t k = start_index_grid; k < end_index_grid;
-       k += std::min<size_t>(getChunkGridPoints(), (end_index_grid - k))) {
-    size_t grid_inc = std::min<size_t>((size_t)getChunkGridPoints(), (end_index_grid - k));
-
-    for (size_t i = start_index_data; i < end_index_data; i++) {
-      for (size_t j = k; j < k + grid_inc; j++) {
-        double curSupport = ptrSource[i];
-
-        for (size_t d = 0; d < dims; d++) {
-          double eval = ((ptrLevel[(j * dims) + d]) * (ptrData[(d * sourceSize) + i]));
-          double index_calc = eval - (ptrIndex[(j * dims) + d]);
-          double abs = fabs(index_calc);
-          double last = 1.0 - abs;
-          double localSupport = std::max<double>(last, 0.0);
-          curSupport *= localSupport;
-        }
-
-        ptrResult[j] += curSupport;
-      }
-    }
-  }
-#endif
-}
+}  // namespace StreamingKernels
 }  // namespace datadriven
 }  // namespace sgpp
@@ -50,6 +50,7 @@ void OperationDensityMarginalizeKDE::doMarginalize(
 
   // initialize kde with new samples
   marginalizedKDE.initialize(newSamplesVec);
+  marginalizedKDE.setEvaluationTolerance(kde->getEvaluationTolerance());
 }
 
 void OperationDensityMarginalizeKDE::doMarginalize(
@@ -83,6 +84,7 @@ void OperationDensityMarginalizeKDE::doMarginalize(
   }
 
   marginalizedKDE.initialize(newSamplesVec);
+  marginalizedKDE.setEvaluationTolerance(kde->getEvaluationTolerance());
 }
 
 void OperationDensityMarginalizeKDE::margToDimX(
@@ -97,6 +99,7 @@ void OperationDensityMarginalizeKDE::margToDimX(
 
   // initialize marginalized kde
   marginalizedKDE.initialize(newSamplesVec);
+  marginalizedKDE.setEvaluationTolerance(kde->getEvaluationTolerance());
 }
 
 void OperationDensityMarginalizeKDE::margToDimXs(
@@ -112,6 +115,7 @@ void OperationDensityMarginalizeKDE::margToDimXs(
 
   // initialize kde with new samples
   marginalizedKDE.initialize(newSamplesVec);
+  marginalizedKDE.setEvaluationTolerance(kde->getEvaluationTolerance());
 }
 }  // namespace datadriven
 }  // namespace sgpp
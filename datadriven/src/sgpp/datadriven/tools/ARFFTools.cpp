@@ -5,6 +5,8 @@
 
 #include <sgpp/base/exception/file_exception.hpp>
 #include <sgpp/datadriven/tools/ARFFTools.hpp>
+#include <sgpp/datadriven/tools/DelimitedTextParser.hpp>
+#include <sgpp/datadriven/tools/MemoryMappedFile.hpp>
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/tools/StringTokenizer.hpp>
 
@@ -60,13 +62,23 @@ Dataset ARFFTools::readARFFFromFile(const std::string& filename,
   return d;
 }
 
+Dataset ARFFTools::readARFFFromMappedFile(const std::string& filename,
+                                          bool hasTargets,
+                                          size_t instanceCutoff,
+                                          std::vector<size_t> selectedCols,
+                                          std::vector<double> selectedTargets) {
+  MemoryMappedFile file(filename);
+  return DelimitedTextParser::parse(file.begin(), file.end(), false, true, hasTargets,
+                                    instanceCutoff, selectedCols, selectedTargets);
+}
+
 Dataset ARFFTools::readARFFFromString(const std::string& content,
                                       bool hasTargets,
                                       size_t instanceCutoff,
                                       std::vector<size_t> selectedCols,
                                       std::vector<double> selectedTargets) {
-  std::istringstream stream(content);
-  return readARFF(stream, hasTargets, instanceCutoff, selectedCols, selectedTargets);
+  return DelimitedTextParser::parse(content.data(), content.data() + content.size(), false, true,
+                                    hasTargets, instanceCutoff, selectedCols, selectedTargets);
 }
 
 void ARFFTools::readARFFSize(std::istream& stream,
@@ -108,7 +108,19 @@ class ARFFTools {
                                   std::vector<double> selectedTargets = std::vector<double>());
 
   /**
-   * Wrapper from input type: String. See readARFF for more details
+   * Reads an ARFF file by mapping it into memory and parsing it in parallel with
+   * DelimitedTextParser instead of reading it line by line. See readARFF for the parameters.
+   */
+  static Dataset readARFFFromMappedFile(const std::string& filename,
+                                        bool hasTargets = true,
+                                        size_t instanceCutoff = -1,
+                                        std::vector<size_t> selectedCols = std::vector<size_t>(),
+                                        std::vector<double> selectedTargets =
+                                            std::vector<double>());
+
+  /**
+   * Wrapper from input type: String, parsed with DelimitedTextParser. See readARFF for more
+   * details
    */
   static Dataset readARFFFromString(const std::string& content,
                                     bool hasTargets = true,
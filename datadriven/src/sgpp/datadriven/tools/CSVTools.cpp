@@ -4,6 +4,8 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/datadriven/tools/CSVTools.hpp>
+#include <sgpp/datadriven/tools/DelimitedTextParser.hpp>
+#include <sgpp/datadriven/tools/MemoryMappedFile.hpp>
 #include <sgpp/base/exception/file_exception.hpp>
 #include <sgpp/base/tools/StringTokenizer.hpp>
 
@@ -39,6 +41,28 @@ Dataset CSVTools::readCSVFromFile(const std::string& filename,
   return d;
 }
 
+Dataset CSVTools::readCSVFromMappedFile(const std::string& filename,
+                                        bool skipFirstLine,
+                                        bool hasTargets,
+                                        size_t instanceCutoff,
+                                        std::vector<size_t> selectedCols,
+                                        std::vector<double> selectedTargets) {
+  MemoryMappedFile file(filename);
+  return DelimitedTextParser::parse(file.begin(), file.end(), skipFirstLine, false, hasTargets,
+                                    instanceCutoff, selectedCols, selectedTargets);
+}
+
+Dataset CSVTools::readCSVFromString(const std::string& content,
+                                    bool skipFirstLine,
+                                    bool hasTargets,
+                                    size_t instanceCutoff,
+                                    std::vector<size_t> selectedCols,
+                                    std::vector<double> selectedTargets) {
+  return DelimitedTextParser::parse(content.data(), content.data() + content.size(),
+                                    skipFirstLine, false, hasTargets, instanceCutoff, selectedCols,
+                                    selectedTargets);
+}
+
 void CSVTools::readCSVSizeFromFile(const std::string& filename,
                                    size_t& numberInstances,
                                    size_t& dimension,
@@ -95,6 +95,30 @@ class CSVTools {
                                  std::vector<size_t> selectedCols = std::vector<size_t>(),
                                  std::vector<double> selectedTargets = std::vector<double>());
 
+  /**
+   * Reads a CSV file by mapping it into memory and parsing it in parallel with
+   * DelimitedTextParser instead of reading it line by line. See readCSV for the parameters.
+   * In contrast to readCSV, skipFirstLine skips the first non-empty line.
+   */
+  static Dataset readCSVFromMappedFile(const std::string& filename,
+                                       bool skipFirstLine = false,
+                                       bool hasTargets = true,
+                                       size_t instanceCutoff = -1,
+                                       std::vector<size_t> selectedCols = std::vector<size_t>(),
+                                       std::vector<double> selectedTargets =
+                                           std::vector<double>());
+
+  /**
+   * Reads CSV data from a string with DelimitedTextParser. See readCSVFromMappedFile for the
+   * parameters.
+   */
+  static Dataset readCSVFromString(const std::string& content,
+                                   bool skipFirstLine = false,
+                                   bool hasTargets = true,
+                                   size_t instanceCutoff = -1,
+                                   std::vector<size_t> selectedCols = std::vector<size_t>(),
+                                   std::vector<double> selectedTargets = std::vector<double>());
+
   /**
    * Wrapper from input type: File. See readCSVSize for more details
    */
@@ -0,0 +1,381 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/tools/DelimitedTextParser.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+/// minimal number of bytes per thread, smaller buffers are not split
+const size_t minBytesPerChunk = 1 << 16;
+
+/// powers of ten that are exactly representable as double
+const double exactPowersOfTen[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                   1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                   1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+/**
+ * @return pointer to the line break terminating the line starting at p (or end)
+ */
+inline const char* findLineEnd(const char* p, const char* end) {
+  const char* lineEnd = static_cast<const char*>(std::memchr(p, '\n', end - p));
+  return (lineEnd == nullptr) ? end : lineEnd;
+}
+
+/**
+ * Checks whether the line [lineBegin, lineEnd) contains data. A trailing carriage return
+ * is removed from the line.
+ */
+inline bool isDataLine(const char* lineBegin, const char*& lineEnd, bool skipAnnotationLines) {
+  if ((lineEnd > lineBegin) && (*(lineEnd - 1) == '\r')) {
+    --lineEnd;
+  }
+
+  if (lineEnd == lineBegin) {
+    return false;
+  }
+
+  if (skipAnnotationLines) {
+    const size_t length = lineEnd - lineBegin;
+
+    if ((std::memchr(lineBegin, '%', length) != nullptr) ||
+        (std::memchr(lineBegin, '@', length) != nullptr)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+inline bool isSelectedTarget(double target, const std::vector<double>& selectedTargets) {
+  if (selectedTargets.empty()) {
+    return true;
+  }
+
+  for (size_t i = 0; i < selectedTargets.size(); i++) {
+    if (std::fabs(target - selectedTargets[i]) < 0.001) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * Counts the admissible rows in the range [begin, end), which has to start at the beginning
+ * of a line. Returns false if a line with a wrong number of columns is found.
+ */
+bool countRows(const char* begin, const char* end, bool skipAnnotationLines,
+               size_t numberOfCommas, bool filterTargets,
+               const std::vector<double>& selectedTargets, size_t& numberOfRows) {
+  numberOfRows = 0;
+
+  for (const char* lineBegin = begin; lineBegin < end;) {
+    const char* lineEnd = findLineEnd(lineBegin, end);
+    const char* next = lineEnd + 1;
+
+    if (isDataLine(lineBegin, lineEnd, skipAnnotationLines)) {
+      if (static_cast<size_t>(std::count(lineBegin, lineEnd, ',')) != numberOfCommas) {
+        return false;
+      }
+
+      if (filterTargets) {
+        const char* lastField = lineEnd;
+
+        while ((lastField > lineBegin) && (*(lastField - 1) != ',')) {
+          --lastField;
+        }
+
+        if (!isSelectedTarget(DelimitedTextParser::parseNumber(lastField, lineEnd),
+                              selectedTargets)) {
+          lineBegin = next;
+          continue;
+        }
+      }
+
+      numberOfRows++;
+    }
+
+    lineBegin = next;
+  }
+
+  return true;
+}
+
+/**
+ * Parses the admissible rows in the range [begin, end) into the dataset, starting at row
+ * firstRow and stopping before row lastRow.
+ */
+void parseRows(const char* begin, const char* end, bool skipAnnotationLines,
+               size_t numberOfColumns, bool hasTargets,
+               const std::vector<size_t>& selectedCols,
+               const std::vector<double>& selectedTargets, size_t firstRow, size_t lastRow,
+               Dataset& dataset) {
+  const size_t dimension = dataset.getDimension();
+  double* data = dataset.getData().getPointer();
+  double* targets = dataset.getTargets().getPointer();
+  std::vector<double> fields(numberOfColumns);
+  size_t row = firstRow;
+
+  for (const char* lineBegin = begin; (lineBegin < end) && (row < lastRow);) {
+    const char* lineEnd = findLineEnd(lineBegin, end);
+    const char* next = lineEnd + 1;
+
+    if (isDataLine(lineBegin, lineEnd, skipAnnotationLines)) {
+      const char* fieldBegin = lineBegin;
+
+      for (size_t j = 0; j < numberOfColumns; j++) {
+        const char* fieldEnd =
+            static_cast<const char*>(std::memchr(fieldBegin, ',', lineEnd - fieldBegin));
+
+        if (fieldEnd == nullptr) {
+          fieldEnd = lineEnd;
+        }
+
+        fields[j] = DelimitedTextParser::parseNumber(fieldBegin, fieldEnd);
+        fieldBegin = fieldEnd + 1;
+      }
+
+      if (hasTargets) {
+        if (!isSelectedTarget(fields[numberOfColumns - 1], selectedTargets)) {
+          lineBegin = next;
+          continue;
+        }
+
+        targets[row] = fields[numberOfColumns - 1];
+      }
+
+      double* dataRow = data + row * dimension;
+
+      if (selectedCols.empty()) {
+        std::copy(fields.begin(), fields.begin() + dimension, dataRow);
+      } else {
+        for (size_t i = 0; i < dimension; i++) {
+          dataRow[i] = fields[selectedCols[i]];
+        }
+      }
+
+      row++;
+    }
+
+    lineBegin = next;
+  }
+}
+
+}  // namespace
+
+double DelimitedTextParser::parseNumber(const char* begin, const char* end) {
+  const char* p = begin;
+
+  while ((p < end) && ((*p == ' ') || (*p == '\t'))) {
+    ++p;
+  }
+
+  bool negative = false;
+
+  if ((p < end) && ((*p == '-') || (*p == '+'))) {
+    negative = (*p == '-');
+    ++p;
+  }
+
+  uint64_t mantissa = 0;
+  int significantDigits = 0;
+  int exponent = 0;
+  bool hasDigits = false;
+  bool afterPoint = false;
+
+  for (; p < end; ++p) {
+    if ((*p >= '0') && (*p <= '9')) {
+      const uint64_t digit = static_cast<uint64_t>(*p - '0');
+      hasDigits = true;
+
+      // leading zeros only shift the decimal exponent
+      if ((mantissa == 0) && (digit == 0)) {
+        exponent -= afterPoint ? 1 : 0;
+        continue;
+      }
+
+      if (significantDigits < 16) {
+        mantissa = 10 * mantissa + digit;
+        exponent -= afterPoint ? 1 : 0;
+      } else {
+        exponent += afterPoint ? 0 : 1;
+      }
+
+      significantDigits++;
+    } else if ((*p == '.') && !afterPoint) {
+      afterPoint = true;
+    } else {
+      break;
+    }
+  }
+
+  bool fastPath = hasDigits && (significantDigits <= 15);
+
+  if (fastPath && (p < end) && ((*p == 'e') || (*p == 'E'))) {
+    ++p;
+    bool negativeExponent = false;
+
+    if ((p < end) && ((*p == '-') || (*p == '+'))) {
+      negativeExponent = (*p == '-');
+      ++p;
+    }
+
+    int exponentValue = 0;
+    bool hasExponentDigits = false;
+
+    for (; (p < end) && (*p >= '0') && (*p <= '9'); ++p) {
+      hasExponentDigits = true;
+
+      if (exponentValue < 10000) {
+        exponentValue = 10 * exponentValue + (*p - '0');
+      }
+    }
+
+    fastPath = hasExponentDigits;
+    exponent += negativeExponent ? -exponentValue : exponentValue;
+  }
+
+  while ((p < end) && ((*p == ' ') || (*p == '\t'))) {
+    ++p;
+  }
+
+  if (fastPath && (p == end) && (exponent >= -22) && (exponent <= 22)) {
+    // both the mantissa (< 2^53) and the power of ten are exact, so a single correctly
+    // rounded operation yields the correctly rounded result
+    double value = static_cast<double>(mantissa);
+
+    if (exponent < 0) {
+      value /= exactPowersOfTen[-exponent];
+    } else {
+      value *= exactPowersOfTen[exponent];
+    }
+
+    return negative ? -value : value;
+  }
+
+  const std::string field(begin, end);
+  return std::strtod(field.c_str(), nullptr);
+}
+
+Dataset DelimitedTextParser::parse(const char* begin, const char* end, bool skipFirstLine,
+                                   bool skipAnnotationLines, bool hasTargets,
+                                   size_t instanceCutoff,
+                                   const std::vector<size_t>& selectedCols,
+                                   const std::vector<double>& selectedTargets) {
+  // find the first data line, which determines the number of columns
+  const char* dataBegin = begin;
+  size_t numberOfCommas = 0;
+  bool foundDataLine = false;
+
+  while (dataBegin < end) {
+    const char* lineEnd = findLineEnd(dataBegin, end);
+
+    if (isDataLine(dataBegin, lineEnd, skipAnnotationLines)) {
+      if (!skipFirstLine) {
+        numberOfCommas = std::count(dataBegin, lineEnd, ',');
+        foundDataLine = true;
+        break;
+      }
+
+      skipFirstLine = false;
+    }
+
+    dataBegin = findLineEnd(dataBegin, end) + 1;
+  }
+
+  if (!foundDataLine) {
+    // nothing to validate the column selection against (e.g., a chunk of header lines)
+    return Dataset(0, selectedCols.size());
+  }
+
+  const size_t numberOfColumns = numberOfCommas + 1;
+  const size_t maxDimension = hasTargets ? (numberOfColumns - 1) : numberOfColumns;
+  size_t dimension = maxDimension;
+
+  if (!selectedCols.empty()) {
+    if (*std::max_element(selectedCols.begin(), selectedCols.end()) >= maxDimension) {
+      throw sgpp::base::file_exception("DelimitedTextParser: invalid column selection");
+    }
+
+    dimension = selectedCols.size();
+  }
+
+  // split the data lines into ranges that start at the beginning of a line
+  size_t numberOfChunks = 1;
+#ifdef _OPENMP
+  numberOfChunks = static_cast<size_t>(omp_get_max_threads());
+#endif
+  const size_t numberOfBytes = static_cast<size_t>(end - dataBegin);
+  numberOfChunks =
+      std::max<size_t>(1, std::min(numberOfChunks, numberOfBytes / minBytesPerChunk));
+
+  std::vector<const char*> chunkBegin(numberOfChunks + 1, end);
+  chunkBegin[0] = dataBegin;
+
+  for (size_t c = 1; c < numberOfChunks; c++) {
+    const char* p = std::max(chunkBegin[c - 1], dataBegin + c * (numberOfBytes / numberOfChunks));
+    p = (p < end) ? findLineEnd(p, end) : end;
+    chunkBegin[c] = (p < end) ? (p + 1) : end;
+  }
+
+  // first pass: validate lines and count admissible rows per range
+  const bool filterTargets = hasTargets && !selectedTargets.empty();
+  std::vector<size_t> rowsPerChunk(numberOfChunks, 0);
+  std::vector<char> chunkValid(numberOfChunks, 1);
+
+#pragma omp parallel for schedule(static, 1)
+  for (size_t c = 0; c < numberOfChunks; c++) {
+    chunkValid[c] = countRows(chunkBegin[c], chunkBegin[c + 1], skipAnnotationLines,
+                              numberOfCommas, filterTargets, selectedTargets, rowsPerChunk[c])
+                        ? 1
+                        : 0;
+  }
+
+  if (std::find(chunkValid.begin(), chunkValid.end(), 0) != chunkValid.end()) {
+    throw sgpp::base::file_exception("DelimitedTextParser: columns missing in line");
+  }
+
+  std::vector<size_t> firstRowOfChunk(numberOfChunks + 1, 0);
+
+  for (size_t c = 0; c < numberOfChunks; c++) {
+    firstRowOfChunk[c + 1] = firstRowOfChunk[c] + rowsPerChunk[c];
+  }
+
+  const size_t numberInstances = std::min(firstRowOfChunk[numberOfChunks], instanceCutoff);
+  Dataset dataset(numberInstances, dimension);
+
+  // second pass: parse every range directly into its part of the dataset
+#pragma omp parallel for schedule(static, 1)
+  for (size_t c = 0; c < numberOfChunks; c++) {
+    if (firstRowOfChunk[c] < numberInstances) {
+      parseRows(chunkBegin[c], chunkBegin[c + 1], skipAnnotationLines, numberOfColumns,
+                hasTargets, selectedCols, selectedTargets, firstRowOfChunk[c],
+                std::min(firstRowOfChunk[c + 1], numberInstances), dataset);
+    }
+  }
+
+  return dataset;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,76 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef DELIMITEDTEXTPARSER_HPP
+#define DELIMITEDTEXTPARSER_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Parser for comma-separated numerical data held in memory (e.g., a MemoryMappedFile), used
+ * by the CSV and ARFF readers.
+ *
+ * In contrast to the stream based readers, the buffer is not tokenized into strings. The data
+ * lines are split into byte ranges aligned to line breaks, which are processed in parallel in
+ * two passes: the first pass validates and counts the admissible rows of every range, the
+ * second one parses the numbers directly into the preallocated Dataset at the offsets given
+ * by the prefix sums of the row counts.
+ *
+ * The semantics (empty lines are ignored, the dimension is determined by the first data line,
+ * the target is the last column, selection of columns and targets) are the same as the ones
+ * of CSVTools::readCSV and ARFFTools::readARFF.
+ */
+class DelimitedTextParser {
+ public:
+  /**
+   * Parses a buffer.
+   *
+   * @param begin pointer to the first byte of the buffer
+   * @param end pointer past the last byte of the buffer
+   * @param skipFirstLine whether to skip the first non-empty line (e.g., a CSV header)
+   * @param skipAnnotationLines whether to skip all lines containing '%' or '@' (ARFF header
+   *        and comments)
+   * @param hasTargets whether the last column contains the targets
+   * @param instanceCutoff maximal number of instances in the returned Dataset
+   * @param selectedCols columns written to the DataMatrix (empty: all columns except the
+   *        target column)
+   * @param selectedTargets only rows with one of these targets (0.001 precision) are
+   *        included (empty: all targets are admissible)
+   * @return parsed Dataset
+   * @throws sgpp::base::file_exception if the number of columns is not consistent or
+   *         selectedCols contains invalid columns
+   */
+  static Dataset parse(const char* begin, const char* end, bool skipFirstLine,
+                       bool skipAnnotationLines, bool hasTargets, size_t instanceCutoff,
+                       const std::vector<size_t>& selectedCols,
+                       const std::vector<double>& selectedTargets);
+
+  /**
+   * Converts a field to a floating point number.
+   *
+   * Decimal numbers with at most 15 significant digits and a decimal exponent of magnitude
+   * at most 22 are converted exactly with a single floating point multiplication or
+   * division, all other fields are converted by std::strtod. Like atof, fields that do not
+   * start with a number are converted to 0.
+   *
+   * @param begin pointer to the first character of the field
+   * @param end pointer past the last character of the field
+   * @return value of the field
+   */
+  static double parseNumber(const char* begin, const char* end);
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
+
+#endif /* DELIMITEDTEXTPARSER_HPP */
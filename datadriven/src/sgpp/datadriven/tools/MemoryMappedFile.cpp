@@ -0,0 +1,81 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/tools/MemoryMappedFile.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+namespace sgpp {
+namespace datadriven {
+
+MemoryMappedFile::MemoryMappedFile(const std::string& filename)
+    : data(nullptr), length(0), mapped(false), buffer() {
+#ifndef _WIN32
+  int fd = open(filename.c_str(), O_RDONLY);
+
+  if (fd < 0) {
+    throw sgpp::base::file_exception("MemoryMappedFile: unable to open file");
+  }
+
+  struct stat fileStat;
+
+  if ((fstat(fd, &fileStat) == 0) && S_ISREG(fileStat.st_mode) && (fileStat.st_size > 0)) {
+    void* address = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ,
+                         MAP_PRIVATE, fd, 0);
+
+    if (address != MAP_FAILED) {
+      data = static_cast<const char*>(address);
+      length = static_cast<size_t>(fileStat.st_size);
+      mapped = true;
+#ifdef MADV_WILLNEED
+      // the file is parsed completely, so let the kernel read ahead aggressively
+      madvise(address, length, MADV_WILLNEED);
+#endif
+    }
+  }
+
+  close(fd);
+
+  if (mapped) {
+    return;
+  }
+#endif
+
+  readIntoBuffer(filename);
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+#ifndef _WIN32
+  if (mapped) {
+    munmap(const_cast<char*>(data), length);
+  }
+#endif
+}
+
+void MemoryMappedFile::readIntoBuffer(const std::string& filename) {
+  std::ifstream stream(filename.c_str(), std::ios::in | std::ios::binary);
+
+  if (!stream.is_open()) {
+    throw sgpp::base::file_exception("MemoryMappedFile: unable to open file");
+  }
+
+  buffer.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+  data = buffer.data();
+  length = buffer.size();
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
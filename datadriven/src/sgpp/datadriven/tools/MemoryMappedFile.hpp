@@ -0,0 +1,76 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef MEMORYMAPPEDFILE_HPP
+#define MEMORYMAPPEDFILE_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Read-only view of the contents of a file.
+ *
+ * On POSIX systems the file is mapped into memory, so the data is paged in by the operating
+ * system when it is accessed and no copy is made. If mapping is not available (e.g., on
+ * Windows or for empty files and pipes), the file is read into an internal buffer instead.
+ * The mapping is released when the object is destroyed.
+ */
+class MemoryMappedFile {
+ public:
+  /**
+   * Opens and maps a file.
+   *
+   * @param filename path of the file
+   * @throws sgpp::base::file_exception if the file cannot be opened
+   */
+  explicit MemoryMappedFile(const std::string& filename);
+
+  /**
+   * Destructor, unmaps the file.
+   */
+  ~MemoryMappedFile();
+
+  MemoryMappedFile(const MemoryMappedFile&) = delete;
+  MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+  /**
+   * @return pointer to the first byte of the file
+   */
+  inline const char* begin() const { return data; }
+
+  /**
+   * @return pointer past the last byte of the file
+   */
+  inline const char* end() const { return data + length; }
+
+  /**
+   * @return size of the file in bytes
+   */
+  inline size_t size() const { return length; }
+
+ private:
+  /// reads the whole file into buffer (fallback if mapping is not possible)
+  void readIntoBuffer(const std::string& filename);
+
+  /// pointer to the contents
+  const char* data;
+  /// size of the contents in bytes
+  size_t length;
+  /// true if data points to a memory mapping that has to be released
+  bool mapped;
+  /// contents of the file if it has not been mapped
+  std::vector<char> buffer;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
+
+#endif /* MEMORYMAPPEDFILE_HPP */
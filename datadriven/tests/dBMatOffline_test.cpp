@@ -176,6 +176,8 @@ BOOST_AUTO_TEST_CASE(testReadWriteEigen) {
   offline->store(filename);
   auto newOffline = std::unique_ptr<sgpp::datadriven::DBMatOffline>{
       sgpp::datadriven::DBMatOfflineFactory::buildFromFile(filename)};
+  // the file constructor has to read the same blocks as the factory
+  sgpp::datadriven::DBMatOfflineEigen directOffline(filename);
   std::remove(filename.c_str());
 
   /**
@@ -189,6 +191,13 @@ BOOST_AUTO_TEST_CASE(testReadWriteEigen) {
   for (size_t i = 0; i < newMatrix.getSize(); i++) {
     BOOST_CHECK_CLOSE(newMatrix[i], oldMatrix[i], 1e-4);
   }
+
+  auto& directMatrix = directOffline.getDecomposedMatrix();
+  BOOST_CHECK_EQUAL(directMatrix.getSize(), newMatrix.getSize());
+
+  for (size_t i = 0; i < directMatrix.getSize(); i++) {
+    BOOST_CHECK_EQUAL(directMatrix[i], newMatrix[i]);
+  }
 }
 
 BOOST_AUTO_TEST_CASE(testReadWriteLU) {
@@ -142,6 +142,31 @@ BOOST_AUTO_TEST_CASE(upperLevelTest) {
   BOOST_CHECK_LE(res2, 0.3);
 }
 
+BOOST_AUTO_TEST_CASE(parallelTrialsTest) {
+  // same as upperLevelTest, but learning two configurations at a time and proposing batches of
+  // two configurations in Bayesian optimization
+  std::string path("datadriven/tests/pipeline/config_hpoParallel.json");
+  sgpp::datadriven::DataMiningConfigParser parser(path);
+  sgpp::datadriven::LeastSquaresRegressionMinerFactory minfac{};
+
+  sgpp::datadriven::BoHyperparameterOptimizer bohpo(minfac.buildMiner(path),
+                                                    new FitterFactoryTester(), parser);
+  sgpp::datadriven::HarmonicaHyperparameterOptimizer harmhpo(minfac.buildMiner(path),
+                                                             new FitterFactoryTester(), parser);
+  BOOST_CHECK_EQUAL(bohpo.getNumberOfWorkers(), 1);
+  bohpo.addWorkerMiner(minfac.buildMiner(path));
+  harmhpo.addWorkerMiner(minfac.buildMiner(path));
+  // surplus miners are not used
+  harmhpo.addWorkerMiner(minfac.buildMiner(path));
+  BOOST_CHECK_EQUAL(bohpo.getNumberOfWorkers(), 2);
+  BOOST_CHECK_EQUAL(harmhpo.getNumberOfWorkers(), 2);
+
+  double res1 = bohpo.run(false);
+  double res2 = harmhpo.run(false);
+  BOOST_CHECK_LE(res1, 0.3);
+  BOOST_CHECK_LE(res2, 0.3);
+}
+
 BOOST_AUTO_TEST_CASE(harmonicaConfigs) {
   // tests the bit management, especially setParameters and addConstraint by comparing to a vector
   // of all possible bit configurations
@@ -426,6 +451,35 @@ BOOST_AUTO_TEST_CASE(fitScalesGP) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(batchProposals) {
+  // a batch must not contain the same point twice
+  std::vector<BOConfig> initialConfigs{};
+  std::mt19937 generator(42);
+
+  std::vector<int> discOptions = {};
+  std::vector<int> catOptions = {};
+  size_t nCont = 2;
+  BOConfig prototype{&discOptions, &catOptions, nCont};
+
+  for (size_t i = 0; i < 6; i++) {
+    initialConfigs.emplace_back(prototype);
+    initialConfigs[i].randomize(generator);
+    initialConfigs[i].setScore(std::pow(initialConfigs[i].getCont(0) - 0.3, 2) +
+                               std::pow(initialConfigs[i].getCont(1) - 0.6, 2));
+  }
+
+  sgpp::datadriven::BayesianOptimization bo(initialConfigs);
+  std::vector<BOConfig> batch = bo.main(prototype, 3);
+  BOOST_CHECK_EQUAL(batch.size(), 3);
+
+  DataVector scales(prototype.getNPar() + 1, 1);
+  for (size_t i = 0; i < batch.size(); i++) {
+    for (size_t j = 0; j < i; j++) {
+      BOOST_CHECK_GT(batch[i].getScaledDistance(batch[j], scales), 1e-6);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(validAcquisitionFunction) {
   // testing acquisition function for monotonicity with respect to mean and
   // variance
@@ -10,16 +10,22 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/ArffFileSampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/CSVFileSampleProvider.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/GzipFileSampleDecorator.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <zlib.h>
+
+#include <cstdio>
+#include <memory>
 #include <string>
 
 BOOST_AUTO_TEST_SUITE(dataminingGzipSampleDecoratorTest)
 
 using sgpp::datadriven::GzipFileSampleDecorator;
 using sgpp::datadriven::ArffFileSampleProvider;
+using sgpp::datadriven::CSVFileSampleProvider;
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
 using sgpp::datadriven::Dataset;
@@ -66,5 +72,86 @@ BOOST_AUTO_TEST_CASE(gzipTestReadFile) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(gzipTestStreaming) {
+  const auto datasetPath = "datadriven/datasets/liver/liver-disorders_normalized_small.arff.gz";
+
+  GzipFileSampleDecorator fullProvider(new ArffFileSampleProvider());
+  fullProvider.readFile(datasetPath, true);
+  std::unique_ptr<Dataset> expected(fullProvider.getAllSamples());
+
+  // small chunks, such that lines are split across chunks
+  GzipFileSampleDecorator sampleProvider(new ArffFileSampleProvider(), true, 37);
+  sampleProvider.readFile(datasetPath, true);
+  BOOST_CHECK_EQUAL(3, sampleProvider.getDim());
+  BOOST_CHECK_EQUAL(10, sampleProvider.getNumSamples());
+
+  for (size_t epoch = 0; epoch < 2; epoch++) {
+    size_t row = 0;
+
+    while (true) {
+      std::unique_ptr<Dataset> batch(sampleProvider.getNextSamples(3));
+
+      if (batch->getNumberInstances() == 0) {
+        break;
+      }
+
+      for (size_t i = 0; i < batch->getNumberInstances(); i++, row++) {
+        for (size_t j = 0; j < 3; j++) {
+          BOOST_CHECK_EQUAL(batch->getData().get(i, j), expected->getData().get(row, j));
+        }
+
+        BOOST_CHECK_EQUAL(batch->getTargets().get(i), expected->getTargets().get(row));
+      }
+    }
+
+    BOOST_CHECK_EQUAL(10, row);
+    sampleProvider.reset();
+  }
+
+  // cutoff and class selection
+  GzipFileSampleDecorator filteredProvider(new ArffFileSampleProvider(), true, 37);
+  filteredProvider.readFile(datasetPath, true, 4, std::vector<size_t>{2, 0},
+                            std::vector<double>{1.0});
+  std::unique_ptr<Dataset> filtered(filteredProvider.getAllSamples());
+  BOOST_CHECK_EQUAL(4, filtered->getNumberInstances());
+  BOOST_CHECK_EQUAL(2, filtered->getDimension());
+  BOOST_CHECK_EQUAL(4, filteredProvider.getNumSamples());
+
+  for (size_t i = 0; i < 4; i++) {
+    BOOST_CHECK_EQUAL(filtered->getData().get(i, 0), expected->getData().get(i + 1, 2));
+    BOOST_CHECK_EQUAL(filtered->getTargets().get(i), 1.0);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(gzipTestStreamingCSV) {
+  const std::string datasetPath = "gzipTestStreamingCSV.csv.gz";
+  gzFile file = gzopen(datasetPath.c_str(), "wb");
+  gzputs(file, "x1,x2,class\n");
+
+  for (size_t i = 0; i < 1000; i++) {
+    gzprintf(file, "%d,%d.5,%d\n", static_cast<int>(i), static_cast<int>(i), (i % 2 == 0) ? 1 : -1);
+  }
+
+  gzclose(file);
+
+  GzipFileSampleDecorator sampleProvider(new CSVFileSampleProvider(), true, 100);
+  sampleProvider.readFile(datasetPath, true);
+  BOOST_CHECK_EQUAL(1000, sampleProvider.getNumSamples());
+  size_t row = 0;
+
+  for (size_t batchIdx = 0; batchIdx < 10; batchIdx++) {
+    std::unique_ptr<Dataset> batch(sampleProvider.getNextSamples(100));
+    BOOST_CHECK_EQUAL(100, batch->getNumberInstances());
+
+    for (size_t i = 0; i < batch->getNumberInstances(); i++, row++) {
+      BOOST_CHECK_EQUAL(batch->getData().get(i, 0), static_cast<double>(row));
+      BOOST_CHECK_EQUAL(batch->getData().get(i, 1), static_cast<double>(row) + 0.5);
+      BOOST_CHECK_EQUAL(batch->getTargets().get(i), (row % 2 == 0) ? 1.0 : -1.0);
+    }
+  }
+
+  std::remove(datasetPath.c_str());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 #endif
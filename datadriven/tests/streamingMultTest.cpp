@@ -4,7 +4,6 @@
 // sgpp.sparsegrids.org
 
 #ifdef ZLIB
-#ifdef __AVX__
 
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
@@ -13,12 +12,16 @@
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 #include <sgpp/base/tools/ConfigurationParameters.hpp>
+#include <sgpp/base/tools/OperationConfiguration.hpp>
 #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreamingKernels.hpp>
 #include <sgpp/datadriven/tools/ARFFTools.hpp>
 #include <sgpp/globaldef.hpp>
 
 #include <zlib.h>
 
+#include <cmath>
 #include <fstream>
 #include <iostream>
 #include <random>
@@ -55,7 +58,104 @@ BOOST_AUTO_TEST_CASE(Simple) {
                   configuration);
 }
 
-BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_CASE(InstructionSets) {
+  // every kernel compiled into the library and supported by the CPU has to be correct
+  std::vector<std::tuple<std::string, sgpp::datadriven::StreamingInstructionSet>> instructionSets =
+      {std::make_tuple("generic", sgpp::datadriven::StreamingInstructionSet::GENERIC),
+       std::make_tuple("sse3", sgpp::datadriven::StreamingInstructionSet::SSE3),
+       std::make_tuple("avx", sgpp::datadriven::StreamingInstructionSet::AVX),
+       std::make_tuple("avx2", sgpp::datadriven::StreamingInstructionSet::AVX2),
+       std::make_tuple("avx512", sgpp::datadriven::StreamingInstructionSet::AVX512)};
+
+  for (auto& instructionSet : instructionSets) {
+    if (!sgpp::datadriven::OperationMultiEvalStreaming::isInstructionSetSupported(
+            std::get<1>(instructionSet))) {
+      continue;
+    }
+
+    sgpp::base::OperationConfiguration parameters;
+    parameters.addTextAttr("INSTRUCTION_SET", std::get<0>(instructionSet));
+
+    sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+        sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+        sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT, parameters);
+
+    BOOST_TEST_MESSAGE("instruction set: " << std::get<0>(instructionSet));
+    compareDatasets(fileNamesErrorDouble, sgpp::base::GridType::Linear, level, configuration);
+  }
+}
 
+BOOST_AUTO_TEST_CASE(UnalignedBuffers) {
+  // all buffers are offset by one double, such that they are not aligned to vector registers
+  namespace kernels = sgpp::datadriven::StreamingKernels;
+  using sgpp::datadriven::StreamingInstructionSet;
+  const size_t dims = 3;
+  const size_t numberOfDataPoints = 2 * kernels::CHUNK_DATA_POINTS_AVX512;
+  const size_t numberOfGridPoints = 4 * kernels::CHUNK_GRID_POINTS;
+  std::vector<std::tuple<std::string, StreamingInstructionSet, kernels::KernelFunction>> kernelList;
+
+#ifdef STREAMING_LINEAR_KERNEL_SSE3
+  kernelList.push_back(
+      std::make_tuple("sse3", StreamingInstructionSet::SSE3, kernels::multSSE3));
+#endif
+#ifdef STREAMING_LINEAR_KERNEL_AVX
+  kernelList.push_back(
+      std::make_tuple("avx", StreamingInstructionSet::AVX, kernels::multAVX));
+#endif
+#ifdef STREAMING_LINEAR_KERNEL_AVX2
+  kernelList.push_back(
+      std::make_tuple("avx2", StreamingInstructionSet::AVX2, kernels::multAVX2));
 #endif
+  // the IMCI kernel of the Xeon Phi requires aligned buffers
+#if defined(STREAMING_LINEAR_KERNEL_AVX512) && !defined(__MIC__)
+  kernelList.push_back(
+      std::make_tuple("avx512", StreamingInstructionSet::AVX512, kernels::multAVX512));
+#endif
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  std::vector<double> level(numberOfGridPoints * dims + 1);
+  std::vector<double> index(numberOfGridPoints * dims + 1);
+  std::vector<double> dataset(numberOfDataPoints * dims + 1);
+  std::vector<double> source(numberOfGridPoints + 1);
+
+  for (size_t i = 1; i < level.size(); i++) {
+    const unsigned int l = 1 + static_cast<unsigned int>(generator() % 3);
+    level[i] = static_cast<double>(1 << l);
+    index[i] = static_cast<double>(2 * (generator() % (1 << (l - 1))) + 1);
+  }
+
+  for (double& x : dataset) {
+    x = distribution(generator);
+  }
+
+  for (double& x : source) {
+    x = distribution(generator) - 0.5;
+  }
+
+  std::vector<double> resultReference(numberOfDataPoints + 1, 0.0);
+  kernels::multGeneric(level.data() + 1, index.data() + 1, dataset.data() + 1,
+                       source.data() + 1, resultReference.data() + 1, dims, numberOfDataPoints,
+                       0, numberOfGridPoints, 0, numberOfDataPoints);
+
+  for (auto& kernel : kernelList) {
+    if (!sgpp::datadriven::OperationMultiEvalStreaming::isInstructionSetSupported(
+            std::get<1>(kernel))) {
+      continue;
+    }
+
+    BOOST_TEST_MESSAGE("instruction set: " << std::get<0>(kernel));
+    std::vector<double> result(numberOfDataPoints + 1, 0.0);
+    std::get<2>(kernel)(level.data() + 1, index.data() + 1, dataset.data() + 1, source.data() + 1,
+                        result.data() + 1, dims, numberOfDataPoints, 0, numberOfGridPoints, 0,
+                        numberOfDataPoints);
+
+    for (size_t i = 1; i < result.size(); i++) {
+      BOOST_CHECK_SMALL(result[i] - resultReference[i], 1e-12);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 #endif
@@ -0,0 +1,113 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineBinaryFile.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <set>
+#include <string>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::datadriven::DBMatOfflineBinaryFile;
+using sgpp::datadriven::MatrixDecompositionType;
+
+BOOST_AUTO_TEST_SUITE(testDBMatOfflineBinaryFile)
+
+BOOST_AUTO_TEST_CASE(testReadWrite) {
+  const std::string fileName = "DBMatOfflineBinaryFileTest.bin";
+
+  DataMatrix lhs(7, 7);
+  DataMatrix q(7, 3);
+
+  for (size_t i = 0; i < lhs.getSize(); i++) {
+    lhs[i] = static_cast<double>(i) * 0.25 - 3.0;
+  }
+
+  for (size_t i = 0; i < q.getSize(); i++) {
+    q[i] = 1.0 / static_cast<double>(i + 1);
+  }
+
+  std::vector<size_t> permutation{6, 0, 5, 1, 4, 2, 3};
+  std::set<std::set<size_t>> interactions{{}, {0}, {1}, {0, 2}};
+
+  DBMatOfflineBinaryFile::write(fileName, MatrixDecompositionType::SMW_ortho, interactions,
+                                {DBMatOfflineBinaryFile::Block::fromMatrix(lhs),
+                                 DBMatOfflineBinaryFile::Block::fromMatrix(q),
+                                 DBMatOfflineBinaryFile::Block::fromIndices(
+                                     permutation.data(), permutation.size())});
+
+  BOOST_CHECK(DBMatOfflineBinaryFile::isBinaryFile(fileName));
+
+  {
+    DBMatOfflineBinaryFile file(fileName);
+    BOOST_CHECK(file.getDecompositionType() == MatrixDecompositionType::SMW_ortho);
+    BOOST_CHECK(file.getInteractions() == interactions);
+    BOOST_CHECK_EQUAL(file.getNumberOfBlocks(), 3);
+    BOOST_CHECK_EQUAL(file.getRows(1), 7);
+    BOOST_CHECK_EQUAL(file.getCols(1), 3);
+
+    DataMatrix readLhs;
+    DataMatrix readQ;
+    file.readMatrix(0, readLhs);
+    file.readMatrix(1, readQ);
+    BOOST_CHECK_EQUAL_COLLECTIONS(readLhs.begin(), readLhs.end(), lhs.begin(), lhs.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(readQ.begin(), readQ.end(), q.begin(), q.end());
+    BOOST_CHECK_EQUAL(file.getMatrixData(1)[4], q[4]);
+
+    std::vector<size_t> readPermutation(permutation.size());
+    file.readIndices(2, readPermutation.data(), readPermutation.size());
+    BOOST_CHECK(readPermutation == permutation);
+
+    BOOST_CHECK_THROW(file.readIndices(0, readPermutation.data(), readPermutation.size()),
+                      sgpp::base::file_exception);
+    BOOST_CHECK_THROW(file.readIndices(2, readPermutation.data(), readPermutation.size() - 1),
+                      sgpp::base::file_exception);
+  }
+
+  std::remove(fileName.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(testCorruptedFile) {
+  const std::string fileName = "DBMatOfflineBinaryFileCorrupted.bin";
+
+  DataMatrix lhs(4, 4, 1.5);
+  DBMatOfflineBinaryFile::write(fileName, MatrixDecompositionType::Chol, {},
+                                {DBMatOfflineBinaryFile::Block::fromMatrix(lhs)});
+
+  BOOST_CHECK(DBMatOfflineBinaryFile(fileName).getInteractions().empty());
+
+  // overwrite the last byte of the matrix (which ends the file, since 4 * 4 * 8 bytes are aligned)
+  {
+    std::fstream stream(fileName, std::ios::in | std::ios::out | std::ios::binary);
+    stream.seekp(-1, std::ios::end);
+    stream.put('\x7f');
+  }
+
+  {
+    DBMatOfflineBinaryFile file(fileName);
+    DataMatrix readLhs;
+    BOOST_CHECK_THROW(file.readMatrix(0, readLhs), sgpp::base::file_exception);
+  }
+
+  // legacy files are not recognized as binary files
+  {
+    std::ofstream stream(fileName);
+    stream << "4,4,2,0\n";
+  }
+
+  BOOST_CHECK(!DBMatOfflineBinaryFile::isBinaryFile(fileName));
+  BOOST_CHECK_THROW(DBMatOfflineBinaryFile{fileName}, sgpp::base::file_exception);
+
+  std::remove(fileName.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,111 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+
+#ifdef USE_GSL
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineChol.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOnlineDE.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOnlineDEFactory.hpp>
+#include <sgpp/datadriven/algorithm/GridFactory.hpp>
+#include <sgpp/datadriven/configuration/DensityEstimationConfiguration.hpp>
+#include <sgpp/datadriven/configuration/RegularizationConfiguration.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <memory>
+#include <random>
+#include <set>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(DBMatOnlineDEMultipleRHS_tests)
+
+BOOST_AUTO_TEST_CASE(multipleRHS_chol) {
+  sgpp::base::RegularGridConfiguration gridConfig;
+  gridConfig.dim_ = 2;
+  gridConfig.level_ = 3;
+  gridConfig.type_ = sgpp::base::GridType::Linear;
+
+  sgpp::datadriven::RegularizationConfiguration regularizationConfig;
+  regularizationConfig.type_ = sgpp::datadriven::RegularizationType::Identity;
+  regularizationConfig.lambda_ = 0.001;
+
+  sgpp::datadriven::DensityEstimationConfiguration densityEstimationConfig;
+  densityEstimationConfig.decomposition_ = sgpp::datadriven::MatrixDecompositionType::Chol;
+
+  sgpp::datadriven::GridFactory gridFactory;
+  std::unique_ptr<sgpp::base::Grid> grid = std::unique_ptr<sgpp::base::Grid>{
+      gridFactory.createGrid(gridConfig, std::set<std::set<size_t>>())};
+
+  sgpp::datadriven::DBMatOfflineChol offline;
+  offline.buildMatrix(grid.get(), regularizationConfig);
+  offline.decomposeMatrix(regularizationConfig, densityEstimationConfig);
+
+  std::unique_ptr<sgpp::datadriven::DBMatOnlineDE> online{
+      sgpp::datadriven::DBMatOnlineDEFactory::buildDBMatOnlineDE(
+          offline, *grid, regularizationConfig.lambda_, 0.0,
+          densityEstimationConfig.decomposition_)};
+
+  // three batches of different sizes (one per density function), the last one is empty
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  std::vector<sgpp::base::DataMatrix> data;
+  const size_t batchSizes[] = {50, 20, 0};
+
+  for (size_t batchSize : batchSizes) {
+    data.emplace_back(batchSize, gridConfig.dim_);
+
+    for (size_t i = 0; i < data.back().getSize(); i++) {
+      data.back()[i] = distribution(generator);
+    }
+  }
+
+  std::vector<sgpp::base::DataMatrix*> batches;
+
+  for (sgpp::base::DataMatrix& batch : data) {
+    batches.push_back(&batch);
+  }
+
+  sgpp::base::DataMatrix alphas;
+  online->computeDensityFunctions(alphas, batches, *grid, densityEstimationConfig);
+  BOOST_REQUIRE_EQUAL(alphas.getNrows(), grid->getSize());
+  BOOST_REQUIRE_EQUAL(alphas.getNcols(), batches.size());
+
+  // compare to one solve per batch
+  for (size_t j = 0; j < batches.size(); j++) {
+    sgpp::base::DataVector alpha(grid->getSize(), 0.0);
+
+    if (batches[j]->getNrows() > 0) {
+      online->computeDensityFunction(alpha, *batches[j], *grid, densityEstimationConfig);
+    }
+
+    for (size_t i = 0; i < grid->getSize(); i++) {
+      BOOST_CHECK_SMALL(alphas.get(i, j) - alpha[i], 1e-10);
+    }
+  }
+
+  // batched evaluation
+  sgpp::base::DataMatrix results;
+  online->eval(alphas, data[0], results, *grid);
+  BOOST_REQUIRE_EQUAL(results.getNrows(), data[0].getNrows());
+  BOOST_REQUIRE_EQUAL(results.getNcols(), batches.size());
+
+  for (size_t j = 0; j < batches.size(); j++) {
+    sgpp::base::DataVector alpha(grid->getSize());
+    sgpp::base::DataVector result(data[0].getNrows());
+    alphas.getColumn(j, alpha);
+    online->eval(alpha, data[0], result, *grid);
+
+    for (size_t i = 0; i < data[0].getNrows(); i++) {
+      BOOST_CHECK_SMALL(results.get(i, j) - result[i], 1e-10);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif /* USE_GSL */
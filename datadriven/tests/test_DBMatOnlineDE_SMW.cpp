@@ -0,0 +1,130 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+
+#ifdef USE_GSL
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineChol.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOnlineDE.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOnlineDEFactory.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOnlineDE_SMW.hpp>
+#include <sgpp/datadriven/algorithm/GridFactory.hpp>
+#include <sgpp/datadriven/configuration/DensityEstimationConfiguration.hpp>
+#include <sgpp/datadriven/configuration/RegularizationConfiguration.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <memory>
+#include <set>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(DBMatOnlineDE_SMW_tests)
+
+BOOST_AUTO_TEST_CASE(low_rank_refinement) {
+  sgpp::base::RegularGridConfiguration gridConfig;
+  gridConfig.dim_ = 2;
+  gridConfig.level_ = 3;
+  gridConfig.type_ = sgpp::base::GridType::Linear;
+
+  sgpp::datadriven::RegularizationConfiguration regularizationConfig;
+  regularizationConfig.type_ = sgpp::datadriven::RegularizationType::Identity;
+  regularizationConfig.lambda_ = 0.0001;
+
+  sgpp::datadriven::DensityEstimationConfiguration densityEstimationConfig;
+  densityEstimationConfig.decomposition_ = sgpp::datadriven::MatrixDecompositionType::SMW_chol;
+
+  sgpp::datadriven::GridFactory gridFactory;
+  std::unique_ptr<sgpp::base::Grid> grid = std::unique_ptr<sgpp::base::Grid>{
+      gridFactory.createGrid(gridConfig, std::set<std::set<size_t>>())};
+
+  sgpp::datadriven::DBMatOfflineChol offline;
+  offline.buildMatrix(grid.get(), regularizationConfig);
+  offline.decomposeMatrix(regularizationConfig, densityEstimationConfig);
+  offline.compute_inverse();
+
+  // lhs matrix (including lambda) of one level more, its first points are those of grid
+  gridConfig.level_++;
+  std::unique_ptr<sgpp::base::Grid> gridSource = std::unique_ptr<sgpp::base::Grid>{
+      gridFactory.createGrid(gridConfig, std::set<std::set<size_t>>())};
+  sgpp::datadriven::DBMatOfflineChol offlineSource;
+  offlineSource.buildMatrix(gridSource.get(), regularizationConfig);
+  sgpp::base::DataMatrix& lhsSource = offlineSource.getLhsMatrix_ONLY_FOR_TESTING();
+
+  // the first object keeps the corrections in factored form, the second one merges every update
+  std::vector<std::unique_ptr<sgpp::datadriven::DBMatOnlineDE>> onlineParents;
+  std::vector<sgpp::datadriven::DBMatOnlineDE_SMW*> online;
+
+  for (size_t k = 0; k < 2; k++) {
+    onlineParents.emplace_back(sgpp::datadriven::DBMatOnlineDEFactory::buildDBMatOnlineDE(
+        offline, *grid, regularizationConfig.lambda_, 0.0, densityEstimationConfig.decomposition_));
+    online.push_back(static_cast<sgpp::datadriven::DBMatOnlineDE_SMW*>(&*onlineParents.back()));
+  }
+
+  online[1]->setLowRankThreshold(0);
+
+  // refine point by point
+  const size_t oldSize = grid->getSize();
+  const size_t newSize = oldSize + 4;
+
+  for (size_t currentSize = oldSize; currentSize < newSize; currentSize++) {
+    const size_t size = currentSize + 1;
+    const size_t newPoints = 1;
+
+    for (sgpp::datadriven::DBMatOnlineDE_SMW* onlineSMW : online) {
+      sgpp::base::DataMatrix X(size, newPoints);
+
+      for (size_t i = 0; i < size; i++) {
+        for (size_t j = 0; j < newPoints; j++) {
+          X.set(i, j, lhsSource.get(i, currentSize + j));
+        }
+      }
+
+      onlineSMW->smw_adapt(X, newPoints, true);
+    }
+  }
+
+  BOOST_CHECK_GT(online[0]->getLowRankCorrectionRank(), 0);
+  BOOST_CHECK_EQUAL(online[1]->getLowRankCorrectionRank(), 0);
+  BOOST_CHECK_EQUAL(online[0]->getBSize(), newSize);
+
+  const sgpp::base::DataMatrix& BLowRank = online[0]->getB();
+  const sgpp::base::DataMatrix& BDense = online[1]->getB();
+  BOOST_CHECK_EQUAL(online[0]->getLowRankCorrectionRank(), 0);
+  BOOST_REQUIRE_EQUAL(BLowRank.getNcols(), newSize);
+  BOOST_REQUIRE_EQUAL(BDense.getNcols(), newSize);
+
+  for (size_t i = 0; i < newSize; i++) {
+    for (size_t j = 0; j < newSize; j++) {
+      BOOST_CHECK_SMALL(BLowRank.get(i, j) - BDense.get(i, j), 1e-8);
+    }
+  }
+
+  // A^-1 + B has to be the inverse of the refined lhs matrix
+  sgpp::base::DataMatrix& lhsInverse = offline.getInverseMatrix();
+
+  for (size_t i = 0; i < newSize; i++) {
+    for (size_t j = 0; j < newSize; j++) {
+      double value = 0.0;
+
+      for (size_t k = 0; k < newSize; k++) {
+        double inverse = BLowRank.get(i, k);
+
+        if ((i < oldSize) && (k < oldSize)) {
+          inverse += lhsInverse.get(i, k);
+        }
+
+        value += inverse * lhsSource.get(k, j);
+      }
+
+      BOOST_CHECK_SMALL(value - ((i == j) ? 1.0 : 0.0), 1e-6);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif /* USE_GSL */
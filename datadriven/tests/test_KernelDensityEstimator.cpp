@@ -0,0 +1,66 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/datadriven/application/KernelDensityEstimator.hpp>
+
+#include <cmath>
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::BandwidthOptimizationType;
+using sgpp::datadriven::KernelDensityEstimator;
+using sgpp::datadriven::KernelType;
+
+BOOST_AUTO_TEST_SUITE(testKernelDensityEstimator)
+
+BOOST_AUTO_TEST_CASE(testTreeEvaluation) {
+  const size_t numSamples = 5000;
+  const size_t numPoints = 200;
+  const size_t numDims = 3;
+  const double tolerance = 1e-3;
+
+  std::mt19937 generator(42);
+  std::normal_distribution<double> normal(0.0, 1.0);
+  std::uniform_real_distribution<double> uniform(-3.0, 3.0);
+
+  DataMatrix samples(numSamples, numDims);
+  DataMatrix points(numPoints, numDims);
+
+  for (size_t i = 0; i < samples.getSize(); i++) {
+    samples[i] = normal(generator);
+  }
+
+  for (size_t i = 0; i < points.getSize(); i++) {
+    points[i] = uniform(generator);
+  }
+
+  for (KernelType kernelType : {KernelType::GAUSSIAN, KernelType::EPANECHNIKOV}) {
+    KernelDensityEstimator kde(samples, kernelType, BandwidthOptimizationType::SILVERMANSRULE);
+    DataVector exact;
+    kde.pdf(points, exact);
+
+    kde.setEvaluationTolerance(tolerance);
+    DataVector approximate;
+    kde.pdf(points, approximate);
+
+    for (size_t i = 0; i < numPoints; i++) {
+      BOOST_CHECK_LE(std::abs(approximate[i] - exact[i]), tolerance * exact[i] + 1e-300);
+    }
+
+    // single point evaluation and copies use the tree as well
+    KernelDensityEstimator copy(kde);
+    DataVector x(numDims);
+    points.getRow(0, x);
+    BOOST_CHECK_EQUAL(copy.pdf(x), approximate[0]);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -175,4 +175,26 @@ BOOST_AUTO_TEST_CASE(test_read_arff_old) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(test_mappedread) {
+  std::string fileName = "datadriven/datasets/dataread/simple.arff";
+  std::vector<size_t> cols = {4, 0, 2};
+  std::vector<double> classes = {7.0, -5.0};
+
+  for (size_t cutoff : {static_cast<size_t>(-1), static_cast<size_t>(2)}) {
+    Dataset expected = ARFFTools::readARFFFromFile(fileName, true, cutoff, cols, classes);
+    Dataset d = ARFFTools::readARFFFromMappedFile(fileName, true, cutoff, cols, classes);
+    BOOST_CHECK_EQUAL(d.getNumberInstances(), expected.getNumberInstances());
+    BOOST_CHECK_EQUAL(d.getDimension(), expected.getDimension());
+    expected.getData().sub(d.getData());
+    expected.getTargets().sub(d.getTargets());
+    BOOST_CHECK_EQUAL(expected.getData().max(), 0.0);
+    BOOST_CHECK_EQUAL(expected.getData().min(), 0.0);
+    BOOST_CHECK_EQUAL(expected.getTargets().l2Norm(), 0.0);
+  }
+
+  Dataset d = ARFFTools::readARFFFromMappedFile(fileName, false);
+  BOOST_CHECK_EQUAL(d.getNumberInstances(), 5);
+  BOOST_CHECK_EQUAL(d.getDimension(), 6);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
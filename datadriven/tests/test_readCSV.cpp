@@ -11,7 +11,14 @@
 
 #include <sgpp/datadriven/tools/Dataset.hpp>
 #include <sgpp/datadriven/tools/CSVTools.hpp>
-
+#include <sgpp/datadriven/tools/DelimitedTextParser.hpp>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <random>
 #include <string>
 #include <iostream>
 #include <vector>
@@ -20,6 +27,7 @@ using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
 using sgpp::datadriven::Dataset;
 using sgpp::datadriven::CSVTools;
+using sgpp::datadriven::DelimitedTextParser;
 
 
 BOOST_AUTO_TEST_SUITE(test_dataread_csv)
@@ -175,4 +183,73 @@ BOOST_AUTO_TEST_CASE(test_read_csv_old) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(test_mappedread) {
+  std::string fileName = "datadriven/datasets/dataread/simple.csv";
+  std::vector<size_t> cols = {4, 0, 2};
+  std::vector<double> classes = {7.0, -5.0};
+
+  for (size_t cutoff : {static_cast<size_t>(-1), static_cast<size_t>(2)}) {
+    Dataset expected = CSVTools::readCSVFromFile(fileName, true, true, cutoff, cols, classes);
+    Dataset d = CSVTools::readCSVFromMappedFile(fileName, true, true, cutoff, cols, classes);
+    BOOST_CHECK_EQUAL(d.getNumberInstances(), expected.getNumberInstances());
+    BOOST_CHECK_EQUAL(d.getDimension(), expected.getDimension());
+    expected.getData().sub(d.getData());
+    expected.getTargets().sub(d.getTargets());
+    BOOST_CHECK_EQUAL(expected.getData().max(), 0.0);
+    BOOST_CHECK_EQUAL(expected.getData().min(), 0.0);
+    BOOST_CHECK_EQUAL(expected.getTargets().l2Norm(), 0.0);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_mappedread_large) {
+  // large enough to be split into several ranges that are parsed in parallel
+  std::string fileName = "test_mappedread_large.csv";
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-1e3, 1e3);
+  std::ofstream output(fileName.c_str());
+  output << "x1,x2,x3,x4,cl\r\n";
+
+  for (size_t i = 0; i < 20000; i++) {
+    for (size_t j = 0; j < 4; j++) {
+      output << std::setprecision(3 + (i + j) % 15) << distribution(generator) << ",";
+    }
+
+    output << ((i % 3 == 0) ? "1" : "-1") << ((i % 2 == 0) ? "\r\n" : "\n");
+  }
+
+  output.close();
+
+  Dataset expected = CSVTools::readCSVFromFile(fileName, true, true);
+  Dataset d = CSVTools::readCSVFromMappedFile(fileName, true, true);
+  Dataset filtered = CSVTools::readCSVFromMappedFile(fileName, true, true, -1,
+                                                     std::vector<size_t>(), {1.0});
+  std::remove(fileName.c_str());
+
+  BOOST_CHECK_EQUAL(d.getNumberInstances(), 20000);
+  BOOST_CHECK_EQUAL(d.getDimension(), 4);
+  BOOST_CHECK_EQUAL(filtered.getNumberInstances(), 6667);
+  expected.getData().sub(d.getData());
+  expected.getTargets().sub(d.getTargets());
+  BOOST_CHECK_EQUAL(expected.getData().max(), 0.0);
+  BOOST_CHECK_EQUAL(expected.getData().min(), 0.0);
+  BOOST_CHECK_EQUAL(expected.getTargets().l2Norm(), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(test_parse_number) {
+  std::vector<std::string> fields = {"0",      "-0.0",     " 42.42 ", "7e-01", "-7E+2", ".5",
+                                     "1.",     "1e300",    "123456789012345678", "4.9e-324",
+                                     "0.1e-30", "nan",     "abc",     "",      "1e",   "3.14x"};
+
+  for (const std::string& field : fields) {
+    double expected = std::atof(field.c_str());
+    double value = DelimitedTextParser::parseNumber(field.data(), field.data() + field.size());
+
+    if (std::isnan(expected)) {
+      BOOST_CHECK(std::isnan(value));
+    } else {
+      BOOST_CHECK_EQUAL(value, expected);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
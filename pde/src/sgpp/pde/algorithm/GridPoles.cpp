@@ -0,0 +1,123 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/pde/algorithm/GridPoles.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+GridPoles::GridPoles(sgpp::base::GridStorage& storage, const std::vector<size_t>& dims)
+    : poles(storage.getDimension()),
+      gridSize(storage.getSize()),
+      modificationCount(storage.getModificationCount()),
+      maxPoleLength(0),
+      covering(true) {
+  for (size_t dim : dims) {
+    Poles& dimPoles = poles[dim];
+    dimPoles.poleOffsets.push_back(0);
+
+    if (gridSize > 0) {
+      std::vector<size_t> dimList;
+
+      for (size_t i = 0; i < storage.getDimension(); i++) {
+        if (i != dim) {
+          dimList.push_back(i);
+        }
+      }
+
+      grid_iterator index(storage);
+      collectPoles(storage, index, dimList, dimList.size(), dim, dimPoles);
+    }
+
+    // group consecutive poles to chunks of at least MIN_CHUNK_SIZE nodes
+    dimPoles.chunkOffsets.push_back(0);
+
+    for (size_t p = 0; p < dimPoles.getNumberOfPoles(); p++) {
+      const size_t poleLength = dimPoles.poleOffsets[p + 1] - dimPoles.poleOffsets[p];
+      maxPoleLength = std::max(maxPoleLength, poleLength);
+
+      if (dimPoles.poleOffsets[p + 1] - dimPoles.poleOffsets[dimPoles.chunkOffsets.back()] >=
+          MIN_CHUNK_SIZE) {
+        dimPoles.chunkOffsets.push_back(p + 1);
+      }
+    }
+
+    if (dimPoles.chunkOffsets.back() != dimPoles.getNumberOfPoles()) {
+      dimPoles.chunkOffsets.push_back(dimPoles.getNumberOfPoles());
+    }
+
+    covering = covering && (dimPoles.seq.size() == gridSize);
+  }
+}
+
+GridPoles::~GridPoles() {}
+
+void GridPoles::collectPoles(sgpp::base::GridStorage& storage, grid_iterator& index,
+                             const std::vector<size_t>& dimList, size_t dimRem, size_t dim,
+                             Poles& dimPoles) {
+  const size_t poleBegin = dimPoles.seq.size();
+  addNodes(storage, index, dim, poleBegin, 0, false, dimPoles);
+  dimPoles.poleOffsets.push_back(dimPoles.seq.size());
+
+  // dimension recursion unrolled
+  for (size_t d = 0; d < dimRem; d++) {
+    const size_t currentDim = dimList[d];
+
+    if (index.hint()) {
+      continue;
+    }
+
+    index.leftChild(currentDim);
+
+    if (!storage.isInvalidSequenceNumber(index.seq())) {
+      collectPoles(storage, index, dimList, d + 1, dim, dimPoles);
+    }
+
+    index.stepRight(currentDim);
+
+    if (!storage.isInvalidSequenceNumber(index.seq())) {
+      collectPoles(storage, index, dimList, d + 1, dim, dimPoles);
+    }
+
+    index.up(currentDim);
+  }
+}
+
+void GridPoles::addNodes(sgpp::base::GridStorage& storage, grid_iterator& index, size_t dim,
+                         size_t poleBegin, size_t parent, bool isRightChild, Poles& dimPoles) {
+  sgpp::base::level_t l;
+  sgpp::base::index_t i;
+  index.get(dim, l, i);
+
+  const size_t position = dimPoles.seq.size() - poleBegin;
+  dimPoles.seq.push_back(index.seq());
+  dimPoles.level.push_back(l);
+  dimPoles.parent.push_back(parent);
+  dimPoles.isRightChild.push_back(isRightChild ? 1 : 0);
+
+  if (!index.hint()) {
+    index.leftChild(dim);
+
+    if (!storage.isInvalidSequenceNumber(index.seq())) {
+      addNodes(storage, index, dim, poleBegin, position, false, dimPoles);
+    }
+
+    index.stepRight(dim);
+
+    if (!storage.isInvalidSequenceNumber(index.seq())) {
+      addNodes(storage, index, dim, poleBegin, position, true, dimPoles);
+    }
+
+    index.up(dim);
+  }
+}
+
+}  // namespace pde
+}  // namespace sgpp
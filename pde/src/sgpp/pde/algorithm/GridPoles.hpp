@@ -0,0 +1,132 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef GRIDPOLES_HPP
+#define GRIDPOLES_HPP
+
+#include <sgpp/base/grid/GridStorage.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+/**
+ * One-dimensional structure of a sparse grid without boundary points.
+ *
+ * For every given dimension, the grid points are partitioned into poles, i.e., sets of
+ * points that only differ in this dimension. Each pole is a binary tree (rooted at the point
+ * with level 1) that is stored contiguously in pre-order, such that parents precede their
+ * children. For every node, the sequence number of the grid point, its level, and the position
+ * of its parent within the pole are stored, so one-dimensional operators can traverse the poles
+ * without hash lookups.
+ *
+ * The poles are collected in the same way as sgpp::base::sweep::sweep1D traverses the grid,
+ * i.e., points that are not reachable from the root via existing children are not contained.
+ */
+class GridPoles {
+ public:
+  /**
+   * Poles of one dimension.
+   */
+  struct Poles {
+    /// position of the first node of every pole (and the total number of nodes at the end)
+    std::vector<size_t> poleOffsets;
+    /// first pole of every chunk of poles with a similar number of nodes (and the number of
+    /// poles at the end), used for load balancing
+    std::vector<size_t> chunkOffsets;
+    /// sequence number of the grid point of every node
+    std::vector<size_t> seq;
+    /// level of every node in this dimension
+    std::vector<sgpp::base::level_t> level;
+    /// position of the parent within the pole (undefined for the root at position 0)
+    std::vector<size_t> parent;
+    /// whether the node is the right child of its parent
+    std::vector<unsigned char> isRightChild;
+
+    /**
+     * @return number of poles
+     */
+    size_t getNumberOfPoles() const { return poleOffsets.size() - 1; }
+  };
+
+  /**
+   * Constructor, collects the poles of the given dimensions.
+   *
+   * @param storage the grid's sgpp::base::GridStorage object
+   * @param dims dimensions for which the poles are collected (e.g., the algorithmic ones)
+   */
+  GridPoles(sgpp::base::GridStorage& storage, const std::vector<size_t>& dims);
+
+  /**
+   * Destructor
+   */
+  ~GridPoles();
+
+  /**
+   * @param dim dimension (has to be one of the dimensions given to the constructor)
+   * @return poles of the dimension
+   */
+  const Poles& getPoles(size_t dim) const { return poles[dim]; }
+
+  /**
+   * @return number of grid points at the time of construction
+   */
+  size_t getGridSize() const { return gridSize; }
+
+  /**
+   * @return modification count of the storage at the time of construction
+   * (see sgpp::base::GridStorage::getModificationCount)
+   */
+  size_t getModificationCount() const { return modificationCount; }
+
+  /**
+   * @return maximal number of nodes of a pole
+   */
+  size_t getMaxPoleLength() const { return maxPoleLength; }
+
+  /**
+   * @return whether every grid point is contained in the poles of every algorithmic dimension
+   */
+  bool coversGrid() const { return covering; }
+
+ private:
+  typedef sgpp::base::GridStorage::grid_iterator grid_iterator;
+
+  /// minimal number of nodes of a chunk of poles
+  static const size_t MIN_CHUNK_SIZE = 1024;
+
+  /**
+   * Descends on all dimensions beside dim (see sgpp::base::sweep::sweep_rec) and adds the
+   * pole of every visited point.
+   */
+  void collectPoles(sgpp::base::GridStorage& storage, grid_iterator& index,
+                    const std::vector<size_t>& dimList, size_t dimRem, size_t dim,
+                    Poles& dimPoles);
+
+  /**
+   * Adds the subtree of the current point in dimension dim to the current pole in pre-order.
+   */
+  void addNodes(sgpp::base::GridStorage& storage, grid_iterator& index, size_t dim,
+                size_t poleBegin, size_t parent, bool isRightChild, Poles& dimPoles);
+
+  /// poles of every dimension (empty for dimensions that were not given)
+  std::vector<Poles> poles;
+  /// number of grid points
+  size_t gridSize;
+  /// modification count of the storage
+  size_t modificationCount;
+  /// maximal number of nodes of a pole
+  size_t maxPoleLength;
+  /// whether every grid point is contained in the poles
+  bool covering;
+};
+
+}  // namespace pde
+}  // namespace sgpp
+
+#endif /* GRIDPOLES_HPP */
@@ -11,14 +11,11 @@
 
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 
-#ifdef _OPENMP
-#include <omp.h>
-#endif
-
 #include <sgpp/globaldef.hpp>
 
-#include <vector>
+#include <algorithm>
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace pde {
@@ -88,45 +85,8 @@ void HeatEquationParabolicPDESolverSystemParallelOMP::applyMassMatrixComplete(
 
 void HeatEquationParabolicPDESolverSystemParallelOMP::applyLOperatorComplete(
     sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
-  result.setAll(0.0);
-
-  sgpp::base::DataVector temp(alpha.getSize());
-
-  std::vector<size_t> algoDims = this->InnerGrid->getStorage().getAlgorithmicDimensions();
-  size_t nDims = algoDims.size();
-#ifdef _OPENMP
-  omp_lock_t Mutex;
-  omp_init_lock(&Mutex);
-#endif
-
-  // Apply Laplace, parallel in Dimensions
-  for (size_t i = 0; i < nDims; i++) {
-#pragma omp task firstprivate(i) shared(alpha, temp, result, algoDims)
-    {
-      sgpp::base::DataVector myResult(result.getSize());
-
-      /// discuss methods in order to avoid this cast
-      reinterpret_cast<UpDownOneOpDim*>(this->OpLaplaceBound)
-          ->multParallelBuildingBlock(alpha, myResult, algoDims[i]);
-
-// semaphore
-#ifdef _OPENMP
-      omp_set_lock(&Mutex);
-#endif
-      temp.add(myResult);
-#ifdef _OPENMP
-      omp_unset_lock(&Mutex);
-#endif
-    }
-  }
-
-#pragma omp taskwait
-
-#ifdef _OPENMP
-  omp_destroy_lock(&Mutex);
-#endif
-
-  result.axpy((-1.0) * this->a, temp);
+  applyDimensionwiseOperator(this->OpLaplaceBound, alpha, result, (-1.0) * this->a,
+                             this->laplaceResultsComplete);
 }
 
 void HeatEquationParabolicPDESolverSystemParallelOMP::applyMassMatrixInner(
@@ -142,45 +102,66 @@ void HeatEquationParabolicPDESolverSystemParallelOMP::applyMassMatrixInner(
 
 void HeatEquationParabolicPDESolverSystemParallelOMP::applyLOperatorInner(
     sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
-  result.setAll(0.0);
-
-  sgpp::base::DataVector temp(alpha.getSize());
+  applyDimensionwiseOperator(this->OpLaplaceInner, alpha, result, (-1.0) * this->a,
+                             this->laplaceResultsInner);
+}
 
+void HeatEquationParabolicPDESolverSystemParallelOMP::applyDimensionwiseOperator(
+    sgpp::base::OperationMatrix* op, sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+    double factor, std::vector<sgpp::base::DataVector>& dimResults) {
   std::vector<size_t> algoDims = this->InnerGrid->getStorage().getAlgorithmicDimensions();
   size_t nDims = algoDims.size();
-#ifdef _OPENMP
-  omp_lock_t Mutex;
-  omp_init_lock(&Mutex);
-#endif
+  size_t size = result.getSize();
+
+  // the buffers are only reallocated if the grid has changed
+  if (dimResults.size() != nDims) {
+    dimResults.resize(nDims);
+  }
 
-  // Apply Laplace, parallel in Dimensions
   for (size_t i = 0; i < nDims; i++) {
-#pragma omp task firstprivate(i) shared(alpha, temp, result, algoDims)
-    {
-      sgpp::base::DataVector myResult(result.getSize());
+    if (dimResults[i].getSize() != size) {
+      dimResults[i] = sgpp::base::DataVector(size);
+    }
+  }
 
+  // Apply operator, parallel in Dimensions
+  for (size_t i = 0; i < nDims; i++) {
+#pragma omp task firstprivate(i) shared(alpha, dimResults, algoDims)
+    {
       /// discuss methods in order to avoid this cast
-      reinterpret_cast<UpDownOneOpDim*>(this->OpLaplaceInner)
-          ->multParallelBuildingBlock(alpha, myResult, algoDims[i]);
-
-// semaphore
-#ifdef _OPENMP
-      omp_set_lock(&Mutex);
-#endif
-      temp.add(myResult);
-#ifdef _OPENMP
-      omp_unset_lock(&Mutex);
-#endif
+      reinterpret_cast<UpDownOneOpDim*>(op)->multParallelBuildingBlock(alpha, dimResults[i],
+                                                                        algoDims[i]);
     }
   }
 
 #pragma omp taskwait
 
-#ifdef _OPENMP
-  omp_destroy_lock(&Mutex);
-#endif
+  // Sum up the results of all dimensions, parallel in disjoint blocks of coefficients
+  for (size_t blockStart = 0; blockStart < size; blockStart += accumulationBlockSize) {
+#pragma omp task firstprivate(blockStart) shared(result, dimResults)
+    {
+      size_t blockEnd = std::min(blockStart + accumulationBlockSize, size);
+      double* resultData = result.getPointer();
 
-  result.axpy((-1.0) * this->a, temp);
+      for (size_t j = blockStart; j < blockEnd; j++) {
+        resultData[j] = 0.0;
+      }
+
+      for (size_t i = 0; i < nDims; i++) {
+        const double* dimData = dimResults[i].getPointer();
+
+        for (size_t j = blockStart; j < blockEnd; j++) {
+          resultData[j] += dimData[j];
+        }
+      }
+
+      for (size_t j = blockStart; j < blockEnd; j++) {
+        resultData[j] *= factor;
+      }
+    }
+  }
+
+#pragma omp taskwait
 }
 
 void HeatEquationParabolicPDESolverSystemParallelOMP::finishTimestep() {
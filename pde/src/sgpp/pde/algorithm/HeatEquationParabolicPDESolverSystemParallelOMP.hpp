@@ -13,6 +13,7 @@
 #include <sgpp/globaldef.hpp>
 
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace pde {
@@ -34,6 +35,27 @@ class HeatEquationParabolicPDESolverSystemParallelOMP
   sgpp::base::OperationMatrix* OpLaplaceInner;
   /// the LTwoDotProduct Operation (Mass Matrix), on inner grid
   sgpp::base::OperationMatrix* OpMassInner;
+  /// per-dimension results of the Laplace operator on the boundary grid, reused between calls
+  std::vector<sgpp::base::DataVector> laplaceResultsComplete;
+  /// per-dimension results of the Laplace operator on the inner grid, reused between calls
+  std::vector<sgpp::base::DataVector> laplaceResultsInner;
+  /// number of coefficients summed up by one task when accumulating the per-dimension results
+  static const size_t accumulationBlockSize = 4096;
+
+  /**
+   * Applies a dimension-wise operator in parallel. Each dimension is handled by a task writing
+   * into its own buffer, afterwards the buffers are summed up blockwise (each task owns a
+   * disjoint block of coefficients), so no locking is needed.
+   *
+   * @param op the UpDownOneOpDim operator
+   * @param alpha the coefficients the operator is applied to
+   * @param result result of the operator, scaled with factor
+   * @param factor scaling factor of the result
+   * @param dimResults buffers for the per-dimension results, resized if necessary
+   */
+  void applyDimensionwiseOperator(sgpp::base::OperationMatrix* op, sgpp::base::DataVector& alpha,
+                                  sgpp::base::DataVector& result, double factor,
+                                  std::vector<sgpp::base::DataVector>& dimResults);
 
   void applyMassMatrixComplete(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
 
@@ -0,0 +1,55 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef POLEOPERATOR1D_HPP
+#define POLEOPERATOR1D_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/pde/algorithm/GridPoles.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace pde {
+
+/**
+ * One-dimensional operator (e.g., the up or down part of a bilinear form) that is applied to
+ * the poles of a grid (see GridPoles) instead of traversing the grid with a grid_iterator.
+ * Implementations must not depend on the order in which the poles are processed, as
+ * UpDownPoleSweep calls them concurrently for disjoint ranges of poles.
+ */
+class PoleOperator1D {
+ public:
+  /**
+   * Destructor
+   */
+  virtual ~PoleOperator1D() {}
+
+  /**
+   * Applies the operator to a range of poles. Every grid point of these poles has to be
+   * written to result.
+   *
+   * @param poles poles of the dimension dim
+   * @param firstPole first pole of the range
+   * @param lastPole end of the range (exclusive)
+   * @param dim dimension in which the operator is applied
+   * @param source coefficients of the grid points
+   * @param result vector to store the results in
+   * @param workspace scratch memory of getWorkspaceSize() doubles per node of the longest pole
+   */
+  virtual void operator()(const GridPoles::Poles& poles, size_t firstPole, size_t lastPole,
+                          size_t dim, const sgpp::base::DataVector& source,
+                          sgpp::base::DataVector& result, double* workspace) const = 0;
+
+  /**
+   * @return number of doubles of scratch memory that are needed per node of a pole
+   */
+  virtual size_t getWorkspaceSize() const { return 0; }
+};
+
+}  // namespace pde
+}  // namespace sgpp
+
+#endif /* POLEOPERATOR1D_HPP */
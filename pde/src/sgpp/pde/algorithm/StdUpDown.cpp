@@ -13,11 +13,17 @@ namespace pde {
 StdUpDown::StdUpDown(sgpp::base::GridStorage* storage)
     : storage(storage),
       algoDims(storage->getAlgorithmicDimensions()),
-      numAlgoDims_(storage->getAlgorithmicDimensions().size()) {}
+      numAlgoDims_(storage->getAlgorithmicDimensions().size()),
+      poleSweep() {}
 
 StdUpDown::~StdUpDown() {}
 
 void StdUpDown::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
+  if (this->poleSweep != nullptr) {
+    this->poleSweep->updown(alpha, result);
+    return;
+  }
+
   sgpp::base::DataVector beta(result.getSize());
   result.setAll(0.0);
 #pragma omp parallel
@@ -30,6 +36,11 @@ void StdUpDown::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& resu
 
 void StdUpDown::multParallelBuildingBlock(sgpp::base::DataVector& alpha,
                                           sgpp::base::DataVector& result) {
+  if (this->poleSweep != nullptr) {
+    this->poleSweep->updown(alpha, result);
+    return;
+  }
+
   sgpp::base::DataVector beta(result.getSize());
   result.setAll(0.0);
 
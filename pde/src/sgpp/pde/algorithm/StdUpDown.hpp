@@ -9,6 +9,7 @@
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/pde/algorithm/UpDownPoleSweep.hpp>
 
 #ifndef TASKS_PARALLEL_UPDOWN
 #define TASKS_PARALLEL_UPDOWN 4
@@ -16,6 +17,7 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <memory>
 #include <vector>
 
 namespace sgpp {
@@ -68,6 +70,8 @@ class StdUpDown : public sgpp::base::OperationMatrix {
   const size_t numAlgoDims_;
   /// max number of parallel stages (dimension recursive calls)
   static const size_t maxParallelDims_ = TASKS_PARALLEL_UPDOWN;
+  /// pole based Up/Down scheme, used instead of the recursive scheme if set by a subclass
+  std::unique_ptr<UpDownPoleSweep> poleSweep;
 
   /**
    * Recursive procedure for updown
@@ -14,19 +14,35 @@ UpDownOneOpDim::UpDownOneOpDim(sgpp::base::GridStorage* storage, sgpp::base::Dat
     : storage(storage),
       coefs(&coef),
       algoDims(storage->getAlgorithmicDimensions()),
-      numAlgoDims_(storage->getAlgorithmicDimensions().size()) {}
+      numAlgoDims_(storage->getAlgorithmicDimensions().size()),
+      poleSweep() {}
 
 UpDownOneOpDim::UpDownOneOpDim(sgpp::base::GridStorage* storage)
     : storage(storage),
       coefs(nullptr),
       algoDims(storage->getAlgorithmicDimensions()),
-      numAlgoDims_(storage->getAlgorithmicDimensions().size()) {}
+      numAlgoDims_(storage->getAlgorithmicDimensions().size()),
+      poleSweep() {}
 
 UpDownOneOpDim::~UpDownOneOpDim() {}
 
 void UpDownOneOpDim::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
   result.setAll(0.0);
 
+  if (this->poleSweep != nullptr) {
+    for (size_t i = 0; i < this->numAlgoDims_; i++) {
+      if (this->coefs != nullptr) {
+        if (this->coefs->get(i) != 0.0) {
+          this->poleSweep->updownAdd(alpha, result, this->coefs->get(i), i);
+        }
+      } else {
+        this->poleSweep->updownAdd(alpha, result, 1.0, i);
+      }
+    }
+
+    return;
+  }
+
 #pragma omp parallel
   {
 #pragma omp single nowait
@@ -62,6 +78,18 @@ void UpDownOneOpDim::multParallelBuildingBlock(sgpp::base::DataVector& alpha,
                                                size_t operationDim) {
   result.setAll(0.0);
 
+  if (this->poleSweep != nullptr) {
+    if (this->coefs != nullptr) {
+      if (this->coefs->get(operationDim) != 0.0) {
+        this->poleSweep->updownAdd(alpha, result, this->coefs->get(operationDim), operationDim);
+      }
+    } else {
+      this->poleSweep->updownAdd(alpha, result, 1.0, operationDim);
+    }
+
+    return;
+  }
+
   sgpp::base::DataVector beta(result.getSize());
 
   if (this->coefs != nullptr) {
@@ -0,0 +1,212 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/pde/algorithm/UpDownPoleSweep.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+const size_t UpDownPoleSweep::NO_OPERATION_DIMENSION;
+
+UpDownPoleSweep::UpDownPoleSweep(sgpp::base::GridStorage& storage,
+                                 std::unique_ptr<PoleOperator1D> up,
+                                 std::unique_ptr<PoleOperator1D> down,
+                                 std::unique_ptr<PoleOperator1D> upOpDim,
+                                 std::unique_ptr<PoleOperator1D> downOpDim)
+    : storage(storage),
+      algoDims(storage.getAlgorithmicDimensions()),
+      up(std::move(up)),
+      down(std::move(down)),
+      upOpDim(std::move(upOpDim)),
+      downOpDim(std::move(downOpDim)),
+      poles(),
+      vectors(),
+      freeVectors() {
+#ifdef _OPENMP
+  omp_init_lock(&lock);
+#endif
+}
+
+UpDownPoleSweep::~UpDownPoleSweep() {
+#ifdef _OPENMP
+  omp_destroy_lock(&lock);
+#endif
+}
+
+void UpDownPoleSweep::updown(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+                             size_t opDim) {
+  update();
+
+  if (algoDims.empty()) {
+    result.setAll(0.0);
+    return;
+  }
+
+  updownRec(alpha, result, algoDims.size() - 1, opDim);
+}
+
+void UpDownPoleSweep::updownAdd(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+                                double factor, size_t opDim) {
+  update();
+
+  if (algoDims.empty()) {
+    return;
+  }
+
+  PooledVector beta(*this);
+  updownRec(alpha, *beta, algoDims.size() - 1, opDim);
+  axpy(result, factor, *beta);
+}
+
+void UpDownPoleSweep::updownRec(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+                                size_t dim, size_t opDim) {
+  const PoleOperator1D* upOp = (dim == opDim) ? upOpDim.get() : up.get();
+  const PoleOperator1D* downOp = (dim == opDim) ? downOpDim.get() : down.get();
+  const size_t sweepDim = algoDims[dim];
+
+  if ((upOp == nullptr) && (downOp == nullptr)) {
+    result.setAll(0.0);
+    return;
+  }
+
+  if (dim > 0) {
+    // Unidirectional scheme, the branch of a missing operator vanishes
+    PooledVector temp(*this);
+
+    if (upOp != nullptr) {
+      sweep(*upOp, alpha, *temp, sweepDim);
+      updownRec(*temp, result, dim - 1, opDim);
+
+      if (downOp != nullptr) {
+        // Same from the other direction, temp can be reused
+        PooledVector resultTemp(*this);
+        updownRec(alpha, *temp, dim - 1, opDim);
+        sweep(*downOp, *temp, *resultTemp, sweepDim);
+        axpy(result, 1.0, *resultTemp);
+      }
+    } else {
+      updownRec(alpha, *temp, dim - 1, opDim);
+      sweep(*downOp, *temp, result, sweepDim);
+    }
+  } else {
+    // Terminates dimension recursion
+    if (upOp != nullptr) {
+      sweep(*upOp, alpha, result, sweepDim);
+
+      if (downOp != nullptr) {
+        PooledVector temp(*this);
+        sweep(*downOp, alpha, *temp, sweepDim);
+        axpy(result, 1.0, *temp);
+      }
+    } else {
+      sweep(*downOp, alpha, result, sweepDim);
+    }
+  }
+}
+
+void UpDownPoleSweep::sweep(const PoleOperator1D& op, sgpp::base::DataVector& source,
+                            sgpp::base::DataVector& result, size_t dim) {
+  const GridPoles::Poles& dimPoles = poles->getPoles(dim);
+  const size_t numberOfChunks = dimPoles.chunkOffsets.size() - 1;
+  const size_t workspaceSize = op.getWorkspaceSize() * poles->getMaxPoleLength();
+  bool inParallel = false;
+
+#ifdef _OPENMP
+  inParallel = (omp_in_parallel() != 0);
+#endif
+
+  // points that are not contained in any pole are not reached by the operator
+  if (!poles->coversGrid()) {
+    result.setAll(0.0);
+  }
+
+#pragma omp parallel if (!inParallel)
+  {
+    std::vector<double> workspace(workspaceSize);
+
+#pragma omp for schedule(dynamic)
+    for (size_t c = 0; c < numberOfChunks; c++) {
+      op(dimPoles, dimPoles.chunkOffsets[c], dimPoles.chunkOffsets[c + 1], dim, source, result,
+         workspace.data());
+    }
+  }
+}
+
+void UpDownPoleSweep::axpy(sgpp::base::DataVector& result, double factor,
+                           const sgpp::base::DataVector& x) {
+  const size_t n = result.getSize();
+  double* resultData = result.getPointer();
+  const double* xData = x.getPointer();
+  bool inParallel = false;
+
+#ifdef _OPENMP
+  inParallel = (omp_in_parallel() != 0);
+#endif
+
+#pragma omp parallel for schedule(static) if (!inParallel)
+  for (size_t i = 0; i < n; i++) {
+    resultData[i] += factor * xData[i];
+  }
+}
+
+void UpDownPoleSweep::update() {
+#ifdef _OPENMP
+  omp_set_lock(&lock);
+#endif
+
+  if ((poles == nullptr) || (poles->getModificationCount() != storage.getModificationCount())) {
+    poles.reset(new GridPoles(storage, algoDims));
+  }
+
+#ifdef _OPENMP
+  omp_unset_lock(&lock);
+#endif
+}
+
+sgpp::base::DataVector* UpDownPoleSweep::acquireVector() {
+  sgpp::base::DataVector* vector;
+
+#ifdef _OPENMP
+  omp_set_lock(&lock);
+#endif
+
+  if (freeVectors.empty()) {
+    vectors.emplace_back(new sgpp::base::DataVector(storage.getSize()));
+    vector = vectors.back().get();
+  } else {
+    vector = freeVectors.back();
+    freeVectors.pop_back();
+  }
+
+#ifdef _OPENMP
+  omp_unset_lock(&lock);
+#endif
+
+  if (vector->getSize() != storage.getSize()) {
+    vector->resizeZero(storage.getSize());
+  }
+
+  return vector;
+}
+
+void UpDownPoleSweep::releaseVector(sgpp::base::DataVector* vector) {
+#ifdef _OPENMP
+  omp_set_lock(&lock);
+#endif
+
+  freeVectors.push_back(vector);
+
+#ifdef _OPENMP
+  omp_unset_lock(&lock);
+#endif
+}
+
+}  // namespace pde
+}  // namespace sgpp
@@ -0,0 +1,166 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef UPDOWNPOLESWEEP_HPP
+#define UPDOWNPOLESWEEP_HPP
+
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/pde/algorithm/GridPoles.hpp>
+#include <sgpp/pde/algorithm/PoleOperator1D.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+/**
+ * Up/Down scheme (see StdUpDown and UpDownOneOpDim) based on the pole structure of the grid.
+ *
+ * The poles of every dimension are collected once per grid (GridPoles) and the one-dimensional
+ * up and down parts are applied to them by PoleOperator1D objects. Instead of spawning tasks for
+ * the branches of the dimension recursion, every one-dimensional sweep is parallelized over the
+ * poles, which write to disjoint grid points. Hence no locks are needed to accumulate the
+ * results, and the result does not depend on the number of threads. Intermediate vectors are
+ * taken from a pool that is reused for all applications of the operator.
+ *
+ * If a method is called from within a parallel region (e.g., from an OpenMP task as in
+ * StdUpDown::multParallelBuildingBlock), the sweeps are executed by the calling thread.
+ * The pole structure is rebuilt if the grid has been changed since (see
+ * sgpp::base::GridStorage::getModificationCount), e.g., by refinement or coarsening.
+ */
+class UpDownPoleSweep {
+ public:
+  /// value of opDim if there is no dimension with special operators
+  static const size_t NO_OPERATION_DIMENSION = std::numeric_limits<size_t>::max();
+
+  /**
+   * Constructor
+   *
+   * @param storage the grid's sgpp::base::GridStorage object (has to consist of inner points)
+   * @param up 1D up operator
+   * @param down 1D down operator
+   * @param upOpDim 1D up operator in the operation dimension (nullptr if it is zero)
+   * @param downOpDim 1D down operator in the operation dimension (nullptr if it is zero)
+   */
+  UpDownPoleSweep(sgpp::base::GridStorage& storage, std::unique_ptr<PoleOperator1D> up,
+                  std::unique_ptr<PoleOperator1D> down,
+                  std::unique_ptr<PoleOperator1D> upOpDim = nullptr,
+                  std::unique_ptr<PoleOperator1D> downOpDim = nullptr);
+
+  /**
+   * Destructor
+   */
+  ~UpDownPoleSweep();
+
+  /**
+   * Applies the Up/Down scheme in all algorithmic dimensions.
+   *
+   * @param alpha vector of coefficients
+   * @param result vector to store the results in
+   * @param opDim index of the algorithmic dimension in which the special operators are applied
+   */
+  void updown(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+              size_t opDim = NO_OPERATION_DIMENSION);
+
+  /**
+   * Adds the scaled result of the Up/Down scheme to a vector.
+   *
+   * @param alpha vector of coefficients
+   * @param result vector to which factor times the result is added
+   * @param factor scaling factor
+   * @param opDim index of the algorithmic dimension in which the special operators are applied
+   */
+  void updownAdd(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, double factor,
+                 size_t opDim = NO_OPERATION_DIMENSION);
+
+ private:
+  /**
+   * Vector of the pool that is returned to the pool on destruction.
+   */
+  class PooledVector {
+   public:
+    explicit PooledVector(UpDownPoleSweep& sweep)
+        : sweep(sweep), vector(sweep.acquireVector()) {}
+    ~PooledVector() { sweep.releaseVector(vector); }
+    sgpp::base::DataVector& operator*() { return *vector; }
+
+   private:
+    UpDownPoleSweep& sweep;
+    sgpp::base::DataVector* vector;
+  };
+
+  /**
+   * Recursive procedure of the Up/Down scheme.
+   *
+   * @param alpha vector of coefficients
+   * @param result vector to store the results in
+   * @param dim the current (algorithmic) dimension
+   * @param opDim the dimension in which the special operators are applied
+   */
+  void updownRec(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim,
+                 size_t opDim);
+
+  /**
+   * Applies a 1D operator to all poles of a dimension.
+   *
+   * @param op the operator
+   * @param source coefficients of the grid points
+   * @param result vector to store the results in
+   * @param dim dimension
+   */
+  void sweep(const PoleOperator1D& op, sgpp::base::DataVector& source,
+             sgpp::base::DataVector& result, size_t dim);
+
+  /**
+   * result += factor * x, parallelized over the entries
+   */
+  void axpy(sgpp::base::DataVector& result, double factor, const sgpp::base::DataVector& x);
+
+  /**
+   * Rebuilds the pole structure if the grid has been changed.
+   */
+  void update();
+
+  /**
+   * @return vector of the size of the grid from the pool
+   */
+  sgpp::base::DataVector* acquireVector();
+
+  /**
+   * @param vector vector that is returned to the pool
+   */
+  void releaseVector(sgpp::base::DataVector* vector);
+
+  /// the grid's storage
+  sgpp::base::GridStorage& storage;
+  /// algorithmic dimensions
+  const std::vector<size_t> algoDims;
+  /// 1D operators
+  std::unique_ptr<PoleOperator1D> up, down, upOpDim, downOpDim;
+  /// pole structure of the grid
+  std::unique_ptr<GridPoles> poles;
+  /// all vectors of the pool
+  std::vector<std::unique_ptr<sgpp::base::DataVector>> vectors;
+  /// vectors of the pool that are currently not in use
+  std::vector<sgpp::base::DataVector*> freeVectors;
+#ifdef _OPENMP
+  /// lock for the pool and the pole structure
+  omp_lock_t lock;
+#endif
+};
+
+}  // namespace pde
+}  // namespace sgpp
+
+#endif /* UPDOWNPOLESWEEP_HPP */
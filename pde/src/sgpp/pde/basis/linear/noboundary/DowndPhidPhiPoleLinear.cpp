@@ -0,0 +1,34 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/pde/basis/linear/noboundary/DowndPhidPhiPoleLinear.hpp>
+#include <sgpp/base/grid/common/BoundingBox.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace pde {
+
+DowndPhidPhiPoleLinear::DowndPhidPhiPoleLinear(sgpp::base::GridStorage* storage)
+    : storage(storage) {}
+
+DowndPhidPhiPoleLinear::~DowndPhidPhiPoleLinear() {}
+
+void DowndPhidPhiPoleLinear::operator()(const GridPoles::Poles& poles, size_t firstPole,
+                                        size_t lastPole, size_t dim,
+                                        const sgpp::base::DataVector& source,
+                                        sgpp::base::DataVector& result, double* workspace) const {
+  // Bounding Box handling
+  double q = storage->getBoundingBox()->getIntervalWidth(dim);
+  double Qqout = 1.0 / q;
+
+  for (size_t k = poles.poleOffsets[firstPole]; k < poles.poleOffsets[lastPole]; k++) {
+    const size_t seq = poles.seq[k];
+    // only affects the diagonal of the stiffness matrix
+    result[seq] = source[seq] * (Qqout * static_cast<double>(1 << (poles.level[k] + 1)));
+  }
+}
+}  // namespace pde
+}  // namespace sgpp
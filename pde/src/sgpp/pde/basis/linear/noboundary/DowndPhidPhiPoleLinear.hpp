@@ -0,0 +1,49 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef DOWNDPHIDPHIPOLELINEAR_HPP
+#define DOWNDPHIDPHIPOLELINEAR_HPP
+
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/pde/algorithm/PoleOperator1D.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace pde {
+
+/**
+ * Pole operator version of DowndPhidPhiBBIterativeLinear, i.e., the Down of
+ * following bilinearform \f$\int_{x} \frac{\partial \phi(x)}{x} \frac{\partial \phi(x)}{x} dx\f$
+ * on Sparse Grids with linear ansatzfunctions without boundaries.
+ * The operator's matrix only has entries on the diagonal.
+ */
+class DowndPhidPhiPoleLinear : public PoleOperator1D {
+ private:
+  /// Pointer to the grid's storage object
+  sgpp::base::GridStorage* storage;
+
+ public:
+  /**
+   * Constructor
+   *
+   * @param storage Pointer to the grid's storage object
+   */
+  explicit DowndPhidPhiPoleLinear(sgpp::base::GridStorage* storage);
+
+  /**
+   * Destructor
+   */
+  virtual ~DowndPhidPhiPoleLinear();
+
+  void operator()(const GridPoles::Poles& poles, size_t firstPole, size_t lastPole, size_t dim,
+                  const sgpp::base::DataVector& source, sgpp::base::DataVector& result,
+                  double* workspace) const override;
+};
+}  // namespace pde
+}  // namespace sgpp
+
+#endif /* DOWNDPHIDPHIPOLELINEAR_HPP */
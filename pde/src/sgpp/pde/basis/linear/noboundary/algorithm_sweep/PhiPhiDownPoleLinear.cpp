@@ -0,0 +1,67 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/pde/basis/linear/noboundary/algorithm_sweep/PhiPhiDownPoleLinear.hpp>
+#include <sgpp/base/grid/common/BoundingBox.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace pde {
+
+PhiPhiDownPoleLinear::PhiPhiDownPoleLinear(sgpp::base::GridStorage* storage)
+    : storage(storage) {}
+
+PhiPhiDownPoleLinear::~PhiPhiDownPoleLinear() {}
+
+void PhiPhiDownPoleLinear::operator()(const GridPoles::Poles& poles, size_t firstPole,
+                                      size_t lastPole, size_t dim,
+                                      const sgpp::base::DataVector& source,
+                                      sgpp::base::DataVector& result, double* workspace) const {
+  double q = storage->getBoundingBox()->getIntervalWidth(dim);
+
+  for (size_t p = firstPole; p < lastPole; p++) {
+    const size_t begin = poles.poleOffsets[p];
+    const size_t length = poles.poleOffsets[p + 1] - begin;
+
+    // function values at the left and right end and in the middle of the support of every node
+    double* fl = workspace;
+    double* fr = workspace + length;
+    double* fm = workspace + 2 * length;
+
+    // parents are stored before their children
+    for (size_t k = 0; k < length; k++) {
+      const size_t seq = poles.seq[begin + k];
+
+      if (k == 0) {
+        fl[k] = 0.0;
+        fr[k] = 0.0;
+      } else {
+        const size_t parent = poles.parent[begin + k];
+
+        if (poles.isRightChild[begin + k]) {
+          fl[k] = fm[parent];
+          fr[k] = fr[parent];
+        } else {
+          fl[k] = fl[parent];
+          fr[k] = fm[parent];
+        }
+      }
+
+      double alpha_value = source[seq];
+      double h = 1.0 / static_cast<double>(1 << poles.level[begin + k]);
+      double tmp_m = ((fl[k] + fr[k]) / 2.0);
+
+      // integration
+      result[seq] = ((h * tmp_m) + (((2.0 / 3.0) * h) * alpha_value)) * q;
+
+      // dehierarchisation
+      fm[k] = tmp_m + alpha_value;
+    }
+  }
+}
+
+}  // namespace pde
+}  // namespace sgpp
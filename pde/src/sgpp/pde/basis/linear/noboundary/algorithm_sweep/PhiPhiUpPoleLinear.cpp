@@ -0,0 +1,66 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/pde/basis/linear/noboundary/algorithm_sweep/PhiPhiUpPoleLinear.hpp>
+#include <sgpp/base/grid/common/BoundingBox.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+
+namespace sgpp {
+namespace pde {
+
+PhiPhiUpPoleLinear::PhiPhiUpPoleLinear(sgpp::base::GridStorage* storage) : storage(storage) {}
+
+PhiPhiUpPoleLinear::~PhiPhiUpPoleLinear() {}
+
+void PhiPhiUpPoleLinear::operator()(const GridPoles::Poles& poles, size_t firstPole,
+                                    size_t lastPole, size_t dim,
+                                    const sgpp::base::DataVector& source,
+                                    sgpp::base::DataVector& result, double* workspace) const {
+  double q = storage->getBoundingBox()->getIntervalWidth(dim);
+
+  for (size_t p = firstPole; p < lastPole; p++) {
+    const size_t begin = poles.poleOffsets[p];
+    const size_t length = poles.poleOffsets[p + 1] - begin;
+
+    // values that the left and the right child pass to every node
+    double* fromLeftL = workspace;
+    double* fromLeftR = workspace + length;
+    double* fromRightL = workspace + 2 * length;
+    double* fromRightR = workspace + 3 * length;
+    std::fill(workspace, workspace + 4 * length, 0.0);
+
+    // children are stored after their parents
+    for (size_t k = length; k-- > 0;) {
+      const size_t seq = poles.seq[begin + k];
+
+      double fm = fromLeftR[k] + fromRightL[k];
+      double alpha_value = source[seq];
+      double levelFactor = static_cast<double>(1 << (poles.level[begin + k] + 1));
+
+      // transposed operations:
+      result[seq] = fm;
+
+      double tmp = ((fm / 2.0) + ((alpha_value / levelFactor) * q));
+
+      if (k > 0) {
+        const size_t parent = poles.parent[begin + k];
+
+        if (poles.isRightChild[begin + k]) {
+          fromRightL[parent] = tmp + fromLeftL[k];
+          fromRightR[parent] = tmp + fromRightR[k];
+        } else {
+          fromLeftL[parent] = tmp + fromLeftL[k];
+          fromLeftR[parent] = tmp + fromRightR[k];
+        }
+      }
+    }
+  }
+}
+
+}  // namespace pde
+}  // namespace sgpp
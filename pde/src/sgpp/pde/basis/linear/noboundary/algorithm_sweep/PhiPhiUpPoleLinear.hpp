@@ -0,0 +1,51 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef PHIPHIUPPOLELINEAR_HPP
+#define PHIPHIUPPOLELINEAR_HPP
+
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/pde/algorithm/PoleOperator1D.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace pde {
+
+/**
+ * Implementation of pole operator (): 1D Up for
+ * Bilinearform \f$\int_{x} \phi(x) \phi(x) dx\f$,
+ * same as PhiPhiUpBBLinear, but the poles are traversed iteratively in reverse pre-order
+ */
+class PhiPhiUpPoleLinear : public PoleOperator1D {
+ protected:
+  /// Pointer to sgpp::base::GridStorage object
+  sgpp::base::GridStorage* storage;
+
+ public:
+  /**
+   * Constructor
+   *
+   * @param storage the grid's sgpp::base::GridStorage object
+   */
+  explicit PhiPhiUpPoleLinear(sgpp::base::GridStorage* storage);
+
+  /**
+   * Destructor
+   */
+  virtual ~PhiPhiUpPoleLinear();
+
+  void operator()(const GridPoles::Poles& poles, size_t firstPole, size_t lastPole, size_t dim,
+                  const sgpp::base::DataVector& source, sgpp::base::DataVector& result,
+                  double* workspace) const override;
+
+  size_t getWorkspaceSize() const override { return 4; }
+};
+
+}  // namespace pde
+}  // namespace sgpp
+
+#endif /* PHIPHIUPPOLELINEAR_HPP */
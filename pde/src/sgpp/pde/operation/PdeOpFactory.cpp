@@ -29,6 +29,7 @@
 #include <sgpp/pde/operation/hash/OperationLaplaceExplicitLinear.hpp>
 #include <sgpp/pde/operation/hash/OperationLaplaceExplicitBspline.hpp>
 #include <sgpp/pde/operation/hash/OperationLaplaceExplicitModBspline.hpp>
+#include <sgpp/pde/operation/hash/OperationLaplaceExplicitSparse.hpp>
 
 #include <sgpp/pde/operation/hash/OperationMatrixLTwoDotExplicitPeriodic.hpp>
 #include <sgpp/pde/operation/hash/OperationMatrixLTwoDotExplicitLinear.hpp>
@@ -45,6 +46,7 @@
 #include <sgpp/pde/operation/hash/OperationMatrixLTwoDotExplicitPolyClenshawCurtis.hpp>
 #include <sgpp/pde/operation/hash/OperationMatrixLTwoDotExplicitPolyClenshawCurtisBoundary.hpp>
 #include <sgpp/pde/operation/hash/OperationMatrixLTwoDotExplicitModPolyClenshawCurtis.hpp>
+#include <sgpp/pde/operation/hash/OperationMatrixLTwoDotExplicitSparse.hpp>
 
 #include <sgpp/pde/operation/hash/OperationMatrixLTwoDotPeriodic.hpp>
 #include <sgpp/pde/operation/hash/OperationMatrixLTwoDotModLinear.hpp>
@@ -74,6 +76,23 @@
 
 namespace sgpp {
 
+namespace {
+
+/// maximal estimated density of explicit matrices that are stored in sparse format
+const double MAX_DENSITY_EXPLICIT_SPARSE = 0.25;
+
+/**
+ * @param grid Grid which is to be used
+ * @return whether the explicit matrix of the grid should be stored in sparse format
+ */
+bool useExplicitSparse(base::Grid& grid) {
+  return pde::OperationMatrixExplicitSparse::isSupported(grid) &&
+         (pde::OperationMatrixExplicitSparse::estimateDensity(grid) <=
+          MAX_DENSITY_EXPLICIT_SPARSE);
+}
+
+}  // namespace
+
 namespace op_factory {
 
 base::OperationMatrix* createOperationLaplace(base::Grid& grid) {
@@ -131,7 +150,9 @@ base::OperationMatrix* createOperationLaplace(base::Grid& grid, sgpp::base::Data
 }
 
 base::OperationMatrix* createOperationLaplaceExplicit(base::Grid& grid) {
-  if (grid.getType() == base::GridType::Linear) {
+  if (pde::OperationLaplaceExplicitSparse::isSupported(grid) && useExplicitSparse(grid)) {
+    return new pde::OperationLaplaceExplicitSparse(&grid);
+  } else if (grid.getType() == base::GridType::Linear) {
     return new pde::OperationLaplaceExplicitLinear(&grid.getStorage());
   } else if (grid.getType() == base::GridType::Bspline) {
     return new pde::OperationLaplaceExplicitBspline(&grid);
@@ -198,7 +219,9 @@ base::OperationMatrix* createOperationLTwoDotProduct(base::Grid& grid) {
 }
 
 base::OperationMatrix* createOperationLTwoDotExplicit(base::Grid& grid) {
-  if (grid.getType() == base::GridType::Linear) {
+  if (useExplicitSparse(grid)) {
+    return new pde::OperationMatrixLTwoDotExplicitSparse(&grid);
+  } else if (grid.getType() == base::GridType::Linear) {
     return new pde::OperationMatrixLTwoDotExplicitLinear(&grid);
   } else if (grid.getType() == base::GridType::LinearL0Boundary ||
              grid.getType() == base::GridType::LinearBoundary) {
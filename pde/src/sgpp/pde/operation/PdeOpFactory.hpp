@@ -41,6 +41,8 @@ base::OperationMatrix* createOperationLaplace(
 /**
    * Factory method, returning an OperationLaplaceExplicit (OperationMatrix) for the grid at hand.
    * Note: object has to be freed after use.
+   * If the matrix is sparse enough, it is stored in compressed sparse row format
+   * (see pde::OperationLaplaceExplicitSparse).
    *
    * @param grid Grid which is to be used
    * @return Pointer to the new OperationMatrix object for the Grid grid
@@ -71,6 +73,8 @@ base::OperationMatrix* createOperationLTwoDotProduct(base::Grid& grid);
 /**
    * Factory method, returning an OperationLTwoDotExplicit (OperationMatrix) for the grid at hand.
    * Note: object has to be freed after use.
+   * If the matrix is sparse enough, it is stored in compressed sparse row format
+   * (see pde::OperationMatrixLTwoDotExplicitSparse).
    *
    * @param grid Grid which is to be used
    * @return Pointer to the new OperationMatrix object for the Grid grid
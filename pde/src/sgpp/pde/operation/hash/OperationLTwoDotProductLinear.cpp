@@ -7,16 +7,24 @@
 
 #include <sgpp/pde/basis/linear/noboundary/algorithm_sweep/PhiPhiDownBBLinear.hpp>
 #include <sgpp/pde/basis/linear/noboundary/algorithm_sweep/PhiPhiUpBBLinear.hpp>
+#include <sgpp/pde/basis/linear/noboundary/algorithm_sweep/PhiPhiDownPoleLinear.hpp>
+#include <sgpp/pde/basis/linear/noboundary/algorithm_sweep/PhiPhiUpPoleLinear.hpp>
 
 #include <sgpp/base/algorithm/sweep.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <memory>
+
 namespace sgpp {
 namespace pde {
 
 OperationLTwoDotProductLinear::OperationLTwoDotProductLinear(sgpp::base::GridStorage* storage)
-    : StdUpDown(storage) {}
+    : StdUpDown(storage) {
+  this->poleSweep.reset(new UpDownPoleSweep(
+      *storage, std::unique_ptr<PoleOperator1D>(new PhiPhiUpPoleLinear(storage)),
+      std::unique_ptr<PoleOperator1D>(new PhiPhiDownPoleLinear(storage))));
+}
 
 OperationLTwoDotProductLinear::~OperationLTwoDotProductLinear() {}
 
@@ -0,0 +1,82 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/pde/operation/hash/OperationLaplaceExplicitSparse.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+
+namespace sgpp {
+namespace pde {
+
+OperationLaplaceExplicitSparse::OperationLaplaceExplicitSparse(sgpp::base::Grid* grid)
+    : OperationMatrixExplicitSparse(grid), bsplineBasis(nullptr), modBsplineBasis(nullptr) {
+  if (!isSupported(*grid)) {
+    throw sgpp::base::factory_exception(
+        "OperationLaplaceExplicitSparse is not implemented for this grid type.");
+  }
+
+  bsplineBasis = dynamic_cast<sgpp::base::SBsplineBase*>(&grid->getBasis());
+  modBsplineBasis = dynamic_cast<sgpp::base::SBsplineModifiedBase*>(&grid->getBasis());
+  buildMatrix(true);
+}
+
+OperationLaplaceExplicitSparse::~OperationLaplaceExplicitSparse() {}
+
+bool OperationLaplaceExplicitSparse::isSupported(sgpp::base::Grid& grid) {
+  return (grid.getType() == sgpp::base::GridType::Linear) ||
+         (grid.getType() == sgpp::base::GridType::Bspline) ||
+         (grid.getType() == sgpp::base::GridType::ModBspline);
+}
+
+double OperationLaplaceExplicitSparse::computeEntry(
+    const sgpp::base::DataVector& integrals1D,
+    const sgpp::base::DataVector& integralsDeriv1D) const {
+  /**
+   * int nabla phi_i(x) * nabla phi_j(x) dx
+   * = sum_k int (phi'_{i_k}(x_k) * phi'_{j_k}(x_k)) dx_k *
+   *         prod_{l!=k} int (phi_{i_l}(x_l) * phi_{j_l}(x_l)) dx_l
+   */
+  const size_t d = integrals1D.getSize();
+  double res = 0.0;
+
+  for (size_t k = 0; k < d; k++) {
+    double temp_res = integralsDeriv1D[k];
+
+    for (size_t l = 0; (l < d) && (temp_res != 0.0); l++) {
+      if (l != k) {
+        temp_res *= integrals1D[l];
+      }
+    }
+
+    res += temp_res;
+  }
+
+  return res;
+}
+
+double OperationLaplaceExplicitSparse::evalDx(sgpp::base::level_t l, sgpp::base::index_t i,
+                                              double x) const {
+  if (bsplineBasis != nullptr) {
+    return bsplineBasis->evalDx(l, i, x);
+  } else if (modBsplineBasis != nullptr) {
+    return modBsplineBasis->evalDx(l, i, x);
+  } else {
+    // piecewise linear hat function
+    const double hInv = static_cast<double>(static_cast<sgpp::base::index_t>(1) << l);
+    const double t = x * hInv - static_cast<double>(i);
+
+    if ((t <= -1.0) || (t >= 1.0)) {
+      return 0.0;
+    } else {
+      return ((t < 0.0) ? hInv : -hInv);
+    }
+  }
+}
+
+}  // namespace pde
+}  // namespace sgpp
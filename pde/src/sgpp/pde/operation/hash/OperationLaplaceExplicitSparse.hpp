@@ -0,0 +1,58 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/pde/operation/hash/OperationMatrixExplicitSparse.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineModifiedBasis.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace pde {
+
+/**
+ * Explicit representation of the matrix \f$(\nabla \Phi_i, \nabla \Phi_j)_{L2}\f$ for a sparse
+ * grid, stored in the compressed sparse row format (see OperationMatrixExplicitSparse).
+ *
+ * Supported are the grid types Linear, Bspline, and ModBspline.
+ */
+class OperationLaplaceExplicitSparse : public OperationMatrixExplicitSparse {
+ public:
+  /**
+   * Constructor
+   *
+   * @param grid the sparse grid
+   */
+  explicit OperationLaplaceExplicitSparse(sgpp::base::Grid* grid);
+
+  /**
+   * Destructor
+   */
+  ~OperationLaplaceExplicitSparse() override;
+
+  /**
+   * @param grid the sparse grid
+   * @return whether the sparse representation is implemented for the type of the grid
+   */
+  static bool isSupported(sgpp::base::Grid& grid);
+
+ protected:
+  double computeEntry(const sgpp::base::DataVector& integrals1D,
+                      const sgpp::base::DataVector& integralsDeriv1D) const override;
+
+  double evalDx(sgpp::base::level_t l, sgpp::base::index_t i, double x) const override;
+
+  /// B-spline basis (nullptr if the grid is no Bspline grid)
+  sgpp::base::SBsplineBase* bsplineBasis;
+  /// modified B-spline basis (nullptr if the grid is no ModBspline grid)
+  sgpp::base::SBsplineModifiedBase* modBsplineBasis;
+};
+
+}  // namespace pde
+}  // namespace sgpp
@@ -7,25 +7,42 @@
 
 #include <sgpp/pde/basis/linear/noboundary/algorithm_sweep/PhiPhiDownBBLinear.hpp>
 #include <sgpp/pde/basis/linear/noboundary/algorithm_sweep/PhiPhiUpBBLinear.hpp>
+#include <sgpp/pde/basis/linear/noboundary/algorithm_sweep/PhiPhiDownPoleLinear.hpp>
+#include <sgpp/pde/basis/linear/noboundary/algorithm_sweep/PhiPhiUpPoleLinear.hpp>
 
 #include <sgpp/pde/basis/linear/noboundary/DowndPhidPhiBBIterativeLinear.hpp>
+#include <sgpp/pde/basis/linear/noboundary/DowndPhidPhiPoleLinear.hpp>
 
 #include <sgpp/base/algorithm/sweep.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <memory>
+
 namespace sgpp {
 namespace pde {
 
 OperationLaplaceLinear::OperationLaplaceLinear(sgpp::base::GridStorage* storage)
-    : UpDownOneOpDim(storage) {}
+    : UpDownOneOpDim(storage) {
+  initPoleSweep();
+}
 
 OperationLaplaceLinear::OperationLaplaceLinear(sgpp::base::GridStorage* storage,
                                                sgpp::base::DataVector& coef)
-    : UpDownOneOpDim(storage, coef) {}
+    : UpDownOneOpDim(storage, coef) {
+  initPoleSweep();
+}
 
 OperationLaplaceLinear::~OperationLaplaceLinear() {}
 
+void OperationLaplaceLinear::initPoleSweep() {
+  // the up-part in the gradient dimension is empty
+  this->poleSweep.reset(new UpDownPoleSweep(
+      *this->storage, std::unique_ptr<PoleOperator1D>(new PhiPhiUpPoleLinear(this->storage)),
+      std::unique_ptr<PoleOperator1D>(new PhiPhiDownPoleLinear(this->storage)), nullptr,
+      std::unique_ptr<PoleOperator1D>(new DowndPhidPhiPoleLinear(this->storage))));
+}
+
 void OperationLaplaceLinear::specialOP(sgpp::base::DataVector& alpha,
                                        sgpp::base::DataVector& result, size_t dim,
                                        size_t gradient_dim) {
@@ -50,6 +50,12 @@ class OperationLaplaceLinear : public UpDownOneOpDim {
   virtual void downOpDim(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim);
 
   virtual void upOpDim(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim);
+
+ private:
+  /**
+   * Sets up the pole based Up/Down scheme with the linear 1D operators.
+   */
+  void initPoleSweep();
 };
 }  // namespace pde
 }  // namespace sgpp
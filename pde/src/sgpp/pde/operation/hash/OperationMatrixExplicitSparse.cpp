@@ -0,0 +1,436 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/pde/operation/hash/OperationMatrixExplicitSparse.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/tools/GaussLegendreQuadRule1D.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+namespace {
+
+/// pair of one-dimensional basis functions (levels and indices), used as cache key
+struct BasisPair {
+  sgpp::base::level_t l1;
+  sgpp::base::index_t i1;
+  sgpp::base::level_t l2;
+  sgpp::base::index_t i2;
+
+  bool operator==(const BasisPair& other) const {
+    return (l1 == other.l1) && (i1 == other.i1) && (l2 == other.l2) && (i2 == other.i2);
+  }
+};
+
+struct BasisPairHash {
+  size_t operator()(const BasisPair& key) const {
+    size_t hash = std::hash<size_t>()(key.l1);
+    hash = hash * 31 + std::hash<size_t>()(key.i1);
+    hash = hash * 31 + std::hash<size_t>()(key.l2);
+    return hash * 31 + std::hash<size_t>()(key.i2);
+  }
+};
+
+}  // namespace
+
+OperationMatrixExplicitSparse::OperationMatrixExplicitSparse(sgpp::base::Grid* grid)
+    : grid(grid), rowPointers(1, 0), columnIndices(), values() {
+  if (!isSupported(*grid)) {
+    throw sgpp::base::factory_exception(
+        "OperationMatrixExplicitSparse is not implemented for this grid type.");
+  }
+}
+
+OperationMatrixExplicitSparse::~OperationMatrixExplicitSparse() {}
+
+bool OperationMatrixExplicitSparse::isSupported(sgpp::base::Grid& grid) {
+  return (getSupportRadius(grid) > 0.0);
+}
+
+double OperationMatrixExplicitSparse::getSupportRadius(sgpp::base::Grid& grid) {
+  switch (grid.getType()) {
+    case sgpp::base::GridType::Linear:
+    case sgpp::base::GridType::LinearL0Boundary:
+    case sgpp::base::GridType::LinearBoundary:
+    case sgpp::base::GridType::ModLinear:
+    case sgpp::base::GridType::Poly:
+    case sgpp::base::GridType::PolyBoundary:
+    case sgpp::base::GridType::ModPoly:
+      return 1.0;
+
+    case sgpp::base::GridType::Bspline:
+    case sgpp::base::GridType::BsplineBoundary:
+    case sgpp::base::GridType::ModBspline:
+      // modified B-splines at the boundary are sums of B-splines with centers outside of [0, 1],
+      // their support in [0, 1] is therefore still contained in that of the unmodified function
+      return static_cast<double>(grid.getBasis().getDegree() + 1) / 2.0;
+
+    default:
+      return 0.0;
+  }
+}
+
+void OperationMatrixExplicitSparse::buildSupportIndex(sgpp::base::GridStorage& storage,
+                                                      SupportIndex& supportIndex) {
+  const size_t d = storage.getDimension();
+  supportIndex.assign(d, std::vector<std::vector<std::pair<sgpp::base::index_t, size_t>>>());
+
+  for (size_t j = 0; j < storage.getSize(); j++) {
+    for (size_t t = 0; t < d; t++) {
+      const sgpp::base::level_t l = storage[j].getLevel(t);
+
+      if (supportIndex[t].size() <= l) {
+        supportIndex[t].resize(l + 1);
+      }
+
+      supportIndex[t][l].emplace_back(storage[j].getIndex(t), j);
+    }
+  }
+
+  for (size_t t = 0; t < d; t++) {
+    for (auto& points : supportIndex[t]) {
+      std::sort(points.begin(), points.end());
+    }
+  }
+}
+
+void OperationMatrixExplicitSparse::getOverlappingPoints(sgpp::base::GridStorage& storage,
+                                                         const SupportIndex& supportIndex,
+                                                         double supportRadius, size_t i,
+                                                         std::vector<size_t>& columns) {
+  typedef std::vector<std::pair<sgpp::base::index_t, size_t>>::const_iterator Iterator;
+  const size_t d = storage.getDimension();
+  const sgpp::base::GridPoint& gp = storage[i];
+
+  // the supports of (l, i) and (l', i') overlap if and only if
+  // |i' - i * 2^(l'-l)| < r * (1 + 2^(l'-l)) (all quantities are dyadic, i.e., exact)
+  auto getRange = [&](size_t t, sgpp::base::level_t l) {
+    const std::vector<std::pair<sgpp::base::index_t, size_t>>& points = supportIndex[t][l];
+    const double scaling =
+        std::ldexp(1.0, static_cast<int>(l) - static_cast<int>(gp.getLevel(t)));
+    const double center = static_cast<double>(gp.getIndex(t)) * scaling;
+    const double radius = supportRadius * (1.0 + scaling);
+    const double lowerIndex = std::floor(center - radius) + 1.0;
+    const double upperIndex = std::ceil(center + radius) - 1.0;
+
+    if ((upperIndex < 0.0) || (upperIndex < lowerIndex)) {
+      return std::make_pair(points.end(), points.end());
+    }
+
+    const sgpp::base::index_t lower =
+        static_cast<sgpp::base::index_t>(std::max(lowerIndex, 0.0));
+    const sgpp::base::index_t upper = static_cast<sgpp::base::index_t>(upperIndex);
+    const Iterator first = std::lower_bound(points.begin(), points.end(),
+                                            std::make_pair(lower, static_cast<size_t>(0)));
+    const Iterator last = std::upper_bound(first, points.end(),
+                                           std::make_pair(upper, storage.getSize()));
+    return std::make_pair(first, last);
+  };
+
+  // take the candidates from the dimension with the fewest overlapping one-dimensional
+  // basis functions and check the remaining dimensions
+  size_t bestDim = 0;
+  size_t bestCount = storage.getSize() + 1;
+
+  for (size_t t = 0; t < d; t++) {
+    size_t count = 0;
+
+    for (sgpp::base::level_t l = 0; l < supportIndex[t].size(); l++) {
+      const auto range = getRange(t, l);
+      count += static_cast<size_t>(range.second - range.first);
+    }
+
+    if (count < bestCount) {
+      bestDim = t;
+      bestCount = count;
+    }
+  }
+
+  columns.clear();
+
+  for (sgpp::base::level_t l = 0; l < supportIndex[bestDim].size(); l++) {
+    const auto range = getRange(bestDim, l);
+
+    for (Iterator it = range.first; it != range.second; ++it) {
+      const sgpp::base::GridPoint& gpOther = storage[it->second];
+      bool overlaps = true;
+
+      for (size_t t = 0; t < d; t++) {
+        if (t == bestDim) {
+          continue;
+        }
+
+        const double scaling = std::ldexp(
+            1.0, static_cast<int>(gpOther.getLevel(t)) - static_cast<int>(gp.getLevel(t)));
+
+        if (std::abs(static_cast<double>(gpOther.getIndex(t)) -
+                     static_cast<double>(gp.getIndex(t)) * scaling) >=
+            supportRadius * (1.0 + scaling)) {
+          overlaps = false;
+          break;
+        }
+      }
+
+      if (overlaps) {
+        columns.push_back(it->second);
+      }
+    }
+  }
+}
+
+double OperationMatrixExplicitSparse::estimateDensity(sgpp::base::Grid& grid,
+                                                      size_t numberOfSamples) {
+  const double supportRadius = getSupportRadius(grid);
+
+  if (supportRadius <= 0.0) {
+    throw sgpp::base::factory_exception(
+        "OperationMatrixExplicitSparse is not implemented for this grid type.");
+  }
+
+  sgpp::base::GridStorage& storage = grid.getStorage();
+  const size_t n = storage.getSize();
+
+  if ((n == 0) || (numberOfSamples == 0)) {
+    return 0.0;
+  }
+
+  SupportIndex supportIndex;
+  buildSupportIndex(storage, supportIndex);
+
+  // rows spread evenly over the grid storage
+  const size_t numberOfRows = std::min(numberOfSamples, n);
+  std::vector<size_t> columns;
+  size_t nnz = 0;
+
+  for (size_t k = 0; k < numberOfRows; k++) {
+    getOverlappingPoints(storage, supportIndex, supportRadius, k * n / numberOfRows, columns);
+    nnz += columns.size();
+  }
+
+  return static_cast<double>(nnz) /
+         (static_cast<double>(numberOfRows) * static_cast<double>(n));
+}
+
+double OperationMatrixExplicitSparse::evalDx(sgpp::base::level_t l, sgpp::base::index_t i,
+                                             double x) const {
+  throw sgpp::base::operation_exception(
+      "OperationMatrixExplicitSparse::evalDx: derivatives are not available.");
+}
+
+void OperationMatrixExplicitSparse::buildMatrix(bool derivatives) {
+  sgpp::base::GridStorage& storage = grid->getStorage();
+  sgpp::base::SBasis& basis = grid->getBasis();
+  const size_t n = storage.getSize();
+  const size_t d = storage.getDimension();
+  const double supportRadius = getSupportRadius(*grid);
+
+  // the basis functions are piecewise polynomials of degree at most p, whose pieces are
+  // separated by integer (odd degree) or half-integer (even degree) multiples of the mesh width
+  const size_t p = basis.getDegree();
+  const bool halfCells = (std::floor(supportRadius) != supportRadius);
+  const size_t cellsPerMeshWidth = (halfCells ? 2 : 1);
+  const size_t numberOfCells =
+      static_cast<size_t>(std::lround(2.0 * supportRadius)) * cellsPerMeshWidth;
+  const size_t quadOrder = p + 1;
+
+  sgpp::base::DataVector coordinates;
+  sgpp::base::DataVector weights;
+  sgpp::base::GaussLegendreQuadRule1D gauss;
+  gauss.getLevelPointsAndWeightsNormalized(quadOrder, coordinates, weights);
+
+  SupportIndex supportIndex;
+  buildSupportIndex(storage, supportIndex);
+
+  // upper triangle (including the diagonal) of every row
+  std::vector<std::vector<size_t>> upperColumns(n);
+  std::vector<std::vector<double>> upperValues(n);
+
+#pragma omp parallel
+  {
+    std::unordered_map<BasisPair, std::pair<double, double>, BasisPairHash> cache;
+    std::vector<size_t> columns;
+    sgpp::base::DataVector integrals1D(d);
+    sgpp::base::DataVector integralsDeriv1D(d, 0.0);
+
+    // exact integral of the product of two overlapping one-dimensional basis functions
+    // (and of their derivatives) on the knot intervals of the finer function
+    auto computeIntegrals = [&](sgpp::base::level_t l1, sgpp::base::index_t i1,
+                                sgpp::base::level_t l2, sgpp::base::index_t i2) {
+      if ((l1 > l2) || ((l1 == l2) && (i1 > i2))) {
+        std::swap(l1, l2);
+        std::swap(i1, i2);
+      }
+
+      const BasisPair key{l1, i1, l2, i2};
+      const auto it = cache.find(key);
+
+      if (it != cache.end()) {
+        return it->second;
+      }
+
+      const double h1 = std::ldexp(1.0, -static_cast<int>(l1));
+      const double h2 = std::ldexp(1.0, -static_cast<int>(l2));
+      const double lowerBound =
+          std::max(std::max((static_cast<double>(i1) - supportRadius) * h1,
+                            (static_cast<double>(i2) - supportRadius) * h2),
+                   0.0);
+      const double upperBound =
+          std::min(std::min((static_cast<double>(i1) + supportRadius) * h1,
+                            (static_cast<double>(i2) + supportRadius) * h2),
+                   1.0);
+      const double cellWidth = h2 / static_cast<double>(cellsPerMeshWidth);
+      const double offset = (static_cast<double>(i2) - supportRadius) * h2;
+      const double tolerance = 1e-8 * cellWidth;
+      double integral = 0.0;
+      double integralDeriv = 0.0;
+
+      for (size_t c = 0; c < numberOfCells; c++) {
+        const double left = offset + static_cast<double>(c) * cellWidth;
+
+        if ((left < lowerBound - tolerance) || (left + cellWidth > upperBound + tolerance)) {
+          continue;
+        }
+
+        for (size_t q = 0; q < quadOrder; q++) {
+          const double x = left + cellWidth * coordinates[q];
+          integral += weights[q] * basis.eval(l1, i1, x) * basis.eval(l2, i2, x);
+
+          if (derivatives) {
+            integralDeriv += weights[q] * evalDx(l1, i1, x) * evalDx(l2, i2, x);
+          }
+        }
+      }
+
+      const std::pair<double, double> result(cellWidth * integral, cellWidth * integralDeriv);
+      cache.emplace(key, result);
+      return result;
+    };
+
+#pragma omp for schedule(dynamic, 16)
+    for (size_t i = 0; i < n; i++) {
+      getOverlappingPoints(storage, supportIndex, supportRadius, i, columns);
+      std::sort(columns.begin(), columns.end());
+      const sgpp::base::GridPoint& gpI = storage[i];
+
+      for (size_t j : columns) {
+        if (j < i) {
+          continue;
+        }
+
+        const sgpp::base::GridPoint& gpJ = storage[j];
+
+        for (size_t t = 0; t < d; t++) {
+          const std::pair<double, double> integrals = computeIntegrals(
+              gpI.getLevel(t), gpI.getIndex(t), gpJ.getLevel(t), gpJ.getIndex(t));
+          integrals1D[t] = integrals.first;
+          integralsDeriv1D[t] = integrals.second;
+        }
+
+        const double entry = computeEntry(integrals1D, integralsDeriv1D);
+
+        if (entry != 0.0) {
+          upperColumns[i].push_back(j);
+          upperValues[i].push_back(entry);
+        }
+      }
+    }
+  }
+
+  // mirror the upper triangle, every row consists of its strictly lower entries
+  // (ascending, as the rows are traversed in ascending order) followed by its upper entries
+  std::vector<size_t> rowLengths(n, 0);
+
+  for (size_t i = 0; i < n; i++) {
+    rowLengths[i] += upperColumns[i].size();
+
+    for (size_t j : upperColumns[i]) {
+      if (j > i) {
+        rowLengths[j]++;
+      }
+    }
+  }
+
+  rowPointers.assign(n + 1, 0);
+
+  for (size_t i = 0; i < n; i++) {
+    rowPointers[i + 1] = rowPointers[i] + rowLengths[i];
+  }
+
+  columnIndices.resize(rowPointers[n]);
+  values.resize(rowPointers[n]);
+  std::vector<size_t> nextEntry(rowPointers.begin(), rowPointers.end() - 1);
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t k = 0; k < upperColumns[i].size(); k++) {
+      const size_t j = upperColumns[i][k];
+
+      if (j > i) {
+        columnIndices[nextEntry[j]] = i;
+        values[nextEntry[j]] = upperValues[i][k];
+        nextEntry[j]++;
+      }
+    }
+  }
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < n; i++) {
+    std::copy(upperColumns[i].begin(), upperColumns[i].end(),
+              columnIndices.begin() + nextEntry[i]);
+    std::copy(upperValues[i].begin(), upperValues[i].end(), values.begin() + nextEntry[i]);
+  }
+}
+
+double OperationMatrixExplicitSparse::get(size_t i, size_t j) const {
+  const auto first = columnIndices.begin() + rowPointers[i];
+  const auto last = columnIndices.begin() + rowPointers[i + 1];
+  const auto it = std::lower_bound(first, last, j);
+
+  if ((it != last) && (*it == j)) {
+    return values[it - columnIndices.begin()];
+  } else {
+    return 0.0;
+  }
+}
+
+void OperationMatrixExplicitSparse::mult(sgpp::base::DataVector& alpha,
+                                         sgpp::base::DataVector& result) {
+  const size_t n = getSize();
+
+  if (alpha.getSize() != n || result.getSize() != n) {
+    throw sgpp::base::data_exception("Dimensions do not match!");
+  }
+
+  const size_t* rowPointersData = rowPointers.data();
+  const size_t* columnIndicesData = columnIndices.data();
+  const double* valuesData = values.data();
+  const double* alphaData = alpha.getPointer();
+  double* resultData = result.getPointer();
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < n; i++) {
+    double temp = 0.0;
+
+#pragma omp simd reduction(+ : temp)
+    for (size_t k = rowPointersData[i]; k < rowPointersData[i + 1]; k++) {
+      temp += valuesData[k] * alphaData[columnIndicesData[k]];
+    }
+
+    resultData[i] = temp;
+  }
+}
+
+}  // namespace pde
+}  // namespace sgpp
@@ -0,0 +1,181 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+/**
+ * Explicit representation of a symmetric bilinear form
+ * \f$(a(\varphi_i, \varphi_j))_{i,j}\f$ on a sparse grid, which is stored in the compressed
+ * sparse row (CSR) format.
+ *
+ * Only pairs of basis functions whose supports overlap are assembled. These pairs are found by
+ * sorting the grid points in every dimension by level and index, such that the number of entries
+ * that are computed is proportional to the number of non-zeros instead of the squared grid size.
+ * The one-dimensional integrals are computed exactly with Gauss-Legendre quadrature on the knot
+ * intervals of the finer basis function.
+ *
+ * Supported are the grid types Linear, LinearL0Boundary, LinearBoundary, ModLinear, Bspline,
+ * BsplineBoundary, ModBspline, Poly, PolyBoundary, and ModPoly.
+ */
+class OperationMatrixExplicitSparse : public sgpp::base::OperationMatrix {
+ public:
+  /**
+   * Destructor
+   */
+  ~OperationMatrixExplicitSparse() override;
+
+  /**
+   * Sparse matrix-vector multiplication (parallelized over the rows).
+   *
+   * @param alpha DataVector that is multiplied to the matrix
+   * @param result DataVector into which the result of multiplication is stored
+   */
+  void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) override;
+
+  /**
+   * @return number of rows and columns of the matrix
+   */
+  size_t getSize() const { return rowPointers.size() - 1; }
+
+  /**
+   * @return number of stored (non-zero) entries
+   */
+  size_t getNumberOfNonZeros() const { return values.size(); }
+
+  /**
+   * @param i row index
+   * @param j column index
+   * @return entry of the matrix (zero if it is not stored)
+   */
+  double get(size_t i, size_t j) const;
+
+  /**
+   * @return CSR row pointers (size + 1 entries)
+   */
+  const std::vector<size_t>& getRowPointers() const { return rowPointers; }
+
+  /**
+   * @return CSR column indices (ascending in every row)
+   */
+  const std::vector<size_t>& getColumnIndices() const { return columnIndices; }
+
+  /**
+   * @return CSR values
+   */
+  const std::vector<double>& getValues() const { return values; }
+
+  /**
+   * @param grid the sparse grid
+   * @return whether the sparse representation is implemented for the type of the grid
+   */
+  static bool isSupported(sgpp::base::Grid& grid);
+
+  /**
+   * Estimates the fraction of pairs of grid points whose basis functions have overlapping
+   * supports (i.e., an upper bound for the density of the matrix) by enumerating the overlapping
+   * basis functions for some of the rows. No integrals are computed.
+   *
+   * @param grid              the sparse grid (its type has to be supported)
+   * @param numberOfSamples   maximal number of rows to examine (all rows if the grid is smaller)
+   * @return estimated density in \f$[0, 1]\f$
+   */
+  static double estimateDensity(sgpp::base::Grid& grid, size_t numberOfSamples = 100);
+
+ protected:
+  /// sorted pairs (index, grid point) for every dimension and level
+  typedef std::vector<std::vector<std::vector<std::pair<sgpp::base::index_t, size_t>>>>
+      SupportIndex;
+
+  /**
+   * Constructor, the matrix is built by buildMatrix.
+   *
+   * @param grid the sparse grid
+   */
+  explicit OperationMatrixExplicitSparse(sgpp::base::Grid* grid);
+
+  /**
+   * Assembles the matrix. Has to be called by the constructors of derived classes.
+   *
+   * @param derivatives whether the one-dimensional integrals of the products of the
+   *                    derivatives are needed by computeEntry
+   */
+  void buildMatrix(bool derivatives);
+
+  /**
+   * Combines the one-dimensional integrals of two grid points to an entry of the matrix.
+   *
+   * @param integrals1D       integrals of \f$\varphi_{i,t} \varphi_{j,t}\f$ for all dimensions t
+   * @param integralsDeriv1D  integrals of \f$\varphi_{i,t}' \varphi_{j,t}'\f$ for all
+   *                          dimensions t (only computed if requested in buildMatrix)
+   * @return matrix entry
+   */
+  virtual double computeEntry(const sgpp::base::DataVector& integrals1D,
+                              const sgpp::base::DataVector& integralsDeriv1D) const = 0;
+
+  /**
+   * Evaluates the derivative of a one-dimensional basis function. Only called if derivatives
+   * are requested in buildMatrix.
+   *
+   * @param l level
+   * @param i index
+   * @param x evaluation point
+   * @return derivative of the basis function in x
+   */
+  virtual double evalDx(sgpp::base::level_t l, sgpp::base::index_t i, double x) const;
+
+  /// the sparse grid
+  sgpp::base::Grid* grid;
+
+ private:
+  /**
+   * @param grid the sparse grid
+   * @return radius of the support of the basis functions relative to their mesh width
+   *         (0 if the grid type is not supported)
+   */
+  static double getSupportRadius(sgpp::base::Grid& grid);
+
+  /**
+   * Sorts the grid points in every dimension by level and index.
+   *
+   * @param storage             grid storage
+   * @param[out] supportIndex   sorted grid points
+   */
+  static void buildSupportIndex(sgpp::base::GridStorage& storage, SupportIndex& supportIndex);
+
+  /**
+   * Enumerates the grid points whose basis functions overlap with the one of the i-th point.
+   *
+   * @param storage         grid storage
+   * @param supportIndex    sorted grid points (see buildSupportIndex)
+   * @param supportRadius   support radius (see getSupportRadius)
+   * @param i               grid point index
+   * @param[out] columns    indices of the overlapping grid points (unsorted)
+   */
+  static void getOverlappingPoints(sgpp::base::GridStorage& storage,
+                                   const SupportIndex& supportIndex, double supportRadius,
+                                   size_t i, std::vector<size_t>& columns);
+
+  /// CSR row pointers
+  std::vector<size_t> rowPointers;
+  /// CSR column indices
+  std::vector<size_t> columnIndices;
+  /// CSR values
+  std::vector<double> values;
+};
+
+}  // namespace pde
+}  // namespace sgpp
@@ -0,0 +1,34 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/pde/operation/hash/OperationMatrixLTwoDotExplicitSparse.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace pde {
+
+OperationMatrixLTwoDotExplicitSparse::OperationMatrixLTwoDotExplicitSparse(
+    sgpp::base::Grid* grid)
+    : OperationMatrixExplicitSparse(grid) {
+  buildMatrix(false);
+}
+
+OperationMatrixLTwoDotExplicitSparse::~OperationMatrixLTwoDotExplicitSparse() {}
+
+double OperationMatrixLTwoDotExplicitSparse::computeEntry(
+    const sgpp::base::DataVector& integrals1D,
+    const sgpp::base::DataVector& integralsDeriv1D) const {
+  double res = 1.0;
+
+  for (size_t k = 0; k < integrals1D.getSize(); k++) {
+    res *= integrals1D[k];
+  }
+
+  return res;
+}
+
+}  // namespace pde
+}  // namespace sgpp
@@ -0,0 +1,41 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/pde/operation/hash/OperationMatrixExplicitSparse.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace pde {
+
+/**
+ * Explicit representation of the matrix \f$(\Phi_i,\Phi_j)_{L2}\f$ for a sparse grid,
+ * stored in the compressed sparse row format (see OperationMatrixExplicitSparse).
+ */
+class OperationMatrixLTwoDotExplicitSparse : public OperationMatrixExplicitSparse {
+ public:
+  /**
+   * Constructor
+   *
+   * @param grid the sparse grid
+   */
+  explicit OperationMatrixLTwoDotExplicitSparse(sgpp::base::Grid* grid);
+
+  /**
+   * Destructor
+   */
+  ~OperationMatrixLTwoDotExplicitSparse() override;
+
+ protected:
+  double computeEntry(const sgpp::base::DataVector& integrals1D,
+                      const sgpp::base::DataVector& integralsDeriv1D) const override;
+};
+
+}  // namespace pde
+}  // namespace sgpp
@@ -0,0 +1,66 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/globaldef.hpp>
+#include <sgpp/pde/algorithm/HeatEquationParabolicPDESolverSystem.hpp>
+#include <sgpp/pde/algorithm/HeatEquationParabolicPDESolverSystemParallelOMP.hpp>
+
+#include <cmath>
+#include <memory>
+#include <string>
+
+BOOST_AUTO_TEST_SUITE(testHeatEquationParabolicPDESolverSystem)
+
+BOOST_AUTO_TEST_CASE(testParallelOMPMatchesSerial) {
+  const size_t d = 5;
+  const size_t l = 4;
+  const double a = 0.5;
+  const double timestepSize = 0.01;
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearBoundaryGrid(d));
+  grid->getGenerator().regular(l);
+
+  sgpp::base::DataVector alpha(grid->getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = std::sin(static_cast<double>(i));
+  }
+
+  for (std::string mode : {"ExEul", "ImEul", "CrNic"}) {
+    sgpp::base::DataVector alphaSerial(alpha);
+    sgpp::base::DataVector alphaParallel(alpha);
+    sgpp::pde::HeatEquationParabolicPDESolverSystem serial(*grid, alphaSerial, a, timestepSize,
+                                                           mode);
+    sgpp::pde::HeatEquationParabolicPDESolverSystemParallelOMP parallel(
+        *grid, alphaParallel, a, timestepSize, mode);
+
+    // repeated applications reuse the scratch buffers of the parallel system
+    for (size_t k = 0; k < 2; k++) {
+      sgpp::base::DataVector rhsSerial(*serial.generateRHS());
+      sgpp::base::DataVector rhsParallel(*parallel.generateRHS());
+      BOOST_REQUIRE_EQUAL(rhsSerial.getSize(), rhsParallel.getSize());
+
+      for (size_t i = 0; i < rhsSerial.getSize(); i++) {
+        BOOST_CHECK_SMALL(rhsSerial[i] - rhsParallel[i], 1e-12);
+      }
+
+      sgpp::base::DataVector resultSerial(rhsSerial.getSize());
+      sgpp::base::DataVector resultParallel(rhsSerial.getSize());
+      serial.mult(rhsSerial, resultSerial);
+      parallel.mult(rhsSerial, resultParallel);
+
+      for (size_t i = 0; i < resultSerial.getSize(); i++) {
+        BOOST_CHECK_SMALL(resultSerial[i] - resultParallel[i], 1e-12);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -10,7 +10,13 @@
 #include <sgpp_base.hpp>
 #include <sgpp_pde.hpp>
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
+#include <sgpp/pde/operation/hash/OperationLaplaceExplicitSparse.hpp>
+#include <sgpp/pde/operation/hash/OperationLTwoDotProductLinear.hpp>
 #include <sgpp/globaldef.hpp>
+
+#include <list>
+#include <memory>
+#include <vector>
 namespace sgpp {
 namespace pde {
   /*
@@ -398,6 +404,170 @@ namespace pde {
     }
   }
 
+  BOOST_AUTO_TEST_CASE(testOperationLaplaceExplicitSparse) {
+    const size_t d = 3;
+    const size_t l = 4;
+    std::vector<std::unique_ptr<sgpp::base::Grid>> grids;
+    grids.emplace_back(sgpp::base::Grid::createLinearGrid(d));
+    grids.emplace_back(sgpp::base::Grid::createBsplineGrid(d, 3));
+    grids.emplace_back(sgpp::base::Grid::createModBsplineGrid(d, 3));
+
+    for (std::unique_ptr<sgpp::base::Grid>& grid : grids) {
+      grid->getGenerator().regular(l);
+      const size_t n = grid->getSize();
+
+      sgpp::base::DataMatrix m(n, n);
+      std::unique_ptr<sgpp::base::OperationMatrix> opDense(
+        sgpp::op_factory::createOperationLaplaceExplicit(&m, *grid));
+      OperationLaplaceExplicitSparse opSparse(grid.get());
+
+      for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+          BOOST_CHECK_SMALL(opSparse.get(i, j) - m.get(i, j), 1e-10);
+        }
+      }
+    }
+  }
+
+  BOOST_AUTO_TEST_CASE(testOperationLaplaceLinearAdaptive) {
+    // the Up/Down scheme of linear grids without boundary traverses the poles of the grid
+    const size_t d = 3;
+    const size_t l = 3;
+    std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(d));
+    grid->getGenerator().regular(l);
+
+    for (size_t k = 0; k < 2; k++) {
+      sgpp::base::DataVector surpluses(grid->getSize());
+
+      for (size_t i = 0; i < grid->getSize(); i++) {
+        surpluses[i] = static_cast<double>((i * 7) % 11);
+      }
+
+      sgpp::base::SurplusRefinementFunctor functor(surpluses, 5);
+      grid->getGenerator().refine(functor);
+    }
+
+    const size_t n = grid->getSize();
+    sgpp::base::DataVector alpha(n);
+
+    for (size_t i = 0; i < n; i++) {
+      alpha[i] = static_cast<double>(i % 7) - 3.0;
+    }
+
+    sgpp::base::DataMatrix mLaplace(n, n);
+    sgpp::base::DataMatrix mLTwoDot(n, n);
+    std::unique_ptr<sgpp::base::OperationMatrix> opLaplaceExplicit(
+      sgpp::op_factory::createOperationLaplaceExplicit(&mLaplace, *grid));
+    std::unique_ptr<sgpp::base::OperationMatrix> opLTwoDotExplicit(
+      sgpp::op_factory::createOperationLTwoDotExplicit(&mLTwoDot, *grid));
+    OperationLaplaceLinear opLaplace(&grid->getStorage());
+    OperationLTwoDotProductLinear opLTwoDot(&grid->getStorage());
+
+    sgpp::base::DataVector resultExplicit(n);
+    sgpp::base::DataVector resultImplicit(n);
+
+    opLaplaceExplicit->mult(alpha, resultExplicit);
+    opLaplace.mult(alpha, resultImplicit);
+
+    for (size_t i = 0; i < n; i++) {
+      BOOST_CHECK_SMALL(resultImplicit[i] - resultExplicit[i], 1e-10);
+    }
+
+    // the building blocks of all dimensions sum up to the whole operator
+    sgpp::base::DataVector resultBlock(n);
+    sgpp::base::DataVector resultBlocks(n, 0.0);
+
+    for (size_t i = 0; i < d; i++) {
+      opLaplace.multParallelBuildingBlock(alpha, resultBlock, i);
+      resultBlocks.add(resultBlock);
+    }
+
+    for (size_t i = 0; i < n; i++) {
+      BOOST_CHECK_SMALL(resultBlocks[i] - resultExplicit[i], 1e-10);
+    }
+
+    // coefficients scale the contributions of the dimensions
+    sgpp::base::DataVector coef(d, 2.0);
+    OperationLaplaceLinear opLaplaceCoef(&grid->getStorage(), coef);
+    opLaplaceCoef.mult(alpha, resultImplicit);
+
+    for (size_t i = 0; i < n; i++) {
+      BOOST_CHECK_SMALL(resultImplicit[i] - 2.0 * resultExplicit[i], 1e-10);
+    }
+
+    opLTwoDotExplicit->mult(alpha, resultExplicit);
+    opLTwoDot.mult(alpha, resultImplicit);
+
+    for (size_t i = 0; i < n; i++) {
+      BOOST_CHECK_SMALL(resultImplicit[i] - resultExplicit[i], 1e-12);
+    }
+
+    // the pole structure is rebuilt when the grid changes
+    sgpp::base::DataVector surpluses(n, 1.0);
+    sgpp::base::SurplusRefinementFunctor functor(surpluses, 3);
+    grid->getGenerator().refine(functor);
+
+    const size_t nRefined = grid->getSize();
+    BOOST_CHECK_GT(nRefined, n);
+    alpha.resizeZero(nRefined);
+    resultExplicit.resizeZero(nRefined);
+    resultImplicit.resizeZero(nRefined);
+
+    sgpp::base::DataMatrix mRefined(nRefined, nRefined);
+    std::unique_ptr<sgpp::base::OperationMatrix> opRefinedExplicit(
+      sgpp::op_factory::createOperationLTwoDotExplicit(&mRefined, *grid));
+    opRefinedExplicit->mult(alpha, resultExplicit);
+    opLTwoDot.mult(alpha, resultImplicit);
+
+    for (size_t i = 0; i < nRefined; i++) {
+      BOOST_CHECK_SMALL(resultImplicit[i] - resultExplicit[i], 1e-12);
+    }
+
+    // the pole structure is also rebuilt when the grid changes at constant size:
+    // replace a leaf by a child of a point with maximal level in the first dimension
+    sgpp::base::GridStorage& storage = grid->getStorage();
+    size_t iMax = 0;
+
+    for (size_t i = 1; i < nRefined; i++) {
+      if (storage[i].getLevel(0) > storage[iMax].getLevel(0)) {
+        iMax = i;
+      }
+    }
+
+    size_t leaf = 0;
+
+    while ((leaf == iMax) || !storage[leaf].isLeaf()) {
+      leaf++;
+    }
+
+    sgpp::base::GridPoint newPoint(storage[iMax]);
+    newPoint.set(0, newPoint.getLevel(0) + 1, 2 * newPoint.getIndex(0) - 1);
+    std::list<size_t> removePoints(1, leaf);
+    storage.deletePoints(removePoints);
+    storage.insert(newPoint);
+    storage.recalcLeafProperty();
+    BOOST_CHECK_EQUAL(storage.getSize(), nRefined);
+
+    sgpp::base::DataMatrix mChanged(nRefined, nRefined);
+    std::unique_ptr<sgpp::base::OperationMatrix> opChangedLTwoDotExplicit(
+      sgpp::op_factory::createOperationLTwoDotExplicit(&mChanged, *grid));
+    opChangedLTwoDotExplicit->mult(alpha, resultExplicit);
+    opLTwoDot.mult(alpha, resultImplicit);
+
+    for (size_t i = 0; i < nRefined; i++) {
+      BOOST_CHECK_SMALL(resultImplicit[i] - resultExplicit[i], 1e-12);
+    }
+
+    std::unique_ptr<sgpp::base::OperationMatrix> opChangedLaplaceExplicit(
+      sgpp::op_factory::createOperationLaplaceExplicit(&mChanged, *grid));
+    opChangedLaplaceExplicit->mult(alpha, resultExplicit);
+    opLaplace.mult(alpha, resultImplicit);
+
+    for (size_t i = 0; i < nRefined; i++) {
+      BOOST_CHECK_SMALL(resultImplicit[i] - resultExplicit[i], 1e-10);
+    }
+  }
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace pde
 }  // namespace sgpp
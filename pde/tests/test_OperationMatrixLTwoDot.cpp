@@ -9,7 +9,11 @@
 #include <sgpp_base.hpp>
 #include <sgpp_pde.hpp>
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
+#include <sgpp/pde/operation/hash/OperationMatrixLTwoDotExplicitSparse.hpp>
 #include <sgpp/globaldef.hpp>
+
+#include <memory>
+#include <vector>
 namespace sgpp {
 namespace pde {
 
@@ -502,6 +506,62 @@ BOOST_AUTO_TEST_CASE(testOperationMatrixLTwoDotExplicitBsplineClenshawCurtis) {
   delete opExplicit;
 }
 
+// test if the sparse representation equals the dense one
+BOOST_AUTO_TEST_CASE(testOperationMatrixLTwoDotExplicitSparse) {
+  const size_t d = 3;
+  const size_t l = 4;
+  std::vector<std::unique_ptr<sgpp::base::Grid>> grids;
+  grids.emplace_back(sgpp::base::Grid::createLinearGrid(d));
+  grids.emplace_back(sgpp::base::Grid::createLinearBoundaryGrid(d, 0));
+  grids.emplace_back(sgpp::base::Grid::createModLinearGrid(d));
+  grids.emplace_back(sgpp::base::Grid::createPolyGrid(d, 3));
+  grids.emplace_back(sgpp::base::Grid::createPolyBoundaryGrid(d, 3));
+  grids.emplace_back(sgpp::base::Grid::createModPolyGrid(d, 3));
+  grids.emplace_back(sgpp::base::Grid::createBsplineGrid(d, 3));
+  grids.emplace_back(sgpp::base::Grid::createBsplineGrid(d, 5));
+  grids.emplace_back(sgpp::base::Grid::createBsplineBoundaryGrid(d, 3));
+  grids.emplace_back(sgpp::base::Grid::createModBsplineGrid(d, 3));
+
+  for (std::unique_ptr<sgpp::base::Grid>& grid : grids) {
+    grid->getGenerator().regular(l);
+    const size_t n = grid->getSize();
+
+    sgpp::base::DataMatrix m(n, n);
+    std::unique_ptr<sgpp::base::OperationMatrix> opDense(
+        sgpp::op_factory::createOperationLTwoDotExplicit(&m, *grid));
+    OperationMatrixLTwoDotExplicitSparse opSparse(grid.get());
+
+    size_t nnz = 0;
+
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < n; j++) {
+        BOOST_CHECK_SMALL(opSparse.get(i, j) - m.get(i, j), 1e-12);
+        nnz += (m.get(i, j) != 0.0) ? 1 : 0;
+      }
+    }
+
+    // only overlapping pairs are stored, the estimate is an upper bound of the density
+    BOOST_CHECK_EQUAL(opSparse.getNumberOfNonZeros(), nnz);
+    BOOST_CHECK_GE(OperationMatrixExplicitSparse::estimateDensity(*grid, n) + 1e-12,
+                   static_cast<double>(nnz) / static_cast<double>(n * n));
+
+    sgpp::base::DataVector alpha(n);
+
+    for (size_t i = 0; i < n; i++) {
+      alpha[i] = static_cast<double>(i % 7) - 3.0;
+    }
+
+    sgpp::base::DataVector resultDense(n);
+    sgpp::base::DataVector resultSparse(n);
+    opDense->mult(alpha, resultDense);
+    opSparse.mult(alpha, resultSparse);
+
+    for (size_t i = 0; i < n; i++) {
+      BOOST_CHECK_SMALL(resultSparse[i] - resultDense[i], 1e-12);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace pde
 }  // namespace sgpp
@@ -7,3 +7,5 @@
 
 %newobject sgpp::op_factory::createOperationQuadratureMCAdvanced(
     base::Grid& grid, size_t numberOfSamples, std::uint64_t seed);
+%newobject sgpp::op_factory::createOperationQuadratureMCStreaming(
+    base::Grid& grid, size_t numberOfSamples, std::uint64_t seed);
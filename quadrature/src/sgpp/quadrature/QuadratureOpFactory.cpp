@@ -15,5 +15,10 @@ quadrature::OperationQuadratureMCAdvanced* createOperationQuadratureMCAdvanced(
   return new quadrature::OperationQuadratureMCAdvanced(grid, numberOfSamples, seed);
 }
 
+quadrature::OperationQuadratureMCStreaming* createOperationQuadratureMCStreaming(
+    base::Grid& grid, size_t numberOfSamples, std::uint64_t seed) {
+  return new quadrature::OperationQuadratureMCStreaming(grid, numberOfSamples, seed);
+}
+
 }  // namespace op_factory
 }  // namespace sgpp
@@ -11,6 +11,7 @@
  */
 
 #include <sgpp/quadrature/operation/hash/OperationQuadratureMCAdvanced.hpp>
+#include <sgpp/quadrature/operation/hash/OperationQuadratureMCStreaming.hpp>
 #include <sgpp/globaldef.hpp>
 
 #include <random>
@@ -28,6 +29,16 @@ namespace op_factory {
 quadrature::OperationQuadratureMCAdvanced* createOperationQuadratureMCAdvanced(
     base::Grid& grid, size_t numberOfSamples, std::uint64_t seed = std::mt19937_64::default_seed);
 
+/**
+ * Creates an OperationQuadratureMCStreaming.
+ *
+ * @param grid Reference to the grid object
+ * @param numberOfSamples Maximal number of Monte Carlo samples
+ * @param seed Custom seed (defaults to default seed of mt19937_64)
+ */
+quadrature::OperationQuadratureMCStreaming* createOperationQuadratureMCStreaming(
+    base::Grid& grid, size_t numberOfSamples, std::uint64_t seed = std::mt19937_64::default_seed);
+
 }  // namespace op_factory
 }  // namespace sgpp
 
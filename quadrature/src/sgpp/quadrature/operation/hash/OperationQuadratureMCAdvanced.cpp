@@ -12,6 +12,7 @@
 #include <sgpp/quadrature/sampling/HaltonSampleGenerator.hpp>
 #include <sgpp/quadrature/sampling/LatinHypercubeSampleGenerator.hpp>
 #include <sgpp/quadrature/sampling/NaiveSampleGenerator.hpp>
+#include <sgpp/quadrature/sampling/SobolSampleGenerator.hpp>
 #include <sgpp/quadrature/sampling/StratifiedSampleGenerator.hpp>
 
 #include <cmath>
@@ -76,6 +77,22 @@ void OperationQuadratureMCAdvanced::useQuasiMonteCarloWithHaltonSequences() {
   myGenerator = new sgpp::quadrature::HaltonSampleGenerator(dimensions);
 }
 
+void OperationQuadratureMCAdvanced::useQuasiMonteCarloWithSobolSequences() {
+  if (myGenerator != nullptr) {
+    delete myGenerator;
+  }
+
+  myGenerator = new sgpp::quadrature::SobolSampleGenerator(dimensions, seed, false);
+}
+
+void OperationQuadratureMCAdvanced::useQuasiMonteCarloWithScrambledSobolSequences() {
+  if (myGenerator != nullptr) {
+    delete myGenerator;
+  }
+
+  myGenerator = new sgpp::quadrature::SobolSampleGenerator(dimensions, seed, true);
+}
+
 double OperationQuadratureMCAdvanced::doQuadrature(sgpp::base::DataVector& alpha) {
   sgpp::base::DataMatrix dm(numberOfSamples, dimensions);
 
@@ -0,0 +1,348 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/quadrature/operation/hash/OperationQuadratureMCStreaming.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/globaldef.hpp>
+#include <sgpp/quadrature/sampling/HaltonSampleGenerator.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace quadrature {
+
+namespace {
+
+/**
+ * Compensated (Kahan-Babuska-Neumaier) summation.
+ */
+class CompensatedSum {
+ public:
+  CompensatedSum() : sum(0.0), compensation(0.0) {}
+
+  void add(double value) {
+    const double t = sum + value;
+
+    if (std::abs(sum) >= std::abs(value)) {
+      compensation += (sum - t) + value;
+    } else {
+      compensation += (value - t) + sum;
+    }
+
+    sum = t;
+  }
+
+  double get() const { return sum + compensation; }
+
+ private:
+  double sum;
+  double compensation;
+};
+
+/// number of samples, sum, and sum of squared deviations from the mean of one block
+struct BlockResult {
+  size_t count;
+  double sum;
+  double m2;
+};
+
+/**
+ * Counter-based random number generator (SplitMix64 finalizer applied to the counter).
+ *
+ * @param seed      seed
+ * @param counter   counter
+ * @return uniformly distributed number in [0, 1)
+ */
+inline double counterBasedUniform(std::uint64_t seed, std::uint64_t counter) {
+  std::uint64_t z = seed + (counter + 1) * 0x9E3779B97F4A7C15ULL;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  z ^= (z >> 31);
+  // use the upper 53 bits
+  return static_cast<double>(z >> 11) / 9007199254740992.0;
+}
+
+}  // namespace
+
+OperationQuadratureMCStreaming::OperationQuadratureMCStreaming(sgpp::base::Grid& grid,
+                                                               size_t numberOfSamples,
+                                                               std::uint64_t seed)
+    : OperationQuadratureMCStreaming(grid.getDimension(), numberOfSamples, seed) {
+  this->grid = &grid;
+}
+
+OperationQuadratureMCStreaming::OperationQuadratureMCStreaming(size_t dimensions,
+                                                               size_t numberOfSamples,
+                                                               std::uint64_t seed)
+    : grid(nullptr),
+      numberOfSamples(numberOfSamples),
+      dimensions(dimensions),
+      seed(seed),
+      samplerType(SamplerTypes::Naive),
+      blockSize(4096),
+      tolerance(0.0),
+      minNumberOfSamples(0),
+      callback(),
+      numberOfUsedSamples(0),
+      errorEstimate(0.0),
+      haltonBases(),
+      sobolGenerator() {
+  // first primes as bases of the Halton sequence
+  for (size_t candidate = 2; haltonBases.size() < dimensions; candidate++) {
+    bool isPrime = true;
+
+    for (size_t prime : haltonBases) {
+      if (prime * prime > candidate) {
+        break;
+      } else if (candidate % prime == 0) {
+        isPrime = false;
+        break;
+      }
+    }
+
+    if (isPrime) {
+      haltonBases.push_back(candidate);
+    }
+  }
+}
+
+OperationQuadratureMCStreaming::~OperationQuadratureMCStreaming() {}
+
+void OperationQuadratureMCStreaming::setSamplerType(SamplerTypes samplerType) {
+  if ((samplerType == SamplerTypes::Sobol) || (samplerType == SamplerTypes::ScrambledSobol)) {
+    sobolGenerator.reset(new SobolSampleGenerator(dimensions, seed,
+                                                  samplerType == SamplerTypes::ScrambledSobol));
+  } else if ((samplerType == SamplerTypes::Naive) || (samplerType == SamplerTypes::Halton)) {
+    sobolGenerator.reset();
+  } else {
+    throw sgpp::base::application_exception(
+        "OperationQuadratureMCStreaming: sampler type not supported.");
+  }
+
+  this->samplerType = samplerType;
+}
+
+void OperationQuadratureMCStreaming::setBlockSize(size_t blockSize) {
+  if (blockSize == 0) {
+    throw sgpp::base::application_exception(
+        "OperationQuadratureMCStreaming: block size must be positive.");
+  }
+
+  this->blockSize = blockSize;
+}
+
+void OperationQuadratureMCStreaming::setTolerance(double tolerance, size_t minNumberOfSamples) {
+  this->tolerance = tolerance;
+  this->minNumberOfSamples = minNumberOfSamples;
+}
+
+void OperationQuadratureMCStreaming::getSamples(size_t firstIndex,
+                                                sgpp::base::DataMatrix& samples) const {
+  if (samples.getNcols() != dimensions) {
+    throw sgpp::base::application_exception(
+        "OperationQuadratureMCStreaming::getSamples: number of columns does not match.");
+  }
+
+  const size_t n = samples.getNrows();
+  double* data = samples.getPointer();
+
+  if (samplerType == SamplerTypes::Naive) {
+    for (size_t i = 0; i < n; i++) {
+      const std::uint64_t index = static_cast<std::uint64_t>(firstIndex + i);
+
+      for (size_t t = 0; t < dimensions; t++) {
+        data[i * dimensions + t] = counterBasedUniform(seed, index * dimensions + t);
+      }
+    }
+
+    return;
+  }
+
+  // quasi-random samples are generated coordinate by coordinate
+  sgpp::base::DataMatrix block(dimensions, n);
+
+  if (samplerType == SamplerTypes::Halton) {
+    // the sequence starts with index 1 (index 0 would be the origin)
+    for (size_t t = 0; t < dimensions; t++) {
+      HaltonSampleGenerator::radicalInverseBlock(firstIndex + 1, 1, n, haltonBases[t],
+                                                 block.getPointer() + t * n);
+    }
+  } else {
+    sobolGenerator->getSampleBlockAt(firstIndex, 1, block);
+  }
+
+  const double* blockData = block.getPointer();
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t t = 0; t < dimensions; t++) {
+      data[i * dimensions + t] = blockData[t * n + i];
+    }
+  }
+}
+
+double OperationQuadratureMCStreaming::integrate(
+    std::function<void(sgpp::base::DataMatrix&, sgpp::base::DataVector&)> evaluateBlock) {
+  // multiply with determinant of "unit cube -> BoundingBox" transformation
+  double determinant = 1.0;
+
+  if (grid != nullptr) {
+    for (size_t t = 0; t < dimensions; t++) {
+      determinant *= grid->getBoundingBox().getIntervalWidth(t);
+    }
+  }
+
+  const size_t numberOfBlocks = (numberOfSamples + blockSize - 1) / blockSize;
+  size_t blocksPerRound = 1;
+#ifdef _OPENMP
+  blocksPerRound = 2 * static_cast<size_t>(omp_get_max_threads());
+#endif /* _OPENMP */
+
+  std::vector<BlockResult> blockResults(blocksPerRound);
+  CompensatedSum sum;
+  size_t count = 0;
+  double mean = 0.0;
+  double m2 = 0.0;
+  bool converged = false;
+
+  numberOfUsedSamples = 0;
+  errorEstimate = 0.0;
+
+  for (size_t roundStart = 0; (roundStart < numberOfBlocks) && !converged;
+       roundStart += blocksPerRound) {
+    const size_t roundEnd = std::min(roundStart + blocksPerRound, numberOfBlocks);
+    std::exception_ptr exception = nullptr;
+
+#pragma omp parallel
+    {
+      sgpp::base::DataMatrix samples(0, dimensions);
+      sgpp::base::DataVector values;
+
+#pragma omp for schedule(dynamic, 1)
+      for (size_t b = roundStart; b < roundEnd; b++) {
+        try {
+          const size_t firstIndex = b * blockSize;
+          const size_t currentBlockSize = std::min(blockSize, numberOfSamples - firstIndex);
+          samples.resizeRowsCols(currentBlockSize, dimensions);
+          values.resize(currentBlockSize);
+          getSamples(firstIndex, samples);
+
+          if (grid != nullptr) {
+            sgpp::base::BoundingBox& boundingBox = grid->getBoundingBox();
+            double* data = samples.getPointer();
+
+            for (size_t i = 0; i < currentBlockSize; i++) {
+              for (size_t t = 0; t < dimensions; t++) {
+                data[i * dimensions + t] =
+                    boundingBox.transformPointToBoundingBox(t, data[i * dimensions + t]);
+              }
+            }
+          }
+
+          evaluateBlock(samples, values);
+
+          // two passes, as the values of the block are available
+          CompensatedSum blockSum;
+
+          for (size_t i = 0; i < currentBlockSize; i++) {
+            blockSum.add(values[i]);
+          }
+
+          const double blockMean = blockSum.get() / static_cast<double>(currentBlockSize);
+          double blockM2 = 0.0;
+
+          for (size_t i = 0; i < currentBlockSize; i++) {
+            blockM2 += (values[i] - blockMean) * (values[i] - blockMean);
+          }
+
+          blockResults[b - roundStart] = BlockResult{currentBlockSize, blockSum.get(), blockM2};
+        } catch (...) {
+#pragma omp critical
+          exception = std::current_exception();
+        }
+      }
+    }
+
+    if (exception != nullptr) {
+      std::rethrow_exception(exception);
+    }
+
+    // merge the blocks in their order, such that the result does not depend on the number of
+    // threads (Chan et al. for the variance)
+    for (size_t b = roundStart; b < roundEnd; b++) {
+      const BlockResult& blockResult = blockResults[b - roundStart];
+      const size_t newCount = count + blockResult.count;
+      const double blockMean = blockResult.sum / static_cast<double>(blockResult.count);
+      const double delta = blockMean - mean;
+
+      sum.add(blockResult.sum);
+      mean += delta * static_cast<double>(blockResult.count) / static_cast<double>(newCount);
+      m2 += blockResult.m2 + delta * delta * static_cast<double>(count) *
+                                 static_cast<double>(blockResult.count) /
+                                 static_cast<double>(newCount);
+      count = newCount;
+
+      numberOfUsedSamples = count;
+      errorEstimate =
+          ((count > 1) ? std::sqrt(m2 / static_cast<double>(count - 1) / static_cast<double>(count))
+                       : INFINITY) *
+          std::abs(determinant);
+
+      if (callback) {
+        callback(count, sum.get() / static_cast<double>(count) * determinant, errorEstimate);
+      }
+
+      if ((tolerance > 0.0) && (count > 1) && (count >= minNumberOfSamples) &&
+          (errorEstimate <= tolerance)) {
+        converged = true;
+        break;
+      }
+    }
+  }
+
+  if (count == 0) {
+    return 0.0;
+  }
+
+  return sum.get() / static_cast<double>(count) * determinant;
+}
+
+double OperationQuadratureMCStreaming::doQuadrature(sgpp::base::DataVector& alpha) {
+  if (grid == nullptr) {
+    throw sgpp::base::operation_exception(
+        "OperationQuadratureMCStreaming::doQuadrature: no grid given.");
+  }
+
+  return integrate([this, &alpha](sgpp::base::DataMatrix& samples,
+                                  sgpp::base::DataVector& values) {
+    std::unique_ptr<sgpp::base::OperationMultipleEval>(
+        sgpp::op_factory::createOperationMultipleEval(*grid, samples))
+        ->mult(alpha, values);
+  });
+}
+
+double OperationQuadratureMCStreaming::doQuadratureFunc(FUNC func, void* clientdata) {
+  return integrate([this, func, clientdata](sgpp::base::DataMatrix& samples,
+                                            sgpp::base::DataVector& values) {
+    double* data = samples.getPointer();
+
+    for (size_t i = 0; i < samples.getNrows(); i++) {
+      values[i] = func(static_cast<int>(dimensions), data + i * dimensions, clientdata);
+    }
+  });
+}
+
+}  // namespace quadrature
+}  // namespace sgpp
@@ -0,0 +1,192 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef OPERATIONQUADRATUREMCSTREAMING_HPP
+#define OPERATIONQUADRATUREMCSTREAMING_HPP
+
+#include <sgpp/base/operation/hash/OperationQuadrature.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/globaldef.hpp>
+#include <sgpp/quadrature/operation/hash/OperationQuadratureMCAdvanced.hpp>
+#include <sgpp/quadrature/sampling/SamplerTypes.hpp>
+#include <sgpp/quadrature/sampling/SobolSampleGenerator.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace sgpp {
+namespace quadrature {
+
+/**
+ * Quadrature on any sparse grid (that has OperationMultipleEval implemented) using (quasi-)Monte
+ * Carlo with a bounded amount of memory.
+ *
+ * The samples are processed in blocks of fixed size, which are evaluated in parallel (one
+ * OperationMultipleEval per block). The k-th sample only depends on k and the seed (random
+ * samples are generated by a counter-based generator, quasi-random samples are the points of a
+ * Halton or (scrambled) Sobol sequence), which is why the result does not depend on the number
+ * of threads.
+ * The block sums are accumulated with compensated summation in the order of the blocks.
+ *
+ * Optionally, the integration stops as soon as the estimated standard error of the result
+ * falls below a tolerance (checked after every block).
+ */
+class OperationQuadratureMCStreaming : public sgpp::base::OperationQuadrature {
+ public:
+  /**
+   * Callback that is called after every block with the number of samples processed so far,
+   * the current estimate of the integral, and its estimated standard error.
+   */
+  typedef std::function<void(size_t, double, double)> ProgressCallback;
+
+  /**
+   * @brief Constructor of OperationQuadratureMCStreaming, specifying a grid
+   * object and the (maximal) number of samples to use.
+   *
+   * @param grid Reference to the grid object
+   * @param numberOfSamples Maximal number of Monte Carlo samples
+   * @param seed Custom seed (defaults to default seed of mt19937_64)
+   */
+  OperationQuadratureMCStreaming(sgpp::base::Grid& grid, size_t numberOfSamples,
+                                 std::uint64_t seed = std::mt19937_64::default_seed);
+
+  /**
+   * @brief Constructor of OperationQuadratureMCStreaming, specifying dimensions
+   * and the (maximal) number of samples to use (only doQuadratureFunc is available).
+   *
+   * @param dimensions dimensionality of this problem
+   * @param numberOfSamples Maximal number of Monte Carlo samples
+   * @param seed Custom seed (defaults to default seed of mt19937_64)
+   */
+  OperationQuadratureMCStreaming(size_t dimensions, size_t numberOfSamples,
+                                 std::uint64_t seed = std::mt19937_64::default_seed);
+
+  /**
+   * Destructor
+   */
+  ~OperationQuadratureMCStreaming() override;
+
+  /**
+   * @brief Quadrature using (quasi-)MC in the bounding box of the grid.
+   *
+   * @param alpha Coefficient vector for current grid
+   */
+  double doQuadrature(sgpp::base::DataVector& alpha) override;
+
+  /**
+   * @brief Quadrature of an arbitrary function using (quasi-)MC in the bounding box of the grid
+   * (@f$\Omega=[0,1]^d@f$ if there is no grid).
+   * The function is called concurrently from several threads.
+   *
+   * @param func The function to integrate
+   * @param clientdata Optional data to pass to FUNC
+   */
+  double doQuadratureFunc(FUNC func, void* clientdata);
+
+  /**
+   * @brief Sets the type of the samples, SamplerTypes::Naive (counter-based pseudo-random
+   * numbers, default), SamplerTypes::Halton (Halton sequence with the first d primes as bases),
+   * SamplerTypes::Sobol, or SamplerTypes::ScrambledSobol (see SobolSampleGenerator, the
+   * scrambling depends on the seed).
+   *
+   * @param samplerType type of the samples
+   */
+  void setSamplerType(SamplerTypes samplerType);
+
+  /**
+   * @return type of the samples
+   */
+  SamplerTypes getSamplerType() const { return samplerType; }
+
+  /**
+   * @param blockSize number of samples per block (default 4096)
+   */
+  void setBlockSize(size_t blockSize);
+
+  /**
+   * @return number of samples per block
+   */
+  size_t getBlockSize() const { return blockSize; }
+
+  /**
+   * @param tolerance the integration stops if the estimated standard error is less than or
+   *                  equal to the tolerance (default 0, i.e., all samples are used)
+   * @param minNumberOfSamples minimal number of samples before the integration may stop
+   */
+  void setTolerance(double tolerance, size_t minNumberOfSamples = 0);
+
+  /**
+   * @param callback function that is called after every block (may be empty)
+   */
+  void setProgressCallback(ProgressCallback callback) { this->callback = callback; }
+
+  /**
+   * @return number of samples used in the last quadrature
+   */
+  size_t getNumberOfUsedSamples() const { return numberOfUsedSamples; }
+
+  /**
+   * @return estimated standard error of the last quadrature (for quasi-random samples, this is the
+   *         Monte Carlo estimate, which usually overestimates the actual error)
+   */
+  double getErrorEstimate() const { return errorEstimate; }
+
+  /**
+   * @brief Writes the samples with the given consecutive indices to the rows of a matrix.
+   *
+   * @param firstIndex index of the first sample
+   * @param[out] samples matrix whose rows will contain the samples in @f$[0,1)^d@f$
+   *             (its number of rows is the number of samples)
+   */
+  void getSamples(size_t firstIndex, sgpp::base::DataMatrix& samples) const;
+
+ protected:
+  /// Pointer to the grid object
+  sgpp::base::Grid* grid;
+  /// Maximal number of MC samples
+  size_t numberOfSamples;
+  /// number of dimensions (same as in Grid, if given)
+  size_t dimensions;
+  /// seed for the counter-based random number generator
+  std::uint64_t seed;
+  /// type of the samples
+  SamplerTypes samplerType;
+  /// number of samples per block
+  size_t blockSize;
+  /// tolerance for the estimated standard error
+  double tolerance;
+  /// minimal number of samples before stopping
+  size_t minNumberOfSamples;
+  /// progress callback
+  ProgressCallback callback;
+  /// number of samples used in the last quadrature
+  size_t numberOfUsedSamples;
+  /// estimated standard error of the last quadrature
+  double errorEstimate;
+  /// bases of the Halton sequence (first primes)
+  std::vector<size_t> haltonBases;
+  /// generator of the Sobol points (only for SamplerTypes::Sobol and ScrambledSobol)
+  std::unique_ptr<SobolSampleGenerator> sobolGenerator;
+
+  /**
+   * Processes all blocks.
+   *
+   * @param evaluateBlock function that writes the values of the integrand for the samples
+   *                      (rows of the first argument, transformed to the domain) to the second
+   *                      argument, it is called concurrently
+   * @return estimate of the integral
+   */
+  double integrate(
+      std::function<void(sgpp::base::DataMatrix&, sgpp::base::DataVector&)> evaluateBlock);
+};
+
+}  // namespace quadrature
+}  // namespace sgpp
+
+#endif /* OPERATIONQUADRATUREMCSTREAMING_HPP */
@@ -6,26 +6,19 @@
 #include <sgpp/quadrature/sampling/HaltonSampleGenerator.hpp>
 #include <sgpp/globaldef.hpp>
 
-#include <random>
+#include <algorithm>
 #include <cmath>
+#include <random>
 
 namespace sgpp {
 namespace quadrature {
 
 HaltonSampleGenerator::HaltonSampleGenerator(size_t dimensions, std::uint64_t seed)
-    : SampleGenerator(dimensions, seed),
-      index(1),
-      baseVector(dimensions),
-      iVector(dimensions),
-      fVector(dimensions),
-      resultVector(dimensions),
-      distInt(0, 15) {
+    : SampleGenerator(dimensions, seed), index(1), baseVector(dimensions), distInt(0, 14) {
   size_t basePrimes[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47};
 
   for (size_t i = 0; i < dimensions; i++) {
     baseVector[i] = basePrimes[distInt(rng)];
-    fVector[i] = 1. / static_cast<double>(baseVector[i]);
-    resultVector[i] = 0.;
   }
 }
 
@@ -33,22 +26,94 @@ HaltonSampleGenerator::~HaltonSampleGenerator() {}
 
 void HaltonSampleGenerator::getSample(sgpp::base::DataVector& dv) {
   for (size_t i = 0; i < dimensions; i++) {
-    resultVector[i] = 0.;
-    fVector[i] = 1. / static_cast<double>(baseVector[i]);
-    iVector[i] = static_cast<double>(index);
-
-    while (iVector[i] > 0) {
-      resultVector[i] = resultVector[i] + fVector[i] * (static_cast<double>(
-          static_cast<size_t>(iVector[i]) % baseVector[i]));
-      iVector[i] = floor(static_cast<double>(iVector[i]) / static_cast<double>(baseVector[i]));
-      fVector[i] = fVector[i] / static_cast<double>(baseVector[i]);
-    }
-
-    dv[i] = resultVector[i];
+    dv[i] = radicalInverse(index, baseVector[i]);
   }
 
   index++;
 }
 
+void HaltonSampleGenerator::getSampleBlock(sgpp::base::DataMatrix& block) {
+  // Number of rows has to correspond to the number of dimensions
+  if (block.getNrows() != dimensions) return;
+
+  const size_t n = block.getNcols();
+
+  for (size_t i = 0; i < dimensions; i++) {
+    radicalInverseBlock(index, stride, n, baseVector[i], block.getPointer() + i * n);
+  }
+
+  index += n * stride;
+}
+
+void HaltonSampleGenerator::skip(size_t numberOfSamples) { index += numberOfSamples; }
+
+double HaltonSampleGenerator::radicalInverse(std::uint64_t index, size_t base) {
+  const double invBase = 1.0 / static_cast<double>(base);
+  double f = invBase;
+  double result = 0.0;
+
+  while (index > 0) {
+    result += f * static_cast<double>(index % base);
+    index /= base;
+    f *= invBase;
+  }
+
+  return result;
+}
+
+void HaltonSampleGenerator::radicalInverseBlock(std::uint64_t firstIndex, std::uint64_t stride,
+                                                size_t n, size_t base, double* result) {
+  const size_t lanes = 8;
+  const double baseDbl = static_cast<double>(base);
+  const double invBase = 1.0 / baseDbl;
+
+  for (size_t j0 = 0; j0 < n; j0 += lanes) {
+    const size_t m = std::min(lanes, n - j0);
+    const std::uint64_t maxIndex = firstIndex + (j0 + m - 1) * stride;
+
+    // the floating-point digit extraction is exact for indices below 2^48
+    if (maxIndex >= (static_cast<std::uint64_t>(1) << 48)) {
+      for (size_t k = 0; k < m; k++) {
+        result[j0 + k] = radicalInverse(firstIndex + (j0 + k) * stride, base);
+      }
+
+      continue;
+    }
+
+    double remaining[lanes];
+    double value[lanes];
+
+    for (size_t k = 0; k < lanes; k++) {
+      remaining[k] =
+          (k < m) ? static_cast<double>(firstIndex + (j0 + k) * stride) : 0.0;
+      value[k] = 0.0;
+    }
+
+    double f = invBase;
+
+    // one iteration per digit of the largest index
+    for (std::uint64_t digits = maxIndex; digits > 0; digits /= base) {
+#pragma omp simd
+      for (size_t k = 0; k < lanes; k++) {
+        double quotient = std::floor(remaining[k] * invBase);
+        double digit = remaining[k] - quotient * baseDbl;
+        // correct the quotient if the product was rounded to the wrong side
+        const double low = (digit < 0.0) ? 1.0 : 0.0;
+        const double high = (digit >= baseDbl) ? 1.0 : 0.0;
+        quotient += high - low;
+        digit += (low - high) * baseDbl;
+        value[k] += f * digit;
+        remaining[k] = quotient;
+      }
+
+      f *= invBase;
+    }
+
+    for (size_t k = 0; k < m; k++) {
+      result[j0 + k] = value[k];
+    }
+  }
+}
+
 }  // namespace quadrature
 }  // namespace sgpp
@@ -11,6 +11,7 @@
 #include <sgpp/globaldef.hpp>
 #include <sgpp/quadrature/sampling/SampleGenerator.hpp>
 
+#include <cstdint>
 #include <vector>
 
 namespace sgpp {
@@ -43,12 +44,49 @@ class HaltonSampleGenerator : public SampleGenerator {
    */
   virtual void getSample(sgpp::base::DataVector& sample);
 
+  /**
+   * Generates a block of consecutive samples (column by column, see
+   * SampleGenerator::getSampleBlock). The radical inverses of one dimension
+   * are computed for several indices at once, which can be vectorized.
+   *
+   * @param block DataMatrix (dimensions x number of samples) storing the samples
+   */
+  void getSampleBlock(sgpp::base::DataMatrix& block) override;
+
+  /**
+   * Skips samples in constant time.
+   *
+   * @param numberOfSamples number of samples to skip
+   */
+  void skip(size_t numberOfSamples) override;
+
+  /**
+   * Radical inverse of an index, i.e., the index-th element of the van der Corput sequence.
+   *
+   * @param index index of the element
+   * @param base  base (prime)
+   * @return digits of the index in the given base, mirrored at the decimal point
+   */
+  static double radicalInverse(std::uint64_t index, size_t base);
+
+  /**
+   * Radical inverses of the indices firstIndex, firstIndex + stride, ...,
+   * firstIndex + (n - 1) * stride. The results are the same as those of
+   * radicalInverse, but the digits are extracted in floating-point
+   * arithmetic for several indices at once (SIMD).
+   *
+   * @param firstIndex index of the first element
+   * @param stride distance between consecutive indices
+   * @param n number of elements
+   * @param base base (prime)
+   * @param[out] result array of size n for the radical inverses
+   */
+  static void radicalInverseBlock(std::uint64_t firstIndex, std::uint64_t stride, size_t n,
+                                  size_t base, double* result);
+
  private:
   size_t index;
   std::vector<size_t> baseVector;
-  std::vector<double> iVector;
-  std::vector<double> fVector;
-  std::vector<double> resultVector;
   //
   std::uniform_int_distribution<std::uint64_t> distInt;
 };
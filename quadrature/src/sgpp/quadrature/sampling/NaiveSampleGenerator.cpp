@@ -24,5 +24,11 @@ void NaiveSampleGenerator::getSample(base::DataVector& sample) {
   }
 }
 
+void NaiveSampleGenerator::skip(size_t numberOfSamples) {
+  // uniformRealDist is stateless and consumes exactly one 64-bit random number
+  // per double
+  rng.discard(static_cast<unsigned long long>(numberOfSamples) * dimensions);
+}
+
 }  // namespace quadrature
 }  // namespace sgpp
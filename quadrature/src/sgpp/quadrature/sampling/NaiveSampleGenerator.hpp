@@ -46,6 +46,14 @@ class NaiveSampleGenerator : public SampleGenerator {
    */
   virtual void getSample(sgpp::base::DataVector& sample);
 
+  /**
+   * Skips samples by discarding the corresponding random numbers of the
+   * underlying engine (one per coordinate).
+   *
+   * @param numberOfSamples number of samples to skip
+   */
+  void skip(size_t numberOfSamples) override;
+
  private:
   std::uniform_real_distribution<double> uniformRealDist;
 };
@@ -8,11 +8,13 @@
 #include <sgpp/quadrature/Random.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
+
 namespace sgpp {
 namespace quadrature {
 
 SampleGenerator::SampleGenerator(size_t dimensions, std::uint64_t seed)
-    : dimensions(dimensions), seed(seed) {
+    : dimensions(dimensions), seed(seed), stride(1) {
   rng.seed(seed);
 }
 
@@ -22,15 +24,60 @@ void SampleGenerator::getSamples(base::DataMatrix& samples) {
   // Number of columns has to correspond to the number of dimensions
   if (samples.getNcols() != dimensions) return;
 
-  // generate one sample for every row of the given DataMatrix
+  // generate the samples block by block and transpose them to the rows of
+  // the given DataMatrix
+  const size_t maxBlockSize = 1024;
+  const size_t numberOfSamples = samples.getNrows();
+  base::DataMatrix block(dimensions, std::min(maxBlockSize, numberOfSamples));
+  double* data = samples.getPointer();
+
+  for (size_t first = 0; first < numberOfSamples; first += maxBlockSize) {
+    const size_t blockSize = std::min(maxBlockSize, numberOfSamples - first);
+
+    if (block.getNcols() != blockSize) {
+      block.resizeRowsCols(dimensions, blockSize);
+    }
+
+    getSampleBlock(block);
+    const double* blockData = block.getPointer();
+
+    for (size_t j = 0; j < blockSize; j++) {
+      for (size_t t = 0; t < dimensions; t++) {
+        data[(first + j) * dimensions + t] = blockData[t * blockSize + j];
+      }
+    }
+  }
+}
+
+void SampleGenerator::getSampleBlock(base::DataMatrix& block) {
+  // Number of rows has to correspond to the number of dimensions
+  if (block.getNrows() != dimensions) return;
+
   base::DataVector dv(dimensions);
 
-  for (size_t i = 0; i < samples.getNrows(); i++) {
+  for (size_t j = 0; j < block.getNcols(); j++) {
     getSample(dv);
-    samples.setRow(i, dv);
+    block.setColumn(j, dv);
+
+    if (stride > 1) {
+      skip(stride - 1);
+    }
   }
 }
 
+void SampleGenerator::skip(size_t numberOfSamples) {
+  base::DataVector dv(dimensions);
+
+  for (size_t i = 0; i < numberOfSamples; i++) {
+    getSample(dv);
+  }
+}
+
+void SampleGenerator::setLeapfrog(size_t numberOfSubstreams, size_t substreamIndex) {
+  stride = std::max(numberOfSubstreams, static_cast<size_t>(1));
+  skip(substreamIndex);
+}
+
 size_t SampleGenerator::getDimensions() { return dimensions; }
 
 void SampleGenerator::setDimensions(size_t dimensions) { this->dimensions = dimensions; }
@@ -56,6 +56,43 @@ class SampleGenerator {
 
   void getSamples(sgpp::base::DataMatrix& samples);
 
+  /**
+   * This method generates a block of samples, which are stored column by
+   * column, i.e., the number of rows has to fit the number of dimensions,
+   * the i-th column is the i-th sample, and the values of one coordinate of
+   * all samples are contiguous in memory. The default implementation calls
+   * getSample for every column.
+   *
+   * @param block provide a DataMatrix (dimensions x number of samples) to
+   * hold the generated samples
+   */
+
+  virtual void getSampleBlock(sgpp::base::DataMatrix& block);
+
+  /**
+   * Skips the given number of samples of the sequence (skip-ahead).
+   * The default implementation generates and discards the samples, generators
+   * with random access to their sequence override it.
+   *
+   * @param numberOfSamples number of samples to skip
+   */
+
+  virtual void skip(size_t numberOfSamples);
+
+  /**
+   * Restricts getSamples and getSampleBlock to a leapfrog substream, i.e.,
+   * they only return every numberOfSubstreams-th sample of the sequence,
+   * starting with the substreamIndex-th next sample. If each of m threads
+   * uses a generator with the same seed and the substream (m, k), they
+   * together generate the same samples as a single generator.
+   * getSample is not affected.
+   *
+   * @param numberOfSubstreams number of substreams (1 for the full sequence)
+   * @param substreamIndex index of the substream in [0, numberOfSubstreams)
+   */
+
+  void setLeapfrog(size_t numberOfSubstreams, size_t substreamIndex);
+
   /**
    *
    * @return current number of dimensions used for sample generation
@@ -80,6 +117,10 @@ class SampleGenerator {
 
   // random number generator
   std::mt19937_64 rng;
+
+  // distance between consecutive samples returned by getSamples and
+  // getSampleBlock (number of leapfrog substreams)
+  size_t stride;
 };
 }  // namespace quadrature
 }  // namespace sgpp
@@ -0,0 +1,256 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/quadrature/sampling/SobolSampleGenerator.hpp>
+#include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+
+namespace sgpp {
+namespace quadrature {
+
+namespace {
+
+/// primitive polynomial (degree s, coefficients a) and initial direction numbers m
+struct DirectionNumberEntry {
+  unsigned int s;
+  unsigned int a;
+  std::uint32_t m[8];
+};
+
+/// direction numbers of Joe and Kuo (new-joe-kuo-6.21201) for the dimensions 2, ..., 40
+const DirectionNumberEntry directionNumberTable[] = {
+    {1, 0, {1}},
+    {2, 1, {1, 3}},
+    {3, 1, {1, 3, 1}},
+    {3, 2, {1, 1, 1}},
+    {4, 1, {1, 1, 3, 3}},
+    {4, 4, {1, 3, 5, 13}},
+    {5, 2, {1, 1, 5, 5, 17}},
+    {5, 4, {1, 1, 5, 5, 5}},
+    {5, 7, {1, 1, 7, 11, 19}},
+    {5, 11, {1, 1, 5, 1, 1}},
+    {5, 13, {1, 1, 1, 3, 11}},
+    {5, 14, {1, 3, 5, 5, 31}},
+    {6, 1, {1, 3, 3, 9, 7, 49}},
+    {6, 13, {1, 1, 1, 15, 21, 21}},
+    {6, 16, {1, 3, 1, 13, 27, 49}},
+    {6, 19, {1, 1, 1, 15, 7, 5}},
+    {6, 22, {1, 3, 1, 15, 13, 25}},
+    {6, 25, {1, 1, 5, 5, 19, 61}},
+    {7, 1, {1, 3, 7, 11, 23, 15, 103}},
+    {7, 4, {1, 3, 7, 13, 13, 15, 69}},
+    {7, 7, {1, 1, 3, 13, 7, 35, 63}},
+    {7, 8, {1, 3, 5, 9, 1, 25, 53}},
+    {7, 14, {1, 3, 1, 13, 9, 35, 107}},
+    {7, 19, {1, 3, 1, 5, 27, 61, 31}},
+    {7, 21, {1, 1, 5, 11, 19, 41, 61}},
+    {7, 28, {1, 3, 5, 3, 3, 13, 69}},
+    {7, 31, {1, 1, 7, 13, 1, 19, 1}},
+    {7, 32, {1, 3, 7, 5, 13, 19, 59}},
+    {7, 37, {1, 1, 3, 9, 25, 29, 41}},
+    {7, 41, {1, 3, 5, 13, 23, 1, 55}},
+    {7, 42, {1, 3, 7, 3, 13, 59, 17}},
+    {7, 50, {1, 3, 1, 3, 5, 53, 69}},
+    {7, 55, {1, 1, 5, 5, 23, 33, 13}},
+    {7, 56, {1, 1, 7, 7, 1, 61, 123}},
+    {7, 59, {1, 1, 7, 9, 13, 61, 49}},
+    {7, 62, {1, 3, 3, 5, 3, 55, 33}},
+    {8, 14, {1, 3, 1, 15, 31, 13, 49, 245}},
+    {8, 21, {1, 3, 5, 15, 31, 59, 63, 97}},
+    {8, 22, {1, 3, 1, 11, 11, 11, 77, 249}}};
+
+/// number of bits of the points
+const unsigned int BITS = 32;
+
+/// scaling of the digits to [0, 1)
+const double INV_TWO_POW_BITS = 1.0 / 4294967296.0;
+
+inline std::uint32_t parity(std::uint32_t x) {
+  x ^= x >> 16;
+  x ^= x >> 8;
+  x ^= x >> 4;
+  x ^= x >> 2;
+  x ^= x >> 1;
+  return x & 1;
+}
+
+}  // namespace
+
+SobolSampleGenerator::SobolSampleGenerator(size_t dimensions, std::uint64_t seed, bool scrambled)
+    : SampleGenerator(dimensions, seed),
+      index(0),
+      scrambled(scrambled),
+      directionNumbers(dimensions * BITS),
+      shifts(dimensions, 0) {
+  if (dimensions > MAX_DIMENSIONS) {
+    throw sgpp::base::application_exception(
+        "SobolSampleGenerator: at most 40 dimensions are supported.");
+  }
+
+  for (size_t t = 0; t < dimensions; t++) {
+    std::uint32_t* v = &directionNumbers[t * BITS];
+
+    if (t == 0) {
+      // first dimension: van der Corput sequence in base 2
+      for (unsigned int k = 0; k < BITS; k++) {
+        v[k] = static_cast<std::uint32_t>(1) << (BITS - 1 - k);
+      }
+    } else {
+      const DirectionNumberEntry& entry = directionNumberTable[t - 1];
+
+      for (unsigned int k = 0; k < entry.s; k++) {
+        v[k] = entry.m[k] << (BITS - 1 - k);
+      }
+
+      for (unsigned int k = entry.s; k < BITS; k++) {
+        v[k] = v[k - entry.s] ^ (v[k - entry.s] >> entry.s);
+
+        for (unsigned int i = 1; i < entry.s; i++) {
+          if ((entry.a >> (entry.s - 1 - i)) & 1) {
+            v[k] ^= v[k - i];
+          }
+        }
+      }
+    }
+  }
+
+  if (scrambled) {
+    std::uniform_int_distribution<std::uint32_t> distInt;
+
+    for (size_t t = 0; t < dimensions; t++) {
+      // random lower triangular matrix with unit diagonal, the r-th row only contains the
+      // unit bit of the r-th digit and random bits of the more significant digits
+      std::uint32_t matrixRows[BITS];
+
+      for (unsigned int r = 0; r < BITS; r++) {
+        const std::uint32_t unit = static_cast<std::uint32_t>(1) << (BITS - 1 - r);
+        matrixRows[r] = unit | (distInt(rng) & ~(unit | (unit - 1)));
+      }
+
+      // the scrambling is linear, hence it can be applied to the direction numbers
+      std::uint32_t* v = &directionNumbers[t * BITS];
+
+      for (unsigned int k = 0; k < BITS; k++) {
+        std::uint32_t scrambledNumber = 0;
+
+        for (unsigned int r = 0; r < BITS; r++) {
+          scrambledNumber |= parity(matrixRows[r] & v[k]) << (BITS - 1 - r);
+        }
+
+        v[k] = scrambledNumber;
+      }
+
+      shifts[t] = distInt(rng);
+    }
+  }
+}
+
+SobolSampleGenerator::~SobolSampleGenerator() {}
+
+std::uint32_t SobolSampleGenerator::getDigits(std::uint64_t index, size_t dimension) const {
+  if (index >= (static_cast<std::uint64_t>(1) << BITS)) {
+    throw sgpp::base::application_exception(
+        "SobolSampleGenerator: at most 2^32 points are supported.");
+  }
+
+  const std::uint32_t* v = &directionNumbers[dimension * BITS];
+  std::uint32_t grayCode = static_cast<std::uint32_t>(index ^ (index >> 1));
+  std::uint32_t digits = shifts[dimension];
+
+  for (unsigned int k = 0; grayCode != 0; k++, grayCode >>= 1) {
+    if (grayCode & 1) {
+      digits ^= v[k];
+    }
+  }
+
+  return digits;
+}
+
+void SobolSampleGenerator::getSample(sgpp::base::DataVector& dv) {
+  for (size_t t = 0; t < dimensions; t++) {
+    dv[t] = static_cast<double>(getDigits(index, t)) * INV_TWO_POW_BITS;
+  }
+
+  index++;
+}
+
+void SobolSampleGenerator::getSampleBlock(sgpp::base::DataMatrix& block) {
+  // Number of rows has to correspond to the number of dimensions
+  if (block.getNrows() != dimensions) return;
+
+  getSampleBlockAt(index, stride, block);
+  index += block.getNcols() * stride;
+}
+
+void SobolSampleGenerator::getSampleBlockAt(std::uint64_t firstIndex, std::uint64_t stride,
+                                            sgpp::base::DataMatrix& block) const {
+  if (block.getNrows() != dimensions) {
+    throw sgpp::base::application_exception(
+        "SobolSampleGenerator::getSampleBlockAt: number of rows does not match.");
+  }
+
+  const size_t n = block.getNcols();
+
+  if (n == 0) {
+    return;
+  }
+
+  const std::uint64_t lastIndex = firstIndex + (n - 1) * stride;
+
+  if (lastIndex >= (static_cast<std::uint64_t>(1) << BITS)) {
+    throw sgpp::base::application_exception(
+        "SobolSampleGenerator: at most 2^32 points are supported.");
+  }
+
+  // number of direction numbers that are needed for the largest Gray code
+  unsigned int numberOfBits = 0;
+
+  for (std::uint64_t code = lastIndex | (lastIndex >> 1); code != 0; code >>= 1) {
+    numberOfBits++;
+  }
+
+  const size_t lanes = 8;
+  std::uint32_t grayCodes[lanes];
+  std::uint32_t digits[lanes];
+
+  for (size_t j0 = 0; j0 < n; j0 += lanes) {
+    const size_t m = std::min(lanes, n - j0);
+
+    for (size_t k = 0; k < lanes; k++) {
+      const std::uint64_t i = (k < m) ? (firstIndex + (j0 + k) * stride) : 0;
+      grayCodes[k] = static_cast<std::uint32_t>(i ^ (i >> 1));
+    }
+
+    for (size_t t = 0; t < dimensions; t++) {
+      const std::uint32_t* v = &directionNumbers[t * BITS];
+      double* row = block.getPointer() + t * n + j0;
+
+      for (size_t k = 0; k < lanes; k++) {
+        digits[k] = shifts[t];
+      }
+
+      for (unsigned int b = 0; b < numberOfBits; b++) {
+        const std::uint32_t direction = v[b];
+
+        // branchless: the mask is all ones if the b-th bit of the Gray code is set
+#pragma omp simd
+        for (size_t k = 0; k < lanes; k++) {
+          digits[k] ^= (0u - ((grayCodes[k] >> b) & 1u)) & direction;
+        }
+      }
+
+      for (size_t k = 0; k < m; k++) {
+        row[k] = static_cast<double>(digits[k]) * INV_TWO_POW_BITS;
+      }
+    }
+  }
+}
+
+void SobolSampleGenerator::skip(size_t numberOfSamples) { index += numberOfSamples; }
+
+}  // namespace quadrature
+}  // namespace sgpp
@@ -0,0 +1,116 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SOBOLSAMPLEGENERATOR_HPP
+#define SOBOLSAMPLEGENERATOR_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/globaldef.hpp>
+#include <sgpp/quadrature/sampling/SampleGenerator.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace sgpp {
+namespace quadrature {
+
+/**
+ * The class SobolSampleGenerator generates the points of a Sobol sequence
+ * (direction numbers of Joe and Kuo, Gray code ordering, 32 bit resolution).
+ * The sequence starts with the origin, such that the first 2^m points form a
+ * (t, m, d)-net in base 2.
+ *
+ * Optionally, the sequence is randomized by a linear matrix scrambling
+ * (Matousek) followed by a random digital shift, which preserves the net
+ * property. The random numbers are drawn from the seed, i.e., the scrambled
+ * sequence is reproducible.
+ *
+ * Every point is computed directly from its index, so skipping samples is
+ * cheap and blocks of points can be generated at any position of the sequence.
+ * At most 40 dimensions and 2^32 points are supported.
+ */
+class SobolSampleGenerator : public SampleGenerator {
+ public:
+  /// maximal number of dimensions (size of the table of direction numbers)
+  static const size_t MAX_DIMENSIONS = 40;
+
+  /**
+   * Standard constructor
+   *
+   * @param dimensions number of dimensions used for sample generation
+   * @param seed custom seed for the scrambling (defaults to default seed of mt19937_64)
+   * @param scrambled whether the sequence is scrambled
+   */
+  explicit SobolSampleGenerator(size_t dimensions,
+                                std::uint64_t seed = std::mt19937_64::default_seed,
+                                bool scrambled = true);
+
+  /**
+   * Destructor
+   */
+  ~SobolSampleGenerator() override;
+
+  /**
+   * Generates the next point of the sequence.
+   *
+   * @param sample DataVector storing the new generated sample vector
+   */
+  void getSample(sgpp::base::DataVector& sample) override;
+
+  /**
+   * Generates a block of points (column by column, see
+   * SampleGenerator::getSampleBlock).
+   *
+   * @param block DataMatrix (dimensions x number of samples) storing the samples
+   */
+  void getSampleBlock(sgpp::base::DataMatrix& block) override;
+
+  /**
+   * Generates the points with the indices firstIndex, firstIndex + stride, ...
+   * column by column, independently of the state of the generator. The
+   * coordinates are computed for several points at once (SIMD).
+   *
+   * @param firstIndex index of the first point (the origin has index 0)
+   * @param stride distance between the indices of consecutive points
+   * @param block DataMatrix (dimensions x number of samples) storing the samples
+   */
+  void getSampleBlockAt(std::uint64_t firstIndex, std::uint64_t stride,
+                        sgpp::base::DataMatrix& block) const;
+
+  /**
+   * Skips samples in constant time.
+   *
+   * @param numberOfSamples number of samples to skip
+   */
+  void skip(size_t numberOfSamples) override;
+
+  /**
+   * @return whether the sequence is scrambled
+   */
+  bool isScrambled() const { return scrambled; }
+
+ private:
+  /**
+   * @param index index of a point
+   * @return 32 bit digits of the point in the given dimension
+   */
+  std::uint32_t getDigits(std::uint64_t index, size_t dimension) const;
+
+  // index of the next point
+  std::uint64_t index;
+  // whether the sequence is scrambled
+  bool scrambled;
+  // (scrambled) direction numbers, 32 per dimension
+  std::vector<std::uint32_t> directionNumbers;
+  // digital shift per dimension (zero if not scrambled)
+  std::vector<std::uint32_t> shifts;
+};
+
+}  // namespace quadrature
+}  // namespace sgpp
+
+#endif /* SOBOLSAMPLEGENERATOR_HPP */
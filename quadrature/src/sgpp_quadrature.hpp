@@ -13,8 +13,10 @@
 #include <sgpp/quadrature/sampling/StratifiedSampleGenerator.hpp>
 #include <sgpp/quadrature/sampling/LatinHypercubeSampleGenerator.hpp>
 #include <sgpp/quadrature/sampling/HaltonSampleGenerator.hpp>
+#include <sgpp/quadrature/sampling/SobolSampleGenerator.hpp>
 
 #include <sgpp/quadrature/QuadratureOpFactory.hpp>
 #include <sgpp/quadrature/operation/hash/OperationQuadratureMCAdvanced.hpp>
+#include <sgpp/quadrature/operation/hash/OperationQuadratureMCStreaming.hpp>
 
 #endif /* QUADRATURE_HPP */
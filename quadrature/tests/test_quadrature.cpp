@@ -27,11 +27,15 @@ std::string normalize_test_case_name(const_string name) {
 
 #include <sgpp_base.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/exception/application_exception.hpp>
 
 #include <sgpp_quadrature.hpp>
 #include <sgpp/quadrature/QuadratureOpFactory.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <memory>
 #include <vector>
 
 using sgpp::base::DataVector;
@@ -40,6 +44,7 @@ using sgpp::quadrature::HaltonSampleGenerator;
 using sgpp::quadrature::LatinHypercubeSampleGenerator;
 using sgpp::quadrature::NaiveSampleGenerator;
 using sgpp::quadrature::SampleGenerator;
+using sgpp::quadrature::SobolSampleGenerator;
 using sgpp::quadrature::StratifiedSampleGenerator;
 
 double f(DataVector x) {
@@ -82,11 +87,167 @@ BOOST_AUTO_TEST_CASE(testSamplers) {
   }
 
   StratifiedSampleGenerator pSSampler(blockSize);
+  SobolSampleGenerator pSobSampler(dim, seed, false);
+  SobolSampleGenerator pSSobSampler(dim, seed, true);
 
   testSampler(pNSampler, dim, numSamples, analyticResult, 5e-2);
   testSampler(pHSampler, dim, numSamples, analyticResult, 1e-3);
   testSampler(pLHSampler, dim, numSamples, analyticResult, 1e-3);
   testSampler(pSSampler, dim, numSamples, analyticResult, 1e-3);
+  testSampler(pSobSampler, dim, numSamples, analyticResult, 1e-3);
+  testSampler(pSSobSampler, dim, numSamples, analyticResult, 1e-3);
+}
+
+void testSampleBlocks(SampleGenerator& sequentialSampler, SampleGenerator& blockSampler,
+                      std::vector<std::unique_ptr<SampleGenerator>>& leapfrogSamplers, size_t dim,
+                      size_t numSamples) {
+  // reference: one sample after another
+  sgpp::base::DataMatrix reference(numSamples, dim);
+  DataVector sample(dim);
+
+  for (size_t i = 0; i < numSamples; i++) {
+    sequentialSampler.getSample(sample);
+    reference.setRow(i, sample);
+  }
+
+  // blocks of different sizes, stored column by column
+  const size_t blockSizes[] = {1, 7, 64};
+  size_t i = 0;
+
+  for (size_t b = 0; i < numSamples; b++) {
+    sgpp::base::DataMatrix block(dim, std::min(blockSizes[b % 3], numSamples - i));
+    blockSampler.getSampleBlock(block);
+
+    for (size_t j = 0; j < block.getNcols(); j++, i++) {
+      for (size_t t = 0; t < dim; t++) {
+        BOOST_CHECK_EQUAL(block.get(t, j), reference.get(i, t));
+      }
+    }
+  }
+
+  // leapfrog substreams together yield the same samples
+  const size_t numberOfSubstreams = leapfrogSamplers.size();
+
+  for (size_t k = 0; k < numberOfSubstreams; k++) {
+    leapfrogSamplers[k]->setLeapfrog(numberOfSubstreams, k);
+    sgpp::base::DataMatrix samples((numSamples - k + numberOfSubstreams - 1) / numberOfSubstreams,
+                                   dim);
+    leapfrogSamplers[k]->getSamples(samples);
+
+    for (size_t j = 0; j < samples.getNrows(); j++) {
+      for (size_t t = 0; t < dim; t++) {
+        BOOST_CHECK_EQUAL(samples.get(j, t), reference.get(j * numberOfSubstreams + k, t));
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testSampleBlocksAndLeapfrog) {
+  size_t dim = 3;
+  size_t numSamples = 1000;
+  size_t numberOfSubstreams = 3;
+  std::uint64_t seed = 1234567;
+
+  {
+    NaiveSampleGenerator sequentialSampler(dim, seed);
+    NaiveSampleGenerator blockSampler(dim, seed);
+    std::vector<std::unique_ptr<SampleGenerator>> leapfrogSamplers;
+
+    for (size_t k = 0; k < numberOfSubstreams; k++) {
+      leapfrogSamplers.emplace_back(new NaiveSampleGenerator(dim, seed));
+    }
+
+    testSampleBlocks(sequentialSampler, blockSampler, leapfrogSamplers, dim, numSamples);
+  }
+
+  {
+    HaltonSampleGenerator sequentialSampler(dim, seed);
+    HaltonSampleGenerator blockSampler(dim, seed);
+    std::vector<std::unique_ptr<SampleGenerator>> leapfrogSamplers;
+
+    for (size_t k = 0; k < numberOfSubstreams; k++) {
+      leapfrogSamplers.emplace_back(new HaltonSampleGenerator(dim, seed));
+    }
+
+    testSampleBlocks(sequentialSampler, blockSampler, leapfrogSamplers, dim, numSamples);
+  }
+
+  for (bool scrambled : {false, true}) {
+    SobolSampleGenerator sequentialSampler(dim, seed, scrambled);
+    SobolSampleGenerator blockSampler(dim, seed, scrambled);
+    std::vector<std::unique_ptr<SampleGenerator>> leapfrogSamplers;
+
+    for (size_t k = 0; k < numberOfSubstreams; k++) {
+      leapfrogSamplers.emplace_back(new SobolSampleGenerator(dim, seed, scrambled));
+    }
+
+    testSampleBlocks(sequentialSampler, blockSampler, leapfrogSamplers, dim, numSamples);
+  }
+
+  // radical inverses of large indices
+  for (std::uint64_t index : {std::uint64_t(1) << 40, (std::uint64_t(1) << 48) + 12345}) {
+    double result[3];
+    HaltonSampleGenerator::radicalInverseBlock(index, 1, 3, 3, result);
+
+    for (size_t k = 0; k < 3; k++) {
+      BOOST_CHECK_EQUAL(result[k], HaltonSampleGenerator::radicalInverse(index + k, 3));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testSobolNet) {
+  size_t dim = SobolSampleGenerator::MAX_DIMENSIONS;
+  size_t m = 8;
+  size_t numSamples = static_cast<size_t>(1) << m;
+
+  // first points of the unscrambled sequence
+  SobolSampleGenerator sobol(dim, 0, false);
+  sgpp::base::DataMatrix block(dim, 4);
+  sobol.getSampleBlock(block);
+  const double firstPoints[4][2] = {{0.0, 0.0}, {0.5, 0.5}, {0.75, 0.25}, {0.25, 0.75}};
+
+  for (size_t j = 0; j < 4; j++) {
+    BOOST_CHECK_EQUAL(block.get(0, j), firstPoints[j][0]);
+    BOOST_CHECK_EQUAL(block.get(1, j), firstPoints[j][1]);
+  }
+
+  for (bool scrambled : {false, true}) {
+    SobolSampleGenerator sampler(dim, 1234567, scrambled);
+    sgpp::base::DataMatrix samples(numSamples, dim);
+    sampler.getSamples(samples);
+
+    // every coordinate is stratified into 2^m intervals, the first two dimensions form a
+    // (0, m, 2)-net, i.e., every elementary interval of volume 2^-m contains exactly one point
+    for (size_t t = 0; t < dim; t++) {
+      std::vector<size_t> counts(numSamples, 0);
+
+      for (size_t i = 0; i < numSamples; i++) {
+        BOOST_CHECK_GE(samples.get(i, t), 0.0);
+        BOOST_CHECK_LT(samples.get(i, t), 1.0);
+        counts[static_cast<size_t>(samples.get(i, t) * static_cast<double>(numSamples))]++;
+      }
+
+      for (size_t count : counts) {
+        BOOST_CHECK_EQUAL(count, 1);
+      }
+    }
+
+    for (size_t a = 0; a <= m; a++) {
+      std::vector<size_t> counts(numSamples, 0);
+
+      for (size_t i = 0; i < numSamples; i++) {
+        const size_t cell0 = static_cast<size_t>(samples.get(i, 0) * std::pow(2.0, a));
+        const size_t cell1 = static_cast<size_t>(samples.get(i, 1) * std::pow(2.0, m - a));
+        counts[(cell0 << (m - a)) + cell1]++;
+      }
+
+      for (size_t count : counts) {
+        BOOST_CHECK_EQUAL(count, 1);
+      }
+    }
+  }
+
+  BOOST_CHECK_THROW(SobolSampleGenerator(dim + 1), sgpp::base::application_exception);
 }
 
 void testOperationQuadratureMCAdvanced(Grid& grid, DataVector& alpha,
@@ -112,6 +273,14 @@ void testOperationQuadratureMCAdvanced(Grid& grid, DataVector& alpha,
     case sgpp::quadrature::SamplerTypes::Halton:
       opQuad->useQuasiMonteCarloWithHaltonSequences();
       break;
+
+    case sgpp::quadrature::SamplerTypes::Sobol:
+      opQuad->useQuasiMonteCarloWithSobolSequences();
+      break;
+
+    case sgpp::quadrature::SamplerTypes::ScrambledSobol:
+      opQuad->useQuasiMonteCarloWithScrambledSobolSequences();
+      break;
   }
 
   double resMC = opQuad->doQuadrature(alpha);
@@ -151,4 +320,84 @@ BOOST_AUTO_TEST_CASE(testOperationMCAdvanced) {
                                     dim, numSamples, blockSize, analyticResult, 1e-3, seed);
   testOperationQuadratureMCAdvanced(*grid, alpha, sgpp::quadrature::SamplerTypes::Halton, dim,
                                     numSamples, blockSize, analyticResult, 1e-3, seed);
+  testOperationQuadratureMCAdvanced(*grid, alpha, sgpp::quadrature::SamplerTypes::Sobol, dim,
+                                    numSamples, blockSize, analyticResult, 1e-3, seed);
+  testOperationQuadratureMCAdvanced(*grid, alpha, sgpp::quadrature::SamplerTypes::ScrambledSobol,
+                                    dim, numSamples, blockSize, analyticResult, 1e-3, seed);
+}
+
+double fFunc(int dim, double* x, void* clientdata) {
+  double res = 1.0;
+
+  for (int i = 0; i < dim; i++) {
+    res *= 4 * (1 - x[i]) * x[i];
+  }
+
+  return res;
+}
+
+BOOST_AUTO_TEST_CASE(testOperationMCStreaming) {
+  size_t dim = 2;
+  size_t numSamples = 100000;
+  double analyticResult = std::pow(2. / 3., dim);
+  std::uint64_t seed = 1234567;
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createPolyGrid(dim, 2));
+  grid->getGenerator().regular(1);
+
+  DataVector alpha(1);
+  alpha[0] = 1.0;
+
+  std::unique_ptr<sgpp::quadrature::OperationQuadratureMCStreaming> opQuad(
+      sgpp::op_factory::createOperationQuadratureMCStreaming(*grid, numSamples, seed));
+
+  // pseudo-random samples, the result must not depend on the block size
+  opQuad->setBlockSize(1000);
+  double resMC = opQuad->doQuadrature(alpha);
+  BOOST_CHECK_CLOSE(resMC, analyticResult, 5e-2 * 1e2);
+  BOOST_CHECK_EQUAL(opQuad->getNumberOfUsedSamples(), numSamples);
+  BOOST_CHECK_SMALL(std::abs(resMC - analyticResult), 5.0 * opQuad->getErrorEstimate());
+
+  opQuad->setBlockSize(777);
+  BOOST_CHECK_CLOSE(opQuad->doQuadrature(alpha), resMC, 1e-10);
+  BOOST_CHECK_CLOSE(opQuad->doQuadratureFunc(fFunc, nullptr), resMC, 1e-10);
+
+  // Halton sequence
+  opQuad->setSamplerType(sgpp::quadrature::SamplerTypes::Halton);
+  BOOST_CHECK_CLOSE(opQuad->doQuadrature(alpha), analyticResult, 1e-3 * 1e2);
+
+  // (scrambled) Sobol sequence, the samples must match the ones of the generator
+  for (sgpp::quadrature::SamplerTypes samplerType :
+       {sgpp::quadrature::SamplerTypes::Sobol, sgpp::quadrature::SamplerTypes::ScrambledSobol}) {
+    opQuad->setSamplerType(samplerType);
+    BOOST_CHECK_CLOSE(opQuad->doQuadrature(alpha), analyticResult, 1e-3 * 1e2);
+
+    SobolSampleGenerator sampler(dim, seed,
+                                 samplerType == sgpp::quadrature::SamplerTypes::ScrambledSobol);
+    sgpp::base::DataMatrix samples(100, dim);
+    sgpp::base::DataMatrix referenceSamples(100, dim);
+    sampler.skip(50);
+    sampler.getSamples(referenceSamples);
+    opQuad->getSamples(50, samples);
+
+    for (size_t i = 0; i < samples.getSize(); i++) {
+      BOOST_CHECK_EQUAL(samples[i], referenceSamples[i]);
+    }
+  }
+
+  // early stopping
+  const double tolerance = 1e-3;
+  size_t numberOfCallbacks = 0;
+  opQuad->setSamplerType(sgpp::quadrature::SamplerTypes::Naive);
+  opQuad->setTolerance(tolerance);
+  opQuad->setProgressCallback([&numberOfCallbacks](size_t, double, double) {
+    numberOfCallbacks++;
+  });
+  resMC = opQuad->doQuadrature(alpha);
+  BOOST_CHECK_LT(opQuad->getNumberOfUsedSamples(), numSamples);
+  BOOST_CHECK_LE(opQuad->getErrorEstimate(), tolerance);
+  BOOST_CHECK_EQUAL(numberOfCallbacks,
+                    (opQuad->getNumberOfUsedSamples() + opQuad->getBlockSize() - 1) /
+                        opQuad->getBlockSize());
+  BOOST_CHECK_SMALL(resMC - analyticResult, 5.0 * tolerance);
 }
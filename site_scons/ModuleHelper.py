@@ -253,12 +253,14 @@ class Module(object):
         boostTestTargetList.append(test)
 
   def runBoostTests(self, boostTestFolder="tests",
-                    compileFlag="COMPILE_BOOST_TESTS", runFlag="RUN_BOOST_TESTS"):
-    """Run the Boost tests.
+                    compileFlag="COMPILE_BOOST_TESTS", runFlag="RUN_BOOST_TESTS",
+                    builder="BoostTest"):
+    """Run the Boost tests (with the builder BoostTestMPI for tests that need mpirun).
     """
     if env[compileFlag] and env[runFlag]:
       # run Boost tests
-      testRun = env.BoostTest(self.boostTestExecutable + "_run", self.boostTestExecutable)
+      testRun = getattr(env, builder)(self.boostTestExecutable + "_run",
+                                      self.boostTestExecutable)
       boostTestRunTargetList.append(testRun)
 
   def checkStyle(self):
@@ -23,6 +23,8 @@ SLESolverType SLESolverTypeParser::parse(const std::string &input) {
     return sgpp::solver::SLESolverType::BiCGSTAB;
   } else if (inputLower.compare("fista") == 0) {
     return sgpp::solver::SLESolverType::FISTA;
+  } else if (inputLower.compare("pipelinedcg") == 0) {
+    return sgpp::solver::SLESolverType::PipelinedCG;
   } else {
     std::string errorMsg =
         "Failed to convert string \"" + input + "\" to any known SLESolverType";
@@ -39,7 +41,8 @@ const SLESolverTypeParser::SLESolverTypeMap_t
       return SLESolverTypeParser::SLESolverTypeMap_t{
           std::make_pair(SLESolverType::CG, "CG"),
           std::make_pair(SLESolverType::BiCGSTAB, "BiCGSTAB"),
-          std::make_pair(SLESolverType::FISTA, "FISTA")};
+          std::make_pair(SLESolverType::FISTA, "FISTA"),
+          std::make_pair(SLESolverType::PipelinedCG, "PipelinedCG")};
     }();
 } /* namespace solver */
 } /* namespace sgpp */
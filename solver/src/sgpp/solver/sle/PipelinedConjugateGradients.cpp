@@ -0,0 +1,205 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef X86_MIC_SYMMETRIC
+#include <mpi.h>
+#endif
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+PipelinedConjugateGradients::PipelinedConjugateGradients(size_t imax, double epsilon)
+    : SLESolver(imax, epsilon) {}
+
+PipelinedConjugateGradients::~PipelinedConjugateGradients() {}
+
+void PipelinedConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
+                                        sgpp::base::DataVector& alpha, sgpp::base::DataVector& b,
+                                        bool reuse, bool verbose, double max_threshold) {
+  this->starting();
+
+  if (verbose == true) {
+    std::cout << "Starting Pipelined Conjugated Gradients" << std::endl;
+  }
+
+  // needed for residuum calculation
+  double epsilonSquared = this->myEpsilon * this->myEpsilon;
+  // number of current iterations
+  this->nIterations = 0;
+
+  const size_t size = alpha.getSize();
+
+  // residual r, w = A*r, search direction p, s = A*p, z = A*s and n = A*w
+  sgpp::base::DataVector r(size);
+  sgpp::base::DataVector w(size);
+  sgpp::base::DataVector p(size, 0.0);
+  sgpp::base::DataVector s(size, 0.0);
+  sgpp::base::DataVector z(size, 0.0);
+  sgpp::base::DataVector n(size);
+
+  double delta_0 = 0.0;
+  // gamma = r.r and delta = w.r, in one array for the broadcast
+  double dots[2] = {0.0, 0.0};
+  double gamma_old = 0.0;
+  double a_old = 0.0;
+
+  if (reuse == true) {
+    delta_0 = b.dotProduct(b) * epsilonSquared;
+  } else {
+    alpha.setAll(0.0);
+  }
+
+  // calculate the starting residuum
+  this->replaceResidual(SystemMatrix, alpha, b, r, w, p, s, z);
+  dots[0] = r.dotProduct(r);
+  dots[1] = w.dotProduct(r);
+
+  if (reuse == false) {
+    delta_0 = dots[0] * epsilonSquared;
+  }
+
+  this->residuum = (delta_0 / epsilonSquared);
+  this->calcStarting();
+
+  if (verbose == true) {
+    std::cout << "Starting norm of residuum: " << (delta_0 / epsilonSquared) << std::endl;
+    std::cout << "Target norm:               " << (delta_0) << std::endl;
+  }
+
+  double* ptrAlpha = alpha.getPointer();
+  double* ptrR = r.getPointer();
+  double* ptrW = w.getPointer();
+  double* ptrP = p.getPointer();
+  double* ptrS = s.getPointer();
+  double* ptrZ = z.getPointer();
+  const double* ptrN = n.getPointer();
+
+  while (this->nIterations < this->nMaxIterations) {
+#ifdef X86_MIC_SYMMETRIC
+    // the inner products are distributed while the matrix-vector product is computed
+    MPI_Request request;
+    MPI_Ibcast(dots, 2, MPI_DOUBLE, 0, MPI_COMM_WORLD, &request);
+
+    // n = A*w
+    SystemMatrix.mult(w, n);
+
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+
+    if ((dots[0] <= delta_0) || (dots[0] <= max_threshold)) {
+      break;
+    }
+#else
+    if ((dots[0] <= delta_0) || (dots[0] <= max_threshold)) {
+      break;
+    }
+
+    // n = A*w
+    SystemMatrix.mult(w, n);
+#endif
+
+    const double gamma = dots[0];
+    const double delta = dots[1];
+    double beta = 0.0;
+    double denominator = delta;
+
+    if (this->nIterations > 0) {
+      beta = gamma / gamma_old;
+      denominator = delta - beta * gamma / a_old;
+    }
+
+    // denominator = d.(A*d) in the notation of ConjugateGradients
+    if (denominator == 0.0) {
+      break;
+    }
+
+    const double a = gamma / denominator;
+    double gamma_new = 0.0;
+    double delta_new = 0.0;
+
+    // z = n + beta*z, s = w + beta*s, p = r + beta*p, x = x + a*p, r = r - a*s, w = w - a*z,
+    // and the inner products for the next iteration, in a single sweep
+#pragma omp parallel for reduction(+ : gamma_new, delta_new)
+    for (size_t i = 0; i < size; i++) {
+      const double zi = ptrN[i] + beta * ptrZ[i];
+      const double si = ptrW[i] + beta * ptrS[i];
+      const double pi = ptrR[i] + beta * ptrP[i];
+      const double ri = ptrR[i] - a * si;
+      const double wi = ptrW[i] - a * zi;
+
+      ptrZ[i] = zi;
+      ptrS[i] = si;
+      ptrP[i] = pi;
+      ptrAlpha[i] += a * pi;
+      ptrR[i] = ri;
+      ptrW[i] = wi;
+
+      gamma_new += ri * ri;
+      delta_new += wi * ri;
+    }
+
+    gamma_old = gamma;
+    a_old = a;
+    this->nIterations++;
+
+    if ((this->nIterations % residualReplacementInterval) == 0) {
+      // the recursively updated vectors drift away from their definitions, recompute them
+      this->replaceResidual(SystemMatrix, alpha, b, r, w, p, s, z);
+      gamma_new = r.dotProduct(r);
+      delta_new = w.dotProduct(r);
+    }
+
+    dots[0] = gamma_new;
+    dots[1] = delta_new;
+
+    this->residuum = gamma_new;
+    this->iterationComplete();
+
+    if (verbose == true) {
+      std::cout << "delta: " << gamma_new << std::endl;
+    }
+  }
+
+  this->residuum = dots[0];
+  this->complete();
+
+  if (verbose == true) {
+    std::cout << "Number of iterations: " << this->nIterations << " (max. " << this->nMaxIterations
+              << ")" << std::endl;
+    std::cout << "Final norm of residuum: " << dots[0] << std::endl;
+  }
+}
+
+void PipelinedConjugateGradients::replaceResidual(
+    sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
+    sgpp::base::DataVector& b, sgpp::base::DataVector& r, sgpp::base::DataVector& w,
+    sgpp::base::DataVector& p, sgpp::base::DataVector& s, sgpp::base::DataVector& z) {
+  // r = b - A*x
+  SystemMatrix.mult(alpha, r);
+  r.mult(-1.0);
+  r.add(b);
+
+  // w = A*r
+  SystemMatrix.mult(r, w);
+
+  // s = A*p, z = A*s (not needed as long as there is no search direction yet)
+  if (this->nIterations > 0) {
+    SystemMatrix.mult(p, s);
+    SystemMatrix.mult(s, z);
+  }
+}
+
+void PipelinedConjugateGradients::starting() {}
+
+void PipelinedConjugateGradients::calcStarting() {}
+
+void PipelinedConjugateGradients::iterationComplete() {}
+
+void PipelinedConjugateGradients::complete() {}
+
+}  // namespace solver
+}  // namespace sgpp
@@ -0,0 +1,97 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef PIPELINEDCONJUGATEGRADIENTS_HPP
+#define PIPELINEDCONJUGATEGRADIENTS_HPP
+
+#include <sgpp/solver/SLESolver.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <iostream>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Pipelined conjugate gradients (Ghysels and Vanroose, 2014).
+ *
+ * Mathematically equivalent to ConjugateGradients, but the recurrences are rearranged such that
+ * each iteration needs only one matrix-vector product and one global reduction, which does not
+ * depend on the result of that product. All vector updates of an iteration and both inner
+ * products are computed in a single sweep over the vectors, which reduces the memory traffic
+ * outside of the matrix-vector product from about ten to one pass. With MPI (X86_MIC_SYMMETRIC),
+ * the broadcast of the inner products is overlapped with the matrix-vector product.
+ *
+ * The price are three additional vectors and a slightly larger rounding error in the recursively
+ * updated residual, which is why the residual is recomputed every 50 iterations (like in
+ * ConjugateGradients).
+ */
+class PipelinedConjugateGradients : public SLESolver {
+ public:
+  /**
+   * Std-Constructor
+   *
+   * @param imax number of maximum executed iterations
+   * @param epsilon the final error in the iterative solver
+   */
+  PipelinedConjugateGradients(size_t imax, double epsilon);
+
+  /**
+   * Std-Destructor
+   */
+  virtual ~PipelinedConjugateGradients();
+
+  virtual void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
+                     sgpp::base::DataVector& b, bool reuse = false, bool verbose = false,
+                     double max_threshold = -1.0);
+
+  /**
+   * function that signals the start of the CG method
+   */
+  virtual void starting();
+
+  /**
+   * function that signals the start of the calculation of the CG method
+   */
+  virtual void calcStarting();
+
+  /**
+   * function that signals that one iteration step of the CG method has been completed
+   */
+  virtual void iterationComplete();
+
+  /**
+   * function that signals the finish of the CG method
+   */
+  virtual void complete();
+
+ protected:
+  /// number of iterations after which the recursively updated vectors are recomputed
+  static const size_t residualReplacementInterval = 50;
+
+  /**
+   * Recomputes the residual and the auxiliary vectors from the current iterate.
+   *
+   * @param SystemMatrix system matrix
+   * @param alpha current iterate
+   * @param b right hand side
+   * @param r residual b - A alpha
+   * @param w A r
+   * @param p search direction
+   * @param s A p
+   * @param z A s
+   */
+  void replaceResidual(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
+                       sgpp::base::DataVector& b, sgpp::base::DataVector& r,
+                       sgpp::base::DataVector& w, sgpp::base::DataVector& p,
+                       sgpp::base::DataVector& s, sgpp::base::DataVector& z);
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* PIPELINEDCONJUGATEGRADIENTS_HPP */
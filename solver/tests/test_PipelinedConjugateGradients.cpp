@@ -0,0 +1,111 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+
+namespace {
+
+/**
+ * Dense symmetric positive definite matrix A = B^T B + shift * I.
+ */
+class DenseSPDMatrix : public sgpp::base::OperationMatrix {
+ public:
+  DenseSPDMatrix(size_t n, double shift, std::mt19937& generator) : matrix(n, n) {
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    DataMatrix factor(n, n);
+
+    for (size_t i = 0; i < factor.getSize(); i++) {
+      factor[i] = distribution(generator);
+    }
+
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < n; j++) {
+        double value = (i == j) ? shift : 0.0;
+
+        for (size_t k = 0; k < n; k++) {
+          value += factor(k, i) * factor(k, j);
+        }
+
+        matrix(i, j) = value;
+      }
+    }
+  }
+
+  void mult(DataVector& alpha, DataVector& result) override { matrix.mult(alpha, result); }
+
+ private:
+  DataMatrix matrix;
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestPipelinedConjugateGradients)
+
+BOOST_AUTO_TEST_CASE(testMatchesConjugateGradients) {
+  const size_t n = 200;
+  std::mt19937 generator(42);
+  DenseSPDMatrix systemMatrix(n, 1.0, generator);
+
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  DataVector b(n);
+
+  for (size_t i = 0; i < n; i++) {
+    b[i] = distribution(generator);
+  }
+
+  // many iterations, such that the residual replacement is exercised
+  sgpp::solver::ConjugateGradients cg(1000, 1e-10);
+  sgpp::solver::PipelinedConjugateGradients pipelinedCG(1000, 1e-10);
+
+  DataVector alphaCG(n);
+  DataVector alphaPipelined(n);
+  cg.solve(systemMatrix, alphaCG, b);
+  pipelinedCG.solve(systemMatrix, alphaPipelined, b);
+
+  BOOST_CHECK_GT(pipelinedCG.getNumberIterations(), 50);
+  BOOST_CHECK_LE(pipelinedCG.getNumberIterations(), cg.getNumberIterations() + 5);
+
+  DataVector residual(n);
+  systemMatrix.mult(alphaPipelined, residual);
+  residual.sub(b);
+  BOOST_CHECK_LE(residual.l2Norm(), 1e-8 * b.l2Norm());
+
+  for (size_t i = 0; i < n; i++) {
+    BOOST_CHECK_SMALL(alphaPipelined[i] - alphaCG[i], 1e-6);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testReuse) {
+  const size_t n = 50;
+  std::mt19937 generator(7);
+  DenseSPDMatrix systemMatrix(n, 10.0, generator);
+
+  DataVector b(n, 1.0);
+  DataVector alpha(n);
+  sgpp::solver::PipelinedConjugateGradients pipelinedCG(1000, 1e-12);
+  pipelinedCG.solve(systemMatrix, alpha, b);
+
+  // restarting from the solution does not need any further iteration
+  pipelinedCG.solve(systemMatrix, alpha, b, true);
+  BOOST_CHECK_EQUAL(pipelinedCG.getNumberIterations(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()